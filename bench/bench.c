@@ -0,0 +1,675 @@
+/**
+ * @brief MKL-free benchmark driver
+ *
+ * One binary for every operation, format and precision, selected by flag:
+ *
+ *   bench --data-file=A.mtx --op=mv --formatA=CSR --data-type=d --thread-num=8 --warmup=3 --iter=50 --output=csv
+ *   bench --gen=stencil27:64,64,64 --seed=1 --op=mm --columns=8 --output=json
+ *
+ * Each configuration runs --warmup untimed calls and --iter timed ones. The
+ * report gives min/median/p95/mean seconds, GFLOP/s and effective GB/s of
+ * the median call, and that bandwidth as a share of a STREAM triad measured
+ * on the same thread count (or given with --stream-bw).
+ *
+ * flops     2 per stored multiply-add (8 for complex), mirrored entries of a
+ *           symmetric/hermitian descriptor count twice, mm multiplies by columns
+ * bytes     compulsory traffic: the stored matrix once, x read, y written once
+ *           (beta is 0), CSR-like index cost for formats other than COO
+ *
+ * With --perf the timed calls also run under perf_event_open counters, reported
+ * per call (cycles, instructions, cache and LLC misses, stalled cycles). Events
+ * the machine does not provide show as -1 in csv and are left out otherwise.
+ *
+ * With --check the result of the last timed call is compared against a plain
+ * serial loop over the CSR arrays of the input, in double complex whatever the
+ * precision; the outcome goes to stderr and a mismatch makes the exit status -1.
+ */
+
+#include <alphasparse.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_STREAM_ELEMENTS (1ul << 24)
+
+typedef enum
+{
+    BENCH_MV = 0,
+    BENCH_MM = 1,
+    BENCH_TRSV = 2,
+} bench_op_t;
+
+typedef struct
+{
+    const char *file; // data file, or the generator spec
+    const char *gen;
+    uint64_t seed;
+    const char *op_name;
+    bench_op_t op;
+    alphasparse_format_t format;
+    alphasparse_datatype_t datatype;
+    alphasparse_operation_t trans;
+    alphasparse_layout_t layout;
+    struct alpha_matrix_descr descr;
+    int thread_num;
+    int warmup;
+    int iter;
+    int block_size;
+    ALPHA_INT columns;
+
+    ALPHA_INT rows;
+    ALPHA_INT cols;
+    // CSR arrays of the input, kept for --check
+    ALPHA_OFFSET *rows_offset;
+    ALPHA_INT *col_index;
+    void *values;
+
+    ALPHA_INT64 nnz;      // stored entries
+    ALPHA_INT64 products; // multiply-adds of one call with a single right hand side
+    double flops;
+    double bytes;
+} bench_t;
+
+static const char *format_name[] = {"COO", "CSR", "CSC", "BSR", "SKY", "DIA"};
+static const char *datatype_name[] = {"s", "d", "c", "z"};
+
+static size_t value_size(alphasparse_datatype_t datatype)
+{
+    static const size_t size[] = {sizeof(float), sizeof(double), sizeof(ALPHA_Complex8), sizeof(ALPHA_Complex16)};
+    return size[datatype];
+}
+
+static bool is_complex(alphasparse_datatype_t datatype)
+{
+    return datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX || datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX;
+}
+
+static void fill_random(alphasparse_datatype_t datatype, void *arr, unsigned int seed, size_t size)
+{
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+        alpha_fill_random_s(arr, seed, size);
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+        alpha_fill_random_d(arr, seed, size);
+    else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+        alpha_fill_random_c(arr, seed, size);
+    else
+        alpha_fill_random_z(arr, seed, size);
+}
+
+// multiply-adds one call performs, only the triangle a structured descriptor reads
+static ALPHA_INT64 count_products(const bench_t *b, const ALPHA_OFFSET *rows_offset, const ALPHA_INT *col_index)
+{
+    const alphasparse_matrix_type_t type = b->descr.type;
+    if (type == ALPHA_SPARSE_MATRIX_TYPE_GENERAL && b->op != BENCH_TRSV)
+        return rows_offset[b->rows];
+    ALPHA_INT64 lower = 0, upper = 0, diag = 0;
+    for (ALPHA_INT r = 0; r < b->rows; r++)
+        for (ALPHA_OFFSET ai = rows_offset[r]; ai < rows_offset[r + 1]; ai++)
+        {
+            if (r > col_index[ai])
+                lower++;
+            else if (r < col_index[ai])
+                upper++;
+            else
+                diag++;
+        }
+    const ALPHA_INT64 off = b->descr.mode == ALPHA_SPARSE_FILL_MODE_LOWER ? lower : upper;
+    const ALPHA_INT64 on = b->descr.diag == ALPHA_SPARSE_DIAG_UNIT ? b->rows : diag;
+    if (type == ALPHA_SPARSE_MATRIX_TYPE_SYMMETRIC || type == ALPHA_SPARSE_MATRIX_TYPE_HERMITIAN)
+        return 2 * off + on;
+    if (type == ALPHA_SPARSE_MATRIX_TYPE_DIAGONAL)
+        return on;
+    return off + on;
+}
+
+// CSR arrays of the input, generated from --gen or read from --data-file
+static alphasparse_status_t bench_source(bench_t *b, ALPHA_OFFSET **rows_offset, ALPHA_INT **col_index, void **values)
+{
+    alphasparse_status_t status;
+    if (b->gen != NULL)
+    {
+        alpha_gen_t gen;
+        check_error_return(alpha_gen_parse(b->gen, b->seed, &gen));
+        if (b->datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+            status = alpha_gen_s_csr(&gen, &b->rows, &b->cols, rows_offset, col_index, (float **)values);
+        else if (b->datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+            status = alpha_gen_d_csr(&gen, &b->rows, &b->cols, rows_offset, col_index, (double **)values);
+        else if (b->datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+            status = alpha_gen_c_csr(&gen, &b->rows, &b->cols, rows_offset, col_index, (ALPHA_Complex8 **)values);
+        else
+            status = alpha_gen_z_csr(&gen, &b->rows, &b->cols, rows_offset, col_index, (ALPHA_Complex16 **)values);
+        return status;
+    }
+
+    alpha_mtx_t mtx;
+    check_error_return(alpha_mtx_open(b->file, &mtx));
+    // structured descriptors only read one triangle, no need to expand the file
+    mtx.half = b->descr.type == ALPHA_SPARSE_MATRIX_TYPE_SYMMETRIC || b->descr.type == ALPHA_SPARSE_MATRIX_TYPE_HERMITIAN;
+    if (mtx.half && mtx.symmetry != ALPHA_MTX_GENERAL)
+        b->descr.mode = ALPHA_SPARSE_FILL_MODE_LOWER;
+    const ALPHA_INT64 nnz_max = alpha_mtx_nnz_max(&mtx);
+    b->rows = mtx.rows;
+    b->cols = mtx.cols;
+    *rows_offset = alpha_memalign((b->rows + 1) * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
+    *col_index = alpha_memalign(nnz_max * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    *values = alpha_memalign(nnz_max * value_size(b->datatype), DEFAULT_ALIGNMENT);
+    if (b->datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+        status = alpha_mtx_read_csr_s(&mtx, *rows_offset, *col_index, *values);
+    else if (b->datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+        status = alpha_mtx_read_csr_d(&mtx, *rows_offset, *col_index, *values);
+    else if (b->datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+        status = alpha_mtx_read_csr_c(&mtx, *rows_offset, *col_index, *values);
+    else
+        status = alpha_mtx_read_csr_z(&mtx, *rows_offset, *col_index, *values);
+    alpha_mtx_close(&mtx);
+    return status;
+}
+
+static alphasparse_status_t bench_load(bench_t *b, alphasparse_matrix_t *A)
+{
+    check_error_return(bench_source(b, &b->rows_offset, &b->col_index, &b->values));
+    ALPHA_OFFSET *rows_offset = b->rows_offset;
+    ALPHA_INT *col_index = b->col_index;
+    void *values = b->values;
+    b->nnz = rows_offset[b->rows];
+    b->products = count_products(b, rows_offset, col_index);
+
+    alphasparse_matrix_t csr;
+    alphasparse_status_t status;
+    const alphasparse_index_base_t base = ALPHA_SPARSE_INDEX_BASE_ZERO;
+    if (b->datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+        status = alphasparse_s_create_csr(&csr, base, b->rows, b->cols, rows_offset, rows_offset + 1, col_index, values);
+    else if (b->datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+        status = alphasparse_d_create_csr(&csr, base, b->rows, b->cols, rows_offset, rows_offset + 1, col_index, values);
+    else if (b->datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+        status = alphasparse_c_create_csr(&csr, base, b->rows, b->cols, rows_offset, rows_offset + 1, col_index, values);
+    else
+        status = alphasparse_z_create_csr(&csr, base, b->rows, b->cols, rows_offset, rows_offset + 1, col_index, values);
+    check_error_return(status);
+    if (b->format == ALPHA_SPARSE_FORMAT_CSR)
+    {
+        *A = csr;
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    }
+
+    const alphasparse_operation_t as_is = ALPHA_SPARSE_OPERATION_NON_TRANSPOSE;
+    alphasparse_matrix_t coo;
+    status = alphasparse_convert_coo(csr, as_is, &coo);
+    alphasparse_destroy(csr);
+    check_error_return(status);
+    if (b->format == ALPHA_SPARSE_FORMAT_COO)
+    {
+        *A = coo;
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    }
+    // the other conversions only take a COO source
+    if (b->format == ALPHA_SPARSE_FORMAT_CSC)
+        status = alphasparse_convert_csc(coo, as_is, A);
+    else if (b->format == ALPHA_SPARSE_FORMAT_BSR)
+        status = alphasparse_convert_bsr(coo, b->block_size, ALPHA_SPARSE_LAYOUT_ROW_MAJOR, as_is, A);
+    else if (b->format == ALPHA_SPARSE_FORMAT_SKY)
+        status = alphasparse_convert_sky(coo, as_is, b->descr.mode, A);
+    else if (b->format == ALPHA_SPARSE_FORMAT_DIA)
+        status = alphasparse_convert_dia(coo, as_is, A);
+    else
+        status = ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
+    alphasparse_destroy(coo);
+    return status;
+}
+
+static void bench_model(bench_t *b)
+{
+    const double vsize = value_size(b->datatype);
+    const double rhs = b->op == BENCH_MM ? b->columns : 1;
+    b->flops = (is_complex(b->datatype) ? 8.0 : 2.0) * b->products * rhs;
+
+    double matrix;
+    if (b->format == ALPHA_SPARSE_FORMAT_COO)
+        matrix = b->nnz * (vsize + 2.0 * sizeof(ALPHA_INT));
+    else if (b->format == ALPHA_SPARSE_FORMAT_CSC)
+        matrix = b->nnz * (vsize + sizeof(ALPHA_INT)) + (b->cols + 1.0) * sizeof(ALPHA_OFFSET);
+    else
+        matrix = b->nnz * (vsize + sizeof(ALPHA_INT)) + (b->rows + 1.0) * sizeof(ALPHA_OFFSET);
+    const bool trans = b->trans != ALPHA_SPARSE_OPERATION_NON_TRANSPOSE;
+    const double x_len = trans ? b->rows : b->cols;
+    const double y_len = trans ? b->cols : b->rows;
+    b->bytes = matrix + (x_len + y_len) * vsize * rhs;
+}
+
+static alphasparse_status_t bench_call(const bench_t *b, alphasparse_matrix_t A, const void *x, void *y)
+{
+    const ALPHA_INT ld_x = b->layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR ? b->columns : (b->trans ? b->rows : b->cols);
+    const ALPHA_INT ld_y = b->layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR ? b->columns : (b->trans ? b->cols : b->rows);
+    if (b->datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+    {
+        if (b->op == BENCH_MV)
+            return alphasparse_s_mv(b->trans, 1.f, A, b->descr, x, 0.f, y);
+        if (b->op == BENCH_MM)
+            return alphasparse_s_mm(b->trans, 1.f, A, b->descr, b->layout, x, b->columns, ld_x, 0.f, y, ld_y);
+        return alphasparse_s_trsv(b->trans, 1.f, A, b->descr, x, y);
+    }
+    else if (b->datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+    {
+        if (b->op == BENCH_MV)
+            return alphasparse_d_mv(b->trans, 1., A, b->descr, x, 0., y);
+        if (b->op == BENCH_MM)
+            return alphasparse_d_mm(b->trans, 1., A, b->descr, b->layout, x, b->columns, ld_x, 0., y, ld_y);
+        return alphasparse_d_trsv(b->trans, 1., A, b->descr, x, y);
+    }
+    else if (b->datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+    {
+        const ALPHA_Complex8 one = {1.f, 0.f}, zero = {0.f, 0.f};
+        if (b->op == BENCH_MV)
+            return alphasparse_c_mv(b->trans, one, A, b->descr, x, zero, y);
+        if (b->op == BENCH_MM)
+            return alphasparse_c_mm(b->trans, one, A, b->descr, b->layout, x, b->columns, ld_x, zero, y, ld_y);
+        return alphasparse_c_trsv(b->trans, one, A, b->descr, x, y);
+    }
+    else
+    {
+        const ALPHA_Complex16 one = {1., 0.}, zero = {0., 0.};
+        if (b->op == BENCH_MV)
+            return alphasparse_z_mv(b->trans, one, A, b->descr, x, zero, y);
+        if (b->op == BENCH_MM)
+            return alphasparse_z_mm(b->trans, one, A, b->descr, b->layout, x, b->columns, ld_x, zero, y, ld_y);
+        return alphasparse_z_trsv(b->trans, one, A, b->descr, x, y);
+    }
+}
+
+static ALPHA_Complex16 widen(alphasparse_datatype_t datatype, const void *arr, size_t i)
+{
+    ALPHA_Complex16 v = {0., 0.};
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+        v.real = ((const float *)arr)[i];
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+        v.real = ((const double *)arr)[i];
+    else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+    {
+        v.real = ((const ALPHA_Complex8 *)arr)[i].real;
+        v.imag = ((const ALPHA_Complex8 *)arr)[i].imag;
+    }
+    else
+        v = ((const ALPHA_Complex16 *)arr)[i];
+    return v;
+}
+
+static ALPHA_Complex16 reference_mul(const ALPHA_Complex16 a, const ALPHA_Complex16 b)
+{
+    ALPHA_Complex16 v = {a.real * b.real - a.imag * b.imag, a.real * b.imag + a.imag * b.real};
+    return v;
+}
+
+static ALPHA_Complex16 reference_div(const ALPHA_Complex16 a, const ALPHA_Complex16 b)
+{
+    const double d = b.real * b.real + b.imag * b.imag;
+    ALPHA_Complex16 v = {(a.real * b.real + a.imag * b.imag) / d, (a.imag * b.real - a.real * b.imag) / d};
+    return v;
+}
+
+typedef struct
+{
+    ALPHA_INT *row;
+    ALPHA_INT *col;
+    ALPHA_Complex16 *val;
+    ALPHA_INT64 count;
+} reference_entries_t;
+
+// one entry of A, placed where op(A) has it
+static void reference_emit(const bench_t *b, reference_entries_t *e, const ALPHA_INT r, const ALPHA_INT c, ALPHA_Complex16 v)
+{
+    const bool trans = b->trans != ALPHA_SPARSE_OPERATION_NON_TRANSPOSE;
+    if (b->trans == ALPHA_SPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+        v.imag = -v.imag;
+    e->row[e->count] = trans ? c : r;
+    e->col[e->count] = trans ? r : c;
+    e->val[e->count] = v;
+    e->count++;
+}
+
+/*
+* op(A) as row lists, the descriptor applied the way the kernels read it: one triangle
+* mirrored for symmetric and hermitian, one triangle for triangular, the diagonal alone
+* for diagonal, and stored diagonals replaced by ones for a unit descriptor.
+*/
+static void reference_rows(const bench_t *b, ALPHA_OFFSET *ptr, ALPHA_INT **col, ALPHA_Complex16 **val)
+{
+    const alphasparse_matrix_type_t type = b->descr.type;
+    const bool general = type == ALPHA_SPARSE_MATRIX_TYPE_GENERAL;
+    const bool mirror = type == ALPHA_SPARSE_MATRIX_TYPE_SYMMETRIC || type == ALPHA_SPARSE_MATRIX_TYPE_HERMITIAN;
+    const bool unit = !general && b->descr.diag == ALPHA_SPARSE_DIAG_UNIT;
+    const bool lower = b->descr.mode == ALPHA_SPARSE_FILL_MODE_LOWER;
+    const ALPHA_INT diag_len = b->rows < b->cols ? b->rows : b->cols;
+    const ALPHA_INT out_rows = b->trans != ALPHA_SPARSE_OPERATION_NON_TRANSPOSE ? b->cols : b->rows;
+    const size_t cap = 2 * b->nnz + diag_len;
+    reference_entries_t e = {alpha_malloc(cap * sizeof(ALPHA_INT)), alpha_malloc(cap * sizeof(ALPHA_INT)),
+                             alpha_malloc(cap * sizeof(ALPHA_Complex16)), 0};
+    for (ALPHA_INT r = 0; r < b->rows; r++)
+        for (ALPHA_OFFSET ai = b->rows_offset[r]; ai < b->rows_offset[r + 1]; ai++)
+        {
+            const ALPHA_INT c = b->col_index[ai];
+            const ALPHA_Complex16 v = widen(b->datatype, b->values, ai);
+            if (general)
+            {
+                reference_emit(b, &e, r, c, v);
+                continue;
+            }
+            if (r == c)
+            {
+                if (!unit)
+                    reference_emit(b, &e, r, c, v);
+                continue;
+            }
+            if (type == ALPHA_SPARSE_MATRIX_TYPE_DIAGONAL || (lower ? c > r : c < r))
+                continue;
+            reference_emit(b, &e, r, c, v);
+            if (mirror)
+            {
+                ALPHA_Complex16 m = v;
+                if (type == ALPHA_SPARSE_MATRIX_TYPE_HERMITIAN)
+                    m.imag = -m.imag;
+                reference_emit(b, &e, c, r, m);
+            }
+        }
+    const ALPHA_Complex16 one = {1., 0.};
+    for (ALPHA_INT i = 0; i < diag_len && unit; i++)
+        reference_emit(b, &e, i, i, one);
+
+    memset(ptr, 0, (out_rows + 1) * sizeof(ALPHA_OFFSET));
+    for (ALPHA_INT64 i = 0; i < e.count; i++)
+        ptr[e.row[i] + 1]++;
+    for (ALPHA_INT r = 0; r < out_rows; r++)
+        ptr[r + 1] += ptr[r];
+    *col = alpha_malloc((e.count + 1) * sizeof(ALPHA_INT));
+    *val = alpha_malloc((e.count + 1) * sizeof(ALPHA_Complex16));
+    ALPHA_OFFSET *fill = alpha_malloc((out_rows + 1) * sizeof(ALPHA_OFFSET));
+    memcpy(fill, ptr, (out_rows + 1) * sizeof(ALPHA_OFFSET));
+    for (ALPHA_INT64 i = 0; i < e.count; i++)
+    {
+        const ALPHA_OFFSET at = fill[e.row[i]]++;
+        (*col)[at] = e.col[i];
+        (*val)[at] = e.val[i];
+    }
+    alpha_release(fill);
+    alpha_release(e.row);
+    alpha_release(e.col);
+    alpha_release(e.val);
+}
+
+// the last timed call against a serial loop over the CSR arrays, 0 when they agree
+static int bench_check(const bench_t *b, const void *x, const void *y)
+{
+    const bool trans = b->trans != ALPHA_SPARSE_OPERATION_NON_TRANSPOSE;
+    const ALPHA_INT out_rows = trans ? b->cols : b->rows;
+    const ALPHA_INT rhs = b->op == BENCH_MM ? b->columns : 1;
+    const bool row_major = b->op == BENCH_MM && b->layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR;
+    const ALPHA_INT ld_x = row_major ? rhs : (trans ? b->rows : b->cols);
+    const ALPHA_INT ld_y = row_major ? rhs : out_rows;
+    ALPHA_OFFSET *ptr = alpha_malloc((out_rows + 1) * sizeof(ALPHA_OFFSET));
+    ALPHA_INT *col;
+    ALPHA_Complex16 *val;
+    reference_rows(b, ptr, &col, &val);
+    ALPHA_Complex16 *ref = alpha_malloc((size_t)out_rows * rhs * sizeof(ALPHA_Complex16));
+
+    for (ALPHA_INT j = 0; j < rhs; j++)
+    {
+#define AT(ld, i) (row_major ? (size_t)(i) * (ld) + j : (size_t)j * (ld) + (i))
+        if (b->op == BENCH_TRSV)
+        {
+            // op(A) is lower when the stored triangle is lower and not transposed, or upper and transposed
+            const bool forward = (b->descr.mode == ALPHA_SPARSE_FILL_MODE_LOWER) != trans;
+            for (ALPHA_INT n = 0; n < out_rows; n++)
+            {
+                const ALPHA_INT r = forward ? n : out_rows - 1 - n;
+                ALPHA_Complex16 sum = widen(b->datatype, x, AT(ld_x, r)), diag = {0., 0.};
+                for (ALPHA_OFFSET ai = ptr[r]; ai < ptr[r + 1]; ai++)
+                {
+                    if (col[ai] == r)
+                    {
+                        diag.real += val[ai].real;
+                        diag.imag += val[ai].imag;
+                    }
+                    else if (forward ? col[ai] < r : col[ai] > r)
+                    {
+                        const ALPHA_Complex16 p = reference_mul(val[ai], ref[AT(ld_y, col[ai])]);
+                        sum.real -= p.real;
+                        sum.imag -= p.imag;
+                    }
+                }
+                ref[AT(ld_y, r)] = reference_div(sum, diag);
+            }
+            continue;
+        }
+        for (ALPHA_INT r = 0; r < out_rows; r++)
+        {
+            ALPHA_Complex16 sum = {0., 0.};
+            for (ALPHA_OFFSET ai = ptr[r]; ai < ptr[r + 1]; ai++)
+            {
+                const ALPHA_Complex16 p = reference_mul(val[ai], widen(b->datatype, x, AT(ld_x, col[ai])));
+                sum.real += p.real;
+                sum.imag += p.imag;
+            }
+            ref[AT(ld_y, r)] = sum;
+        }
+#undef AT
+    }
+
+    // max error relative to the largest result, the check_* measure
+    double max_error = 0, max_result = 0;
+    for (size_t i = 0; i < (size_t)out_rows * rhs; i++)
+    {
+        const ALPHA_Complex16 got = widen(b->datatype, y, i);
+        const double err = hypot(got.real - ref[i].real, got.imag - ref[i].imag);
+        const double mag = hypot(got.real, got.imag);
+        max_error = err > max_error ? err : max_error;
+        max_result = mag > max_result ? mag : max_result;
+    }
+    const double relative_error = max_result > 0 ? max_error / max_result : max_error;
+    const bool single = b->datatype == ALPHA_SPARSE_DATATYPE_FLOAT || b->datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX;
+    const bool correct = relative_error <= (single ? 2e-5 : 2e-12);
+    fprintf(stderr, "check against the CSR reference : %s,%.10f\n", correct ? "correct" : "error", relative_error);
+
+    alpha_release(ptr);
+    alpha_release(col);
+    alpha_release(val);
+    alpha_release(ref);
+    return correct ? 0 : -1;
+}
+
+static void bench_report(const bench_t *b, const alpha_bench_stats_t *stats, const double stream_bw, const alpha_perf_counters_t *counters,
+                         const char *output, const char *output_file)
+{
+    FILE *fp = stdout;
+    bool header = true;
+    if (output_file != NULL)
+    {
+        fp = fopen(output_file, "a");
+        if (fp == NULL)
+        {
+            printf("can not open %s!!!\n", output_file);
+            return;
+        }
+        header = ftell(fp) == 0;
+    }
+    const double gflops = b->flops / stats->median * 1e-9;
+    const double gbs = b->bytes / stats->median * 1e-9;
+    const double stream_pct = stream_bw > 0 ? 100 * gbs / stream_bw : 0;
+    const char *layout = b->layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR ? "R" : "C";
+    const ALPHA_INT columns = b->op == BENCH_MM ? b->columns : 1;
+    // counters per timed call, -1 for missing events
+    double per_call[ALPHA_PERF_EVENT_NUM];
+    bool counted = false;
+    for (int e = 0; e < ALPHA_PERF_EVENT_NUM; e++)
+    {
+        per_call[e] = counters->value[e] < 0 ? -1 : (double)counters->value[e] / stats->count;
+        counted |= counters->value[e] >= 0;
+    }
+
+    if (strcmp(output, "csv") == 0)
+    {
+        if (header)
+        {
+            fprintf(fp, "file,op,format,data_type,threads,layout,columns,rows,cols,nnz,warmup,iter,min_s,median_s,p95_s,mean_s,gflops,gbs,stream_gbs,stream_pct");
+            for (int e = 0; e < ALPHA_PERF_EVENT_NUM; e++)
+                fprintf(fp, ",%s", alpha_perf_event_name[e]);
+            fprintf(fp, "\n");
+        }
+        fprintf(fp, "\"%s\",%s,%s,%s,%d,%s,%d,%d,%d,%lld,%d,%d,%.9e,%.9e,%.9e,%.9e,%.4f,%.4f,%.4f,%.2f",
+                b->file, b->op_name, format_name[b->format], datatype_name[b->datatype], b->thread_num, layout, (int)columns,
+                (int)b->rows, (int)b->cols, (long long)b->nnz, b->warmup, stats->count,
+                stats->min, stats->median, stats->p95, stats->mean, gflops, gbs, stream_bw, stream_pct);
+        for (int e = 0; e < ALPHA_PERF_EVENT_NUM; e++)
+            fprintf(fp, ",%.1f", per_call[e]);
+        fprintf(fp, "\n");
+    }
+    else if (strcmp(output, "json") == 0)
+    {
+        // one object per line so runs can be appended to the same file
+        fprintf(fp, "{\"file\":\"%s\",\"op\":\"%s\",\"format\":\"%s\",\"data_type\":\"%s\",\"threads\":%d,\"layout\":\"%s\",\"columns\":%d,"
+                    "\"rows\":%d,\"cols\":%d,\"nnz\":%lld,\"warmup\":%d,\"iter\":%d,"
+                    "\"min_s\":%.9e,\"median_s\":%.9e,\"p95_s\":%.9e,\"mean_s\":%.9e,\"gflops\":%.4f,\"gbs\":%.4f,\"stream_gbs\":%.4f,\"stream_pct\":%.2f",
+                b->file, b->op_name, format_name[b->format], datatype_name[b->datatype], b->thread_num, layout, (int)columns,
+                (int)b->rows, (int)b->cols, (long long)b->nnz, b->warmup, stats->count,
+                stats->min, stats->median, stats->p95, stats->mean, gflops, gbs, stream_bw, stream_pct);
+        for (int e = 0; e < ALPHA_PERF_EVENT_NUM; e++)
+            if (per_call[e] >= 0)
+                fprintf(fp, ",\"%s\":%.1f", alpha_perf_event_name[e], per_call[e]);
+        fprintf(fp, "}\n");
+    }
+    else
+    {
+        fprintf(fp, "%s %s %s %s threads %d : %d x %d nnz %lld\n", b->file, b->op_name, format_name[b->format], datatype_name[b->datatype],
+                b->thread_num, (int)b->rows, (int)b->cols, (long long)b->nnz);
+        fprintf(fp, "  time[sec]  min %.6e  median %.6e  p95 %.6e  mean %.6e  (%d runs, %d warmup)\n",
+                stats->min, stats->median, stats->p95, stats->mean, stats->count, b->warmup);
+        fprintf(fp, "  %.4f GFLOP/s  %.4f GB/s  %.1f%% of STREAM triad %.4f GB/s\n", gflops, gbs, stream_pct, stream_bw);
+        if (counted)
+        {
+            fprintf(fp, "  per call:");
+            for (int e = 0; e < ALPHA_PERF_EVENT_NUM; e++)
+                if (per_call[e] >= 0)
+                    fprintf(fp, "  %s %.0f", alpha_perf_event_name[e], per_call[e]);
+            fprintf(fp, "\n");
+            if (per_call[ALPHA_PERF_CYCLES] > 0 && per_call[ALPHA_PERF_INSTRUCTIONS] >= 0)
+                fprintf(fp, "  IPC %.3f", per_call[ALPHA_PERF_INSTRUCTIONS] / per_call[ALPHA_PERF_CYCLES]);
+            if (per_call[ALPHA_PERF_LLC_LOAD_MISSES] >= 0)
+                fprintf(fp, "  LLC miss traffic %.4f GB/s (64 B lines)", per_call[ALPHA_PERF_LLC_LOAD_MISSES] * 64 / stats->mean * 1e-9);
+            fprintf(fp, "\n");
+        }
+    }
+    if (fp != stdout)
+        fclose(fp);
+}
+
+int main(int argc, const char *argv[])
+{
+    args_help(argc, argv);
+    bench_t b;
+    memset(&b, 0, sizeof(bench_t));
+    b.file = args_get_data_file(argc, argv);
+    b.gen = args_get_gen(argc, argv);
+    b.seed = args_get_seed(argc, argv);
+    if (b.gen != NULL)
+        b.file = b.gen;
+    b.op_name = args_get_op(argc, argv);
+    b.format = alpha_args_get_formatA(argc, argv);
+    b.datatype = alpha_args_get_data_type(argc, argv);
+    b.trans = alpha_args_get_transA(argc, argv);
+    b.layout = alpha_args_get_layout(argc, argv);
+    b.descr = alpha_args_get_matrix_descrA(argc, argv);
+    b.thread_num = args_get_thread_num(argc, argv);
+    b.warmup = args_get_warmup(argc, argv);
+    b.iter = args_get_iter(argc, argv);
+    b.block_size = args_get_block_size(argc, argv);
+    const char *output = args_get_output(argc, argv);
+    const char *output_file = args_get_output_file(argc, argv);
+    double stream_bw = args_get_stream_bw(argc, argv);
+    const bool perf = args_get_perf(argc, argv);
+    const bool check = args_get_if_check(argc, argv);
+
+    if (strcmp(b.op_name, "mv") == 0)
+        b.op = BENCH_MV;
+    else if (strcmp(b.op_name, "mm") == 0)
+        b.op = BENCH_MM;
+    else if (strcmp(b.op_name, "trsv") == 0)
+        b.op = BENCH_TRSV;
+    else
+    {
+        printf("invalid op value!!! %s\n", b.op_name);
+        return -1;
+    }
+    if (b.op == BENCH_TRSV && b.descr.type == ALPHA_SPARSE_MATRIX_TYPE_GENERAL)
+        b.descr.type = ALPHA_SPARSE_MATRIX_TYPE_TRIANGULAR;
+    if (b.iter < 1 || b.warmup < 0)
+    {
+        printf("iter must be positive and warmup not negative!!!\n");
+        return -1;
+    }
+
+    alpha_set_thread_num(b.thread_num);
+    alphasparse_matrix_t A;
+    alphasparse_status_t status = bench_load(&b, &A);
+    if (status != ALPHA_SPARSE_STATUS_SUCCESS)
+    {
+        printf("can not load %s as %s, status %d!!!\n", b.file, format_name[b.format], status);
+        return -1;
+    }
+    b.columns = args_get_columns(argc, argv, 1);
+    bench_model(&b);
+
+    const bool trans = b.trans != ALPHA_SPARSE_OPERATION_NON_TRANSPOSE;
+    const size_t rhs = b.op == BENCH_MM ? b.columns : 1;
+    const size_t x_len = (size_t)(trans ? b.rows : b.cols) * rhs;
+    const size_t y_len = (size_t)(trans ? b.cols : b.rows) * rhs;
+    const size_t vsize = value_size(b.datatype);
+    void *x = alpha_memalign(x_len * vsize, DEFAULT_ALIGNMENT);
+    void *y = alpha_memalign(y_len * vsize, DEFAULT_ALIGNMENT);
+    fill_random(b.datatype, x, 1, x_len);
+    memset(y, 0, y_len * vsize);
+
+    for (int i = 0; i < b.warmup; i++)
+    {
+        status = bench_call(&b, A, x, y);
+        if (status != ALPHA_SPARSE_STATUS_SUCCESS)
+        {
+            printf("%s on %s failed, status %d!!!\n", b.op_name, format_name[b.format], status);
+            return -1;
+        }
+    }
+    if (perf && !alpha_perf_enable(true))
+        printf("hardware counters are not available on this machine, running without them\n");
+    double *times = alpha_malloc(b.iter * sizeof(double));
+    alpha_perf_counters_t counters;
+    const unsigned generation = alpha_perf_begin(b.thread_num);
+    for (int i = 0; i < b.iter; i++)
+    {
+        alpha_timer_t timer;
+        alpha_timing_start(&timer);
+        status = bench_call(&b, A, x, y);
+        alpha_timing_end(&timer);
+        if (status != ALPHA_SPARSE_STATUS_SUCCESS)
+        {
+            printf("%s on %s failed, status %d!!!\n", b.op_name, format_name[b.format], status);
+            return -1;
+        }
+        times[i] = alpha_timing_elapsed_time(&timer);
+    }
+    alpha_perf_end(b.thread_num, generation, &counters);
+    alpha_bench_stats_t stats;
+    alpha_bench_stats(times, b.iter, &stats);
+
+    if (stream_bw <= 0)
+        stream_bw = alpha_bench_stream_triad(BENCH_STREAM_ELEMENTS, b.thread_num);
+    bench_report(&b, &stats, stream_bw, &counters, output, output_file);
+    // y holds the result of the last timed call, beta is 0
+    const int checked = check ? bench_check(&b, x, y) : 0;
+
+    alphasparse_destroy(A);
+    alpha_free(times);
+    alpha_free(x);
+    alpha_free(y);
+    alpha_release(b.rows_offset);
+    alpha_release(b.col_index);
+    alpha_release(b.values);
+    return checked;
+}
@@ -27,6 +27,9 @@ extern "C"
 #include "alphasparse/util/analysis.h"
 #include "alphasparse/util/io.h"
 #include "alphasparse/util/algebra.h"
+#include "alphasparse/util/bench.h"
+#include "alphasparse/util/generate.h"
+#include "alphasparse/util/perf.h"
 
 #ifdef __cplusplus
 }
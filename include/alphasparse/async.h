@@ -0,0 +1,46 @@
+#pragma once
+
+/**
+ * @brief header for the executor behind the asynchronous routines
+ *
+ * Requests are run by a fixed set of worker threads, one per team. Each
+ * worker owns an execution context giving it its share of the threads and
+ * cores, so requests running side by side do not each take the whole machine.
+ */
+
+#include "spdef.h"
+#include "types.h"
+
+// body of a request, args is the block handed to alpha_async_submit
+typedef alphasparse_status_t (*alpha_async_fn_t)(void *args);
+
+/*
+* Queue fn(args) to run once every request of deps has completed. args must
+* come from malloc and is owned by the executor from the call on, it is freed
+* after fn ran and also when submitting fails. When a dependency failed fn is
+* not run and the request completes with ALPHA_SPARSE_STATUS_EXECUTION_FAILED.
+*/
+alphasparse_status_t alpha_async_submit(alpha_async_fn_t fn,
+                                        void *args,
+                                        const ALPHA_INT dep_num,
+                                        const alphasparse_future_t *deps,
+                                        alphasparse_future_t *future);
+
+// synchronous routines of the precision being compiled, for the _x_ sources
+#ifndef COMPLEX
+#ifndef DOUBLE
+#define alpha_async_mv alphasparse_s_mv
+#define alpha_async_mm alphasparse_s_mm
+#else
+#define alpha_async_mv alphasparse_d_mv
+#define alpha_async_mm alphasparse_d_mm
+#endif
+#else
+#ifndef DOUBLE
+#define alpha_async_mv alphasparse_c_mv
+#define alpha_async_mm alphasparse_c_mm
+#else
+#define alpha_async_mv alphasparse_z_mv
+#define alpha_async_mm alphasparse_z_mm
+#endif
+#endif
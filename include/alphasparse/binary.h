@@ -0,0 +1,64 @@
+#pragma once
+
+/**
+ * @brief on-disk layout written by alphasparse_save and mapped by alphasparse_load
+ */
+
+#include "spdef.h"
+#include "types.h"
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+* A file is one header followed by the arrays of the matrix, each starting on
+* an ALPHA_BINARY_ALIGNMENT boundary so a mapping of the file can serve them
+* in place. Arrays are stored exactly as the in-memory structs hold them, with
+* the 3-array offsets of CSR/BSR (rows + 1 entries). A loader only accepts files
+* written with the same byte order, ALPHA_INT and ALPHA_OFFSET widths.
+*
+* Version history
+* 1   CSR, BSR and pattern-only CSR, optional value index of the inspector
+*/
+
+#define ALPHA_BINARY_MAGIC "ALPHASPM"
+#define ALPHA_BINARY_VERSION 1
+#define ALPHA_BINARY_ENDIAN 0x01020304u
+#define ALPHA_BINARY_ALIGNMENT 64
+
+typedef enum
+{
+  ALPHA_BINARY_SECTION_ROWS_OFFSET = 0, // ALPHA_OFFSET[rows + 1]
+  ALPHA_BINARY_SECTION_COL_INDX = 1,    // ALPHA_INT[nnz]
+  ALPHA_BINARY_SECTION_VALUES = 2,      // nnz values (blocks for BSR), absent for pattern-only matrices
+  ALPHA_BINARY_SECTION_INDEX_PTR = 3,   // value index of the inspector, alpha_value_index_t::ptr
+  ALPHA_BINARY_SECTION_INDEX_IDX = 4,   // alpha_value_index_t::idx
+  ALPHA_BINARY_SECTION_INDEX_POS = 5,   // alpha_value_index_t::pos
+  ALPHA_BINARY_SECTION_NUM = 8          // room for later versions
+} alpha_binary_section_t;
+
+// rows were packed on the way out, stored positions differ from the saved handle's
+#define ALPHA_BINARY_FLAG_REPACKED 0x1u
+
+typedef struct
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t endian;      // ALPHA_BINARY_ENDIAN as seen by the writer
+  uint32_t int_size;    // sizeof(ALPHA_INT)
+  uint32_t offset_size; // sizeof(ALPHA_OFFSET)
+  uint32_t format;      // alphasparse_format_t
+  uint32_t datatype;    // alphasparse_datatype_t
+  int64_t rows;         // block rows for BSR
+  int64_t cols;         // block cols for BSR
+  int64_t nnz;          // stored entries, blocks for BSR
+  int64_t block_size;
+  uint32_t block_layout;
+  uint32_t flags;       // ALPHA_BINARY_FLAG_*
+  uint64_t file_size;
+  uint64_t section[ALPHA_BINARY_SECTION_NUM]; // byte offset of each section, 0 if absent
+} alpha_binary_header_t;
+
+/* pad fp to the next ALPHA_BINARY_ALIGNMENT boundary, write bytes of data there and record the offset */
+alphasparse_status_t alpha_binary_write_section(FILE *fp, alpha_binary_header_t *header, const alpha_binary_section_t section, const void *data, const size_t bytes);
+/* start of a section in a mapped file, NULL if it is absent or its bytes run past the file */
+void *alpha_binary_section(const alpha_binary_header_t *header, const alpha_binary_section_t section, const size_t bytes);
@@ -0,0 +1,69 @@
+#pragma once
+
+/**
+ * @brief header for the incremental CSR builder behind alphasparse_csr_builder_t
+ */
+
+#include "spdef.h"
+#include "types.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+* Rows are appended in order inside a range, ranges are independent so each
+* producer thread can fill its own one without locking.
+*
+* row_begin/row_end  Rows of the range, [row_begin, row_end)
+* next_row           Next row append_row fills
+* nnz                Entries appended so far
+* capacity           Entries col_indx/values can hold before growing (unused in exact mode)
+* col_indx/values    Private buffers growing geometrically, or NULL in exact mode
+*/
+struct alpha_csr_builder_range
+{
+  struct alpha_csr_builder *builder;
+  ALPHA_INT row_begin;
+  ALPHA_INT row_end;
+  ALPHA_INT next_row;
+  ALPHA_OFFSET nnz;
+  ALPHA_OFFSET capacity;
+  ALPHA_INT *col_indx;
+  void *values;
+};
+
+/*
+* exact        Per-row counts were given, rows_offset is final and every row is
+*              written straight into col_indx/values
+* rows_offset  rows + 1 entries, in the growing mode rows_offset[r + 1] holds
+*              the length of row r until finalize turns it into offsets
+* nnz_hint     Expected nnz of the whole matrix, spread over ranges without a hint of their own
+*/
+struct alpha_csr_builder
+{
+  alphasparse_datatype_t datatype;
+  size_t value_size;
+  ALPHA_INT rows;
+  ALPHA_INT cols;
+  bool exact;
+  ALPHA_OFFSET nnz_hint;
+  ALPHA_OFFSET *rows_offset;
+  ALPHA_INT *col_indx;
+  void *values;
+  struct alpha_csr_builder_range **ranges;
+  ALPHA_INT range_num;
+  ALPHA_INT range_capacity;
+};
+
+/* set up a builder for one datatype, row_nnz may be NULL */
+alphasparse_status_t alpha_csr_builder_init(alphasparse_csr_builder_t *builder,
+                                            const alphasparse_datatype_t datatype,
+                                            const size_t value_size,
+                                            const ALPHA_INT rows,
+                                            const ALPHA_INT cols,
+                                            const ALPHA_INT *row_nnz,
+                                            const ALPHA_OFFSET nnz_hint);
+/* append the next row of range, values has value_size bytes per entry */
+alphasparse_status_t alpha_csr_builder_append(alphasparse_csr_range_t range,
+                                              const ALPHA_INT nnz,
+                                              const ALPHA_INT *col_indx,
+                                              const void *values);
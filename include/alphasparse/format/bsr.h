@@ -5,10 +5,15 @@
  */
 
 #include "../types.h"
+#include "../binary.h"
+#include <stdio.h>
 #include "../spmat.h"
 
 alphasparse_status_t destroy_s_bsr(spmat_bsr_s_t *A);
 alphasparse_status_t transpose_s_bsr(const spmat_bsr_s_t *s, spmat_bsr_s_t **d);
+alphasparse_status_t extract_s_bsr(const spmat_bsr_s_t *A, const ALPHA_INT rows, const ALPHA_INT *row_indx, const ALPHA_INT cols, const ALPHA_INT *col_map, spmat_bsr_s_t **dest);
+alphasparse_status_t save_s_bsr(const spmat_bsr_s_t *A, FILE *fp, alpha_binary_header_t *header);
+alphasparse_status_t load_s_bsr(const alpha_binary_header_t *header, spmat_bsr_s_t **A);
 alphasparse_status_t convert_coo_s_bsr(const spmat_bsr_s_t *source, spmat_coo_s_t **dest);
 alphasparse_status_t convert_csr_s_bsr(const spmat_bsr_s_t *source, spmat_csr_s_t **dest);
 alphasparse_status_t convert_csc_s_bsr(const spmat_bsr_s_t *source, spmat_csc_s_t **dest);
@@ -16,6 +21,9 @@ alphasparse_status_t convert_bsr_s_bsr(const spmat_bsr_s_t *source, spmat_bsr_s_
 
 alphasparse_status_t destroy_d_bsr(spmat_bsr_d_t *A);
 alphasparse_status_t transpose_d_bsr(const spmat_bsr_d_t *s, spmat_bsr_d_t **d);
+alphasparse_status_t extract_d_bsr(const spmat_bsr_d_t *A, const ALPHA_INT rows, const ALPHA_INT *row_indx, const ALPHA_INT cols, const ALPHA_INT *col_map, spmat_bsr_d_t **dest);
+alphasparse_status_t save_d_bsr(const spmat_bsr_d_t *A, FILE *fp, alpha_binary_header_t *header);
+alphasparse_status_t load_d_bsr(const alpha_binary_header_t *header, spmat_bsr_d_t **A);
 alphasparse_status_t convert_coo_d_bsr(const spmat_bsr_d_t *source, spmat_coo_d_t **dest);
 alphasparse_status_t convert_csr_d_bsr(const spmat_bsr_d_t *source, spmat_csr_d_t **dest);
 alphasparse_status_t convert_csc_d_bsr(const spmat_bsr_d_t *source, spmat_csc_d_t **dest);
@@ -24,6 +32,9 @@ alphasparse_status_t convert_bsr_d_bsr(const spmat_bsr_d_t *source, spmat_bsr_d_
 
 alphasparse_status_t destroy_c_bsr(spmat_bsr_c_t *A);
 alphasparse_status_t transpose_c_bsr(const spmat_bsr_c_t *s, spmat_bsr_c_t **d);
+alphasparse_status_t extract_c_bsr(const spmat_bsr_c_t *A, const ALPHA_INT rows, const ALPHA_INT *row_indx, const ALPHA_INT cols, const ALPHA_INT *col_map, spmat_bsr_c_t **dest);
+alphasparse_status_t save_c_bsr(const spmat_bsr_c_t *A, FILE *fp, alpha_binary_header_t *header);
+alphasparse_status_t load_c_bsr(const alpha_binary_header_t *header, spmat_bsr_c_t **A);
 alphasparse_status_t transpose_conj_c_bsr(const spmat_bsr_c_t *s, spmat_bsr_c_t **d);
 alphasparse_status_t convert_coo_c_bsr(const spmat_bsr_c_t *source, spmat_coo_c_t **dest);
 alphasparse_status_t convert_csr_c_bsr(const spmat_bsr_c_t *source, spmat_csr_c_t **dest);
@@ -33,6 +44,9 @@ alphasparse_status_t convert_bsr_c_bsr(const spmat_bsr_c_t *source, spmat_bsr_c_
 
 alphasparse_status_t destroy_z_bsr(spmat_bsr_z_t *A);
 alphasparse_status_t transpose_z_bsr(const spmat_bsr_z_t *s, spmat_bsr_z_t **d);
+alphasparse_status_t extract_z_bsr(const spmat_bsr_z_t *A, const ALPHA_INT rows, const ALPHA_INT *row_indx, const ALPHA_INT cols, const ALPHA_INT *col_map, spmat_bsr_z_t **dest);
+alphasparse_status_t save_z_bsr(const spmat_bsr_z_t *A, FILE *fp, alpha_binary_header_t *header);
+alphasparse_status_t load_z_bsr(const alpha_binary_header_t *header, spmat_bsr_z_t **A);
 alphasparse_status_t transpose_conj_z_bsr(const spmat_bsr_z_t *s, spmat_bsr_z_t **d);
 alphasparse_status_t convert_coo_z_bsr(const spmat_bsr_z_t *source, spmat_coo_z_t **dest);
 alphasparse_status_t convert_csr_z_bsr(const spmat_bsr_z_t *source, spmat_csr_z_t **dest);
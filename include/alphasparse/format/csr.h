@@ -6,6 +6,8 @@
 
 #include "../spmat.h"
 #include "../types.h"
+#include "../binary.h"
+#include <stdio.h>
 alphasparse_status_t csr_s_order(spmat_csr_s_t *mat);
 alphasparse_status_t csr_d_order(spmat_csr_d_t *mat);
 alphasparse_status_t csr_c_order(spmat_csr_c_t *mat);
@@ -13,6 +15,10 @@ alphasparse_status_t csr_z_order(spmat_csr_z_t *mat);
 
 alphasparse_status_t destroy_s_csr(spmat_csr_s_t *A);
 alphasparse_status_t transpose_s_csr(const spmat_csr_s_t *s, spmat_csr_s_t **d);
+alphasparse_status_t convert_pattern_s_csr(const spmat_csr_s_t *source, spmat_csr_s_t **dest);
+alphasparse_status_t extract_s_csr(const spmat_csr_s_t *A, const ALPHA_INT rows, const ALPHA_INT *row_indx, const ALPHA_INT cols, const ALPHA_INT *col_map, spmat_csr_s_t **dest);
+alphasparse_status_t save_s_csr(const spmat_csr_s_t *A, FILE *fp, alpha_binary_header_t *header);
+alphasparse_status_t load_s_csr(const alpha_binary_header_t *header, spmat_csr_s_t **A);
 alphasparse_status_t convert_coo_s_csr(const spmat_csr_s_t *source, spmat_coo_s_t **dest);
 alphasparse_status_t convert_csr_s_csr(const spmat_csr_s_t *source, spmat_csr_s_t **dest);
 alphasparse_status_t convert_csr5_s_csr(const spmat_csr_s_t *source, spmat_csr5_s_t **dest);
@@ -29,6 +35,10 @@ alphasparse_status_t convert_hints_ell_s_csr(const spmat_csr_s_t *source, spmat_
 
 alphasparse_status_t destroy_d_csr(spmat_csr_d_t *A);
 alphasparse_status_t transpose_d_csr(const spmat_csr_d_t *s, spmat_csr_d_t **d);
+alphasparse_status_t convert_pattern_d_csr(const spmat_csr_d_t *source, spmat_csr_d_t **dest);
+alphasparse_status_t extract_d_csr(const spmat_csr_d_t *A, const ALPHA_INT rows, const ALPHA_INT *row_indx, const ALPHA_INT cols, const ALPHA_INT *col_map, spmat_csr_d_t **dest);
+alphasparse_status_t save_d_csr(const spmat_csr_d_t *A, FILE *fp, alpha_binary_header_t *header);
+alphasparse_status_t load_d_csr(const alpha_binary_header_t *header, spmat_csr_d_t **A);
 alphasparse_status_t convert_coo_d_csr(const spmat_csr_d_t *source, spmat_coo_d_t **dest);
 alphasparse_status_t convert_csr_d_csr(const spmat_csr_d_t *source, spmat_csr_d_t **dest);
 alphasparse_status_t convert_csr5_d_csr(const spmat_csr_d_t *source, spmat_csr5_d_t **dest);
@@ -45,6 +55,10 @@ alphasparse_status_t convert_hints_ell_d_csr(const spmat_csr_d_t *source, spmat_
 
 alphasparse_status_t destroy_c_csr(spmat_csr_c_t *A);
 alphasparse_status_t transpose_c_csr(const spmat_csr_c_t *s, spmat_csr_c_t **d);
+alphasparse_status_t convert_pattern_c_csr(const spmat_csr_c_t *source, spmat_csr_c_t **dest);
+alphasparse_status_t extract_c_csr(const spmat_csr_c_t *A, const ALPHA_INT rows, const ALPHA_INT *row_indx, const ALPHA_INT cols, const ALPHA_INT *col_map, spmat_csr_c_t **dest);
+alphasparse_status_t save_c_csr(const spmat_csr_c_t *A, FILE *fp, alpha_binary_header_t *header);
+alphasparse_status_t load_c_csr(const alpha_binary_header_t *header, spmat_csr_c_t **A);
 alphasparse_status_t transpose_conj_c_csr(const spmat_csr_c_t *s, spmat_csr_c_t **d);
 alphasparse_status_t convert_coo_c_csr(const spmat_csr_c_t *source, spmat_coo_c_t **dest);
 alphasparse_status_t convert_csr_c_csr(const spmat_csr_c_t *source, spmat_csr_c_t **dest);
@@ -62,6 +76,10 @@ alphasparse_status_t convert_hints_ell_c_csr(const spmat_csr_c_t *source, spmat_
 
 alphasparse_status_t destroy_z_csr(spmat_csr_z_t *A);
 alphasparse_status_t transpose_z_csr(const spmat_csr_z_t *s, spmat_csr_z_t **d);
+alphasparse_status_t convert_pattern_z_csr(const spmat_csr_z_t *source, spmat_csr_z_t **dest);
+alphasparse_status_t extract_z_csr(const spmat_csr_z_t *A, const ALPHA_INT rows, const ALPHA_INT *row_indx, const ALPHA_INT cols, const ALPHA_INT *col_map, spmat_csr_z_t **dest);
+alphasparse_status_t save_z_csr(const spmat_csr_z_t *A, FILE *fp, alpha_binary_header_t *header);
+alphasparse_status_t load_z_csr(const alpha_binary_header_t *header, spmat_csr_z_t **A);
 alphasparse_status_t transpose_conj_z_csr(const spmat_csr_z_t *s, spmat_csr_z_t **d);
 alphasparse_status_t convert_coo_z_csr(const spmat_csr_z_t *source, spmat_coo_z_t **dest);
 alphasparse_status_t convert_csr_z_csr(const spmat_csr_z_t *source, spmat_csr_z_t **dest);
@@ -8,15 +8,19 @@
 #include "../spmat.h"
 
 alphasparse_status_t destroy_s_dia(spmat_dia_s_t *A);
+alphasparse_status_t destroy_s_dia_csr(spmat_dia_csr_s_t *A);
 alphasparse_status_t transpose_s_dia(const spmat_dia_s_t *s, spmat_dia_s_t **d);
 
 alphasparse_status_t destroy_d_dia(spmat_dia_d_t *A);
+alphasparse_status_t destroy_d_dia_csr(spmat_dia_csr_d_t *A);
 alphasparse_status_t transpose_d_dia(const spmat_dia_d_t *s, spmat_dia_d_t **d);
 
 alphasparse_status_t destroy_c_dia(spmat_dia_c_t *A);
+alphasparse_status_t destroy_c_dia_csr(spmat_dia_csr_c_t *A);
 alphasparse_status_t transpose_c_dia(const spmat_dia_c_t *s, spmat_dia_c_t **d);
 alphasparse_status_t transpose_conj_c_dia(const spmat_dia_c_t *s, spmat_dia_c_t **d);
 
 alphasparse_status_t destroy_z_dia(spmat_dia_z_t *A);
+alphasparse_status_t destroy_z_dia_csr(spmat_dia_csr_z_t *A);
 alphasparse_status_t transpose_z_dia(const spmat_dia_z_t *s, spmat_dia_z_t **d);
 alphasparse_status_t transpose_conj_z_dia(const spmat_dia_z_t *s, spmat_dia_z_t **d);
\ No newline at end of file
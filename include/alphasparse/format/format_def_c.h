@@ -11,12 +11,14 @@
 
 #define destroy_coo destroy_c_coo
 #define transpose_coo transpose_c_coo
+#define convert_pattern_coo convert_pattern_c_coo
 #define transpose_conj_coo transpose_conj_c_coo
 #define convert_csr_coo convert_csr_c_coo
 #define convert_csc_coo convert_csc_c_coo
 #define convert_bsr_coo convert_bsr_c_coo
 #define convert_sky_coo convert_sky_c_coo
 #define convert_dia_coo convert_dia_c_coo
+#define convert_dia_csr_coo convert_dia_csr_c_coo
 #define convert_ell_coo convert_ell_c_coo
 #define convert_hints_ell_coo convert_hints_ell_c_coo
 #define convert_hints_ell_coo convert_hints_ell_c_coo
@@ -24,6 +26,10 @@
 
 #define destroy_csr destroy_c_csr
 #define transpose_csr transpose_c_csr
+#define convert_pattern_csr convert_pattern_c_csr
+#define extract_csr extract_c_csr
+#define save_csr save_c_csr
+#define load_csr load_c_csr
 #define transpose_conj_csr transpose_conj_c_csr
 #define csr_order csr_c_order
 #define bsr_order bsr_c_order
@@ -36,6 +42,8 @@
 
 #define destroy_csc destroy_c_csc
 #define transpose_csc transpose_c_csc
+#define extract_csc extract_c_csc
+#define convert_pattern_csc convert_pattern_c_csc
 #define transpose_conj_csc transpose_conj_c_csc
 #define convert_coo_csc convert_coo_c_csc
 #define convert_csr_csc convert_csr_c_csc
@@ -44,6 +52,9 @@
 
 #define destroy_bsr destroy_c_bsr
 #define transpose_bsr transpose_c_bsr
+#define extract_bsr extract_c_bsr
+#define save_bsr save_c_bsr
+#define load_bsr load_c_bsr
 #define transpose_conj_bsr transpose_conj_c_bsr
 #define convert_coo_bsr convert_coo_c_bsr
 #define convert_csr_bsr convert_csr_c_bsr
@@ -55,6 +66,7 @@
 #define transpose_conj_sky transpose_conj_c_sky
 
 #define destroy_dia destroy_c_dia
+#define destroy_dia_csr destroy_c_dia_csr
 #define transpose_dia transpose_c_dia
 #define transpose_conj_dia transpose_conj_c_dia
 
@@ -11,12 +11,14 @@
 
 #define destroy_coo destroy_d_coo
 #define transpose_coo transpose_d_coo
+#define convert_pattern_coo convert_pattern_d_coo
 #define transpose_conj_coo transpose_conj_d_coo
 #define convert_csr_coo convert_csr_d_coo
 #define convert_csc_coo convert_csc_d_coo
 #define convert_bsr_coo convert_bsr_d_coo
 #define convert_sky_coo convert_sky_d_coo
 #define convert_dia_coo convert_dia_d_coo
+#define convert_dia_csr_coo convert_dia_csr_d_coo
 #define convert_ell_coo convert_ell_d_coo
 #define convert_hints_ell_coo convert_hints_ell_d_coo
 #define convert_hints_ell_coo convert_hints_ell_d_coo
@@ -24,6 +26,10 @@
 
 #define destroy_csr destroy_d_csr
 #define transpose_csr transpose_d_csr
+#define convert_pattern_csr convert_pattern_d_csr
+#define extract_csr extract_d_csr
+#define save_csr save_d_csr
+#define load_csr load_d_csr
 #define transpose_conj_csr transpose_conj_d_csr
 #define csr_order csr_d_order
 #define bsr_order bsr_d_order
@@ -36,6 +42,8 @@
 
 #define destroy_csc destroy_d_csc
 #define transpose_csc transpose_d_csc
+#define extract_csc extract_d_csc
+#define convert_pattern_csc convert_pattern_d_csc
 #define transpose_conj_csc transpose_conj_d_csc
 #define convert_coo_csc convert_coo_d_csc
 #define convert_csr_csc convert_csr_d_csc
@@ -44,6 +52,9 @@
 
 #define destroy_bsr destroy_d_bsr
 #define transpose_bsr transpose_d_bsr
+#define extract_bsr extract_d_bsr
+#define save_bsr save_d_bsr
+#define load_bsr load_d_bsr
 #define transpose_conj_bsr transpose_conj_d_bsr
 #define convert_coo_bsr convert_coo_d_bsr
 #define convert_csr_bsr convert_csr_d_bsr
@@ -55,6 +66,7 @@
 #define transpose_conj_sky transpose_conj_d_sky
 
 #define destroy_dia destroy_d_dia
+#define destroy_dia_csr destroy_d_dia_csr
 #define transpose_dia transpose_d_dia
 #define transpose_conj_dia transpose_conj_d_dia
 
@@ -11,12 +11,14 @@
 
 #define destroy_coo destroy_s_coo
 #define transpose_coo transpose_s_coo
+#define convert_pattern_coo convert_pattern_s_coo
 #define transpose_conj_coo transpose_conj_s_coo
 #define convert_csr_coo convert_csr_s_coo
 #define convert_csc_coo convert_csc_s_coo
 #define convert_bsr_coo convert_bsr_s_coo
 #define convert_sky_coo convert_sky_s_coo
 #define convert_dia_coo convert_dia_s_coo
+#define convert_dia_csr_coo convert_dia_csr_s_coo
 #define convert_ell_coo convert_ell_s_coo
 #define convert_hints_ell_coo convert_hints_ell_s_coo
 #define convert_hints_ell_coo convert_hints_ell_s_coo
@@ -24,6 +26,10 @@
 
 #define destroy_csr destroy_s_csr
 #define transpose_csr transpose_s_csr
+#define convert_pattern_csr convert_pattern_s_csr
+#define extract_csr extract_s_csr
+#define save_csr save_s_csr
+#define load_csr load_s_csr
 #define transpose_conj_csr transpose_conj_s_csr
 #define csr_order csr_s_order
 #define bsr_order bsr_s_order
@@ -36,6 +42,8 @@
 
 #define destroy_csc destroy_s_csc
 #define transpose_csc transpose_s_csc
+#define extract_csc extract_s_csc
+#define convert_pattern_csc convert_pattern_s_csc
 #define transpose_conj_csc transpose_conj_s_csc
 #define convert_coo_csc convert_coo_s_csc
 #define convert_csr_csc convert_csr_s_csc
@@ -44,6 +52,9 @@
 
 #define destroy_bsr destroy_s_bsr
 #define transpose_bsr transpose_s_bsr
+#define extract_bsr extract_s_bsr
+#define save_bsr save_s_bsr
+#define load_bsr load_s_bsr
 #define transpose_conj_bsr transpose_conj_s_bsr
 #define convert_coo_bsr convert_coo_s_bsr
 #define convert_csr_bsr convert_csr_s_bsr
@@ -55,6 +66,7 @@
 #define transpose_conj_sky transpose_conj_s_sky
 
 #define destroy_dia destroy_s_dia
+#define destroy_dia_csr destroy_s_dia_csr
 #define transpose_dia transpose_s_dia
 #define transpose_conj_dia transpose_conj_s_dia
 
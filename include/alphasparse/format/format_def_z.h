@@ -11,12 +11,14 @@
 
 #define destroy_coo destroy_z_coo
 #define transpose_coo transpose_z_coo
+#define convert_pattern_coo convert_pattern_z_coo
 #define transpose_conj_coo transpose_conj_z_coo
 #define convert_csr_coo convert_csr_z_coo
 #define convert_csc_coo convert_csc_z_coo
 #define convert_bsr_coo convert_bsr_z_coo
 #define convert_sky_coo convert_sky_z_coo
 #define convert_dia_coo convert_dia_z_coo
+#define convert_dia_csr_coo convert_dia_csr_z_coo
 #define convert_ell_coo convert_ell_z_coo
 #define convert_hints_ell_coo convert_hints_ell_z_coo
 #define convert_hints_ell_coo convert_hints_ell_z_coo
@@ -24,6 +26,10 @@
 
 #define destroy_csr destroy_z_csr
 #define transpose_csr transpose_z_csr
+#define convert_pattern_csr convert_pattern_z_csr
+#define extract_csr extract_z_csr
+#define save_csr save_z_csr
+#define load_csr load_z_csr
 #define transpose_conj_csr transpose_conj_z_csr
 #define csr_order csr_z_order
 #define bsr_order bsr_z_order
@@ -36,6 +42,8 @@
 
 #define destroy_csc destroy_z_csc
 #define transpose_csc transpose_z_csc
+#define extract_csc extract_z_csc
+#define convert_pattern_csc convert_pattern_z_csc
 #define transpose_conj_csc transpose_conj_z_csc
 #define convert_coo_csc convert_coo_z_csc
 #define convert_csr_csc convert_csr_z_csc
@@ -44,6 +52,9 @@
 
 #define destroy_bsr destroy_z_bsr
 #define transpose_bsr transpose_z_bsr
+#define extract_bsr extract_z_bsr
+#define save_bsr save_z_bsr
+#define load_bsr load_z_bsr
 #define transpose_conj_bsr transpose_conj_z_bsr
 #define convert_coo_bsr convert_coo_z_bsr
 #define convert_csr_bsr convert_csr_z_bsr
@@ -55,6 +66,7 @@
 #define transpose_conj_sky transpose_conj_z_sky
 
 #define destroy_dia destroy_z_dia
+#define destroy_dia_csr destroy_z_dia_csr
 #define transpose_dia transpose_z_dia
 #define transpose_conj_dia transpose_conj_z_dia
 
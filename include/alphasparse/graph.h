@@ -0,0 +1,135 @@
+#pragma once
+
+/**
+ * @brief header for operation graphs, recorded kernel sequences replayed with fused stages
+ */
+
+#include "spdef.h"
+#include "types.h"
+#include <stdbool.h>
+
+// rows a thread runs through all nodes of a stage before moving on, so fused nodes find their operands in cache
+#define ALPHA_GRAPH_ROW_BLOCK 512
+
+typedef enum
+{
+    ALPHA_GRAPH_MV = 0,    // out = alpha * op(A) * in[0] + beta * out
+    ALPHA_GRAPH_AXPBY = 1, // out = alpha * in[0] + beta * in[1]
+    ALPHA_GRAPH_DOT = 2,   // *out = sum of in[0][i] * in[1][i]
+} alpha_graph_op_t;
+
+typedef union
+{
+    float s;
+    double d;
+    ALPHA_Complex8 c;
+    ALPHA_Complex16 z;
+} alpha_graph_scalar_t;
+
+/*
+* one recorded operation
+*
+* rows      Length of out, rows of A for mv
+* fusable   Row-parallel with each out row depending on row i of the
+*           elementwise operands only: CSR general mv without transpose,
+*           axpby and dot
+* rows_end  Row ends of A for balancing the stage partition, mv only
+*/
+typedef struct
+{
+    alpha_graph_op_t op;
+    alphasparse_operation_t operation;
+    alphasparse_matrix_t A;
+    struct alpha_matrix_descr descr;
+    alpha_graph_scalar_t alpha;
+    alpha_graph_scalar_t beta;
+    ALPHA_INT rows;
+    bool fusable;
+    const ALPHA_OFFSET *rows_end;
+    const void *in[2];
+    void *out;
+} alpha_graph_node_t;
+
+/*
+* consecutive nodes run as one row-parallel loop, or a single unfused node
+*
+* partition     Row range of each thread, thread_num + 1 entries, fused stages only
+* dot_first     Index of the first dot of the stage in the per-thread partial sums
+* region_end    Last stage of the parallel region this stage opens, -1 when it does not open one
+*/
+typedef struct
+{
+    ALPHA_INT first;
+    ALPHA_INT last;
+    bool fused;
+    ALPHA_INT rows;
+    ALPHA_INT *partition;
+    ALPHA_INT dot_first;
+    ALPHA_INT region_end;
+} alpha_graph_stage_t;
+
+/*
+* graph behind alphasparse_graph_t
+*
+* capturing     mv calls of the capturing thread are recorded instead of run
+* finalized     stages are up to date for thread_num threads
+* dot_num       Dot nodes, dot_partial holds dot_num partial sums per thread
+*/
+struct alpha_graph
+{
+    alphasparse_datatype_t datatype;
+    bool typed;
+    bool capturing;
+    ALPHA_INT node_num;
+    ALPHA_INT node_cap;
+    alpha_graph_node_t *nodes;
+    bool finalized;
+    ALPHA_INT thread_num;
+    ALPHA_INT stage_num;
+    alpha_graph_stage_t *stages;
+    ALPHA_INT dot_num;
+    alpha_graph_scalar_t *dot_partial;
+};
+
+// graph the calling thread is capturing into, NULL when not capturing
+extern _Thread_local struct alpha_graph *alpha_graph_capture;
+#define alpha_graph_capturing() (alpha_graph_capture != NULL)
+
+// append a zeroed node of datatype to graph, INVALID_VALUE when graph holds another datatype
+alphasparse_status_t alpha_graph_append(struct alpha_graph *graph, const alphasparse_datatype_t datatype, alpha_graph_node_t **node);
+
+// split the nodes into stages and regions and partition the stages for thread_num threads
+alphasparse_status_t alpha_graph_finalize(struct alpha_graph *graph, const ALPHA_INT thread_num);
+
+alphasparse_status_t graph_s_record_mv(struct alpha_graph *graph, const alphasparse_operation_t operation, const float alpha, const alphasparse_matrix_t A, const struct alpha_matrix_descr descr, const float *x, const float beta, float *y);
+alphasparse_status_t graph_d_record_mv(struct alpha_graph *graph, const alphasparse_operation_t operation, const double alpha, const alphasparse_matrix_t A, const struct alpha_matrix_descr descr, const double *x, const double beta, double *y);
+alphasparse_status_t graph_c_record_mv(struct alpha_graph *graph, const alphasparse_operation_t operation, const ALPHA_Complex8 alpha, const alphasparse_matrix_t A, const struct alpha_matrix_descr descr, const ALPHA_Complex8 *x, const ALPHA_Complex8 beta, ALPHA_Complex8 *y);
+alphasparse_status_t graph_z_record_mv(struct alpha_graph *graph, const alphasparse_operation_t operation, const ALPHA_Complex16 alpha, const alphasparse_matrix_t A, const struct alpha_matrix_descr descr, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+
+alphasparse_status_t graph_s_execute(struct alpha_graph *graph);
+alphasparse_status_t graph_d_execute(struct alpha_graph *graph);
+alphasparse_status_t graph_c_execute(struct alpha_graph *graph);
+alphasparse_status_t graph_z_execute(struct alpha_graph *graph);
+
+// routines and scalar member of the precision being compiled, for the _x_ sources
+#ifndef COMPLEX
+#ifndef DOUBLE
+#define alpha_graph_record_mv graph_s_record_mv
+#define alpha_graph_mv alphasparse_s_mv
+#define ALPHA_GRAPH_SCALAR s
+#else
+#define alpha_graph_record_mv graph_d_record_mv
+#define alpha_graph_mv alphasparse_d_mv
+#define ALPHA_GRAPH_SCALAR d
+#endif
+#else
+#ifndef DOUBLE
+#define alpha_graph_record_mv graph_c_record_mv
+#define alpha_graph_mv alphasparse_c_mv
+#define ALPHA_GRAPH_SCALAR c
+#else
+#define alpha_graph_record_mv graph_z_record_mv
+#define alpha_graph_mv alphasparse_z_mv
+#define ALPHA_GRAPH_SCALAR z
+#endif
+#endif
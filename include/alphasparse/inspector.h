@@ -0,0 +1,153 @@
+#pragma once
+
+/**
+ * @brief header for the per-matrix analysis data kept in alphasparse_matrix::inspector
+ */
+
+#include "spdef.h"
+#include "types.h"
+#include "util/csr_tiles.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+* Position index of the stored entries, built once per handle and reused by
+* every later lookup. Entries are grouped by their major index (row for
+* CSR/COO/BSR, column for CSC) and sorted by their minor index inside a group.
+*
+* n         Number of major lines (block rows for BSR)
+* nnz       Number of indexed entries (blocks for BSR)
+* ptr       Start of each major line in idx and pos, length n + 1
+* idx       Minor index of each entry, sorted ascending within a line
+* pos       Offset of the entry in the values array of the matrix (block number for BSR)
+*/
+typedef struct
+{
+  ALPHA_INT n;
+  ALPHA_OFFSET nnz;
+  ALPHA_OFFSET *ptr;
+  ALPHA_INT *idx;
+  ALPHA_OFFSET *pos;
+} alpha_value_index_t;
+
+/*
+* Values of a complex CSR or BSR matrix split into parts, in the order of the
+* values array. real and imag hold nnz floats or doubles for the precision
+* of the matrix. Changing values in place (set_value, update_values) copies
+* the parts again; a copy marked stale is skipped by the kernels, which read
+* the interleaved values until the next alphasparse_optimize refreshes it.
+*/
+typedef struct
+{
+  ALPHA_OFFSET nnz;
+  void *real;
+  void *imag;
+  bool stale;
+} alpha_split_values_t;
+
+/*
+* Analysis data attached to a matrix handle. It only depends on the sparsity
+* pattern, so it stays valid when values are updated in place.
+*
+* value_index   (row, col) -> values position, used by alphasparse_?_update_values
+* mapping       File mapping the matrix arrays point into (alphasparse_load), NULL
+*               for matrices owning their arrays
+* mapping_size  Length of mapping in bytes
+* value_index_mapped  The arrays of value_index lie in mapping, loaded with the matrix
+* exec_context  Execution context of the calls on this matrix (alphasparse_set_exec_context),
+*               owned by the caller, NULL for the process wide thread count
+* cross_index   The entries grouped by the other index (column for CSR/COO, row for CSC),
+*               pos still into the values of the matrix, built for SpMSpV
+* complex_layout  Layout of the complex values asked for with alphasparse_set_complex_layout_hint
+* split_values  Split copy of the values, built by alphasparse_optimize under ALPHA_SPARSE_COMPLEX_SPLIT
+* view          The matrix arrays belong to another matrix (alphasparse_view_rows), only the
+*               descriptor is released with this matrix
+* mv_tiling     Blocking of mv asked for with alphasparse_set_mv_tiling_hint
+* csr_tiles     Tiled copy of a CSR matrix, built by alphasparse_optimize under ALPHA_SPARSE_MV_TILING_2D
+*/
+typedef struct
+{
+  alpha_value_index_t *value_index;
+  void *mapping;
+  size_t mapping_size;
+  alphasparse_exec_context_t exec_context;
+  alpha_value_index_t *cross_index;
+  alphasparse_complex_layout_t complex_layout;
+  alpha_split_values_t *split_values;
+  bool view;
+  alphasparse_mv_tiling_t mv_tiling;
+  alpha_csr_tiles_t *csr_tiles;
+  bool value_index_mapped;
+} alphasparse_inspector;
+
+typedef alphasparse_inspector *alphasparse_inspector_t;
+
+/* return the inspector of A, creating an empty one on first use */
+alphasparse_inspector_t alphasparse_inspector_get(alphasparse_matrix_t A);
+void alphasparse_inspector_destroy(alphasparse_inspector_t inspector);
+/* execution context attached to A, NULL when A has none */
+alphasparse_exec_context_t alpha_matrix_exec_context(const alphasparse_matrix_t A);
+/*
+ * entries of a CSR, CSC or COO matrix grouped by row (by_row) or by column, the value index or
+ * the cross index of the inspector, built on first use
+ */
+alphasparse_status_t alphasparse_inspector_lines(alphasparse_matrix_t A, const bool by_row, alpha_value_index_t **lines);
+/* the same grouping when it is already built, NULL otherwise */
+const alpha_value_index_t *alphasparse_inspector_lines_built(const alphasparse_matrix_t A, const bool by_row);
+
+/* build or refresh the split values of a complex CSR or BSR matrix */
+alphasparse_status_t alphasparse_inspector_split_values(alphasparse_matrix_t A);
+/* split values of A that match its values, NULL when there are none */
+const alpha_split_values_t *alpha_matrix_split_values(const alphasparse_matrix_t A);
+/* called after the values of A changed in place, refreshes the derived copies of the values */
+void alphasparse_inspector_values_changed(alphasparse_matrix_t A);
+void alpha_split_values_destroy(alpha_split_values_t *split);
+
+/* build or refresh the tiles of a CSR matrix, released when one panel covers every column */
+alphasparse_status_t alphasparse_inspector_csr_tiles(alphasparse_matrix_t A);
+/* tiles of A, NULL when there are none */
+const alpha_csr_tiles_t *alpha_matrix_csr_tiles(const alphasparse_matrix_t A);
+
+/* index of a compressed structure with ALPHA_OFFSET offsets, rows_start/rows_end/col_indx of CSR and BSR */
+alphasparse_status_t alpha_value_index_build_compressed(const ALPHA_INT n,
+                                                       const ALPHA_OFFSET *start,
+                                                       const ALPHA_OFFSET *end,
+                                                       const ALPHA_INT *indx,
+                                                       alpha_value_index_t **index);
+/* same with ALPHA_INT offsets, cols_start/cols_end/row_indx of CSC */
+alphasparse_status_t alpha_value_index_build_compressed_int(const ALPHA_INT n,
+                                                           const ALPHA_INT *start,
+                                                           const ALPHA_INT *end,
+                                                           const ALPHA_INT *indx,
+                                                           alpha_value_index_t **index);
+/* index of a coordinate structure, major is the row index */
+alphasparse_status_t alpha_value_index_build_coo(const ALPHA_INT n,
+                                                const ALPHA_INT nnz,
+                                                const ALPHA_INT *major,
+                                                const ALPHA_INT *minor,
+                                                alpha_value_index_t **index);
+/* regroup index by its minor index, n minor lines, the major indices come out sorted within a line */
+alphasparse_status_t alpha_value_index_build_cross(const alpha_value_index_t *index,
+                                                  const ALPHA_INT n,
+                                                  alpha_value_index_t **cross);
+void alpha_value_index_destroy(alpha_value_index_t *index);
+
+/* position of entry (major, minor), -1 if it is not stored */
+static inline ALPHA_OFFSET alpha_value_index_find(const alpha_value_index_t *index, const ALPHA_INT major, const ALPHA_INT minor)
+{
+  if (major < 0 || major >= index->n)
+    return -1;
+  ALPHA_OFFSET l = index->ptr[major];
+  ALPHA_OFFSET r = index->ptr[major + 1];
+  while (l < r)
+  {
+    ALPHA_OFFSET mid = l + ((r - l) >> 1);
+    if (index->idx[mid] < minor)
+      l = mid + 1;
+    else
+      r = mid;
+  }
+  if (l < index->ptr[major + 1] && index->idx[l] == minor)
+    return index->pos[l];
+  return -1;
+}
@@ -18,6 +18,8 @@
 
 #define gemv_coo gemv_d_coo
 #define gemv_coo_trans gemv_d_coo_trans
+#define gemv_coo_pattern gemv_d_coo_pattern
+#define gemv_coo_pattern_trans gemv_d_coo_pattern_trans
 #define symv_coo_n_lo symv_d_coo_n_lo
 #define symv_coo_u_lo symv_d_coo_u_lo
 #define symv_coo_n_hi symv_d_coo_n_hi
@@ -37,6 +39,10 @@
 #define gemm_coo_col gemm_d_coo_col
 #define gemm_coo_row_trans gemm_d_coo_row_trans
 #define gemm_coo_col_trans gemm_d_coo_col_trans
+#define gemm_coo_pattern_row gemm_d_coo_pattern_row
+#define gemm_coo_pattern_col gemm_d_coo_pattern_col
+#define gemm_coo_pattern_row_trans gemm_d_coo_pattern_row_trans
+#define gemm_coo_pattern_col_trans gemm_d_coo_pattern_col_trans
 #define symm_coo_n_lo_row symm_d_coo_n_lo_row
 #define symm_coo_u_lo_row symm_d_coo_u_lo_row
 #define symm_coo_n_hi_row symm_d_coo_n_hi_row
@@ -117,7 +123,10 @@
 
 #define gemv_csr gemv_d_csr
 #define gemv_csr_trans gemv_d_csr_trans
+#define gemv_csr_tiled gemv_d_csr_tiled
 #define gemv_csr_conj gemv_d_csr_conj
+#define gemv_csr_pattern gemv_d_csr_pattern
+#define gemv_csr_pattern_trans gemv_d_csr_pattern_trans
 #define symv_csr_n_lo symv_d_csr_n_lo
 #define symv_csr_u_lo symv_d_csr_u_lo
 #define symv_csr_n_hi symv_d_csr_n_hi
@@ -143,6 +152,10 @@
 #define gemm_csr_col_trans gemm_d_csr_col_trans
 // #define gemm_csr_row_conj gemm_d_csr_row_conj
 // #define gemm_csr_col_conj gemm_d_csr_col_conj
+#define gemm_csr_pattern_row gemm_d_csr_pattern_row
+#define gemm_csr_pattern_col gemm_d_csr_pattern_col
+#define gemm_csr_pattern_row_trans gemm_d_csr_pattern_row_trans
+#define gemm_csr_pattern_col_trans gemm_d_csr_pattern_col_trans
 #define symm_csr_n_lo_row symm_d_csr_n_lo_row
 #define symm_csr_u_lo_row symm_d_csr_u_lo_row
 #define symm_csr_n_hi_row symm_d_csr_n_hi_row
@@ -190,6 +203,7 @@
 #define spmm_csr spmm_d_csr
 #define spmm_csr_trans spmm_d_csr_trans
 #define spmm_csr_conj spmm_d_csr_conj
+#define spmm_csr_pattern spmm_d_csr_pattern
 
 #define trsv_csr_n_lo trsv_d_csr_n_lo
 #define trsv_csr_u_lo trsv_d_csr_u_lo
@@ -245,6 +259,8 @@
 
 #define gemv_csc gemv_d_csc
 #define gemv_csc_trans gemv_d_csc_trans
+#define gemv_csc_pattern gemv_d_csc_pattern
+#define gemv_csc_pattern_trans gemv_d_csc_pattern_trans
 #define symv_csc_n_lo symv_d_csc_n_lo
 #define symv_csc_u_lo symv_d_csc_u_lo
 #define symv_csc_n_hi symv_d_csc_n_hi
@@ -264,6 +280,10 @@
 #define gemm_csc_col gemm_d_csc_col
 #define gemm_csc_row_trans gemm_d_csc_row_trans
 #define gemm_csc_col_trans gemm_d_csc_col_trans
+#define gemm_csc_pattern_row gemm_d_csc_pattern_row
+#define gemm_csc_pattern_col gemm_d_csc_pattern_col
+#define gemm_csc_pattern_row_trans gemm_d_csc_pattern_row_trans
+#define gemm_csc_pattern_col_trans gemm_d_csc_pattern_col_trans
 #define symm_csc_n_lo_row symm_d_csc_n_lo_row
 #define symm_csc_u_lo_row symm_d_csc_u_lo_row
 #define symm_csc_n_hi_row symm_d_csc_n_hi_row
@@ -623,4 +643,10 @@
 #define diagsm_dia_n_row diagsm_d_dia_n_row
 #define diagsm_dia_u_row diagsm_d_dia_u_row
 #define diagsm_dia_n_col diagsm_d_dia_n_col
-#define diagsm_dia_u_col diagsm_d_dia_u_col
\ No newline at end of file
+#define diagsm_dia_u_col diagsm_d_dia_u_col
+
+// dia_csr
+#define gemv_dia_csr gemv_d_dia_csr
+#define gemv_dia_csr_trans gemv_d_dia_csr_trans
+#define gemm_dia_csr_row gemm_d_dia_csr_row
+#define gemm_dia_csr_col gemm_d_dia_csr_col
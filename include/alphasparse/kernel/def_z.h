@@ -21,6 +21,8 @@
 #define gemv_coo gemv_z_coo
 #define gemv_coo_trans gemv_z_coo_trans
 #define gemv_coo_conj gemv_z_coo_conj
+#define gemv_coo_pattern gemv_z_coo_pattern
+#define gemv_coo_pattern_trans gemv_z_coo_pattern_trans
 #define symv_coo_n_lo symv_z_coo_n_lo
 #define symv_coo_u_lo symv_z_coo_u_lo
 #define symv_coo_n_hi symv_z_coo_n_hi
@@ -58,6 +60,10 @@
 #define gemm_coo_col_trans gemm_z_coo_col_trans
 #define gemm_coo_row_conj gemm_z_coo_row_conj
 #define gemm_coo_col_conj gemm_z_coo_col_conj
+#define gemm_coo_pattern_row gemm_z_coo_pattern_row
+#define gemm_coo_pattern_col gemm_z_coo_pattern_col
+#define gemm_coo_pattern_row_trans gemm_z_coo_pattern_row_trans
+#define gemm_coo_pattern_col_trans gemm_z_coo_pattern_col_trans
 #define symm_coo_n_lo_row symm_z_coo_n_lo_row
 #define symm_coo_u_lo_row symm_z_coo_u_lo_row
 #define symm_coo_n_hi_row symm_z_coo_n_hi_row
@@ -185,7 +191,10 @@
 
 #define gemv_csr gemv_z_csr
 #define gemv_csr_trans gemv_z_csr_trans
+#define gemv_csr_tiled gemv_z_csr_tiled
 #define gemv_csr_conj gemv_z_csr_conj
+#define gemv_csr_pattern gemv_z_csr_pattern
+#define gemv_csr_pattern_trans gemv_z_csr_pattern_trans
 #define symv_csr_n_lo symv_z_csr_n_lo
 #define symv_csr_u_lo symv_z_csr_u_lo
 #define symv_csr_n_hi symv_z_csr_n_hi
@@ -223,6 +232,10 @@
 #define gemm_csr_col_trans gemm_z_csr_col_trans
 #define gemm_csr_row_conj gemm_z_csr_row_conj
 #define gemm_csr_col_conj gemm_z_csr_col_conj
+#define gemm_csr_pattern_row gemm_z_csr_pattern_row
+#define gemm_csr_pattern_col gemm_z_csr_pattern_col
+#define gemm_csr_pattern_row_trans gemm_z_csr_pattern_row_trans
+#define gemm_csr_pattern_col_trans gemm_z_csr_pattern_col_trans
 #define symm_csr_n_lo_row symm_z_csr_n_lo_row
 #define symm_csr_u_lo_row symm_z_csr_u_lo_row
 #define symm_csr_n_hi_row symm_z_csr_n_hi_row
@@ -294,6 +307,7 @@
 #define spmm_csr spmm_z_csr
 #define spmm_csr_trans spmm_z_csr_trans
 #define spmm_csr_conj spmm_z_csr_conj
+#define spmm_csr_pattern spmm_z_csr_pattern
 
 #define trsv_csr_n_lo trsv_z_csr_n_lo
 #define trsv_csr_u_lo trsv_z_csr_u_lo
@@ -351,6 +365,8 @@
 #define gemv_csc gemv_z_csc
 #define gemv_csc_trans gemv_z_csc_trans
 #define gemv_csc_conj gemv_z_csc_conj
+#define gemv_csc_pattern gemv_z_csc_pattern
+#define gemv_csc_pattern_trans gemv_z_csc_pattern_trans
 #define symv_csc_n_lo symv_z_csc_n_lo
 #define symv_csc_u_lo symv_z_csc_u_lo
 #define symv_csc_n_hi symv_z_csc_n_hi
@@ -388,6 +404,10 @@
 #define gemm_csc_col_trans gemm_z_csc_col_trans
 #define gemm_csc_row_conj gemm_z_csc_row_conj
 #define gemm_csc_col_conj gemm_z_csc_col_conj
+#define gemm_csc_pattern_row gemm_z_csc_pattern_row
+#define gemm_csc_pattern_col gemm_z_csc_pattern_col
+#define gemm_csc_pattern_row_trans gemm_z_csc_pattern_row_trans
+#define gemm_csc_pattern_col_trans gemm_z_csc_pattern_col_trans
 #define symm_csc_n_lo_row symm_z_csc_n_lo_row
 #define symm_csc_u_lo_row symm_z_csc_u_lo_row
 #define symm_csc_n_hi_row symm_z_csc_n_hi_row
@@ -976,3 +996,39 @@
 #define diagsm_dia_u_row diagsm_z_dia_u_row
 #define diagsm_dia_n_col diagsm_z_dia_n_col
 #define diagsm_dia_u_col diagsm_z_dia_u_col
+
+#define gemv_csr_split gemv_z_csr_split
+#define gemv_csr_split_trans gemv_z_csr_split_trans
+#define gemv_csr_split_conj gemv_z_csr_split_conj
+#define hermv_csr_split_n_lo hermv_z_csr_split_n_lo
+#define hermv_csr_split_u_lo hermv_z_csr_split_u_lo
+#define hermv_csr_split_n_hi hermv_z_csr_split_n_hi
+#define hermv_csr_split_u_hi hermv_z_csr_split_u_hi
+#define hermv_csr_split_n_lo_trans hermv_z_csr_split_n_lo_trans
+#define hermv_csr_split_u_lo_trans hermv_z_csr_split_u_lo_trans
+#define hermv_csr_split_n_hi_trans hermv_z_csr_split_n_hi_trans
+#define hermv_csr_split_u_hi_trans hermv_z_csr_split_u_hi_trans
+#define trsv_csr_split_n_lo trsv_z_csr_split_n_lo
+#define trsv_csr_split_u_lo trsv_z_csr_split_u_lo
+#define trsv_csr_split_n_hi trsv_z_csr_split_n_hi
+#define trsv_csr_split_u_hi trsv_z_csr_split_u_hi
+#define trsv_csr_split_n_lo_trans trsv_z_csr_split_n_lo_trans
+#define trsv_csr_split_u_lo_trans trsv_z_csr_split_u_lo_trans
+#define trsv_csr_split_n_hi_trans trsv_z_csr_split_n_hi_trans
+#define trsv_csr_split_u_hi_trans trsv_z_csr_split_u_hi_trans
+#define trsv_csr_split_n_lo_conj trsv_z_csr_split_n_lo_conj
+#define trsv_csr_split_u_lo_conj trsv_z_csr_split_u_lo_conj
+#define trsv_csr_split_n_hi_conj trsv_z_csr_split_n_hi_conj
+#define trsv_csr_split_u_hi_conj trsv_z_csr_split_u_hi_conj
+#define gemm_csr_split_row gemm_z_csr_split_row
+#define gemm_csr_split_col gemm_z_csr_split_col
+#define gemm_csr_split_row_trans gemm_z_csr_split_row_trans
+#define gemm_csr_split_row_conj gemm_z_csr_split_row_conj
+#define gemv_bsr_split gemv_z_bsr_split
+
+// dia_csr
+#define gemv_dia_csr gemv_z_dia_csr
+#define gemv_dia_csr_trans gemv_z_dia_csr_trans
+#define gemv_dia_csr_conj gemv_z_dia_csr_conj
+#define gemm_dia_csr_row gemm_z_dia_csr_row
+#define gemm_dia_csr_col gemm_z_dia_csr_col
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../spmat.h"
+#include "../inspector.h"
 
 alphasparse_status_t add_c_bsr(const spmat_bsr_c_t *A, const ALPHA_Complex8 alpha, const spmat_bsr_c_t *B, spmat_bsr_c_t **C);
 alphasparse_status_t add_c_bsr_trans(const spmat_bsr_c_t *A, const ALPHA_Complex8 alpha, const spmat_bsr_c_t *B, spmat_bsr_c_t **C);
@@ -356,6 +357,8 @@ alphasparse_status_t sctr_c(const ALPHA_INT nz, const ALPHA_Complex8* x, const A
 ALPHA_Complex8 doti_c(const ALPHA_INT nz,  const ALPHA_Complex8* x,  const ALPHA_INT* indx, const ALPHA_Complex8* y);
 
 alphasparse_status_t set_value_c_bsr (spmat_bsr_c_t * A, const ALPHA_INT row, const ALPHA_INT col, const ALPHA_Complex8 value);
-alphasparse_status_t update_values_c_bsr (spmat_bsr_c_t * A, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, ALPHA_Complex8 *values);
-
+alphasparse_status_t update_values_c_bsr (spmat_bsr_c_t * A, const alpha_value_index_t *index, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, const ALPHA_Complex8 *values);
 
+// split complex values, the real parts of A->values in re and the imaginary parts in im (alphasparse_optimize)
+// alpha*A*x + beta*y
+alphasparse_status_t gemv_c_bsr_split(const ALPHA_Complex8 alpha, const spmat_bsr_c_t *A, const float *re, const float *im, const ALPHA_Complex8 *x, const ALPHA_Complex8 beta, ALPHA_Complex8 *y);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../spmat.h"
+#include "../inspector.h"
 
 alphasparse_status_t add_d_bsr(const spmat_bsr_d_t *A, const double alpha, const spmat_bsr_d_t *B, spmat_bsr_d_t **C);
 alphasparse_status_t add_d_bsr_trans(const spmat_bsr_d_t *A, const double alpha, const spmat_bsr_d_t *B, spmat_bsr_d_t **C);
@@ -201,6 +202,6 @@ alphasparse_status_t diagsm_d_bsr_n_col(const double alpha, const spmat_bsr_d_t
 // alpha*x
 alphasparse_status_t diagsm_d_bsr_u_col(const double alpha, const spmat_bsr_d_t *A, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, double *y, const ALPHA_INT ldy);
 
-alphasparse_status_t set_value_bsr_d (spmat_bsr_d_t * A, const ALPHA_INT row, const ALPHA_INT col, const double value);
-alphasparse_status_t update_values_bsr_d (spmat_bsr_d_t * A, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, double *values);
+alphasparse_status_t set_value_d_bsr (spmat_bsr_d_t * A, const ALPHA_INT row, const ALPHA_INT col, const double value);
+alphasparse_status_t update_values_d_bsr (spmat_bsr_d_t * A, const alpha_value_index_t *index, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, const double *values);
 
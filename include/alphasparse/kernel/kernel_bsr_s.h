@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../spmat.h"
+#include "../inspector.h"
 
 alphasparse_status_t add_s_bsr(const spmat_bsr_s_t *A, const float alpha, const spmat_bsr_s_t *B, spmat_bsr_s_t **C);
 alphasparse_status_t add_s_bsr_trans(const spmat_bsr_s_t *A, const float alpha, const spmat_bsr_s_t *B, spmat_bsr_s_t **C);
@@ -204,6 +205,6 @@ alphasparse_status_t diagsm_s_bsr_n_col(const float alpha, const spmat_bsr_s_t *
 // alpha*x
 alphasparse_status_t diagsm_s_bsr_u_col(const float alpha, const spmat_bsr_s_t *A, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, float *y, const ALPHA_INT ldy);
 
-alphasparse_status_t set_value_s_bsr (spmat_bsr_c_t * A, const ALPHA_INT row, const ALPHA_INT col, const float value);
-alphasparse_status_t update_values_s_bsr (spmat_bsr_s_t * A, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, float *values);
+alphasparse_status_t set_value_s_bsr (spmat_bsr_s_t * A, const ALPHA_INT row, const ALPHA_INT col, const float value);
+alphasparse_status_t update_values_s_bsr (spmat_bsr_s_t * A, const alpha_value_index_t *index, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, const float *values);
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../spmat.h"
+#include "../inspector.h"
 
 alphasparse_status_t add_z_bsr(const spmat_bsr_z_t *A, const ALPHA_Complex16 alpha, const spmat_bsr_z_t *B, spmat_bsr_z_t **C);
 alphasparse_status_t add_z_bsr_trans(const spmat_bsr_z_t *A, const ALPHA_Complex16 alpha, const spmat_bsr_z_t *B, spmat_bsr_z_t **C);
@@ -356,4 +357,8 @@ alphasparse_status_t sctr_z(const ALPHA_INT nz, const ALPHA_Complex16* x, const
 ALPHA_Complex16 doti_z(const ALPHA_INT nz,  const ALPHA_Complex16* x,  const ALPHA_INT* indx, const ALPHA_Complex16* y);
 
 alphasparse_status_t set_value_z_bsr (spmat_bsr_z_t * A, const ALPHA_INT row, const ALPHA_INT col, const ALPHA_Complex16 value);
-alphasparse_status_t update_values_z_bsr (spmat_bsr_z_t * A, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, ALPHA_Complex16 *values);
+alphasparse_status_t update_values_z_bsr (spmat_bsr_z_t * A, const alpha_value_index_t *index, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, const ALPHA_Complex16 *values);
+
+// split complex values, the real parts of A->values in re and the imaginary parts in im (alphasparse_optimize)
+// alpha*A*x + beta*y
+alphasparse_status_t gemv_z_bsr_split(const ALPHA_Complex16 alpha, const spmat_bsr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../spmat.h"
+#include "../inspector.h"
 
 alphasparse_status_t add_c_coo(const spmat_coo_c_t *A, const ALPHA_Complex8 alpha, const spmat_coo_c_t *B, spmat_coo_c_t **C);
 alphasparse_status_t add_c_coo_trans(const spmat_coo_c_t *A, const ALPHA_Complex8 alpha, const spmat_coo_c_t *B, spmat_coo_c_t **C);
@@ -16,6 +17,11 @@ alphasparse_status_t gemv_c_coo_trans(const ALPHA_Complex8 alpha, const spmat_co
 // alpha*A^H*x + beta*y
 alphasparse_status_t gemv_c_coo_conj(const ALPHA_Complex8 alpha, const spmat_coo_c_t *A, const ALPHA_Complex8 *x, const ALPHA_Complex8 beta, ALPHA_Complex8 *y);
 
+// alpha*A*x + beta*y, A is pattern-only
+alphasparse_status_t gemv_c_coo_pattern(const ALPHA_Complex8 alpha, const spmat_coo_c_t *A, const ALPHA_Complex8 *x, const ALPHA_Complex8 beta, ALPHA_Complex8 *y);
+// alpha*A^T*x + beta*y, A is pattern-only
+alphasparse_status_t gemv_c_coo_pattern_trans(const ALPHA_Complex8 alpha, const spmat_coo_c_t *A, const ALPHA_Complex8 *x, const ALPHA_Complex8 beta, ALPHA_Complex8 *y);
+
 // alpha*(L+D+L')*x + beta*y
 alphasparse_status_t symv_c_coo_n_lo(const ALPHA_Complex8 alpha, const spmat_coo_c_t *A, const ALPHA_Complex8 *x, const ALPHA_Complex8 beta, ALPHA_Complex8 *y);
 // alpha*(L+I+L')*x + beta*y
@@ -78,6 +84,13 @@ alphasparse_status_t gemm_c_coo_col_trans(const ALPHA_Complex8 alpha, const spma
 alphasparse_status_t gemm_c_coo_row_conj(const ALPHA_Complex8 alpha, const spmat_coo_c_t *mat, const ALPHA_Complex8 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex8 beta, ALPHA_Complex8 *y, const ALPHA_INT ldy);
 alphasparse_status_t gemm_c_coo_col_conj(const ALPHA_Complex8 alpha, const spmat_coo_c_t *mat, const ALPHA_Complex8 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex8 beta, ALPHA_Complex8 *y, const ALPHA_INT ldy);
 
+// alpha*A*B + beta*C, A is pattern-only
+alphasparse_status_t gemm_c_coo_pattern_row(const ALPHA_Complex8 alpha, const spmat_coo_c_t *mat, const ALPHA_Complex8 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex8 beta, ALPHA_Complex8 *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_c_coo_pattern_col(const ALPHA_Complex8 alpha, const spmat_coo_c_t *mat, const ALPHA_Complex8 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex8 beta, ALPHA_Complex8 *y, const ALPHA_INT ldy);
+// alpha*A^T*B + beta*C, A is pattern-only
+alphasparse_status_t gemm_c_coo_pattern_row_trans(const ALPHA_Complex8 alpha, const spmat_coo_c_t *mat, const ALPHA_Complex8 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex8 beta, ALPHA_Complex8 *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_c_coo_pattern_col_trans(const ALPHA_Complex8 alpha, const spmat_coo_c_t *mat, const ALPHA_Complex8 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex8 beta, ALPHA_Complex8 *y, const ALPHA_INT ldy);
+
 // alpha*（L+D+L')^T*B + beta*C
 alphasparse_status_t symm_c_coo_n_lo_row(const ALPHA_Complex8 alpha, const spmat_coo_c_t *mat, const ALPHA_Complex8 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex8 beta, ALPHA_Complex8 *y, const ALPHA_INT ldy);
 // alpha*(L+I+L')*B + beta*C
@@ -285,6 +298,7 @@ alphasparse_status_t diagsm_c_coo_n_col(const ALPHA_Complex8 alpha, const spmat_
 alphasparse_status_t diagsm_c_coo_u_col(const ALPHA_Complex8 alpha, const spmat_coo_c_t *A, const ALPHA_Complex8 *x, const ALPHA_INT columns, const ALPHA_INT ldx, ALPHA_Complex8 *y, const ALPHA_INT ldy);
 
 alphasparse_status_t set_value_c_coo (spmat_coo_c_t * A, const ALPHA_INT row, const ALPHA_INT col, const ALPHA_Complex8 value);
+alphasparse_status_t update_values_c_coo (spmat_coo_c_t * A, const alpha_value_index_t *index, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, const ALPHA_Complex8 *values);
 
 alphasparse_status_t
 hermv_c_coo_u_hi(const ALPHA_Complex8 alpha,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../spmat.h"
+#include "../inspector.h"
 
 alphasparse_status_t add_d_coo(const spmat_coo_d_t *A, const double alpha, const spmat_coo_d_t *B, spmat_coo_d_t **C);
 alphasparse_status_t add_d_coo_trans(const spmat_coo_d_t *A, const double alpha, const spmat_coo_d_t *B, spmat_coo_d_t **C);
@@ -13,6 +14,11 @@ alphasparse_status_t gemv_d_coo(const double alpha, const spmat_coo_d_t *A, cons
 // alpha*A^T*x + beta*y
 alphasparse_status_t gemv_d_coo_trans(const double alpha, const spmat_coo_d_t *A, const double *x, const double beta, double *y);
 
+// alpha*A*x + beta*y, A is pattern-only
+alphasparse_status_t gemv_d_coo_pattern(const double alpha, const spmat_coo_d_t *A, const double *x, const double beta, double *y);
+// alpha*A^T*x + beta*y, A is pattern-only
+alphasparse_status_t gemv_d_coo_pattern_trans(const double alpha, const spmat_coo_d_t *A, const double *x, const double beta, double *y);
+
 // alpha*(L+D+L')*x + beta*y
 alphasparse_status_t symv_d_coo_n_lo(const double alpha, const spmat_coo_d_t *A, const double *x, const double beta, double *y);
 // alpha*(L+I+L')*x + beta*y
@@ -56,6 +62,13 @@ alphasparse_status_t gemm_d_coo_col(const double alpha, const spmat_coo_d_t *mat
 alphasparse_status_t gemm_d_coo_row_trans(const double alpha, const spmat_coo_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
 alphasparse_status_t gemm_d_coo_col_trans(const double alpha, const spmat_coo_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
 
+// alpha*A*B + beta*C, A is pattern-only
+alphasparse_status_t gemm_d_coo_pattern_row(const double alpha, const spmat_coo_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_d_coo_pattern_col(const double alpha, const spmat_coo_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
+// alpha*A^T*B + beta*C, A is pattern-only
+alphasparse_status_t gemm_d_coo_pattern_row_trans(const double alpha, const spmat_coo_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_d_coo_pattern_col_trans(const double alpha, const spmat_coo_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
+
 // alpha*（L+D+L')^T*B + beta*C
 alphasparse_status_t symm_d_coo_n_lo_row(const double alpha, const spmat_coo_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
 // alpha*(L+I+L')*B + beta*C
@@ -202,3 +215,4 @@ alphasparse_status_t diagsm_d_coo_n_col(const double alpha, const spmat_coo_d_t
 alphasparse_status_t diagsm_d_coo_u_col(const double alpha, const spmat_coo_d_t *A, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, double *y, const ALPHA_INT ldy);
 
 alphasparse_status_t set_value_d_coo (spmat_coo_d_t * A, const ALPHA_INT row, const ALPHA_INT col, const double value);
+alphasparse_status_t update_values_d_coo (spmat_coo_d_t * A, const alpha_value_index_t *index, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, const double *values);
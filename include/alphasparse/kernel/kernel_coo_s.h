@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../spmat.h"
+#include "../inspector.h"
 
 alphasparse_status_t add_s_coo(const spmat_coo_s_t *A, const float alpha, const spmat_coo_s_t *B, spmat_coo_s_t **C);
 alphasparse_status_t add_s_coo_trans(const spmat_coo_s_t *A, const float alpha, const spmat_coo_s_t *B, spmat_coo_s_t **C);
@@ -13,6 +14,11 @@ alphasparse_status_t gemv_s_coo(const float alpha, const spmat_coo_s_t *A, const
 // alpha*A^T*x + beta*y
 alphasparse_status_t gemv_s_coo_trans(const float alpha, const spmat_coo_s_t *A, const float *x, const float beta, float *y);
 
+// alpha*A*x + beta*y, A is pattern-only
+alphasparse_status_t gemv_s_coo_pattern(const float alpha, const spmat_coo_s_t *A, const float *x, const float beta, float *y);
+// alpha*A^T*x + beta*y, A is pattern-only
+alphasparse_status_t gemv_s_coo_pattern_trans(const float alpha, const spmat_coo_s_t *A, const float *x, const float beta, float *y);
+
 // alpha*(L+D+L')*x + beta*y
 alphasparse_status_t symv_s_coo_n_lo(const float alpha, const spmat_coo_s_t *A, const float *x, const float beta, float *y);
 // alpha*(L+I+L')*x + beta*y
@@ -56,6 +62,13 @@ alphasparse_status_t gemm_s_coo_col(const float alpha, const spmat_coo_s_t *mat,
 alphasparse_status_t gemm_s_coo_row_trans(const float alpha, const spmat_coo_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
 alphasparse_status_t gemm_s_coo_col_trans(const float alpha, const spmat_coo_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
 
+// alpha*A*B + beta*C, A is pattern-only
+alphasparse_status_t gemm_s_coo_pattern_row(const float alpha, const spmat_coo_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_s_coo_pattern_col(const float alpha, const spmat_coo_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
+// alpha*A^T*B + beta*C, A is pattern-only
+alphasparse_status_t gemm_s_coo_pattern_row_trans(const float alpha, const spmat_coo_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_s_coo_pattern_col_trans(const float alpha, const spmat_coo_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
+
 // alpha*（L+D+L')^T*B + beta*C
 alphasparse_status_t symm_s_coo_n_lo_row(const float alpha, const spmat_coo_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
 // alpha*(L+I+L')*B + beta*C
@@ -202,3 +215,4 @@ alphasparse_status_t diagsm_s_coo_n_col(const float alpha, const spmat_coo_s_t *
 alphasparse_status_t diagsm_s_coo_u_col(const float alpha, const spmat_coo_s_t *A, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, float *y, const ALPHA_INT ldy);
 
 alphasparse_status_t set_value_s_coo (spmat_coo_s_t * A, const ALPHA_INT row, const ALPHA_INT col, const float value);
+alphasparse_status_t update_values_s_coo (spmat_coo_s_t * A, const alpha_value_index_t *index, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, const float *values);
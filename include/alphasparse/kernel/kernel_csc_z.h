@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../spmat.h"
+#include "../inspector.h"
 
 alphasparse_status_t add_z_csc(const spmat_csc_z_t *A, const ALPHA_Complex16 alpha, const spmat_csc_z_t *B, spmat_csc_z_t **C);
 alphasparse_status_t add_z_csc_trans(const spmat_csc_z_t *A, const ALPHA_Complex16 alpha, const spmat_csc_z_t *B, spmat_csc_z_t **C);
@@ -16,6 +17,11 @@ alphasparse_status_t gemv_z_csc_trans(const ALPHA_Complex16 alpha, const spmat_c
 // alpha*A^T*x + beta*y
 alphasparse_status_t gemv_z_csc_conj(const ALPHA_Complex16 alpha, const spmat_csc_z_t *A, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
 
+// alpha*A*x + beta*y, A is pattern-only
+alphasparse_status_t gemv_z_csc_pattern(const ALPHA_Complex16 alpha, const spmat_csc_z_t *A, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+// alpha*A^T*x + beta*y, A is pattern-only
+alphasparse_status_t gemv_z_csc_pattern_trans(const ALPHA_Complex16 alpha, const spmat_csc_z_t *A, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+
 // alpha*(L+D+L')*x + beta*y
 alphasparse_status_t symv_z_csc_n_lo(const ALPHA_Complex16 alpha, const spmat_csc_z_t *A, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
 // alpha*(L+I+L')*x + beta*y
@@ -98,6 +104,13 @@ alphasparse_status_t gemm_z_csc_col_trans(const ALPHA_Complex16 alpha, const spm
 alphasparse_status_t gemm_z_csc_row_conj(const ALPHA_Complex16 alpha, const spmat_csc_z_t *mat, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
 alphasparse_status_t gemm_z_csc_col_conj(const ALPHA_Complex16 alpha, const spmat_csc_z_t *mat, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
 
+// alpha*A*B + beta*C, A is pattern-only
+alphasparse_status_t gemm_z_csc_pattern_row(const ALPHA_Complex16 alpha, const spmat_csc_z_t *mat, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_z_csc_pattern_col(const ALPHA_Complex16 alpha, const spmat_csc_z_t *mat, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
+// alpha*A^T*B + beta*C, A is pattern-only
+alphasparse_status_t gemm_z_csc_pattern_row_trans(const ALPHA_Complex16 alpha, const spmat_csc_z_t *mat, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_z_csc_pattern_col_trans(const ALPHA_Complex16 alpha, const spmat_csc_z_t *mat, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
+
 // alpha*（L+D+L')^T*B + beta*C
 alphasparse_status_t symm_z_csc_n_lo_row(const ALPHA_Complex16 alpha, const spmat_csc_z_t *mat, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
 // alpha*(L+I+L')*B + beta*C
@@ -346,3 +359,4 @@ alphasparse_status_t diagsm_z_csc_n_col(const ALPHA_Complex16 alpha, const spmat
 alphasparse_status_t diagsm_z_csc_u_col(const ALPHA_Complex16 alpha, const spmat_csc_z_t *A, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, ALPHA_Complex16 *y, const ALPHA_INT ldy);
 
 alphasparse_status_t set_value_z_csc (spmat_csc_z_t * A, const ALPHA_INT row, const ALPHA_INT col, const ALPHA_Complex16 value);
+alphasparse_status_t update_values_z_csc (spmat_csc_z_t * A, const alpha_value_index_t *index, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, const ALPHA_Complex16 *values);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../spmat.h"
+#include "../inspector.h"
 
 alphasparse_status_t add_d_csr(const spmat_csr_d_t *A, const double alpha, const spmat_csr_d_t *B, spmat_csr_d_t **C);
 alphasparse_status_t add_d_csr_trans(const spmat_csr_d_t *A, const double alpha, const spmat_csr_d_t *B, spmat_csr_d_t **C);
@@ -13,9 +14,16 @@ alphasparse_status_t add_d_csr_conj(const spmat_csr_d_t *A, const double alpha,
 alphasparse_status_t gemv_d_csr(const double alpha, const spmat_csr_d_t *A, const double *x, const double beta, double *y);
 // alpha*A^T*x + beta*y
 alphasparse_status_t gemv_d_csr_trans(const double alpha, const spmat_csr_d_t *A, const double *x, const double beta, double *y);
+// alpha*A*x + beta*y over the row blocks and column panels of tiles (alphasparse_optimize)
+alphasparse_status_t gemv_d_csr_tiled(const double alpha, const spmat_csr_d_t *A, const alpha_csr_tiles_t *tiles, const double *x, const double beta, double *y);
 // alpha*A^T*x + beta*y
 alphasparse_status_t gemv_d_csr_conj(const double alpha, const spmat_csr_d_t *A, const double *x, const double beta, double *y);
 
+// alpha*A*x + beta*y, A is pattern-only
+alphasparse_status_t gemv_d_csr_pattern(const double alpha, const spmat_csr_d_t *A, const double *x, const double beta, double *y);
+// alpha*A^T*x + beta*y, A is pattern-only
+alphasparse_status_t gemv_d_csr_pattern_trans(const double alpha, const spmat_csr_d_t *A, const double *x, const double beta, double *y);
+
 // alpha*(L+D+L')*x + beta*y
 alphasparse_status_t symv_d_csr_n_lo(const double alpha, const spmat_csr_d_t *A, const double *x, const double beta, double *y);
 // alpha*(L+I+L')*x + beta*y
@@ -71,6 +79,13 @@ alphasparse_status_t gemm_d_csr_col_trans(const double alpha, const spmat_csr_d_
 alphasparse_status_t gemm_d_csr_row_conj(const double alpha, const spmat_csr_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
 alphasparse_status_t gemm_d_csr_col_conj(const double alpha, const spmat_csr_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
 
+// alpha*A*B + beta*C, A is pattern-only
+alphasparse_status_t gemm_d_csr_pattern_row(const double alpha, const spmat_csr_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_d_csr_pattern_col(const double alpha, const spmat_csr_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
+// alpha*A^T*B + beta*C, A is pattern-only
+alphasparse_status_t gemm_d_csr_pattern_row_trans(const double alpha, const spmat_csr_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_d_csr_pattern_col_trans(const double alpha, const spmat_csr_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
+
 // alpha*（L+D+L')^T*B + beta*C
 alphasparse_status_t symm_d_csr_n_lo_row(const double alpha, const spmat_csr_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
 // alpha*(L+I+L')*B + beta*C
@@ -171,6 +186,8 @@ alphasparse_status_t spmmd_d_csr_col_conj(const spmat_csr_d_t *matA, const spmat
 alphasparse_status_t spmm_d_csr(const spmat_csr_d_t *A, const spmat_csr_d_t *B, spmat_csr_d_t **C);
 alphasparse_status_t spmm_d_csr_trans(const spmat_csr_d_t *A, const spmat_csr_d_t *B, spmat_csr_d_t **C);
 alphasparse_status_t spmm_d_csr_conj(const spmat_csr_d_t *A, const spmat_csr_d_t *B, spmat_csr_d_t **C);
+// A or B may be pattern-only (values == NULL), the product always carries values
+alphasparse_status_t spmm_d_csr_pattern(const spmat_csr_d_t *A, const spmat_csr_d_t *B, spmat_csr_d_t **C);
 
 // -----------------------------------------------------------------------------------------------------
 
@@ -264,4 +281,5 @@ alphasparse_status_t diagsm_d_csr_n_col(const double alpha, const spmat_csr_d_t
 // alpha*x
 alphasparse_status_t diagsm_d_csr_u_col(const double alpha, const spmat_csr_d_t *A, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, double *y, const ALPHA_INT ldy);
 
-alphasparse_status_t set_value_d_csr (spmat_csr_d_t * A, const ALPHA_INT row, const ALPHA_INT col, const double value);
\ No newline at end of file
+alphasparse_status_t set_value_d_csr (spmat_csr_d_t * A, const ALPHA_INT row, const ALPHA_INT col, const double value);
+alphasparse_status_t update_values_d_csr (spmat_csr_d_t * A, const alpha_value_index_t *index, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, const double *values);
\ No newline at end of file
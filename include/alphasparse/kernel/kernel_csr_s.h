@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../spmat.h"
+#include "../inspector.h"
 
 alphasparse_status_t add_s_csr(const spmat_csr_s_t *A, const float alpha, const spmat_csr_s_t *B, spmat_csr_s_t **C);
 alphasparse_status_t add_s_csr_trans(const spmat_csr_s_t *A, const float alpha, const spmat_csr_s_t *B, spmat_csr_s_t **C);
@@ -13,9 +14,16 @@ alphasparse_status_t add_s_csr_conj(const spmat_csr_s_t *A, const float alpha, c
 alphasparse_status_t gemv_s_csr(const float alpha, const spmat_csr_s_t *A, const float *x, const float beta, float *y);
 // alpha*A^T*x + beta*y
 alphasparse_status_t gemv_s_csr_trans(const float alpha, const spmat_csr_s_t *A, const float *x, const float beta, float *y);
+// alpha*A*x + beta*y over the row blocks and column panels of tiles (alphasparse_optimize)
+alphasparse_status_t gemv_s_csr_tiled(const float alpha, const spmat_csr_s_t *A, const alpha_csr_tiles_t *tiles, const float *x, const float beta, float *y);
 // alpha*A^T*x + beta*y
 alphasparse_status_t gemv_s_csr_conj(const float alpha, const spmat_csr_s_t *A, const float *x, const float beta, float *y);
 
+// alpha*A*x + beta*y, A is pattern-only
+alphasparse_status_t gemv_s_csr_pattern(const float alpha, const spmat_csr_s_t *A, const float *x, const float beta, float *y);
+// alpha*A^T*x + beta*y, A is pattern-only
+alphasparse_status_t gemv_s_csr_pattern_trans(const float alpha, const spmat_csr_s_t *A, const float *x, const float beta, float *y);
+
 // alpha*(L+D+L')*x + beta*y
 alphasparse_status_t symv_s_csr_n_lo(const float alpha, const spmat_csr_s_t *A, const float *x, const float beta, float *y);
 // alpha*(L+I+L')*x + beta*y
@@ -71,6 +79,13 @@ alphasparse_status_t gemm_s_csr_col_trans(const float alpha, const spmat_csr_s_t
 alphasparse_status_t gemm_s_csr_row_conj(const float alpha, const spmat_csr_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
 alphasparse_status_t gemm_s_csr_col_conj(const float alpha, const spmat_csr_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
 
+// alpha*A*B + beta*C, A is pattern-only
+alphasparse_status_t gemm_s_csr_pattern_row(const float alpha, const spmat_csr_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_s_csr_pattern_col(const float alpha, const spmat_csr_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
+// alpha*A^T*B + beta*C, A is pattern-only
+alphasparse_status_t gemm_s_csr_pattern_row_trans(const float alpha, const spmat_csr_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_s_csr_pattern_col_trans(const float alpha, const spmat_csr_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
+
 // alpha*（L+D+L')^T*B + beta*C
 alphasparse_status_t symm_s_csr_n_lo_row(const float alpha, const spmat_csr_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
 // alpha*(L+I+L')*B + beta*C
@@ -171,6 +186,8 @@ alphasparse_status_t spmmd_s_csr_col_conj(const spmat_csr_s_t *matA, const spmat
 alphasparse_status_t spmm_s_csr(const spmat_csr_s_t *A, const spmat_csr_s_t *B, spmat_csr_s_t **C);
 alphasparse_status_t spmm_s_csr_trans(const spmat_csr_s_t *A, const spmat_csr_s_t *B, spmat_csr_s_t **C);
 alphasparse_status_t spmm_s_csr_conj(const spmat_csr_s_t *A, const spmat_csr_s_t *B, spmat_csr_s_t **C);
+// A or B may be pattern-only (values == NULL), the product always carries values
+alphasparse_status_t spmm_s_csr_pattern(const spmat_csr_s_t *A, const spmat_csr_s_t *B, spmat_csr_s_t **C);
 
 // -----------------------------------------------------------------------------------------------------
 
@@ -264,4 +281,5 @@ alphasparse_status_t diagsm_s_csr_n_col(const float alpha, const spmat_csr_s_t *
 // alpha*x
 alphasparse_status_t diagsm_s_csr_u_col(const float alpha, const spmat_csr_s_t *A, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, float *y, const ALPHA_INT ldy);
 
-alphasparse_status_t set_value_s_csr (spmat_csr_s_t * A, const ALPHA_INT row, const ALPHA_INT col, const float value);
\ No newline at end of file
+alphasparse_status_t set_value_s_csr (spmat_csr_s_t * A, const ALPHA_INT row, const ALPHA_INT col, const float value);
+alphasparse_status_t update_values_s_csr (spmat_csr_s_t * A, const alpha_value_index_t *index, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, const float *values);
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../spmat.h"
+#include "../inspector.h"
 
 alphasparse_status_t add_z_csr(const spmat_csr_z_t *A, const ALPHA_Complex16 alpha, const spmat_csr_z_t *B, spmat_csr_z_t **C);
 alphasparse_status_t add_z_csr_trans(const spmat_csr_z_t *A, const ALPHA_Complex16 alpha, const spmat_csr_z_t *B, spmat_csr_z_t **C);
@@ -13,9 +14,16 @@ alphasparse_status_t add_z_csr_conj(const spmat_csr_z_t *A, const ALPHA_Complex1
 alphasparse_status_t gemv_z_csr(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
 // alpha*A^T*x + beta*y
 alphasparse_status_t gemv_z_csr_trans(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+// alpha*A*x + beta*y over the row blocks and column panels of tiles (alphasparse_optimize)
+alphasparse_status_t gemv_z_csr_tiled(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const alpha_csr_tiles_t *tiles, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
 // alpha*A^T*x + beta*y
 alphasparse_status_t gemv_z_csr_conj(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
 
+// alpha*A*x + beta*y, A is pattern-only
+alphasparse_status_t gemv_z_csr_pattern(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+// alpha*A^T*x + beta*y, A is pattern-only
+alphasparse_status_t gemv_z_csr_pattern_trans(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+
 // alpha*(L+D+L')*x + beta*y
 alphasparse_status_t symv_z_csr_n_lo(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
 // alpha*(L+I+L')*x + beta*y
@@ -97,6 +105,13 @@ alphasparse_status_t gemm_z_csr_col_trans(const ALPHA_Complex16 alpha, const spm
 alphasparse_status_t gemm_z_csr_row_conj(const ALPHA_Complex16 alpha, const spmat_csr_z_t *mat, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
 alphasparse_status_t gemm_z_csr_col_conj(const ALPHA_Complex16 alpha, const spmat_csr_z_t *mat, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
 
+// alpha*A*B + beta*C, A is pattern-only
+alphasparse_status_t gemm_z_csr_pattern_row(const ALPHA_Complex16 alpha, const spmat_csr_z_t *mat, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_z_csr_pattern_col(const ALPHA_Complex16 alpha, const spmat_csr_z_t *mat, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
+// alpha*A^T*B + beta*C, A is pattern-only
+alphasparse_status_t gemm_z_csr_pattern_row_trans(const ALPHA_Complex16 alpha, const spmat_csr_z_t *mat, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_z_csr_pattern_col_trans(const ALPHA_Complex16 alpha, const spmat_csr_z_t *mat, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
+
 // alpha*（L+D+L')^T*B + beta*C
 alphasparse_status_t symm_z_csr_n_lo_row(const ALPHA_Complex16 alpha, const spmat_csr_z_t *mat, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
 // alpha*(L+I+L')*B + beta*C
@@ -251,6 +266,8 @@ alphasparse_status_t spmmd_z_csr_col_conj(const spmat_csr_z_t *matA, const spmat
 alphasparse_status_t spmm_z_csr(const spmat_csr_z_t *A, const spmat_csr_z_t *B, spmat_csr_z_t **C);
 alphasparse_status_t spmm_z_csr_trans(const spmat_csr_z_t *A, const spmat_csr_z_t *B, spmat_csr_z_t **C);
 alphasparse_status_t spmm_z_csr_conj(const spmat_csr_z_t *A, const spmat_csr_z_t *B, spmat_csr_z_t **C);
+// A or B may be pattern-only (values == NULL), the product always carries values
+alphasparse_status_t spmm_z_csr_pattern(const spmat_csr_z_t *A, const spmat_csr_z_t *B, spmat_csr_z_t **C);
 
 // -----------------------------------------------------------------------------------------------------
 
@@ -344,4 +361,60 @@ alphasparse_status_t diagsm_z_csr_n_col(const ALPHA_Complex16 alpha, const spmat
 // alpha*x
 alphasparse_status_t diagsm_z_csr_u_col(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, ALPHA_Complex16 *y, const ALPHA_INT ldy);
 
-alphasparse_status_t set_value_z_csr (spmat_csr_z_t * A, const ALPHA_INT row, const ALPHA_INT col, const ALPHA_Complex16 value);
\ No newline at end of file
+alphasparse_status_t set_value_z_csr (spmat_csr_z_t * A, const ALPHA_INT row, const ALPHA_INT col, const ALPHA_Complex16 value);
+alphasparse_status_t update_values_z_csr (spmat_csr_z_t * A, const alpha_value_index_t *index, const ALPHA_INT nvalues, const ALPHA_INT *indx, const ALPHA_INT *indy, const ALPHA_Complex16 *values);
+
+// split complex values, the real parts of A->values in re and the imaginary parts in im (alphasparse_optimize)
+// alpha*A*x + beta*y
+alphasparse_status_t gemv_z_csr_split(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+// alpha*A^T*x + beta*y
+alphasparse_status_t gemv_z_csr_split_trans(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+// alpha*A^H*x + beta*y
+alphasparse_status_t gemv_z_csr_split_conj(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+// alpha*(L+D+L')*x + beta*y
+alphasparse_status_t hermv_z_csr_split_n_lo(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+// alpha*(L+I+L')*x + beta*y
+alphasparse_status_t hermv_z_csr_split_u_lo(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+// alpha*(U'+D+U)*x + beta*y
+alphasparse_status_t hermv_z_csr_split_n_hi(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+// alpha*(U'+I+U)*x + beta*y
+alphasparse_status_t hermv_z_csr_split_u_hi(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+// alpha*(L+D+L')^T*x + beta*y
+alphasparse_status_t hermv_z_csr_split_n_lo_trans(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+// alpha*(L+I+L')^T*x + beta*y
+alphasparse_status_t hermv_z_csr_split_u_lo_trans(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+// alpha*(U'+D+U)^T*x + beta*y
+alphasparse_status_t hermv_z_csr_split_n_hi_trans(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+// alpha*(U'+I+U)^T*x + beta*y
+alphasparse_status_t hermv_z_csr_split_u_hi_trans(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+// (L+D)^-1*alpha*x
+alphasparse_status_t trsv_z_csr_split_n_lo(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, ALPHA_Complex16 *y);
+// (L+I)^-1*alpha*x
+alphasparse_status_t trsv_z_csr_split_u_lo(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, ALPHA_Complex16 *y);
+// (U+D)^-1*alpha*x
+alphasparse_status_t trsv_z_csr_split_n_hi(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, ALPHA_Complex16 *y);
+// (U+I)^-1*alpha*x
+alphasparse_status_t trsv_z_csr_split_u_hi(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, ALPHA_Complex16 *y);
+// (L+D)^T^-1*alpha*x
+alphasparse_status_t trsv_z_csr_split_n_lo_trans(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, ALPHA_Complex16 *y);
+// (L+I)^T^-1*alpha*x
+alphasparse_status_t trsv_z_csr_split_u_lo_trans(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, ALPHA_Complex16 *y);
+// (U+D)^T^-1*alpha*x
+alphasparse_status_t trsv_z_csr_split_n_hi_trans(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, ALPHA_Complex16 *y);
+// (U+I)^T^-1*alpha*x
+alphasparse_status_t trsv_z_csr_split_u_hi_trans(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, ALPHA_Complex16 *y);
+// (L+D)^H^-1*alpha*x
+alphasparse_status_t trsv_z_csr_split_n_lo_conj(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, ALPHA_Complex16 *y);
+// (L+I)^H^-1*alpha*x
+alphasparse_status_t trsv_z_csr_split_u_lo_conj(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, ALPHA_Complex16 *y);
+// (U+D)^H^-1*alpha*x
+alphasparse_status_t trsv_z_csr_split_n_hi_conj(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, ALPHA_Complex16 *y);
+// (U+I)^H^-1*alpha*x
+alphasparse_status_t trsv_z_csr_split_u_hi_conj(const ALPHA_Complex16 alpha, const spmat_csr_z_t *A, const double *re, const double *im, const ALPHA_Complex16 *x, ALPHA_Complex16 *y);
+// alpha*A*B + beta*C
+alphasparse_status_t gemm_z_csr_split_row(const ALPHA_Complex16 alpha, const spmat_csr_z_t *mat, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_z_csr_split_col(const ALPHA_Complex16 alpha, const spmat_csr_z_t *mat, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
+// alpha*A^T*B + beta*C
+alphasparse_status_t gemm_z_csr_split_row_trans(const ALPHA_Complex16 alpha, const spmat_csr_z_t *mat, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
+// alpha*A^H*B + beta*C
+alphasparse_status_t gemm_z_csr_split_row_conj(const ALPHA_Complex16 alpha, const spmat_csr_z_t *mat, const double *re, const double *im, const ALPHA_Complex16 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex16 beta, ALPHA_Complex16 *y, const ALPHA_INT ldy);
@@ -346,3 +346,10 @@ alphasparse_status_t diagsm_c_dia_n_col(const ALPHA_Complex8 alpha, const spmat_
 alphasparse_status_t diagsm_c_dia_u_col(const ALPHA_Complex8 alpha, const spmat_dia_c_t *A, const ALPHA_Complex8 *x, const ALPHA_INT columns, const ALPHA_INT ldx, ALPHA_Complex8 *y, const ALPHA_INT ldy);
 
 alphasparse_status_t set_value_c_dia (spmat_dia_c_t * A, const ALPHA_INT row, const ALPHA_INT col, const ALPHA_Complex8 value);
+
+// dense diagonals of A in DIA and the rest in a CSR tail, see alphasparse_convert_dia_csr
+alphasparse_status_t gemv_c_dia_csr(const ALPHA_Complex8 alpha, const spmat_dia_csr_c_t *A, const ALPHA_Complex8 *x, const ALPHA_Complex8 beta, ALPHA_Complex8 *y);
+alphasparse_status_t gemv_c_dia_csr_trans(const ALPHA_Complex8 alpha, const spmat_dia_csr_c_t *A, const ALPHA_Complex8 *x, const ALPHA_Complex8 beta, ALPHA_Complex8 *y);
+alphasparse_status_t gemv_c_dia_csr_conj(const ALPHA_Complex8 alpha, const spmat_dia_csr_c_t *A, const ALPHA_Complex8 *x, const ALPHA_Complex8 beta, ALPHA_Complex8 *y);
+alphasparse_status_t gemm_c_dia_csr_row(const ALPHA_Complex8 alpha, const spmat_dia_csr_c_t *mat, const ALPHA_Complex8 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex8 beta, ALPHA_Complex8 *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_c_dia_csr_col(const ALPHA_Complex8 alpha, const spmat_dia_csr_c_t *mat, const ALPHA_Complex8 *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex8 beta, ALPHA_Complex8 *y, const ALPHA_INT ldy);
@@ -201,4 +201,10 @@ alphasparse_status_t diagsm_d_dia_n_col(const double alpha, const spmat_dia_d_t
 // alpha*x
 alphasparse_status_t diagsm_d_dia_u_col(const double alpha, const spmat_dia_d_t *A, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, double *y, const ALPHA_INT ldy);
 
-alphasparse_status_t set_value_d_dia (spmat_dia_d_t * A, const ALPHA_INT row, const ALPHA_INT col, const double value);
\ No newline at end of file
+alphasparse_status_t set_value_d_dia (spmat_dia_d_t * A, const ALPHA_INT row, const ALPHA_INT col, const double value);
+
+// dense diagonals of A in DIA and the rest in a CSR tail, see alphasparse_convert_dia_csr
+alphasparse_status_t gemv_d_dia_csr(const double alpha, const spmat_dia_csr_d_t *A, const double *x, const double beta, double *y);
+alphasparse_status_t gemv_d_dia_csr_trans(const double alpha, const spmat_dia_csr_d_t *A, const double *x, const double beta, double *y);
+alphasparse_status_t gemm_d_dia_csr_row(const double alpha, const spmat_dia_csr_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_d_dia_csr_col(const double alpha, const spmat_dia_csr_d_t *mat, const double *x, const ALPHA_INT columns, const ALPHA_INT ldx, const double beta, double *y, const ALPHA_INT ldy);
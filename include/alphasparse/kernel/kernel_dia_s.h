@@ -201,4 +201,10 @@ alphasparse_status_t diagsm_s_dia_n_col(const float alpha, const spmat_dia_s_t *
 // alpha*x
 alphasparse_status_t diagsm_s_dia_u_col(const float alpha, const spmat_dia_s_t *A, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, float *y, const ALPHA_INT ldy);
 
-alphasparse_status_t set_value_s_dia (spmat_dia_s_t * A, const ALPHA_INT row, const ALPHA_INT col, const float value);
\ No newline at end of file
+alphasparse_status_t set_value_s_dia (spmat_dia_s_t * A, const ALPHA_INT row, const ALPHA_INT col, const float value);
+
+// dense diagonals of A in DIA and the rest in a CSR tail, see alphasparse_convert_dia_csr
+alphasparse_status_t gemv_s_dia_csr(const float alpha, const spmat_dia_csr_s_t *A, const float *x, const float beta, float *y);
+alphasparse_status_t gemv_s_dia_csr_trans(const float alpha, const spmat_dia_csr_s_t *A, const float *x, const float beta, float *y);
+alphasparse_status_t gemm_s_dia_csr_row(const float alpha, const spmat_dia_csr_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
+alphasparse_status_t gemm_s_dia_csr_col(const float alpha, const spmat_dia_csr_s_t *mat, const float *x, const ALPHA_INT columns, const ALPHA_INT ldx, const float beta, float *y, const ALPHA_INT ldy);
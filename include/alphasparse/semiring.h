@@ -0,0 +1,50 @@
+#pragma once
+
+/**
+ * @brief header for the built-in semirings of the semiring kernels
+ *
+ * A semiring kernel is written once as an always inlined body taking add,
+ * multiply, the identity of add and a test for its absorbing element, and
+ * ALPHA_SEMIRING_LIST stamps out one instance per semiring with constant
+ * operators, so every instance is compiled with its operators inlined.
+ * Included by the _f_ sources, ALPHA_Number is the real type being compiled.
+ */
+
+#include "spdef.h"
+#include "types.h"
+#include <float.h>
+#include <stdbool.h>
+
+// largest value of the type, the identity of min; -Ofast assumes finite math, so no infinities
+#ifdef DOUBLE
+#define ALPHA_SEMIRING_MAX DBL_MAX
+#else
+#define ALPHA_SEMIRING_MAX FLT_MAX
+#endif
+
+#define ALPHA_SEMIRING_INLINE static inline __attribute__((always_inline))
+
+typedef ALPHA_Number (*alpha_semiring_op_t)(const ALPHA_Number a, const ALPHA_Number b);
+// whether acc holds the absorbing element of add, so no further entry can change it
+typedef bool (*alpha_semiring_absorbed_t)(const ALPHA_Number acc);
+
+ALPHA_SEMIRING_INLINE ALPHA_Number semiring_plus(const ALPHA_Number a, const ALPHA_Number b) { return a + b; }
+ALPHA_SEMIRING_INLINE ALPHA_Number semiring_times(const ALPHA_Number a, const ALPHA_Number b) { return a * b; }
+ALPHA_SEMIRING_INLINE ALPHA_Number semiring_min(const ALPHA_Number a, const ALPHA_Number b) { return a < b ? a : b; }
+ALPHA_SEMIRING_INLINE ALPHA_Number semiring_max(const ALPHA_Number a, const ALPHA_Number b) { return a > b ? a : b; }
+ALPHA_SEMIRING_INLINE ALPHA_Number semiring_lor(const ALPHA_Number a, const ALPHA_Number b) { return (a != 0 || b != 0) ? 1 : 0; }
+ALPHA_SEMIRING_INLINE ALPHA_Number semiring_land(const ALPHA_Number a, const ALPHA_Number b) { return (a != 0 && b != 0) ? 1 : 0; }
+ALPHA_SEMIRING_INLINE bool semiring_never(const ALPHA_Number acc) { return false; }
+ALPHA_SEMIRING_INLINE bool semiring_true(const ALPHA_Number acc) { return acc != 0; }
+
+/*
+* X(name, add, multiply, identity of add, absorbed) for every built-in
+* semiring, name completes ALPHA_SPARSE_SEMIRING_ and the instance names
+*/
+#define ALPHA_SEMIRING_LIST(X)                                                               \
+    X(PLUS_TIMES, semiring_plus, semiring_times, 0, semiring_never)                         \
+    X(MIN_PLUS, semiring_min, semiring_plus, ALPHA_SEMIRING_MAX, semiring_never)            \
+    X(MAX_PLUS, semiring_max, semiring_plus, -ALPHA_SEMIRING_MAX, semiring_never)           \
+    X(MAX_TIMES, semiring_max, semiring_times, -ALPHA_SEMIRING_MAX, semiring_never)         \
+    X(LOR_LAND, semiring_lor, semiring_land, 0, semiring_true)                              \
+    X(PLUS_MIN, semiring_plus, semiring_min, 0, semiring_never)
@@ -7,6 +7,9 @@
 
 #include "spdef.h"
 #include "types.h"
+#include "trace.h"
+#include "util/steal.h"
+#include <stddef.h>
 
 /**
  * ----------------------------------------------------------------------------
@@ -33,6 +36,13 @@ alphasparse_status_t alphasparse_convert_dia(const alphasparse_matrix_t source,
                                            const alphasparse_operation_t operation,
                                            alphasparse_matrix_t *dest);
 
+/* DIA for the diagonals whose entries fill more than fill_threshold (0 to 1) of their length, CSR for the rest;
+   0 keeps every occupied diagonal in DIA, 1 puts everything in CSR */
+alphasparse_status_t alphasparse_convert_dia_csr(const alphasparse_matrix_t source,
+                                               const alphasparse_operation_t operation,
+                                               const double fill_threshold,
+                                               alphasparse_matrix_t *dest);
+
 alphasparse_status_t alphasparse_convert_ell(const alphasparse_matrix_t source,
                                            const alphasparse_operation_t operation,
                                            alphasparse_matrix_t *dest);
@@ -45,6 +55,16 @@ alphasparse_status_t alphasparse_convert_csr5(const alphasparse_matrix_t source,
                                            const alphasparse_operation_t operation,
                                            alphasparse_matrix_t *dest);
 
+/* fails with INVALID_VALUE unless every stored value of the COO/CSR/CSC source is one */
+alphasparse_status_t alphasparse_convert_pattern(const alphasparse_matrix_t source,
+                                               alphasparse_matrix_t *dest);
+
+/* write a CSR, pattern-only CSR or BSR matrix to file in the layout of alphasparse/binary.h */
+alphasparse_status_t alphasparse_save(const alphasparse_matrix_t A, const char *file);
+
+/* map a file written by alphasparse_save, the arrays of A point into the mapping until it is destroyed */
+alphasparse_status_t alphasparse_load(const char *file, alphasparse_matrix_t *A);
+
 alphasparse_status_t alphasparse_convert_hints_bsr(const alphasparse_matrix_t source, /* convert original matrix to BSR representation */
                                                  const ALPHA_INT block_size,
                                                  const alphasparse_layout_t block_layout, /* block storage: row-major or column-major */
@@ -141,8 +161,8 @@ alphasparse_status_t alphasparse_s_create_csr(alphasparse_matrix_t *A,
                                             const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
                                             const ALPHA_INT rows,
                                             const ALPHA_INT cols,
-                                            ALPHA_INT *rows_start,
-                                            ALPHA_INT *rows_end,
+                                            ALPHA_OFFSET *rows_start,
+                                            ALPHA_OFFSET *rows_end,
                                             ALPHA_INT *col_indx,
                                             float *values);
 
@@ -150,8 +170,8 @@ alphasparse_status_t alphasparse_d_create_csr(alphasparse_matrix_t *A,
                                             const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
                                             const ALPHA_INT rows,
                                             const ALPHA_INT cols,
-                                            ALPHA_INT *rows_start,
-                                            ALPHA_INT *rows_end,
+                                            ALPHA_OFFSET *rows_start,
+                                            ALPHA_OFFSET *rows_end,
                                             ALPHA_INT *col_indx,
                                             double *values);
 
@@ -159,8 +179,8 @@ alphasparse_status_t alphasparse_c_create_csr(alphasparse_matrix_t *A,
                                             const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
                                             const ALPHA_INT rows,
                                             const ALPHA_INT cols,
-                                            ALPHA_INT *rows_start,
-                                            ALPHA_INT *rows_end,
+                                            ALPHA_OFFSET *rows_start,
+                                            ALPHA_OFFSET *rows_end,
                                             ALPHA_INT *col_indx,
                                             ALPHA_Complex8 *values);
 
@@ -168,8 +188,8 @@ alphasparse_status_t alphasparse_z_create_csr(alphasparse_matrix_t *A,
                                             const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
                                             const ALPHA_INT rows,
                                             const ALPHA_INT cols,
-                                            ALPHA_INT *rows_start,
-                                            ALPHA_INT *rows_end,
+                                            ALPHA_OFFSET *rows_start,
+                                            ALPHA_OFFSET *rows_end,
                                             ALPHA_INT *col_indx,
                                             ALPHA_Complex16 *values);
 
@@ -219,6 +239,173 @@ alphasparse_status_t alphasparse_z_create_csc(alphasparse_matrix_t *A,
                                             ALPHA_INT *row_indx,
                                             ALPHA_Complex16 *values);
 
+/*
+    pattern-only formats, every stored entry is an implicit one and no values array is kept,
+    the datatype only selects the precision of x/y and B/C in later operations
+*/
+alphasparse_status_t alphasparse_s_create_coo_pattern(alphasparse_matrix_t *A,
+                                                      const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      const ALPHA_INT nnz,
+                                                      ALPHA_INT *row_indx,
+                                                      ALPHA_INT *col_indx);
+
+alphasparse_status_t alphasparse_d_create_coo_pattern(alphasparse_matrix_t *A,
+                                                      const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      const ALPHA_INT nnz,
+                                                      ALPHA_INT *row_indx,
+                                                      ALPHA_INT *col_indx);
+
+alphasparse_status_t alphasparse_c_create_coo_pattern(alphasparse_matrix_t *A,
+                                                      const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      const ALPHA_INT nnz,
+                                                      ALPHA_INT *row_indx,
+                                                      ALPHA_INT *col_indx);
+
+alphasparse_status_t alphasparse_z_create_coo_pattern(alphasparse_matrix_t *A,
+                                                      const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      const ALPHA_INT nnz,
+                                                      ALPHA_INT *row_indx,
+                                                      ALPHA_INT *col_indx);
+
+alphasparse_status_t alphasparse_s_create_csr_pattern(alphasparse_matrix_t *A,
+                                                      const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      ALPHA_OFFSET *rows_start,
+                                                      ALPHA_OFFSET *rows_end,
+                                                      ALPHA_INT *col_indx);
+
+alphasparse_status_t alphasparse_d_create_csr_pattern(alphasparse_matrix_t *A,
+                                                      const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      ALPHA_OFFSET *rows_start,
+                                                      ALPHA_OFFSET *rows_end,
+                                                      ALPHA_INT *col_indx);
+
+alphasparse_status_t alphasparse_c_create_csr_pattern(alphasparse_matrix_t *A,
+                                                      const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      ALPHA_OFFSET *rows_start,
+                                                      ALPHA_OFFSET *rows_end,
+                                                      ALPHA_INT *col_indx);
+
+alphasparse_status_t alphasparse_z_create_csr_pattern(alphasparse_matrix_t *A,
+                                                      const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      ALPHA_OFFSET *rows_start,
+                                                      ALPHA_OFFSET *rows_end,
+                                                      ALPHA_INT *col_indx);
+
+alphasparse_status_t alphasparse_s_create_csc_pattern(alphasparse_matrix_t *A,
+                                                      const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      ALPHA_INT *cols_start,
+                                                      ALPHA_INT *cols_end,
+                                                      ALPHA_INT *row_indx);
+
+alphasparse_status_t alphasparse_d_create_csc_pattern(alphasparse_matrix_t *A,
+                                                      const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      ALPHA_INT *cols_start,
+                                                      ALPHA_INT *cols_end,
+                                                      ALPHA_INT *row_indx);
+
+alphasparse_status_t alphasparse_c_create_csc_pattern(alphasparse_matrix_t *A,
+                                                      const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      ALPHA_INT *cols_start,
+                                                      ALPHA_INT *cols_end,
+                                                      ALPHA_INT *row_indx);
+
+alphasparse_status_t alphasparse_z_create_csc_pattern(alphasparse_matrix_t *A,
+                                                      const alphasparse_index_base_t indexing, /* indexing: C-style or Fortran-style */
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      ALPHA_INT *cols_start,
+                                                      ALPHA_INT *cols_end,
+                                                      ALPHA_INT *row_indx);
+
+/*
+    incremental CSR construction from row ordered input
+
+    alphasparse_?_create_csr_builder    row_nnz gives the exact length of every row, the arrays are then
+                                        allocated once and rows are written in place; with row_nnz == NULL
+                                        they grow geometrically from nnz_hint (0 if unknown)
+    alphasparse_csr_builder_begin_rows  claim rows [row_begin, row_end) for one producer, ranges must not
+                                        overlap and may be claimed and filled from different threads
+    alphasparse_?_csr_builder_append_row  append the next row of a range, C-style column indices
+    alphasparse_csr_builder_finalize    turn a builder whose rows are all appended into a CSR matrix and
+                                        release the builder
+*/
+alphasparse_status_t alphasparse_s_create_csr_builder(alphasparse_csr_builder_t *builder,
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      const ALPHA_INT *row_nnz,
+                                                      const ALPHA_OFFSET nnz_hint);
+
+alphasparse_status_t alphasparse_d_create_csr_builder(alphasparse_csr_builder_t *builder,
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      const ALPHA_INT *row_nnz,
+                                                      const ALPHA_OFFSET nnz_hint);
+
+alphasparse_status_t alphasparse_c_create_csr_builder(alphasparse_csr_builder_t *builder,
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      const ALPHA_INT *row_nnz,
+                                                      const ALPHA_OFFSET nnz_hint);
+
+alphasparse_status_t alphasparse_z_create_csr_builder(alphasparse_csr_builder_t *builder,
+                                                      const ALPHA_INT rows,
+                                                      const ALPHA_INT cols,
+                                                      const ALPHA_INT *row_nnz,
+                                                      const ALPHA_OFFSET nnz_hint);
+
+alphasparse_status_t alphasparse_csr_builder_begin_rows(alphasparse_csr_builder_t builder,
+                                                        const ALPHA_INT row_begin,
+                                                        const ALPHA_INT row_end,
+                                                        const ALPHA_OFFSET nnz_hint, /* expected nnz of the range, 0 if unknown */
+                                                        alphasparse_csr_range_t *range);
+
+alphasparse_status_t alphasparse_s_csr_builder_append_row(alphasparse_csr_range_t range,
+                                                          const ALPHA_INT nnz,
+                                                          const ALPHA_INT *col_indx,
+                                                          const float *values);
+
+alphasparse_status_t alphasparse_d_csr_builder_append_row(alphasparse_csr_range_t range,
+                                                          const ALPHA_INT nnz,
+                                                          const ALPHA_INT *col_indx,
+                                                          const double *values);
+
+alphasparse_status_t alphasparse_c_csr_builder_append_row(alphasparse_csr_range_t range,
+                                                          const ALPHA_INT nnz,
+                                                          const ALPHA_INT *col_indx,
+                                                          const ALPHA_Complex8 *values);
+
+alphasparse_status_t alphasparse_z_csr_builder_append_row(alphasparse_csr_range_t range,
+                                                          const ALPHA_INT nnz,
+                                                          const ALPHA_INT *col_indx,
+                                                          const ALPHA_Complex16 *values);
+
+alphasparse_status_t alphasparse_csr_builder_finalize(alphasparse_csr_builder_t builder, alphasparse_matrix_t *A);
+
+/* release a builder that will not be finalized */
+alphasparse_status_t alphasparse_csr_builder_destroy(alphasparse_csr_builder_t builder);
+
 /*
     compressed block sparse row format (4-arrays version, square blocks),
     ALPHA_SPARSE_MATRIX_TYPE_GENERAL by default, pointers to input arrays are stored in the handle
@@ -235,8 +422,8 @@ alphasparse_status_t alphasparse_s_create_bsr(alphasparse_matrix_t *A,
                                             const ALPHA_INT rows,
                                             const ALPHA_INT cols,
                                             const ALPHA_INT block_size,
-                                            ALPHA_INT *rows_start,
-                                            ALPHA_INT *rows_end,
+                                            ALPHA_OFFSET *rows_start,
+                                            ALPHA_OFFSET *rows_end,
                                             ALPHA_INT *col_indx,
                                             float *values);
 
@@ -246,8 +433,8 @@ alphasparse_status_t alphasparse_d_create_bsr(alphasparse_matrix_t *A,
                                             const ALPHA_INT rows,
                                             const ALPHA_INT cols,
                                             const ALPHA_INT block_size,
-                                            ALPHA_INT *rows_start,
-                                            ALPHA_INT *rows_end,
+                                            ALPHA_OFFSET *rows_start,
+                                            ALPHA_OFFSET *rows_end,
                                             ALPHA_INT *col_indx,
                                             double *values);
 
@@ -257,8 +444,8 @@ alphasparse_status_t alphasparse_c_create_bsr(alphasparse_matrix_t *A,
                                             const ALPHA_INT rows,
                                             const ALPHA_INT cols,
                                             const ALPHA_INT block_size,
-                                            ALPHA_INT *rows_start,
-                                            ALPHA_INT *rows_end,
+                                            ALPHA_OFFSET *rows_start,
+                                            ALPHA_OFFSET *rows_end,
                                             ALPHA_INT *col_indx,
                                             ALPHA_Complex8 *values);
 
@@ -268,8 +455,8 @@ alphasparse_status_t alphasparse_z_create_bsr(alphasparse_matrix_t *A,
                                             const ALPHA_INT rows,
                                             const ALPHA_INT cols,
                                             const ALPHA_INT block_size,
-                                            ALPHA_INT *rows_start,
-                                            ALPHA_INT *rows_end,
+                                            ALPHA_OFFSET *rows_start,
+                                            ALPHA_OFFSET *rows_end,
                                             ALPHA_INT *col_indx,
                                             ALPHA_Complex16 *values);
 
@@ -311,8 +498,8 @@ alphasparse_status_t alphasparse_s_export_bsr(const alphasparse_matrix_t source,
                                             ALPHA_INT *rows,
                                             ALPHA_INT *cols,
                                             ALPHA_INT *block_size,
-                                            ALPHA_INT **rows_start,
-                                            ALPHA_INT **rows_end,
+                                            ALPHA_OFFSET **rows_start,
+                                            ALPHA_OFFSET **rows_end,
                                             ALPHA_INT **col_indx,
                                             float **values);
 
@@ -322,8 +509,8 @@ alphasparse_status_t alphasparse_d_export_bsr(const alphasparse_matrix_t source,
                                             ALPHA_INT *rows,
                                             ALPHA_INT *cols,
                                             ALPHA_INT *block_size,
-                                            ALPHA_INT **rows_start,
-                                            ALPHA_INT **rows_end,
+                                            ALPHA_OFFSET **rows_start,
+                                            ALPHA_OFFSET **rows_end,
                                             ALPHA_INT **col_indx,
                                             double **values);
 
@@ -333,8 +520,8 @@ alphasparse_status_t alphasparse_c_export_bsr(const alphasparse_matrix_t source,
                                             ALPHA_INT *rows,
                                             ALPHA_INT *cols,
                                             ALPHA_INT *block_size,
-                                            ALPHA_INT **rows_start,
-                                            ALPHA_INT **rows_end,
+                                            ALPHA_OFFSET **rows_start,
+                                            ALPHA_OFFSET **rows_end,
                                             ALPHA_INT **col_indx,
                                             ALPHA_Complex8 **values);
 
@@ -344,8 +531,8 @@ alphasparse_status_t alphasparse_z_export_bsr(const alphasparse_matrix_t source,
                                             ALPHA_INT *rows,
                                             ALPHA_INT *cols,
                                             ALPHA_INT *block_size,
-                                            ALPHA_INT **rows_start,
-                                            ALPHA_INT **rows_end,
+                                            ALPHA_OFFSET **rows_start,
+                                            ALPHA_OFFSET **rows_end,
                                             ALPHA_INT **col_indx,
                                             ALPHA_Complex16 **values);
 
@@ -353,8 +540,8 @@ alphasparse_status_t alphasparse_s_export_csr(const alphasparse_matrix_t source,
                                             alphasparse_index_base_t *indexing, /* indexing: C-style or Fortran-style */
                                             ALPHA_INT *rows,
                                             ALPHA_INT *cols,
-                                            ALPHA_INT **rows_start,
-                                            ALPHA_INT **rows_end,
+                                            ALPHA_OFFSET **rows_start,
+                                            ALPHA_OFFSET **rows_end,
                                             ALPHA_INT **col_indx,
                                             float **values);
 
@@ -362,8 +549,8 @@ alphasparse_status_t alphasparse_d_export_csr(const alphasparse_matrix_t source,
                                             alphasparse_index_base_t *indexing, /* indexing: C-style or Fortran-style */
                                             ALPHA_INT *rows,
                                             ALPHA_INT *cols,
-                                            ALPHA_INT **rows_start,
-                                            ALPHA_INT **rows_end,
+                                            ALPHA_OFFSET **rows_start,
+                                            ALPHA_OFFSET **rows_end,
                                             ALPHA_INT **col_indx,
                                             double **values);
 
@@ -371,8 +558,8 @@ alphasparse_status_t alphasparse_c_export_csr(const alphasparse_matrix_t source,
                                             alphasparse_index_base_t *indexing, /* indexing: C-style or Fortran-style */
                                             ALPHA_INT *rows,
                                             ALPHA_INT *cols,
-                                            ALPHA_INT **rows_start,
-                                            ALPHA_INT **rows_end,
+                                            ALPHA_OFFSET **rows_start,
+                                            ALPHA_OFFSET **rows_end,
                                             ALPHA_INT **col_indx,
                                             ALPHA_Complex8 **values);
 
@@ -380,8 +567,8 @@ alphasparse_status_t alphasparse_z_export_csr(const alphasparse_matrix_t source,
                                             alphasparse_index_base_t *indexing, /* indexing: C-style or Fortran-style */
                                             ALPHA_INT *rows,
                                             ALPHA_INT *cols,
-                                            ALPHA_INT **rows_start,
-                                            ALPHA_INT **rows_end,
+                                            ALPHA_OFFSET **rows_start,
+                                            ALPHA_OFFSET **rows_end,
                                             ALPHA_INT **col_indx,
                                             ALPHA_Complex16 **values);
 
@@ -575,7 +762,10 @@ alphasparse_status_t alphasparse_z_set_value(alphasparse_matrix_t A,
                                            const ALPHA_Complex16 value);
 
 /* update existing values in the matrix for internal storage only 
-       can be used to either update all or selected values */
+       can be used to either update all or selected values
+       indx == NULL && indy == NULL: values replaces all stored values in storage order
+       otherwise: values[i] is written to (indx[i], indy[i]), which must already be stored;
+       the position index is built on the first call and kept in the handle */
 alphasparse_status_t alphasparse_s_update_values(alphasparse_matrix_t A,
                                                const ALPHA_INT nvalues,
                                                const ALPHA_INT *indx,
@@ -600,12 +790,311 @@ alphasparse_status_t alphasparse_z_update_values(alphasparse_matrix_t A,
                                                const ALPHA_INT *indy,
                                                ALPHA_Complex16 *values);
 
+/*****************************************************************************************/
+/****************************** Execution context routines *******************************/
+/*****************************************************************************************/
+
+/*
+    an execution context carries the thread count, core set and workspace of the calls it governs,
+    instead of the process wide alpha_set_thread_num. The context set for the calling thread takes
+    precedence over the one attached to the matrix, so independent user threads can run calls with
+    their own configuration at the same time. A context must not govern two calls at once.
+
+    alphasparse_exec_context_set_cores      bind the threads to cores, CLOSE places thread t on cores[t % core_num],
+                                            SPREAD distributes the threads evenly over the cores, cores outside the
+                                            affinity mask of the process are rejected
+    alphasparse_exec_context_set_workspace  scratch memory for the kernels, the context allocates and grows its own
+                                            one when workspace is NULL
+    alphasparse_set_exec_context            attach ctx to A, NULL detaches, A does not own ctx
+    alphasparse_set_thread_exec_context     context of every call made by the calling thread, NULL to clear
+*/
+alphasparse_status_t alphasparse_create_exec_context(alphasparse_exec_context_t *ctx, const ALPHA_INT thread_num);
+
+alphasparse_status_t alphasparse_exec_context_set_cores(alphasparse_exec_context_t ctx,
+                                                        const ALPHA_INT core_num,
+                                                        const ALPHA_INT *cores,
+                                                        const alphasparse_bind_policy_t policy);
+
+alphasparse_status_t alphasparse_exec_context_set_workspace(alphasparse_exec_context_t ctx, void *workspace, const size_t size);
+
+alphasparse_status_t alphasparse_destroy_exec_context(alphasparse_exec_context_t ctx);
+
+alphasparse_status_t alphasparse_set_exec_context(alphasparse_matrix_t A, alphasparse_exec_context_t ctx);
+
+alphasparse_status_t alphasparse_set_thread_exec_context(alphasparse_exec_context_t ctx);
+
+/*****************************************************************************************/
+/****************************** Asynchronous routines ************************************/
+/*****************************************************************************************/
+
+/*
+    the _async routines queue the operation of their synchronous counterpart and return at once
+    with a future for it. The operation starts once every future of deps has completed, and does
+    not run at all when one of them failed. They run on alphasparse_set_async_teams teams, each
+    with its share of the threads and cores, so independent operations overlap.
+
+    Operands are read when the operation runs and must stay valid until then. A routine producing a
+    matrix returns its handle immediately, it can be passed to later operations that depend on the
+    producing one and must be destroyed with alphasparse_destroy as usual.
+
+    alphasparse_set_async_teams     number of operations run side by side, 0 for the default of 2 (1 on a single core),
+                                    waits for the queued operations first
+    alphasparse_future_wait         block until future completed, returns the status of its operation
+    alphasparse_future_test         completed tells whether future completed, without blocking
+    alphasparse_future_destroy      release future, its operation still runs when pending
+*/
+alphasparse_status_t alphasparse_set_async_teams(const ALPHA_INT team_num);
+
+alphasparse_status_t alphasparse_future_wait(alphasparse_future_t future);
+
+alphasparse_status_t alphasparse_future_test(alphasparse_future_t future, bool *completed);
+
+alphasparse_status_t alphasparse_future_destroy(alphasparse_future_t future);
+
+alphasparse_status_t alphasparse_s_mv_async(const alphasparse_operation_t operation,
+                                          const float alpha,
+                                          const alphasparse_matrix_t A,
+                                          const struct alpha_matrix_descr descr,
+                                          const float *x,
+                                          const float beta,
+                                          float *y,
+                                          const ALPHA_INT dep_num,
+                                          const alphasparse_future_t *deps,
+                                          alphasparse_future_t *future);
+
+alphasparse_status_t alphasparse_d_mv_async(const alphasparse_operation_t operation,
+                                          const double alpha,
+                                          const alphasparse_matrix_t A,
+                                          const struct alpha_matrix_descr descr,
+                                          const double *x,
+                                          const double beta,
+                                          double *y,
+                                          const ALPHA_INT dep_num,
+                                          const alphasparse_future_t *deps,
+                                          alphasparse_future_t *future);
+
+alphasparse_status_t alphasparse_c_mv_async(const alphasparse_operation_t operation,
+                                          const ALPHA_Complex8 alpha,
+                                          const alphasparse_matrix_t A,
+                                          const struct alpha_matrix_descr descr,
+                                          const ALPHA_Complex8 *x,
+                                          const ALPHA_Complex8 beta,
+                                          ALPHA_Complex8 *y,
+                                          const ALPHA_INT dep_num,
+                                          const alphasparse_future_t *deps,
+                                          alphasparse_future_t *future);
+
+alphasparse_status_t alphasparse_z_mv_async(const alphasparse_operation_t operation,
+                                          const ALPHA_Complex16 alpha,
+                                          const alphasparse_matrix_t A,
+                                          const struct alpha_matrix_descr descr,
+                                          const ALPHA_Complex16 *x,
+                                          const ALPHA_Complex16 beta,
+                                          ALPHA_Complex16 *y,
+                                          const ALPHA_INT dep_num,
+                                          const alphasparse_future_t *deps,
+                                          alphasparse_future_t *future);
+
+alphasparse_status_t alphasparse_s_mm_async(const alphasparse_operation_t operation,
+                                          const float alpha,
+                                          const alphasparse_matrix_t A,
+                                          const struct alpha_matrix_descr descr,
+                                          const alphasparse_layout_t layout,
+                                          const float *x,
+                                          const ALPHA_INT columns,
+                                          const ALPHA_INT ldx,
+                                          const float beta,
+                                          float *y,
+                                          const ALPHA_INT ldy,
+                                          const ALPHA_INT dep_num,
+                                          const alphasparse_future_t *deps,
+                                          alphasparse_future_t *future);
+
+alphasparse_status_t alphasparse_d_mm_async(const alphasparse_operation_t operation,
+                                          const double alpha,
+                                          const alphasparse_matrix_t A,
+                                          const struct alpha_matrix_descr descr,
+                                          const alphasparse_layout_t layout,
+                                          const double *x,
+                                          const ALPHA_INT columns,
+                                          const ALPHA_INT ldx,
+                                          const double beta,
+                                          double *y,
+                                          const ALPHA_INT ldy,
+                                          const ALPHA_INT dep_num,
+                                          const alphasparse_future_t *deps,
+                                          alphasparse_future_t *future);
+
+alphasparse_status_t alphasparse_c_mm_async(const alphasparse_operation_t operation,
+                                          const ALPHA_Complex8 alpha,
+                                          const alphasparse_matrix_t A,
+                                          const struct alpha_matrix_descr descr,
+                                          const alphasparse_layout_t layout,
+                                          const ALPHA_Complex8 *x,
+                                          const ALPHA_INT columns,
+                                          const ALPHA_INT ldx,
+                                          const ALPHA_Complex8 beta,
+                                          ALPHA_Complex8 *y,
+                                          const ALPHA_INT ldy,
+                                          const ALPHA_INT dep_num,
+                                          const alphasparse_future_t *deps,
+                                          alphasparse_future_t *future);
+
+alphasparse_status_t alphasparse_z_mm_async(const alphasparse_operation_t operation,
+                                          const ALPHA_Complex16 alpha,
+                                          const alphasparse_matrix_t A,
+                                          const struct alpha_matrix_descr descr,
+                                          const alphasparse_layout_t layout,
+                                          const ALPHA_Complex16 *x,
+                                          const ALPHA_INT columns,
+                                          const ALPHA_INT ldx,
+                                          const ALPHA_Complex16 beta,
+                                          ALPHA_Complex16 *y,
+                                          const ALPHA_INT ldy,
+                                          const ALPHA_INT dep_num,
+                                          const alphasparse_future_t *deps,
+                                          alphasparse_future_t *future);
+
+alphasparse_status_t alphasparse_spmm_async(const alphasparse_operation_t operation,
+                                           const alphasparse_matrix_t A,
+                                           const alphasparse_matrix_t B,
+                                           alphasparse_matrix_t *C,
+                                           const ALPHA_INT dep_num,
+                                           const alphasparse_future_t *deps,
+                                           alphasparse_future_t *future);
+
+alphasparse_status_t alphasparse_convert_csr_async(const alphasparse_matrix_t source,
+                                                  const alphasparse_operation_t operation,
+                                                  alphasparse_matrix_t *dest,
+                                                  const ALPHA_INT dep_num,
+                                                  const alphasparse_future_t *deps,
+                                                  alphasparse_future_t *future);
+
+/*****************************************************************************************/
+/****************************** Operation graph routines *********************************/
+/*****************************************************************************************/
+
+/*
+    an operation graph records a fixed sequence of operations once and replays it many times, e.g.
+    the body of an iterative solver. Between alphasparse_graph_begin_capture and
+    alphasparse_graph_end_capture the alphasparse_?_mv calls of the calling thread are recorded
+    instead of run, alphasparse_?_graph_axpby and alphasparse_?_graph_dot add vector operations.
+    Operands are taken by address and read on every replay.
+
+    alphasparse_graph_execute replays the graph. Consecutive operations on the same rows without a
+    dependency across rows form a stage run by every thread row block by row block, so a CSR mv
+    followed by an axpby or dot reads its result from cache. Consecutive stages share one parallel
+    region, separated by barriers, e.g. a chain of row-aligned CSR mv. Stage partitions are cached
+    until the graph changes or the thread count does. Only general CSR mv without transpose is
+    fused, any other mv runs through alphasparse_?_mv on its own.
+
+    alphasparse_?_graph_axpby       w = alpha * x + beta * y, w may be x or y
+    alphasparse_?_graph_dot         *result = sum of x[i] * y[i], not conjugated, written when the graph is replayed
+    alphasparse_graph_info          operations, stages and parallel regions of one replay
+*/
+alphasparse_status_t alphasparse_graph_create(alphasparse_graph_t *graph);
+
+alphasparse_status_t alphasparse_graph_destroy(alphasparse_graph_t graph);
+
+alphasparse_status_t alphasparse_graph_begin_capture(alphasparse_graph_t graph);
+
+alphasparse_status_t alphasparse_graph_end_capture(alphasparse_graph_t graph);
+
+alphasparse_status_t alphasparse_s_graph_axpby(alphasparse_graph_t graph,
+                                             const ALPHA_INT n,
+                                             const float alpha,
+                                             const float *x,
+                                             const float beta,
+                                             const float *y,
+                                             float *w);
+
+alphasparse_status_t alphasparse_d_graph_axpby(alphasparse_graph_t graph,
+                                             const ALPHA_INT n,
+                                             const double alpha,
+                                             const double *x,
+                                             const double beta,
+                                             const double *y,
+                                             double *w);
+
+alphasparse_status_t alphasparse_c_graph_axpby(alphasparse_graph_t graph,
+                                             const ALPHA_INT n,
+                                             const ALPHA_Complex8 alpha,
+                                             const ALPHA_Complex8 *x,
+                                             const ALPHA_Complex8 beta,
+                                             const ALPHA_Complex8 *y,
+                                             ALPHA_Complex8 *w);
+
+alphasparse_status_t alphasparse_z_graph_axpby(alphasparse_graph_t graph,
+                                             const ALPHA_INT n,
+                                             const ALPHA_Complex16 alpha,
+                                             const ALPHA_Complex16 *x,
+                                             const ALPHA_Complex16 beta,
+                                             const ALPHA_Complex16 *y,
+                                             ALPHA_Complex16 *w);
+
+alphasparse_status_t alphasparse_s_graph_dot(alphasparse_graph_t graph,
+                                           const ALPHA_INT n,
+                                           const float *x,
+                                           const float *y,
+                                           float *result);
+
+alphasparse_status_t alphasparse_d_graph_dot(alphasparse_graph_t graph,
+                                           const ALPHA_INT n,
+                                           const double *x,
+                                           const double *y,
+                                           double *result);
+
+alphasparse_status_t alphasparse_c_graph_dot(alphasparse_graph_t graph,
+                                           const ALPHA_INT n,
+                                           const ALPHA_Complex8 *x,
+                                           const ALPHA_Complex8 *y,
+                                           ALPHA_Complex8 *result);
+
+alphasparse_status_t alphasparse_z_graph_dot(alphasparse_graph_t graph,
+                                           const ALPHA_INT n,
+                                           const ALPHA_Complex16 *x,
+                                           const ALPHA_Complex16 *y,
+                                           ALPHA_Complex16 *result);
+
+alphasparse_status_t alphasparse_graph_execute(alphasparse_graph_t graph);
+
+alphasparse_status_t alphasparse_graph_info(alphasparse_graph_t graph, ALPHA_INT *node_num, ALPHA_INT *stage_num, ALPHA_INT *region_num);
+
 /*****************************************************************************************/
 /****************************** Verbose mode routine *************************************/
 /*****************************************************************************************/
 
-/* allow to switch on/off verbose mode */
-alphasparse_status_t alphasparse_set_verbose_mode(alpha_verbose_mode_t verbose); /* unsupported currently */
+/*
+    allow to switch on/off verbose mode, BASIC records every mv, trsv, mm and trsm call into a ring
+    buffer of ALPHA_SPARSE_TRACE_CAPACITY records, EXTENDED adds the per-thread time spread of the
+    kernels instrumented for it. Calls cost a single branch while the mode is off.
+
+    alphasparse_set_trace_counters  also count hardware events of each traced call with perf_event_open,
+                                    NOT_SUPPORTED when this machine provides none of them
+    alphasparse_trace_size          records held, the oldest ones are overwritten once the buffer is full
+    alphasparse_trace_get           record index of those held, 0 is the oldest
+    alphasparse_trace_clear         drop all records
+    alphasparse_trace_dump_json     write the records held as a JSON array, to stdout if file is NULL
+*/
+alphasparse_status_t alphasparse_set_verbose_mode(alpha_verbose_mode_t verbose);
+
+alphasparse_status_t alphasparse_set_trace_counters(const bool enable);
+
+alphasparse_status_t alphasparse_trace_size(ALPHA_INT *size);
+
+alphasparse_status_t alphasparse_trace_get(const ALPHA_INT index, alphasparse_trace_record_t *record);
+
+alphasparse_status_t alphasparse_trace_clear();
+
+alphasparse_status_t alphasparse_trace_dump_json(const char *file);
+
+/*
+    the SpGEMM, spmmd, transposed CSR mv and BSR conversion kernels schedule their rows by work
+    stealing, alphasparse_get_steal_stats reports how evenly the threads were loaded
+*/
+alphasparse_status_t alphasparse_get_steal_stats(alphasparse_steal_stats_t *stats);
+
+alphasparse_status_t alphasparse_reset_steal_stats();
 
 /*****************************************************************************************/
 /****************************** Optimization routines ************************************/
@@ -663,6 +1152,26 @@ alphasparse_status_t alphasparse_set_lu_smoother_hint(const alphasparse_matrix_t
 alphasparse_status_t alphasparse_set_memory_hint(const alphasparse_matrix_t A,
                                                const alphasparse_memory_usage_t policy); /* ALPHA_SPARSE_MEMORY_AGGRESSIVE is default value */
 
+/*
+    Describe the storage of complex values. Under ALPHA_SPARSE_COMPLEX_SPLIT alphasparse_optimize keeps the real and
+    imaginary parts of the values of a complex CSR or BSR matrix in two arrays next to the interleaved ones, and mv
+    (general and hermitian), mm and trsv run kernels that use two real FMAs per part. A later
+    ALPHA_SPARSE_COMPLEX_INTERLEAVED hint and optimize release the split arrays. set_value and update_values copy
+    the parts of all values again, in parallel.
+*/
+alphasparse_status_t alphasparse_set_complex_layout_hint(const alphasparse_matrix_t A,
+                                                       const alphasparse_complex_layout_t layout); /* ALPHA_SPARSE_COMPLEX_INTERLEAVED is default value */
+
+/*
+    Describe the blocking of mv on a CSR matrix whose x does not fit in cache. Under ALPHA_SPARSE_MV_TILING_2D
+    alphasparse_optimize copies the matrix into row blocks cut into column panels, a panel of x sized for half of a
+    thread's share of L3 and a row block for half of L2 (sizes from sysfs, the defaults in util/malloc.h otherwise), and
+    the general non-transposed mv then walks every row block panel by panel. Nothing is built when one panel covers
+    all columns. set_value and update_values write the new values into the copy as well, the layout stays.
+*/
+alphasparse_status_t alphasparse_set_mv_tiling_hint(const alphasparse_matrix_t A,
+                                                  const alphasparse_mv_tiling_t tiling); /* ALPHA_SPARSE_MV_TILING_NONE is default value */
+
 /*
     Optimize matrix described by the handle. It uses hints (optimization and memory) that should be set up before this call.
     If hints were not explicitly defined, default vales are:
@@ -1332,3 +1841,212 @@ void alphasparse_z_dotui_sub(const ALPHA_INT nz,
                             const ALPHA_INT *indx,
                             const ALPHA_Complex16 *y,
                             ALPHA_Complex16 *dutui);
+
+/*****************************************************************************************/
+/****************************** Sparse vector routines ***********************************/
+/*****************************************************************************************/
+
+/*
+    a sparse vector holds nnz entries of a vector of length size, values[i] at position indx[i].
+    The arrays stay owned by the caller and are used in place. Dense operands are plain arrays of
+    the datatype of the sparse vector, or of the matrix for alphasparse_spmv, and scalars are passed
+    by address in that datatype. The routines run the kernels of the typed level-1 calls.
+
+    alphasparse_spvv        result = x . y, or conj(x) . y for a complex x with CONJUGATE_TRANSPOSE
+    alphasparse_axpby       y = alpha * x + beta * y, y of length size
+    alphasparse_gather      values of x = y at the positions of x
+    alphasparse_scatter     y at the positions of x = values of x
+    alphasparse_spmv        y = alpha * op(A) * x + beta * y for A of any format and datatype
+*/
+alphasparse_status_t alphasparse_create_spvec(alphasparse_spvec_t *x,
+                                            const alphasparse_datatype_t datatype,
+                                            const alphasparse_index_base_t indexing,
+                                            const ALPHA_INT size,
+                                            const ALPHA_INT nnz,
+                                            ALPHA_INT *indx,
+                                            void *values);
+
+alphasparse_status_t alphasparse_destroy_spvec(alphasparse_spvec_t x);
+
+/* arrays of x, those of a vector the library produced stay valid until it is destroyed */
+alphasparse_status_t alphasparse_export_spvec(const alphasparse_spvec_t x,
+                                            alphasparse_index_base_t *indexing,
+                                            ALPHA_INT *size,
+                                            ALPHA_INT *nnz,
+                                            ALPHA_INT **indx,
+                                            void **values);
+
+alphasparse_status_t alphasparse_spvv(const alphasparse_operation_t operation,
+                                    const alphasparse_spvec_t x,
+                                    const void *y,
+                                    void *result);
+
+alphasparse_status_t alphasparse_axpby(const void *alpha,
+                                     const alphasparse_spvec_t x,
+                                     const void *beta,
+                                     void *y);
+
+alphasparse_status_t alphasparse_gather(const void *y, alphasparse_spvec_t x);
+
+alphasparse_status_t alphasparse_scatter(const alphasparse_spvec_t x, void *y);
+
+alphasparse_status_t alphasparse_spmv(const alphasparse_operation_t operation,
+                                    const void *alpha,
+                                    const alphasparse_matrix_t A,
+                                    const struct alpha_matrix_descr descr,
+                                    const void *x,
+                                    const void *beta,
+                                    void *y);
+
+/*
+    Sparse matrix times sparse vector, y := alpha * op(A) * x for A in CSR, CSC or COO. y is a new
+    vector of length rows of op(A) with the indexing of x, sorted, holding every row an entry of x
+    reaches; it owns its arrays and is released with alphasparse_destroy_spvec. alg picks push (over
+    the columns x selects, cost follows that work) or pull (over all rows masked by x, cost follows
+    nnz(A)), AUTO takes push while the selected work is small against nnz(A). The grouping of A each
+    traversal needs is built on first use and kept with the matrix.
+*/
+alphasparse_status_t alphasparse_s_spmspv(const alphasparse_operation_t operation,
+                                        const float alpha,
+                                        const alphasparse_matrix_t A,
+                                        const alphasparse_spvec_t x,
+                                        const alphasparse_spmspv_alg_t alg,
+                                        alphasparse_spvec_t *y);
+
+alphasparse_status_t alphasparse_d_spmspv(const alphasparse_operation_t operation,
+                                        const double alpha,
+                                        const alphasparse_matrix_t A,
+                                        const alphasparse_spvec_t x,
+                                        const alphasparse_spmspv_alg_t alg,
+                                        alphasparse_spvec_t *y);
+
+alphasparse_status_t alphasparse_c_spmspv(const alphasparse_operation_t operation,
+                                        const ALPHA_Complex8 alpha,
+                                        const alphasparse_matrix_t A,
+                                        const alphasparse_spvec_t x,
+                                        const alphasparse_spmspv_alg_t alg,
+                                        alphasparse_spvec_t *y);
+
+alphasparse_status_t alphasparse_z_spmspv(const alphasparse_operation_t operation,
+                                        const ALPHA_Complex16 alpha,
+                                        const alphasparse_matrix_t A,
+                                        const alphasparse_spvec_t x,
+                                        const alphasparse_spmspv_alg_t alg,
+                                        alphasparse_spvec_t *y);
+
+/*****************************************************************************************/
+/********************************** Semiring routines ************************************/
+/*****************************************************************************************/
+
+/*
+    The kernels below replace (+, *) by the add and multiply of a built-in semiring, see
+    alphasparse_semiring_t, for float and double. Every semiring has its own compiled instance
+    with the operators inlined. The additive identity of MIN_PLUS is the largest finite value
+    and that of MAX_PLUS and MAX_TIMES its negative, which also mark unreached entries.
+
+    alphasparse_?_semiring_mv       y = op(A) add.multiply x for dense x and y, CSR, CSC or COO,
+                                    a row without entries gets the additive identity
+    alphasparse_?_semiring_spmspv   the same for a sparse x, producing a sparse y as
+                                    alphasparse_?_spmspv does
+    alphasparse_?_semiring_spgemm   C = A add.multiply B for CSR A and B, C is a new CSR matrix
+*/
+alphasparse_status_t alphasparse_s_semiring_mv(const alphasparse_semiring_t semiring,
+                                             const alphasparse_operation_t operation,
+                                             const alphasparse_matrix_t A,
+                                             const float *x,
+                                             float *y);
+
+alphasparse_status_t alphasparse_d_semiring_mv(const alphasparse_semiring_t semiring,
+                                             const alphasparse_operation_t operation,
+                                             const alphasparse_matrix_t A,
+                                             const double *x,
+                                             double *y);
+
+alphasparse_status_t alphasparse_s_semiring_spmspv(const alphasparse_semiring_t semiring,
+                                                 const alphasparse_operation_t operation,
+                                                 const alphasparse_matrix_t A,
+                                                 const alphasparse_spvec_t x,
+                                                 const alphasparse_spmspv_alg_t alg,
+                                                 alphasparse_spvec_t *y);
+
+alphasparse_status_t alphasparse_d_semiring_spmspv(const alphasparse_semiring_t semiring,
+                                                 const alphasparse_operation_t operation,
+                                                 const alphasparse_matrix_t A,
+                                                 const alphasparse_spvec_t x,
+                                                 const alphasparse_spmspv_alg_t alg,
+                                                 alphasparse_spvec_t *y);
+
+alphasparse_status_t alphasparse_s_semiring_spgemm(const alphasparse_semiring_t semiring,
+                                                 const alphasparse_matrix_t A,
+                                                 const alphasparse_matrix_t B,
+                                                 alphasparse_matrix_t *C);
+
+alphasparse_status_t alphasparse_d_semiring_spgemm(const alphasparse_semiring_t semiring,
+                                                 const alphasparse_matrix_t A,
+                                                 const alphasparse_matrix_t B,
+                                                 alphasparse_matrix_t *C);
+
+/*****************************************************************************************/
+/*********************************** Reordering ******************************************/
+/*****************************************************************************************/
+
+/*
+    Computes an ordering of a CSR or pattern-only CSR matrix and optionally applies it.
+    perm has a slot per row, row i of B is row perm[i] of A. With symmetric the same
+    permutation moves the columns, B = P A P^T, otherwise B = P A. RCM and GORDER run on
+    the pattern of A + A^T and need a square A, as does symmetric.
+
+    perm        filled with the ordering
+    iperm       NULL or filled with the inverse, iperm[perm[i]] = i
+    B           NULL to only compute the ordering, otherwise a new CSR matrix
+
+    Vectors move in and out with gather, y = A x is py = B px with px from
+    alphasparse_?_gthr(n, x, px, perm) when symmetric (px = x otherwise) and y from
+    alphasparse_?_gthr(n, py, y, iperm).
+*/
+alphasparse_status_t alphasparse_reorder(const alphasparse_matrix_t A,
+                                       const alphasparse_reorder_t ordering,
+                                       const bool symmetric,
+                                       ALPHA_INT *perm,
+                                       ALPHA_INT *iperm,
+                                       alphasparse_matrix_t *B);
+
+/*****************************************************************************************/
+/**************************** Permutation and submatrices ********************************/
+/*****************************************************************************************/
+
+/*
+    B = P A Q^T for a CSR, CSC or BSR matrix, in the format of A. Row i of B is row
+    row_perm[i] of A and column j of B is column col_perm[j] of A, NULL keeps the order.
+    The same array for both is the symmetric permutation. For BSR the permutations move
+    block rows and block columns.
+*/
+alphasparse_status_t alphasparse_permute(const alphasparse_matrix_t A,
+                                       const ALPHA_INT *row_perm,
+                                       const ALPHA_INT *col_perm,
+                                       alphasparse_matrix_t *B);
+
+/*
+    B(i, j) = A(row_indx[i], col_indx[j]) for a CSR, CSC or BSR matrix, in the format of A.
+    row_indx holds rows entries and col_indx cols entries, NULL takes every row or column
+    in order. The row set of CSR and BSR and the column set of CSC may repeat an index,
+    the other one may not. Indices count blocks for BSR. Rows come out sorted when A was
+    sorted and the other index set is increasing, otherwise they are sorted.
+*/
+alphasparse_status_t alphasparse_extract_submatrix(const alphasparse_matrix_t A,
+                                                 const ALPHA_INT rows,
+                                                 const ALPHA_INT *row_indx,
+                                                 const ALPHA_INT cols,
+                                                 const ALPHA_INT *col_indx,
+                                                 alphasparse_matrix_t *B);
+
+/*
+    Rows [row_first, row_last) of A with every column. For CSR and BSR B is a view into
+    the arrays of A without a copy, valid as long as A is and released with
+    alphasparse_destroy as usual; values changed through one show in the other. For BSR
+    the bounds must be multiples of the block size. A CSC matrix gets a copy.
+*/
+alphasparse_status_t alphasparse_view_rows(const alphasparse_matrix_t A,
+                                         const ALPHA_INT row_first,
+                                         const ALPHA_INT row_last,
+                                         alphasparse_matrix_t *B);
@@ -129,7 +129,13 @@ typedef enum
     ALPHA_SPARSE_FORMAT_GEBSR = 7,
     ALPHA_SPARSE_FORMAT_HYB = 8,
     ALPHA_SPARSE_FORMAT_COO_AOS = 9,
-    ALPHA_SPARSE_FORMAT_CSR5 = 10
+    ALPHA_SPARSE_FORMAT_CSR5 = 10,
+    // pattern-only variants, every stored entry is an implicit one and values is NULL
+    ALPHA_SPARSE_FORMAT_COO_PATTERN = 11,
+    ALPHA_SPARSE_FORMAT_CSR_PATTERN = 12,
+    ALPHA_SPARSE_FORMAT_CSC_PATTERN = 13,
+    // dense diagonals in DIA plus the remaining entries in a CSR tail, see alphasparse_convert_dia_csr
+    ALPHA_SPARSE_FORMAT_DIA_CSR = 14
 } alphasparse_format_t;
 
 #define ALPHA_SPARSE_FORMAT_NUM 6
@@ -170,6 +176,63 @@ typedef struct {
 } alphasparse_matrix;
 
 typedef alphasparse_matrix *alphasparse_matrix_t;
+
+/* incremental CSR construction, see alphasparse_?_create_csr_builder */
+typedef struct alpha_csr_builder *alphasparse_csr_builder_t;
+/* contiguous row range of a builder, filled by one producer */
+typedef struct alpha_csr_builder_range *alphasparse_csr_range_t;
+/* thread count, cores and workspace of the calls it governs, see alphasparse_create_exec_context */
+typedef struct alpha_exec_context *alphasparse_exec_context_t;
+
+/* placement of the threads of an execution context over its cores */
+typedef enum
+{
+    ALPHA_SPARSE_BIND_NONE = 0,   /* threads are not bound */
+    ALPHA_SPARSE_BIND_CLOSE = 1,  /* thread i on core i, wrapping around */
+    ALPHA_SPARSE_BIND_SPREAD = 2  /* threads evenly spaced over the cores */
+} alphasparse_bind_policy_t;
+/* operation queued by an asynchronous routine, see alphasparse_future_wait */
+typedef struct alpha_future *alphasparse_future_t;
+/* recorded sequence of operations replayed with fused stages, see alphasparse_graph_begin_capture */
+typedef struct alpha_graph *alphasparse_graph_t;
+/* sparse vector over user arrays, see alphasparse_create_spvec */
+typedef struct alpha_spvec *alphasparse_spvec_t;
+/* traversal of alphasparse_?_spmspv */
+typedef enum
+{
+    ALPHA_SPARSE_SPMSPV_AUTO = 0, /* push or pull, chosen from the work the entries of x select */
+    ALPHA_SPARSE_SPMSPV_PUSH = 1, /* over the columns x selects, merged in a bucketed sparse accumulator */
+    ALPHA_SPARSE_SPMSPV_PULL = 2  /* over all rows, masked by the entries of x */
+} alphasparse_spmspv_alg_t;
+/* add.multiply of the alphasparse_?_semiring_* routines */
+typedef enum
+{
+    ALPHA_SPARSE_SEMIRING_PLUS_TIMES = 0, /* ordinary arithmetic */
+    ALPHA_SPARSE_SEMIRING_MIN_PLUS = 1,   /* shortest paths */
+    ALPHA_SPARSE_SEMIRING_MAX_PLUS = 2,   /* longest paths */
+    ALPHA_SPARSE_SEMIRING_MAX_TIMES = 3,  /* most reliable paths */
+    ALPHA_SPARSE_SEMIRING_LOR_LAND = 4,   /* reachability, any nonzero is true and results are 0 or 1 */
+    ALPHA_SPARSE_SEMIRING_PLUS_MIN = 5    /* summed bottlenecks */
+} alphasparse_semiring_t;
+/* storage of complex values, see alphasparse_set_complex_layout_hint */
+typedef enum
+{
+    ALPHA_SPARSE_COMPLEX_INTERLEAVED = 0, /* real and imaginary part of every value next to each other */
+    ALPHA_SPARSE_COMPLEX_SPLIT = 1        /* all real parts in one array and all imaginary parts in another */
+} alphasparse_complex_layout_t;
+/* blocking of the CSR matrix-vector product, see alphasparse_set_mv_tiling_hint */
+typedef enum
+{
+    ALPHA_SPARSE_MV_TILING_NONE = 0, /* rows as stored */
+    ALPHA_SPARSE_MV_TILING_2D = 1    /* row blocks cut into column panels sized for the caches */
+} alphasparse_mv_tiling_t;
+/* ordering computed by alphasparse_reorder */
+typedef enum
+{
+    ALPHA_SPARSE_REORDER_RCM = 0,    /* reverse Cuthill-McKee, narrows the band of meshes */
+    ALPHA_SPARSE_REORDER_DEGREE = 1, /* decreasing degree, groups the hubs of power-law graphs */
+    ALPHA_SPARSE_REORDER_GORDER = 2  /* greedy graph order, neighbours and vertices sharing them land close */
+} alphasparse_reorder_t;
 /*
  * ----------------------------------------------------------------------------------------------------------------------
  */
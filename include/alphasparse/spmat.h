@@ -15,6 +15,7 @@
 #define ALPHA_SPMAT_CSC spmat_csc_s_t
 #define ALPHA_SPMAT_BSR spmat_bsr_s_t
 #define ALPHA_SPMAT_DIA spmat_dia_s_t
+#define ALPHA_SPMAT_DIA_CSR spmat_dia_csr_s_t
 #define ALPHA_SPMAT_SKY spmat_sky_s_t
 #define ALPHA_SPMAT_ELL spmat_ell_s_t
 #define ALPHA_SPMAT_GEBSR spmat_gebsr_s_t
@@ -26,6 +27,7 @@
 #define ALPHA_SPMAT_CSC spmat_csc_d_t
 #define ALPHA_SPMAT_BSR spmat_bsr_d_t
 #define ALPHA_SPMAT_DIA spmat_dia_d_t
+#define ALPHA_SPMAT_DIA_CSR spmat_dia_csr_d_t
 #define ALPHA_SPMAT_SKY spmat_sky_d_t
 #define ALPHA_SPMAT_ELL spmat_ell_d_t
 #define ALPHA_SPMAT_GEBSR spmat_gebsr_d_t
@@ -41,6 +43,7 @@
 #define ALPHA_SPMAT_CSC spmat_csc_c_t
 #define ALPHA_SPMAT_BSR spmat_bsr_c_t
 #define ALPHA_SPMAT_DIA spmat_dia_c_t
+#define ALPHA_SPMAT_DIA_CSR spmat_dia_csr_c_t
 #define ALPHA_SPMAT_SKY spmat_sky_c_t
 #define ALPHA_SPMAT_ELL spmat_ell_c_t
 #define ALPHA_SPMAT_GEBSR spmat_gebsr_c_t
@@ -52,6 +55,7 @@
 #define ALPHA_SPMAT_CSC spmat_csc_z_t
 #define ALPHA_SPMAT_BSR spmat_bsr_z_t
 #define ALPHA_SPMAT_DIA spmat_dia_z_t
+#define ALPHA_SPMAT_DIA_CSR spmat_dia_csr_z_t
 #define ALPHA_SPMAT_SKY spmat_sky_z_t
 #define ALPHA_SPMAT_ELL spmat_ell_z_t
 #define ALPHA_SPMAT_GEBSR spmat_gebsr_z_t
@@ -174,8 +178,8 @@ typedef struct
 typedef struct
 {
   float *values;
-  ALPHA_INT *rows_start;
-  ALPHA_INT *rows_end;
+  ALPHA_OFFSET *rows_start;
+  ALPHA_OFFSET *rows_end;
   ALPHA_INT *col_indx;
   ALPHA_INT rows;
   ALPHA_INT cols;
@@ -203,8 +207,8 @@ typedef struct
 typedef struct 
 {
   double *values;
-  ALPHA_INT *rows_start;
-  ALPHA_INT *rows_end;
+  ALPHA_OFFSET *rows_start;
+  ALPHA_OFFSET *rows_end;
   ALPHA_INT *col_indx;
   ALPHA_INT rows;
   ALPHA_INT cols;
@@ -232,8 +236,8 @@ typedef struct
 typedef struct
 {
   ALPHA_Complex8 *values;
-  ALPHA_INT *rows_start;
-  ALPHA_INT *rows_end;
+  ALPHA_OFFSET *rows_start;
+  ALPHA_OFFSET *rows_end;
   ALPHA_INT *col_indx;
   ALPHA_INT rows;
   ALPHA_INT cols;
@@ -260,8 +264,8 @@ typedef struct
 typedef struct
 {
   ALPHA_Complex16 *values;
-  ALPHA_INT *rows_start;
-  ALPHA_INT *rows_end;
+  ALPHA_OFFSET *rows_start;
+  ALPHA_OFFSET *rows_end;
   ALPHA_INT *col_indx;
   ALPHA_INT rows;
   ALPHA_INT cols;
@@ -386,8 +390,8 @@ typedef struct
 typedef struct
 {
   float *values;
-  ALPHA_INT *rows_start;
-  ALPHA_INT *rows_end;
+  ALPHA_OFFSET *rows_start;
+  ALPHA_OFFSET *rows_end;
   ALPHA_INT *col_indx;
   ALPHA_INT rows;  // block_rows
   ALPHA_INT cols;  // block_cols
@@ -421,8 +425,8 @@ typedef struct
 typedef struct
 {
   double *values;
-  ALPHA_INT *rows_start;
-  ALPHA_INT *rows_end;
+  ALPHA_OFFSET *rows_start;
+  ALPHA_OFFSET *rows_end;
   ALPHA_INT *col_indx;
   ALPHA_INT rows;  // block_rows
   ALPHA_INT cols;  // block_cols
@@ -456,8 +460,8 @@ typedef struct
 typedef struct
 {
   ALPHA_Complex8 *values;
-  ALPHA_INT *rows_start;
-  ALPHA_INT *rows_end;
+  ALPHA_OFFSET *rows_start;
+  ALPHA_OFFSET *rows_end;
   ALPHA_INT *col_indx;
   ALPHA_INT rows;  // block_rows
   ALPHA_INT cols;  // block_cols
@@ -491,8 +495,8 @@ typedef struct
 typedef struct
 {
   ALPHA_Complex16 *values;
-  ALPHA_INT *rows_start;
-  ALPHA_INT *rows_end;
+  ALPHA_OFFSET *rows_start;
+  ALPHA_OFFSET *rows_end;
   ALPHA_INT *col_indx;
   ALPHA_INT rows;  // block_rows
   ALPHA_INT cols;  // block_cols
@@ -614,6 +618,41 @@ typedef struct {
   ALPHA_INT lval;
 } spmat_dia_z_t;
 
+/*
+* dia       diagonals whose fill is above the threshold given at conversion, stored as DIA
+* csr       every other entry, rows x cols with the same indexing as dia
+* rows      Number of rows of matrix
+* cols      Number of column of matrix
+*/
+
+typedef struct {
+  spmat_dia_s_t *dia;
+  spmat_csr_s_t *csr;
+  ALPHA_INT rows;
+  ALPHA_INT cols;
+} spmat_dia_csr_s_t;
+
+typedef struct {
+  spmat_dia_d_t *dia;
+  spmat_csr_d_t *csr;
+  ALPHA_INT rows;
+  ALPHA_INT cols;
+} spmat_dia_csr_d_t;
+
+typedef struct {
+  spmat_dia_c_t *dia;
+  spmat_csr_c_t *csr;
+  ALPHA_INT rows;
+  ALPHA_INT cols;
+} spmat_dia_csr_c_t;
+
+typedef struct {
+  spmat_dia_z_t *dia;
+  spmat_csr_z_t *csr;
+  ALPHA_INT rows;
+  ALPHA_INT cols;
+} spmat_dia_csr_z_t;
+
 typedef struct {
   float *values;  // 列主存储非零元
   ALPHA_INT *indices;
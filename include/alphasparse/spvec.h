@@ -0,0 +1,56 @@
+#pragma once
+
+/**
+ * @brief header for sparse vectors and the typed routines behind the generic sparse vector calls
+ */
+
+#include "spdef.h"
+#include "types.h"
+#include <stdbool.h>
+
+/*
+* sparse vector behind alphasparse_spvec_t, indx and values belong to the caller
+* unless the vector was produced by the library
+*
+* size      Length of the full vector
+* nnz       Entries stored
+* indexing  Base of indx, the typed routines subtract it when they index a dense vector
+* owned     indx and values are freed with the vector, set for the vectors spmspv returns
+*/
+struct alpha_spvec
+{
+    alphasparse_datatype_t datatype;
+    alphasparse_index_base_t indexing;
+    ALPHA_INT size;
+    ALPHA_INT nnz;
+    ALPHA_INT *indx;
+    void *values;
+    bool owned;
+};
+
+// push is taken while the entries of the selected columns, weighted by this, stay below nnz(A)
+#define ALPHA_SPMSPV_PUSH_FACTOR 4
+
+// y = alpha * x + beta * y over the full length of x
+alphasparse_status_t spvec_s_axpby(const float alpha, const struct alpha_spvec *x, const float beta, float *y);
+alphasparse_status_t spvec_d_axpby(const double alpha, const struct alpha_spvec *x, const double beta, double *y);
+alphasparse_status_t spvec_c_axpby(const ALPHA_Complex8 alpha, const struct alpha_spvec *x, const ALPHA_Complex8 beta, ALPHA_Complex8 *y);
+alphasparse_status_t spvec_z_axpby(const ALPHA_Complex16 alpha, const struct alpha_spvec *x, const ALPHA_Complex16 beta, ALPHA_Complex16 *y);
+
+// *result = x . y, conj(x) . y for CONJUGATE_TRANSPOSE
+alphasparse_status_t spvec_s_dot(const alphasparse_operation_t operation, const struct alpha_spvec *x, const float *y, float *result);
+alphasparse_status_t spvec_d_dot(const alphasparse_operation_t operation, const struct alpha_spvec *x, const double *y, double *result);
+alphasparse_status_t spvec_c_dot(const alphasparse_operation_t operation, const struct alpha_spvec *x, const ALPHA_Complex8 *y, ALPHA_Complex8 *result);
+alphasparse_status_t spvec_z_dot(const alphasparse_operation_t operation, const struct alpha_spvec *x, const ALPHA_Complex16 *y, ALPHA_Complex16 *result);
+
+// x = y at the positions of x
+alphasparse_status_t spvec_s_gather(const float *y, struct alpha_spvec *x);
+alphasparse_status_t spvec_d_gather(const double *y, struct alpha_spvec *x);
+alphasparse_status_t spvec_c_gather(const ALPHA_Complex8 *y, struct alpha_spvec *x);
+alphasparse_status_t spvec_z_gather(const ALPHA_Complex16 *y, struct alpha_spvec *x);
+
+// y = x at the positions of x, the rest of y is left alone
+alphasparse_status_t spvec_s_scatter(const struct alpha_spvec *x, float *y);
+alphasparse_status_t spvec_d_scatter(const struct alpha_spvec *x, double *y);
+alphasparse_status_t spvec_c_scatter(const struct alpha_spvec *x, ALPHA_Complex8 *y);
+alphasparse_status_t spvec_z_scatter(const struct alpha_spvec *x, ALPHA_Complex16 *y);
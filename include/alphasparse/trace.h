@@ -0,0 +1,103 @@
+#pragma once
+
+/**
+ * @brief header for per-call tracing behind alphasparse_set_verbose_mode
+ */
+
+#include "spdef.h"
+#include "types.h"
+#include "util/timing.h"
+#include "util/perf.h"
+
+// records kept by the ring buffer, the oldest ones are overwritten first
+#define ALPHA_SPARSE_TRACE_CAPACITY 1024
+// thread ids beyond this one are not part of the thread time spread
+#define ALPHA_SPARSE_TRACE_MAX_THREADS 256
+
+/*
+* one traced call
+*
+* seq           Call number since the trace was last cleared
+* kernel        Kernel the call was dispatched to, e.g. gemv_csr_trans
+* columns       Columns of the dense operand, 1 for mv and trsv
+* nnz           Entries stored by A
+* time          Wall time of the call in seconds
+* gflops        2 flops per stored entry and dense column, 8 for complex types
+* gbytes        GB/s of the compulsory traffic: A once, x once, y read and written
+* thread_*      Per-thread kernel time, EXTENDED mode and instrumented kernels only, thread_count is 0 otherwise
+* counters      Hardware counters summed over the threads, see alphasparse_set_trace_counters, -1 when not counted
+*/
+typedef struct
+{
+    ALPHA_INT64 seq;
+    char kernel[48];
+    alphasparse_format_t format;
+    alphasparse_datatype_t datatype;
+    alphasparse_status_t status;
+    ALPHA_INT rows;
+    ALPHA_INT cols;
+    ALPHA_INT columns;
+    ALPHA_INT64 nnz;
+    int thread_num;
+    double time;
+    double gflops;
+    double gbytes;
+    int thread_count;
+    double thread_min;
+    double thread_mean;
+    double thread_max;
+    alpha_perf_counters_t counters;
+} alphasparse_trace_record_t;
+
+typedef enum
+{
+    ALPHA_TRACE_MV = 0,
+    ALPHA_TRACE_SV = 1,
+    ALPHA_TRACE_MM = 2,
+    ALPHA_TRACE_SM = 3,
+} alpha_trace_op_t;
+
+// current verbose mode, read by the single branch in front of every traced call
+extern alpha_verbose_mode_t alpha_verbose;
+
+#define alpha_trace_on() (alpha_verbose != ALPHA_SPARSE_VERBOSE_OFF)
+
+// start time of a traced call, also forgets the thread times of the previous one on the calling thread
+double alpha_trace_begin();
+// append the record of a call, layout is ignored for mv and sv
+void alpha_trace_end(const alpha_trace_op_t op,
+                     const alphasparse_matrix_t A,
+                     const alphasparse_operation_t operation,
+                     const struct alpha_matrix_descr descr,
+                     const alphasparse_layout_t layout,
+                     const ALPHA_INT columns,
+                     const alphasparse_status_t status,
+                     const double start);
+// thread times of the traced call in flight on the calling thread, NULL outside EXTENDED
+double *alpha_trace_thread_times();
+
+// kernel path the dispatcher took for the call in flight on the calling thread, "_split" or
+// "_tiled", reset to "" by alpha_trace_begin and read into the kernel name by alpha_trace_end
+extern _Thread_local const char *alpha_trace_path;
+#define alpha_trace_kernel_path(path) (alpha_trace_path = (path))
+
+/*
+* Kernels opt in to the thread time spread by taking the times of their calling
+* thread before the parallel region and bracketing the work of each of its threads,
+* the macros cost one branch outside EXTENDED.
+*/
+#define alpha_trace_threads() double *const _trace_times = alpha_trace_thread_times()
+#define alpha_trace_thread_begin() \
+    const double _trace_thread_start = _trace_times != NULL ? alpha_timing_wtime() : 0.
+#define alpha_trace_thread_end(tid)                                                     \
+    do                                                                                  \
+    {                                                                                   \
+        if (_trace_times != NULL && (tid) >= 0 && (tid) < ALPHA_SPARSE_TRACE_MAX_THREADS) \
+            _trace_times[tid] = alpha_timing_wtime() - _trace_thread_start;             \
+    } while (0)
+
+// rows, cols and stored entries of a matrix of each datatype, all 0 for formats it does not know
+void trace_s_shape(const alphasparse_format_t format, const void *mat, ALPHA_INT *rows, ALPHA_INT *cols, ALPHA_INT64 *nnz);
+void trace_d_shape(const alphasparse_format_t format, const void *mat, ALPHA_INT *rows, ALPHA_INT *cols, ALPHA_INT64 *nnz);
+void trace_c_shape(const alphasparse_format_t format, const void *mat, ALPHA_INT *rows, ALPHA_INT *cols, ALPHA_INT64 *nnz);
+void trace_z_shape(const alphasparse_format_t format, const void *mat, ALPHA_INT *rows, ALPHA_INT *cols, ALPHA_INT64 *nnz);
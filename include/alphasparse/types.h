@@ -60,6 +60,15 @@ struct {
     #define ALPHA_INT int32_t
 #endif
 
+/*
+* ALPHA_OFFSET is the type of the row offsets of CSR and BSR (rows_start, rows_end).
+* It follows ALPHA_INT unless set on its own (OFFSET_64 in the Makefile), so matrices
+* with more than 2^31 non-zeros can keep 32-bit column indices.
+*/
+#ifndef ALPHA_OFFSET
+    #define ALPHA_OFFSET ALPHA_INT
+#endif
+
 #ifndef ALPHA_UINT
     #define ALPHA_UINT uint32_t
 #endif
@@ -23,6 +23,10 @@
 
 #include "util/io.h"
 #include "util/algebra.h"
+#include "util/bench.h"
+#include "util/generate.h"
+#include "util/perf.h"
+#include "util/steal.h"
 
 #ifndef index2
 #define index2(y, x, ldx) ((x) + (ldx) * (y))
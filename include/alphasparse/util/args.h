@@ -11,12 +11,21 @@
 #define DEFAULT_LAYOUT ALPHA_SPARSE_LAYOUT_ROW_MAJOR
 #define DEFAULT_SPARSE_OPERATION ALPHA_SPARSE_OPERATION_NON_TRANSPOSE
 #define DEFAULT_ITER 1
+#define DEFAULT_FORMAT ALPHA_SPARSE_FORMAT_CSR
+#define DEFAULT_DATA_TYPE ALPHA_SPARSE_DATATYPE_DOUBLE
+#define DEFAULT_BLOCK_SIZE 4
+#define DEFAULT_OP "mv"
+#define DEFAULT_WARMUP 3
+#define DEFAULT_OUTPUT "text"
+#define DEFAULT_SEED 1
 
 alphasparse_layout_t alphasparse_layout_parse(const char *arg);
 alphasparse_operation_t alphasparse_operation_parse(const char *arg);
 alphasparse_matrix_type_t alphasparse_matrix_type_parse(const char *arg);
 alphasparse_fill_mode_t alphasparse_fill_mode_parse(const char *arg);
 alphasparse_diag_type_t alphasparse_diag_type_parse(const char *arg);
+alphasparse_format_t alphasparse_format_parse(const char *arg);
+alphasparse_datatype_t alphasparse_datatype_parse(const char *arg);
 
 void args_help(const int argc, const char *argv[]);
 bool args_get_if_check(const int argc, const char *argv[]);
@@ -28,6 +37,19 @@ const char* args_get_data_file(const int argc, const char *argv[]);
 const char* args_get_data_fileA(const int argc, const char *argv[]);
 const char* args_get_data_fileB(const int argc, const char *argv[]);
 
+// benchmark driver options
+const char *args_get_op(const int argc, const char *argv[]);
+int args_get_warmup(const int argc, const char *argv[]);
+const char *args_get_output(const int argc, const char *argv[]);
+const char *args_get_output_file(const int argc, const char *argv[]);
+double args_get_stream_bw(const int argc, const char *argv[]); // 0 when not given
+int args_get_block_size(const int argc, const char *argv[]);
+const char *args_get_gen(const int argc, const char *argv[]); // NULL when not given
+unsigned long long args_get_seed(const int argc, const char *argv[]);
+bool args_get_perf(const int argc, const char *argv[]);
+alphasparse_format_t alpha_args_get_formatA(const int argc, const char *argv[]);
+alphasparse_datatype_t alpha_args_get_data_type(const int argc, const char *argv[]);
+
 alphasparse_layout_t alpha_args_get_layout_helper(const int argc, const char *argv[], const int layout_opt);
 struct alpha_matrix_descr alpha_args_get_matrix_descr_helper(const int argc, const char *argv[], const int type_opt, const int fill_opt, const int diag_opt);
 alphasparse_operation_t alpha_args_get_trans_helper(const int argc, const char *argv[], const int trans_opt);
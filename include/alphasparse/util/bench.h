@@ -0,0 +1,22 @@
+#pragma once
+
+/**
+ * @brief header for benchmark statistics and the memory bandwidth reference
+ */
+
+#include <stddef.h>
+
+typedef struct
+{
+    int count;
+    double min;
+    double median;
+    double p95;
+    double mean;
+} alpha_bench_stats_t;
+
+// statistics of count timings, times is sorted in place
+void alpha_bench_stats(double *times, const int count, alpha_bench_stats_t *stats);
+
+// best of a few STREAM triad runs a[i] = b[i] + s * c[i] over three arrays of elements doubles, in GB/s
+double alpha_bench_stream_triad(const size_t elements, const int thread_num);
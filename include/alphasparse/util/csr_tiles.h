@@ -0,0 +1,72 @@
+#pragma once
+
+/**
+ * @brief header for the 2D tiles of a CSR matrix behind the tiled SpMV
+ *
+ * Rows are grouped in blocks of block_rows and every block is cut into
+ * panels of panel_cols columns. The entries are copied block by block and
+ * within a block panel by panel, so a thread that walks its blocks in order
+ * reads one panel of x at a time. The rows of a block with entries in a
+ * panel form one segment each, rows without any are skipped.
+ */
+
+#include "../types.h"
+#include "../spdef.h"
+#include <stddef.h>
+
+/*
+* panel_cols    Columns per panel
+* block_rows    Rows per row block
+* row_blocks    Number of row blocks
+* block_ptr     Offset of the entries of every row block, row_blocks + 1 entries
+* block_seg     First segment of every row block, row_blocks + 1 entries
+* seg_row       Row of every segment
+* seg_ptr       Offset of the entries of every segment, one more than the segments
+* col_indx      Column of every entry in tile order
+* values        Value of every entry in tile order, in the datatype of the matrix
+* value_pos     Position in the values of the matrix of every entry in tile order
+* value_size    Bytes of one value
+*/
+typedef struct
+{
+  ALPHA_INT panel_cols;
+  ALPHA_INT block_rows;
+  ALPHA_INT row_blocks;
+  ALPHA_OFFSET *block_ptr;
+  ALPHA_OFFSET *block_seg;
+  ALPHA_INT *seg_row;
+  ALPHA_OFFSET *seg_ptr;
+  ALPHA_INT *col_indx;
+  void *values;
+  ALPHA_OFFSET *value_pos;
+  size_t value_size;
+} alpha_csr_tiles_t;
+
+/*
+* panel width and row block height for values of value_size bytes, a panel of x takes half
+* of the share of L3 of one of num_threads threads and the rows of a block half of L2
+*/
+void alpha_csr_tiles_size(const ALPHA_INT rows, const size_t value_size, const ALPHA_INT num_threads, ALPHA_INT *panel_cols, ALPHA_INT *block_rows);
+
+/*
+* tiles of a CSR matrix, the columns of a row need not be sorted. Counts the entries and
+* segments of every row block first and fills the blocks in parallel after.
+*/
+alphasparse_status_t alpha_csr_tiles_build(const ALPHA_INT rows,
+                                           const ALPHA_INT cols,
+                                           const ALPHA_OFFSET *rows_start,
+                                           const ALPHA_OFFSET *rows_end,
+                                           const ALPHA_INT *col_indx,
+                                           const void *values,
+                                           const size_t value_size,
+                                           const ALPHA_INT panel_cols,
+                                           const ALPHA_INT block_rows,
+                                           alpha_csr_tiles_t **tiles);
+
+/*
+* copies the values of the matrix into the tiles again through value_pos, for values changed
+* in place on the pattern the tiles were built from
+*/
+void alpha_csr_tiles_refresh(alpha_csr_tiles_t *tiles, const void *values);
+
+void alpha_csr_tiles_destroy(alpha_csr_tiles_t *tiles);
@@ -0,0 +1,351 @@
+#pragma once
+
+/**
+ * @brief header for the fused kernels of the DIA+CSR hybrid format
+ *
+ * Rows of y are walked in tiles with the products of a tile kept in a local
+ * accumulator. Every diagonal is clipped to the tile and runs over
+ * contiguous values and x as one vector multiply-add, then the CSR tail
+ * rows of the tile are added and y is stored once, scaled by beta.
+ *
+ * Transposed products tile the columns of A the same way for the
+ * diagonals. The tail is scattered first, every thread into a partial y of
+ * its own, and the partials of a tile are summed into its accumulator
+ * before the store.
+ *
+ * Included by the _x_ and _c_ kernels, ALPHA_Number is the type being
+ * compiled.
+ */
+
+#include "../types.h"
+#include "../compute.h"
+#include "../spmat.h"
+#include "../util.h"
+#include "thread.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#define DIA_CSR_INLINE static inline __attribute__((always_inline))
+
+// rows of y per tile of the vector kernels
+#define DIA_CSR_TILE 256
+// rows and dense columns per tile of the row-major kernel
+#define DIA_CSR_MM_ROWS 32
+#define DIA_CSR_MM_TILE 16
+
+/*
+* vector of DIA_CSR_W ALPHA_Floats, interleaved complex numbers take two
+*
+* dia_vec_swap      exchange the two parts of every complex in a register
+* dia_vec_dupre     real part of every complex in both of its lanes
+* dia_vec_dupim     imaginary part of every complex in both of its lanes
+* dia_vec_fmaddsub  a * b - c in the real lanes, a * b + c in the imaginary ones
+* dia_vec_fmsubadd  a * b + c in the real lanes, a * b - c in the imaginary ones
+*/
+#if defined(__AVX512F__) && defined(DOUBLE)
+#define DIA_CSR_W 8
+typedef __m512d dia_vec_t;
+#define dia_vec_loadu(p) _mm512_loadu_pd((const double *)(p))
+#define dia_vec_storeu(p, v) _mm512_storeu_pd((double *)(p), v)
+#define dia_vec_set1(v) _mm512_set1_pd(v)
+#define dia_vec_add(a, b) _mm512_add_pd(a, b)
+#define dia_vec_mul(a, b) _mm512_mul_pd(a, b)
+#define dia_vec_fmadd(a, b, c) _mm512_fmadd_pd(a, b, c)
+#define dia_vec_fmaddsub(a, b, c) _mm512_fmaddsub_pd(a, b, c)
+#define dia_vec_fmsubadd(a, b, c) _mm512_fmsubadd_pd(a, b, c)
+#define dia_vec_swap(v) _mm512_permute_pd(v, 0x55)
+#define dia_vec_dupre(v) _mm512_movedup_pd(v)
+#define dia_vec_dupim(v) _mm512_permute_pd(v, 0xFF)
+#elif defined(__AVX512F__)
+#define DIA_CSR_W 16
+typedef __m512 dia_vec_t;
+#define dia_vec_loadu(p) _mm512_loadu_ps((const float *)(p))
+#define dia_vec_storeu(p, v) _mm512_storeu_ps((float *)(p), v)
+#define dia_vec_set1(v) _mm512_set1_ps(v)
+#define dia_vec_add(a, b) _mm512_add_ps(a, b)
+#define dia_vec_mul(a, b) _mm512_mul_ps(a, b)
+#define dia_vec_fmadd(a, b, c) _mm512_fmadd_ps(a, b, c)
+#define dia_vec_fmaddsub(a, b, c) _mm512_fmaddsub_ps(a, b, c)
+#define dia_vec_fmsubadd(a, b, c) _mm512_fmsubadd_ps(a, b, c)
+#define dia_vec_swap(v) _mm512_permute_ps(v, 0xB1)
+#define dia_vec_dupre(v) _mm512_moveldup_ps(v)
+#define dia_vec_dupim(v) _mm512_movehdup_ps(v)
+#elif defined(__AVX2__) && defined(__FMA__) && defined(DOUBLE)
+#define DIA_CSR_W 4
+typedef __m256d dia_vec_t;
+#define dia_vec_loadu(p) _mm256_loadu_pd((const double *)(p))
+#define dia_vec_storeu(p, v) _mm256_storeu_pd((double *)(p), v)
+#define dia_vec_set1(v) _mm256_set1_pd(v)
+#define dia_vec_add(a, b) _mm256_add_pd(a, b)
+#define dia_vec_mul(a, b) _mm256_mul_pd(a, b)
+#define dia_vec_fmadd(a, b, c) _mm256_fmadd_pd(a, b, c)
+#define dia_vec_fmaddsub(a, b, c) _mm256_fmaddsub_pd(a, b, c)
+#define dia_vec_fmsubadd(a, b, c) _mm256_fmsubadd_pd(a, b, c)
+#define dia_vec_swap(v) _mm256_permute_pd(v, 0x5)
+#define dia_vec_dupre(v) _mm256_movedup_pd(v)
+#define dia_vec_dupim(v) _mm256_permute_pd(v, 0xF)
+#elif defined(__AVX2__) && defined(__FMA__)
+#define DIA_CSR_W 8
+typedef __m256 dia_vec_t;
+#define dia_vec_loadu(p) _mm256_loadu_ps((const float *)(p))
+#define dia_vec_storeu(p, v) _mm256_storeu_ps((float *)(p), v)
+#define dia_vec_set1(v) _mm256_set1_ps(v)
+#define dia_vec_add(a, b) _mm256_add_ps(a, b)
+#define dia_vec_mul(a, b) _mm256_mul_ps(a, b)
+#define dia_vec_fmadd(a, b, c) _mm256_fmadd_ps(a, b, c)
+#define dia_vec_fmaddsub(a, b, c) _mm256_fmaddsub_ps(a, b, c)
+#define dia_vec_fmsubadd(a, b, c) _mm256_fmsubadd_ps(a, b, c)
+#define dia_vec_swap(v) _mm256_permute_ps(v, 0xB1)
+#define dia_vec_dupre(v) _mm256_moveldup_ps(v)
+#define dia_vec_dupim(v) _mm256_movehdup_ps(v)
+#endif
+
+#ifdef DIA_CSR_W
+#ifdef COMPLEX
+// ALPHA_Numbers per vector
+#define DIA_CSR_N (DIA_CSR_W / 2)
+// a * b for the complex numbers of a and b, conj(a) * b with conj, ar and ai hold a as from dupre and dupim
+DIA_CSR_INLINE dia_vec_t dia_vec_cmul(const dia_vec_t ar, const dia_vec_t ai, const dia_vec_t b, const bool conj)
+{
+    const dia_vec_t t = dia_vec_mul(ai, dia_vec_swap(b));
+    return conj ? dia_vec_fmsubadd(ar, b, t) : dia_vec_fmaddsub(ar, b, t);
+}
+#else
+#define DIA_CSR_N DIA_CSR_W
+#endif
+#endif
+
+/*
+* acc[i] += v[i] * x[i] for i in [0, n), conj(v[i]) with conj
+*/
+DIA_CSR_INLINE void dia_csr_vmadd(const ALPHA_INT n,
+                                  const ALPHA_Number *v,
+                                  const ALPHA_Number *x,
+                                  const bool conj,
+                                  ALPHA_Number *acc)
+{
+    ALPHA_INT i = 0;
+#ifdef DIA_CSR_W
+    for (; i + DIA_CSR_N <= n; i += DIA_CSR_N)
+    {
+        const dia_vec_t a = dia_vec_loadu(v + i);
+        const dia_vec_t b = dia_vec_loadu(x + i);
+#ifdef COMPLEX
+        dia_vec_storeu(acc + i, dia_vec_add(dia_vec_loadu(acc + i), dia_vec_cmul(dia_vec_dupre(a), dia_vec_dupim(a), b, conj)));
+#else
+        dia_vec_storeu(acc + i, dia_vec_fmadd(a, b, dia_vec_loadu(acc + i)));
+#endif
+    }
+#endif
+#ifdef COMPLEX
+    if (conj)
+    {
+        for (; i < n; i++)
+            alpha_madde_2c(acc[i], v[i], x[i]);
+        return;
+    }
+#endif
+    for (; i < n; i++)
+        alpha_madde(acc[i], v[i], x[i]);
+}
+
+/*
+* y[i] += a * x[i] for i in [0, n)
+*/
+DIA_CSR_INLINE void dia_csr_axpy(const ALPHA_INT n,
+                                 const ALPHA_Number a,
+                                 const ALPHA_Number *x,
+                                 ALPHA_Number *y)
+{
+    ALPHA_INT i = 0;
+#ifdef DIA_CSR_W
+#ifdef COMPLEX
+    const dia_vec_t ar = dia_vec_set1(a.real), ai = dia_vec_set1(a.imag);
+#else
+    const dia_vec_t va = dia_vec_set1(a);
+#endif
+    for (; i + DIA_CSR_N <= n; i += DIA_CSR_N)
+    {
+#ifdef COMPLEX
+        dia_vec_storeu(y + i, dia_vec_add(dia_vec_loadu(y + i), dia_vec_cmul(ar, ai, dia_vec_loadu(x + i), false)));
+#else
+        dia_vec_storeu(y + i, dia_vec_fmadd(va, dia_vec_loadu(x + i), dia_vec_loadu(y + i)));
+#endif
+    }
+#endif
+    for (; i < n; i++)
+        alpha_madde(y[i], a, x[i]);
+}
+
+/*
+* acc[0, r1 - r0) = rows [r0, r1) of A x
+*/
+DIA_CSR_INLINE void dia_csr_rows(const ALPHA_SPMAT_DIA_CSR *A,
+                                 const ALPHA_INT r0,
+                                 const ALPHA_INT r1,
+                                 const ALPHA_Number *x,
+                                 ALPHA_Number *acc)
+{
+    const ALPHA_SPMAT_DIA *dia = A->dia;
+    const ALPHA_SPMAT_CSR *csr = A->csr;
+    for (ALPHA_INT i = 0; i < r1 - r0; i++)
+        alpha_setzero(acc[i]);
+    for (ALPHA_INT d = 0; d < dia->ndiag; d++)
+    {
+        const ALPHA_INT dis = dia->distance[d];
+        const ALPHA_INT lo = alpha_max(r0, -dis);
+        const ALPHA_INT hi = alpha_min(r1, A->cols - dis);
+        const ALPHA_Number *v = &dia->values[(size_t)d * dia->lval];
+        if (lo < hi)
+            dia_csr_vmadd(hi - lo, &v[lo], &x[lo + dis], false, &acc[lo - r0]);
+    }
+    for (ALPHA_INT r = r0; r < r1; r++)
+        for (ALPHA_OFFSET e = csr->rows_start[r]; e < csr->rows_end[r]; e++)
+            alpha_madde(acc[r - r0], csr->values[e], x[csr->col_indx[e]]);
+}
+
+/*
+* acc[0, c1 - c0) = columns [c0, c1) of the diagonals of A, transposed or conjugated, times x
+*/
+DIA_CSR_INLINE void dia_csr_cols(const ALPHA_SPMAT_DIA_CSR *A,
+                                 const ALPHA_INT c0,
+                                 const ALPHA_INT c1,
+                                 const ALPHA_Number *x,
+                                 const bool conj,
+                                 ALPHA_Number *acc)
+{
+    const ALPHA_SPMAT_DIA *dia = A->dia;
+    for (ALPHA_INT j = 0; j < c1 - c0; j++)
+        alpha_setzero(acc[j]);
+    for (ALPHA_INT d = 0; d < dia->ndiag; d++)
+    {
+        const ALPHA_INT dis = dia->distance[d];
+        const ALPHA_INT lo = alpha_max(c0, dis);
+        const ALPHA_INT hi = alpha_min(c1, A->rows + dis);
+        // value and x of column j sit at row j - dis
+        const ALPHA_Number *v = &dia->values[(size_t)d * dia->lval];
+        if (lo < hi)
+            dia_csr_vmadd(hi - lo, &v[lo - dis], &x[lo - dis], conj, &acc[lo - c0]);
+    }
+}
+
+typedef struct
+{
+    const ALPHA_SPMAT_CSR *csr;
+    const ALPHA_Number *x;
+    bool conj;
+    ALPHA_Number *tmp;
+} dia_csr_tail_t;
+
+// scatter the tail rows [begin, end) times x into the partial y of the executing thread
+static inline void dia_csr_tail_rows(void *arg, const ALPHA_INT tid, const ALPHA_INT begin, const ALPHA_INT end)
+{
+    const dia_csr_tail_t *p = arg;
+    const ALPHA_SPMAT_CSR *csr = p->csr;
+    ALPHA_Number *local_y = p->tmp + (size_t)tid * csr->cols;
+    for (ALPHA_INT r = begin; r < end; r++)
+    {
+#ifdef COMPLEX
+        if (p->conj)
+        {
+            for (ALPHA_OFFSET e = csr->rows_start[r]; e < csr->rows_end[r]; e++)
+                alpha_madde_2c(local_y[csr->col_indx[e]], csr->values[e], p->x[r]);
+            continue;
+        }
+#endif
+        for (ALPHA_OFFSET e = csr->rows_start[r]; e < csr->rows_end[r]; e++)
+            alpha_madde(local_y[csr->col_indx[e]], csr->values[e], p->x[r]);
+    }
+}
+
+DIA_CSR_INLINE void dia_csr_store(const ALPHA_Number alpha,
+                                  const ALPHA_Number *acc,
+                                  const ALPHA_INT n,
+                                  const ALPHA_Number beta,
+                                  ALPHA_Number *y)
+{
+    ALPHA_INT i = 0;
+#ifdef DIA_CSR_W
+#ifdef COMPLEX
+    const dia_vec_t ar = dia_vec_set1(alpha.real), ai = dia_vec_set1(alpha.imag);
+    const dia_vec_t br = dia_vec_set1(beta.real), bi = dia_vec_set1(beta.imag);
+    for (; i + DIA_CSR_N <= n; i += DIA_CSR_N)
+        dia_vec_storeu(y + i, dia_vec_add(dia_vec_cmul(br, bi, dia_vec_loadu(y + i), false), dia_vec_cmul(ar, ai, dia_vec_loadu(acc + i), false)));
+#else
+    const dia_vec_t va = dia_vec_set1(alpha), vb = dia_vec_set1(beta);
+    for (; i + DIA_CSR_N <= n; i += DIA_CSR_N)
+        dia_vec_storeu(y + i, dia_vec_fmadd(va, dia_vec_loadu(acc + i), dia_vec_mul(vb, dia_vec_loadu(y + i))));
+#endif
+#endif
+    for (; i < n; i++)
+    {
+        alpha_mul(y[i], y[i], beta);
+        alpha_madde(y[i], alpha, acc[i]);
+    }
+}
+
+/*
+* y := alpha * op(A) x + beta * y for op the transpose, or the conjugate
+* transpose with conj. The tail is cut into parts of at least a tile of
+* entries each, a tail too small to fill two parts runs on one thread.
+*/
+DIA_CSR_INLINE alphasparse_status_t dia_csr_gemv_trans(const ALPHA_Number alpha,
+                                                       const ALPHA_SPMAT_DIA_CSR *A,
+                                                       const ALPHA_Number *x,
+                                                       const ALPHA_Number beta,
+                                                       ALPHA_Number *y,
+                                                       const bool conj)
+{
+    const ALPHA_SPMAT_CSR *csr = A->csr;
+    const ALPHA_INT m = A->rows;
+    const ALPHA_INT n = A->cols;
+    const ALPHA_INT thread_num = alpha_get_thread_num();
+    const ALPHA_INT64 tail = m > 0 ? csr->rows_end[m - 1] - csr->rows_start[0] : 0;
+    const ALPHA_INT parts = tail > 0 ? (ALPHA_INT)alpha_max(alpha_min(tail / DIA_CSR_TILE, (ALPHA_INT64)thread_num), 1) : 0;
+
+    // one partial y per part, taken from the workspace of the execution context when there is one
+    const size_t tmp_size = sizeof(ALPHA_Number) * (size_t)n * parts;
+    ALPHA_Number *tmp = NULL;
+    bool tmp_owned = false;
+    if (tmp_size > 0)
+    {
+        tmp = (ALPHA_Number *)alpha_exec_workspace(tmp_size);
+        tmp_owned = tmp == NULL;
+        if (tmp_owned)
+            tmp = (ALPHA_Number *)malloc(tmp_size);
+        check_null_return(tmp, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+        for (size_t i = 0; i < (size_t)n * parts; ++i)
+            alpha_setzero(tmp[i]);
+        dia_csr_tail_t rows = {csr, x, conj, tmp};
+        alpha_steal_for_offset(parts, m, csr->rows_start, csr->rows_end, dia_csr_tail_rows, &rows);
+    }
+
+    const ALPHA_INT tiles = (n + DIA_CSR_TILE - 1) / DIA_CSR_TILE;
+    const ALPHA_INT num_threads = alpha_min(thread_num, alpha_max(tiles, 1));
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+#endif
+    for (ALPHA_INT t = 0; t < tiles; t++)
+    {
+        ALPHA_Number acc[DIA_CSR_TILE];
+        const ALPHA_INT c0 = t * DIA_CSR_TILE;
+        const ALPHA_INT c1 = alpha_min(n, c0 + DIA_CSR_TILE);
+        dia_csr_cols(A, c0, c1, x, conj, acc);
+        for (ALPHA_INT p = 0; p < parts; p++)
+        {
+            const ALPHA_Number *local_y = tmp + (size_t)p * n + c0;
+            for (ALPHA_INT j = 0; j < c1 - c0; j++)
+                alpha_adde(acc[j], local_y[j]);
+        }
+        dia_csr_store(alpha, acc, c1 - c0, beta, &y[c0]);
+    }
+    if (tmp_owned)
+        free(tmp);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
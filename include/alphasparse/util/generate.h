@@ -0,0 +1,62 @@
+#pragma once
+
+/**
+ * @brief header for synthetic matrix generators
+ *
+ * Every generator writes CSR straight away, in parallel. Random structure and
+ * values derive from (seed, row) or (seed, edge) streams of random.h, so a spec
+ * and seed give the same matrix on any thread count.
+ *
+ * Off-diagonal values are uniform in (-1, 0] and a stored diagonal holds the
+ * row length. Square matrices with a full diagonal are therefore strictly
+ * diagonally dominant and fit trsv as well as mv.
+ */
+
+#include "../spdef.h"
+#include "../types.h"
+#include <stdint.h>
+
+typedef enum
+{
+    ALPHA_GEN_STENCIL_5PT = 0,  // 2D grid nx * ny
+    ALPHA_GEN_STENCIL_7PT = 1,  // 3D grid nx * ny * nz
+    ALPHA_GEN_STENCIL_27PT = 2, // 3D grid nx * ny * nz
+    ALPHA_GEN_BANDED = 3,       // n rows, bandwidth entries on each side of the diagonal
+    ALPHA_GEN_BLOCK_DIAG = 4,   // n rows of dense block_size blocks on the diagonal
+    ALPHA_GEN_FEM = 5,          // 2D quad mesh nx * ny, 9 coupled nodes of block_size dofs each
+    ALPHA_GEN_ER = 6,           // Erdos-Renyi n * n, each entry present with probability degree / n
+    ALPHA_GEN_RMAT = 7,         // R-MAT 2^scale nodes, degree * 2^scale edges, duplicates merged
+} alpha_gen_kind_t;
+
+typedef struct
+{
+    alpha_gen_kind_t kind;
+    ALPHA_INT nx, ny, nz;
+    ALPHA_INT n;
+    ALPHA_INT bandwidth;
+    ALPHA_INT block_size;
+    ALPHA_INT scale;
+    double degree;
+    double a, b, c; // R-MAT quadrant probabilities, d = 1 - a - b - c
+    uint64_t seed;
+} alpha_gen_t;
+
+/*
+* spec strings accepted by alpha_gen_parse
+*
+* stencil5:NX,NY  stencil7:NX,NY,NZ  stencil27:NX,NY,NZ
+* banded:N,BANDWIDTH  blockdiag:N,BLOCK_SIZE  fem:NX,NY,BLOCK_SIZE
+* er:N,DEGREE  rmat:SCALE,DEGREE[,A,B,C]   (A,B,C default to 0.57,0.19,0.19)
+*/
+alphasparse_status_t alpha_gen_parse(const char *spec, const uint64_t seed, alpha_gen_t *gen);
+
+/* structure only, *rows_offset holds rows + 1 entries, columns are sorted and unique in each row */
+alphasparse_status_t alpha_gen_pattern(const alpha_gen_t *gen, ALPHA_INT *rows, ALPHA_INT *cols, ALPHA_OFFSET **rows_offset, ALPHA_INT **col_index);
+/* value of the entry (row, col) of a row holding row_nnz entries */
+void alpha_gen_value(const alpha_gen_t *gen, const ALPHA_INT row, const ALPHA_INT col, const ALPHA_OFFSET row_nnz, double *re, double *im);
+
+/* structure and values, arrays are allocated with alpha_memalign */
+alphasparse_status_t alpha_gen_s_csr(const alpha_gen_t *gen, ALPHA_INT *rows, ALPHA_INT *cols, ALPHA_OFFSET **rows_offset, ALPHA_INT **col_index, float **values);
+alphasparse_status_t alpha_gen_d_csr(const alpha_gen_t *gen, ALPHA_INT *rows, ALPHA_INT *cols, ALPHA_OFFSET **rows_offset, ALPHA_INT **col_index, double **values);
+alphasparse_status_t alpha_gen_c_csr(const alpha_gen_t *gen, ALPHA_INT *rows, ALPHA_INT *cols, ALPHA_OFFSET **rows_offset, ALPHA_INT **col_index, ALPHA_Complex8 **values);
+alphasparse_status_t alpha_gen_z_csr(const alpha_gen_t *gen, ALPHA_INT *rows, ALPHA_INT *cols, ALPHA_OFFSET **rows_offset, ALPHA_INT **col_index, ALPHA_Complex16 **values);
@@ -6,6 +6,7 @@
 
 #include "../spdef.h"
 #include "../types.h"
+#include <stdbool.h>
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -21,6 +22,64 @@ void alpha_read_coo_d(const char *file, ALPHA_INT *m_p, ALPHA_INT *n_p, ALPHA_IN
 void alpha_read_coo_c(const char *file, ALPHA_INT *m_p, ALPHA_INT *n_p, ALPHA_INT *nnz_p, ALPHA_INT **row_index, ALPHA_INT **col_index, ALPHA_Complex8 **values);
 void alpha_read_coo_z(const char *file, ALPHA_INT *m_p, ALPHA_INT *n_p, ALPHA_INT *nnz_p, ALPHA_INT **row_index, ALPHA_INT **col_index, ALPHA_Complex16 **values);
 
+// 1 if the MatrixMarket banner declares a "pattern" field, such files can go straight to the *_create_*_pattern interfaces
+int alpha_read_coo_is_pattern(const char *file);
+void alpha_read_coo_pattern(const char *file, ALPHA_INT *m_p, ALPHA_INT *n_p, ALPHA_INT *nnz_p, ALPHA_INT **row_index, ALPHA_INT **col_index);
+
+typedef enum
+{
+    ALPHA_MTX_FIELD_REAL = 0, // real and integer
+    ALPHA_MTX_FIELD_COMPLEX = 1,
+    ALPHA_MTX_FIELD_PATTERN = 2,
+} alpha_mtx_field_t;
+
+typedef enum
+{
+    ALPHA_MTX_GENERAL = 0,
+    ALPHA_MTX_SYMMETRIC = 1,
+    ALPHA_MTX_SKEW_SYMMETRIC = 2,
+    ALPHA_MTX_HERMITIAN = 3,
+} alpha_mtx_symmetry_t;
+
+/**
+ * a MatrixMarket coordinate file mapped into memory, the alpha_mtx_read_* calls
+ * parse it on all threads straight into caller arrays of alpha_mtx_nnz_max() entries
+ */
+typedef struct
+{
+    const char *data;   // mapped file
+    size_t size;        // file bytes
+    size_t body;        // offset of the first entry line
+    ALPHA_INT rows;
+    ALPHA_INT cols;
+    ALPHA_INT64 entries; // entry lines in the file, before symmetric expansion
+    alpha_mtx_field_t field;
+    alpha_mtx_symmetry_t symmetry;
+    bool half;          // set after open: keep symmetric and hermitian files half-stored in the lower triangle
+    double parse_time; // seconds spent in the last read
+} alpha_mtx_t;
+
+alphasparse_status_t alpha_mtx_open(const char *file, alpha_mtx_t *mtx);
+void alpha_mtx_close(alpha_mtx_t *mtx);
+ALPHA_INT64 alpha_mtx_nnz_max(const alpha_mtx_t *mtx);
+// descriptor matching what the reads return, symmetric/hermitian lower for half-stored files and general otherwise
+struct alpha_matrix_descr alpha_mtx_descr(const alpha_mtx_t *mtx);
+
+// symmetric, skew and hermitian files are expanded unless mtx->half is set, values may be NULL to read the indices only
+alphasparse_status_t alpha_mtx_read_coo_s(alpha_mtx_t *mtx, ALPHA_INT *row_index, ALPHA_INT *col_index, float *values, ALPHA_INT *nnz);
+alphasparse_status_t alpha_mtx_read_coo_d(alpha_mtx_t *mtx, ALPHA_INT *row_index, ALPHA_INT *col_index, double *values, ALPHA_INT *nnz);
+alphasparse_status_t alpha_mtx_read_coo_c(alpha_mtx_t *mtx, ALPHA_INT *row_index, ALPHA_INT *col_index, ALPHA_Complex8 *values, ALPHA_INT *nnz);
+alphasparse_status_t alpha_mtx_read_coo_z(alpha_mtx_t *mtx, ALPHA_INT *row_index, ALPHA_INT *col_index, ALPHA_Complex16 *values, ALPHA_INT *nnz);
+
+// rows_offset holds rows + 1 entries, columns come out sorted within each row
+alphasparse_status_t alpha_mtx_read_csr_s(alpha_mtx_t *mtx, ALPHA_OFFSET *rows_offset, ALPHA_INT *col_index, float *values);
+alphasparse_status_t alpha_mtx_read_csr_d(alpha_mtx_t *mtx, ALPHA_OFFSET *rows_offset, ALPHA_INT *col_index, double *values);
+alphasparse_status_t alpha_mtx_read_csr_c(alpha_mtx_t *mtx, ALPHA_OFFSET *rows_offset, ALPHA_INT *col_index, ALPHA_Complex8 *values);
+alphasparse_status_t alpha_mtx_read_csr_z(alpha_mtx_t *mtx, ALPHA_OFFSET *rows_offset, ALPHA_INT *col_index, ALPHA_Complex16 *values);
+
+// parse throughput of the last read
+void alpha_mtx_stat_print(const alpha_mtx_t *mtx, const char *name);
+
 #ifdef __MKL__
 
 #include <mkl.h>
@@ -14,12 +14,23 @@ void *alpha_malloc(size_t bytes);
 
 void *alpha_memalign(size_t bytes, size_t alignment);
 
+/*
+* Under NUMA the blocks come from numa_alloc_onnode with their size kept in a 64 byte
+* header in front, the pointer returned is past it. Memory from alpha_malloc or
+* alpha_memalign therefore never goes to free() or realloc(), only to alpha_release.
+*/
 void alpha_free(void *point);
+// releases memory from alpha_malloc or alpha_memalign, alpha_free leaves it alone since
+// converted handles may share arrays with their source
+void alpha_release(void *point);
 void alpha_free_dcu(void *point);
 
 #define L1_CACHE_SIZE (64l << 10)
 #define L2_CACHE_SIZE (512l << 10)
 #define L3_CACHE_SIZE (32l << 20)
+// data or unified cache of level 1 to 3 of the first cpu in bytes, read from sysfs once,
+// the L?_CACHE_SIZE above when it is not there
+size_t alpha_cache_size(const int level);
 void alpha_clear_cache();
 
 void alpha_fill_s(float *arr, const float num, const size_t size);
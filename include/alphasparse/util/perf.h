@@ -0,0 +1,55 @@
+#pragma once
+
+/**
+ * @brief header for hardware performance counters around kernel calls
+ *
+ * Counters come from perf_event_open, opened once per thread the first time a
+ * thread takes part in a measurement and kept open until the thread exits or
+ * alpha_perf_enable(false) closes the counters of every thread. Events the
+ * kernel or the CPU does not provide are left out, and on machines without any
+ * of them alpha_perf_enable reports failure and every later call is a no-op.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum
+{
+    ALPHA_PERF_CYCLES = 0,
+    ALPHA_PERF_INSTRUCTIONS = 1,
+    ALPHA_PERF_CACHE_MISSES = 2,    // generic cache misses, usually the last level
+    ALPHA_PERF_LLC_LOADS = 3,       // loads reaching the last level cache
+    ALPHA_PERF_LLC_LOAD_MISSES = 4, // loads going to memory, times the line size gives the DRAM read traffic
+    ALPHA_PERF_STALLED_FRONTEND = 5,
+    ALPHA_PERF_STALLED_BACKEND = 6,
+} alpha_perf_event_t;
+
+#define ALPHA_PERF_EVENT_NUM 7
+
+// event counts summed over the threads, -1 for events that are not available
+typedef struct
+{
+    int64_t value[ALPHA_PERF_EVENT_NUM];
+} alpha_perf_counters_t;
+
+extern const char *const alpha_perf_event_name[ALPHA_PERF_EVENT_NUM];
+
+// switch counting on or off, enabling fails when no event can be opened on this machine,
+// disabling closes the counters of all threads and must not overlap a measurement
+bool alpha_perf_enable(const bool enable);
+
+bool alpha_perf_enabled();
+
+// every counter set to -1
+void alpha_perf_clear(alpha_perf_counters_t *counters);
+
+/*
+* Counting covers the threads of a parallel region of thread_num threads,
+* begin and end run one region each to read the counters of every thread, so
+* the measured calls should use the same thread count. begin returns the
+* generation of the measurement and end only sums the threads that started
+* that one, so measurements from different user threads do not mix.
+*/
+unsigned alpha_perf_begin(const int thread_num);
+
+void alpha_perf_end(const int thread_num, const unsigned generation, alpha_perf_counters_t *counters);
@@ -13,4 +13,29 @@ inline long long random_long(long long m) { return (long long)rand() % m; }
 
 inline double random_double() { return (double)rand() / RAND_MAX; }
 
-inline float random_float() { return (float)rand() / RAND_MAX; }
\ No newline at end of file
+inline float random_float() { return (float)rand() / RAND_MAX; }
+
+#include <stdint.h>
+
+// counter based generator, a (seed, stream) pair gives the same sequence on any
+// thread and thread count, so parallel generators stay reproducible
+static inline uint64_t alpha_random_mix(uint64_t z) {
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+static inline uint64_t alpha_random_stream(uint64_t seed, uint64_t stream) {
+  return alpha_random_mix(seed * 0x9e3779b97f4a7c15ull + alpha_random_mix(stream + 1));
+}
+
+// splitmix64 step
+static inline uint64_t alpha_random_next(uint64_t *state) {
+  *state += 0x9e3779b97f4a7c15ull;
+  return alpha_random_mix(*state);
+}
+
+// uniform in [0, 1)
+static inline double alpha_random_uniform(uint64_t *state) {
+  return (alpha_random_next(state) >> 11) * (1.0 / 9007199254740992.0);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+/**
+ * @brief header for the orderings behind alphasparse_reorder
+ *
+ * The orderings run on an undirected graph in compressed form, adjacency of
+ * vertex v in idx[ptr[v], ptr[v + 1]) without loops or repeated neighbours.
+ * perm[i] is the vertex placed at position i.
+ */
+
+#include "alphasparse/types.h"
+#include "alphasparse/spdef.h"
+
+// vertices ahead of the one being placed that the graph order scores against
+#define ALPHA_REORDER_GORDER_WINDOW 5
+
+/*
+* graph of the pattern of A + A^T for a square n x n matrix given by its rows,
+* *ptr and *idx are allocated here and released with free
+*/
+alphasparse_status_t alpha_reorder_graph(const ALPHA_INT n,
+                                         const ALPHA_OFFSET *rows_start,
+                                         const ALPHA_OFFSET *rows_end,
+                                         const ALPHA_INT *col_indx,
+                                         ALPHA_OFFSET **ptr,
+                                         ALPHA_INT **idx);
+
+// reverse Cuthill-McKee from a pseudo-peripheral vertex of every component
+alphasparse_status_t alpha_reorder_rcm(const ALPHA_INT n, const ALPHA_OFFSET *ptr, const ALPHA_INT *idx, ALPHA_INT *perm);
+
+// decreasing degree, ties in index order, degree v is ptr_end[v] - ptr_start[v]
+alphasparse_status_t alpha_reorder_degree(const ALPHA_INT n, const ALPHA_OFFSET *ptr_start, const ALPHA_OFFSET *ptr_end, ALPHA_INT *perm);
+
+// greedy graph order, every vertex maximises its neighbours and shared neighbours within the last window placed
+alphasparse_status_t alpha_reorder_gorder(const ALPHA_INT n, const ALPHA_OFFSET *ptr, const ALPHA_INT *idx, const ALPHA_INT window, ALPHA_INT *perm);
@@ -0,0 +1,600 @@
+#pragma once
+
+/**
+ * @brief header for the kernels on split complex values
+ *
+ * In the split layout the real and imaginary parts of the values of a CSR
+ * or BSR matrix are kept in two arrays of ALPHA_Float, built by
+ * alphasparse_optimize. A vector of entries then loads as one register of
+ * real parts and one of imaginary parts, and a complex multiply-add is two
+ * real FMAs per part with no shuffles. Dense operands stay interleaved,
+ * their parts are gathered by index or swapped within a register.
+ *
+ * The helpers take a conj flag and use conj(a) for the matrix entries when
+ * it is set. Included by the _c_ kernels, ALPHA_Complex is the type being
+ * compiled and ALPHA_Float its part.
+ */
+
+#include "../spdef.h"
+#include "../types.h"
+#include "../compute.h"
+#include "../util.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#define SPLIT_INLINE static inline __attribute__((always_inline))
+
+/*
+* vector of SPLIT_W parts, the indices of a vector are SPLIT_W ALPHA_INTs
+*
+* split_range       mask of the lanes whose index is inside [lo, hi)
+* split_maskz       zero the lanes outside a mask
+* split_gather      parts of x[idx] for idx2 = 2 * idx, base the first real or imaginary part
+* split_mask_gather the same for the lanes of a mask only, the others are zero and not loaded
+* split_swap        exchange the two parts of every interleaved complex in a register
+*/
+#if defined(__AVX512F__) && defined(DOUBLE)
+#define SPLIT_W 8
+typedef __m512d split_vec_t;
+typedef __m256i split_ivec_t;
+typedef __mmask8 split_mask_t;
+#define split_loadu(p) _mm512_loadu_pd(p)
+#define split_storeu(p, v) _mm512_storeu_pd(p, v)
+#define split_set1(v) _mm512_set1_pd(v)
+#define split_zero() _mm512_setzero_pd()
+#define split_mul(a, b) _mm512_mul_pd(a, b)
+#define split_fmadd(a, b, c) _mm512_fmadd_pd(a, b, c)
+#define split_fnmadd(a, b, c) _mm512_fnmadd_pd(a, b, c)
+#define split_hsum(v) _mm512_reduce_add_pd(v)
+#define split_swap(v) _mm512_permute_pd(v, 0x55)
+#define split_iload(p) _mm256_loadu_si256((const __m256i *)(p))
+#define split_iset1(v) _mm256_set1_epi32(v)
+#define split_idouble(v) _mm256_add_epi32(v, v)
+#define split_range(idx, lo, hi) (_mm256_cmpge_epi32_mask(idx, lo) & _mm256_cmplt_epi32_mask(idx, hi))
+#define split_maskz(m, v) _mm512_maskz_mov_pd(m, v)
+#define split_gather(idx2, base) _mm512_i32gather_pd(idx2, base, 8)
+#define split_mask_gather(m, idx2, base) _mm512_mask_i32gather_pd(_mm512_setzero_pd(), m, idx2, base, 8)
+#define split_mask_scatter(base, m, idx2, v) _mm512_mask_i32scatter_pd(base, m, idx2, v, 8)
+#ifdef __AVX512CD__
+#define split_conflict(m, idx) (_mm256_test_epi32_mask(_mm256_maskz_conflict_epi32(m, idx), _mm256_maskz_conflict_epi32(m, idx)) != 0)
+#endif
+#elif defined(__AVX512F__)
+#define SPLIT_W 16
+typedef __m512 split_vec_t;
+typedef __m512i split_ivec_t;
+typedef __mmask16 split_mask_t;
+#define split_loadu(p) _mm512_loadu_ps(p)
+#define split_storeu(p, v) _mm512_storeu_ps(p, v)
+#define split_set1(v) _mm512_set1_ps(v)
+#define split_zero() _mm512_setzero_ps()
+#define split_mul(a, b) _mm512_mul_ps(a, b)
+#define split_fmadd(a, b, c) _mm512_fmadd_ps(a, b, c)
+#define split_fnmadd(a, b, c) _mm512_fnmadd_ps(a, b, c)
+#define split_hsum(v) _mm512_reduce_add_ps(v)
+#define split_swap(v) _mm512_permute_ps(v, 0xB1)
+#define split_iload(p) _mm512_loadu_si512((const void *)(p))
+#define split_iset1(v) _mm512_set1_epi32(v)
+#define split_idouble(v) _mm512_add_epi32(v, v)
+#define split_range(idx, lo, hi) (_mm512_cmpge_epi32_mask(idx, lo) & _mm512_cmplt_epi32_mask(idx, hi))
+#define split_maskz(m, v) _mm512_maskz_mov_ps(m, v)
+#define split_gather(idx2, base) _mm512_i32gather_ps(idx2, base, 4)
+#define split_mask_gather(m, idx2, base) _mm512_mask_i32gather_ps(_mm512_setzero_ps(), m, idx2, base, 4)
+#define split_mask_scatter(base, m, idx2, v) _mm512_mask_i32scatter_ps(base, m, idx2, v, 4)
+#ifdef __AVX512CD__
+#define split_conflict(m, idx) (_mm512_test_epi32_mask(_mm512_maskz_conflict_epi32(m, idx), _mm512_maskz_conflict_epi32(m, idx)) != 0)
+#endif
+#elif defined(__AVX2__) && defined(__FMA__) && defined(DOUBLE)
+#define SPLIT_W 4
+typedef __m256d split_vec_t;
+typedef __m128i split_ivec_t;
+typedef __m256d split_mask_t;
+#define split_loadu(p) _mm256_loadu_pd(p)
+#define split_storeu(p, v) _mm256_storeu_pd(p, v)
+#define split_set1(v) _mm256_set1_pd(v)
+#define split_zero() _mm256_setzero_pd()
+#define split_mul(a, b) _mm256_mul_pd(a, b)
+#define split_fmadd(a, b, c) _mm256_fmadd_pd(a, b, c)
+#define split_fnmadd(a, b, c) _mm256_fnmadd_pd(a, b, c)
+#define split_swap(v) _mm256_permute_pd(v, 0x5)
+#define split_iload(p) _mm_loadu_si128((const __m128i *)(p))
+#define split_iset1(v) _mm_set1_epi32(v)
+#define split_idouble(v) _mm_add_epi32(v, v)
+#define split_maskz(m, v) _mm256_and_pd(v, m)
+#define split_gather(idx2, base) _mm256_i32gather_pd(base, idx2, 8)
+#define split_mask_gather(m, idx2, base) _mm256_mask_i32gather_pd(_mm256_setzero_pd(), base, idx2, m, 8)
+SPLIT_INLINE double split_hsum(const __m256d v)
+{
+    const __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+}
+SPLIT_INLINE __m256d split_range(const __m128i idx, const __m128i lo, const __m128i hi)
+{
+    const __m128i in = _mm_andnot_si128(_mm_cmpgt_epi32(lo, idx), _mm_cmpgt_epi32(hi, idx));
+    return _mm256_castsi256_pd(_mm256_cvtepi32_epi64(in));
+}
+#elif defined(__AVX2__) && defined(__FMA__)
+#define SPLIT_W 8
+typedef __m256 split_vec_t;
+typedef __m256i split_ivec_t;
+typedef __m256 split_mask_t;
+#define split_loadu(p) _mm256_loadu_ps(p)
+#define split_storeu(p, v) _mm256_storeu_ps(p, v)
+#define split_set1(v) _mm256_set1_ps(v)
+#define split_zero() _mm256_setzero_ps()
+#define split_mul(a, b) _mm256_mul_ps(a, b)
+#define split_fmadd(a, b, c) _mm256_fmadd_ps(a, b, c)
+#define split_fnmadd(a, b, c) _mm256_fnmadd_ps(a, b, c)
+#define split_swap(v) _mm256_permute_ps(v, 0xB1)
+#define split_iload(p) _mm256_loadu_si256((const __m256i *)(p))
+#define split_iset1(v) _mm256_set1_epi32(v)
+#define split_idouble(v) _mm256_add_epi32(v, v)
+#define split_maskz(m, v) _mm256_and_ps(v, m)
+#define split_gather(idx2, base) _mm256_i32gather_ps(base, idx2, 4)
+#define split_mask_gather(m, idx2, base) _mm256_mask_i32gather_ps(_mm256_setzero_ps(), base, idx2, m, 4)
+SPLIT_INLINE float split_hsum(const __m256 v)
+{
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_movehdup_ps(s)));
+}
+SPLIT_INLINE __m256 split_range(const __m256i idx, const __m256i lo, const __m256i hi)
+{
+    const __m256i in = _mm256_andnot_si256(_mm256_cmpgt_epi32(lo, idx), _mm256_cmpgt_epi32(hi, idx));
+    return _mm256_castsi256_ps(in);
+}
+#endif
+
+/*
+* sum of a_k * x[idx_k] over the entries with lo <= idx_k < hi. x is only
+* read inside [lo, hi), the solves pass a y whose other entries are not set.
+*/
+SPLIT_INLINE ALPHA_Complex split_dot_range(const ALPHA_OFFSET nz,
+                                           const ALPHA_Float *re,
+                                           const ALPHA_Float *im,
+                                           const ALPHA_INT *idx,
+                                           const ALPHA_Complex *x,
+                                           const ALPHA_INT lo,
+                                           const ALPHA_INT hi,
+                                           const bool conj)
+{
+    const ALPHA_Float sign = conj ? -1 : 1;
+    ALPHA_Float sr = 0, si = 0;
+    ALPHA_OFFSET k = 0;
+#ifdef SPLIT_W
+    if (sizeof(ALPHA_INT) == 4 && nz >= SPLIT_W)
+    {
+        const ALPHA_Float *xr = (const ALPHA_Float *)x;
+        const split_ivec_t vlo = split_iset1(lo), vhi = split_iset1(hi);
+        const split_vec_t vsign = split_set1(sign);
+        split_vec_t accr = split_zero(), acci = split_zero();
+        for (; k + SPLIT_W <= nz; k += SPLIT_W)
+        {
+            const split_ivec_t vi = split_iload(idx + k);
+            const split_ivec_t vi2 = split_idouble(vi);
+            const split_mask_t m = split_range(vi, vlo, vhi);
+            const split_vec_t ar = split_maskz(m, split_loadu(re + k));
+            const split_vec_t ai = split_mul(split_maskz(m, split_loadu(im + k)), vsign);
+            const split_vec_t br = split_mask_gather(m, vi2, xr);
+            const split_vec_t bi = split_mask_gather(m, vi2, xr + 1);
+            accr = split_fmadd(ar, br, accr);
+            accr = split_fnmadd(ai, bi, accr);
+            acci = split_fmadd(ar, bi, acci);
+            acci = split_fmadd(ai, br, acci);
+        }
+        sr = split_hsum(accr);
+        si = split_hsum(acci);
+    }
+#endif
+    for (; k < nz; k++)
+    {
+        const ALPHA_INT c = idx[k];
+        if (c < lo || c >= hi)
+            continue;
+        const ALPHA_Float ai = sign * im[k];
+        sr += re[k] * x[c].real - ai * x[c].imag;
+        si += re[k] * x[c].imag + ai * x[c].real;
+    }
+    ALPHA_Complex sum = {sr, si};
+    return sum;
+}
+
+/*
+* y[idx_k] += a_k * s over the entries with lo <= idx_k < hi. A vector goes
+* through gather, FMA and scatter when its indices are distinct, any
+* repeated index sends it to the scalar loop, so y comes out the same.
+*/
+SPLIT_INLINE void split_axpy_range(const ALPHA_OFFSET nz,
+                                   const ALPHA_Float *re,
+                                   const ALPHA_Float *im,
+                                   const ALPHA_INT *idx,
+                                   const ALPHA_Complex s,
+                                   const ALPHA_INT lo,
+                                   const ALPHA_INT hi,
+                                   const bool conj,
+                                   ALPHA_Complex *y)
+{
+    const ALPHA_Float sign = conj ? -1 : 1;
+    ALPHA_OFFSET k = 0;
+#if defined(SPLIT_W) && defined(split_conflict)
+    if (sizeof(ALPHA_INT) == 4)
+    {
+        ALPHA_Float *yr = (ALPHA_Float *)y;
+        const split_ivec_t vlo = split_iset1(lo), vhi = split_iset1(hi);
+        const split_vec_t sr = split_set1(s.real), si = split_set1(s.imag), vsign = split_set1(sign);
+        for (; k + SPLIT_W <= nz; k += SPLIT_W)
+        {
+            const split_ivec_t vi = split_iload(idx + k);
+            const split_mask_t m = split_range(vi, vlo, vhi);
+            if (split_conflict(m, vi))
+            {
+                for (ALPHA_INT j = k; j < k + SPLIT_W; j++)
+                {
+                    const ALPHA_INT c = idx[j];
+                    if (c < lo || c >= hi)
+                        continue;
+                    const ALPHA_Float ai = sign * im[j];
+                    y[c].real += re[j] * s.real - ai * s.imag;
+                    y[c].imag += re[j] * s.imag + ai * s.real;
+                }
+                continue;
+            }
+            const split_ivec_t vi2 = split_idouble(vi);
+            const split_vec_t ar = split_loadu(re + k);
+            const split_vec_t ai = split_mul(split_loadu(im + k), vsign);
+            split_vec_t cr = split_mask_gather(m, vi2, yr);
+            split_vec_t ci = split_mask_gather(m, vi2, yr + 1);
+            cr = split_fmadd(ar, sr, cr);
+            cr = split_fnmadd(ai, si, cr);
+            ci = split_fmadd(ar, si, ci);
+            ci = split_fmadd(ai, sr, ci);
+            split_mask_scatter(yr, m, vi2, cr);
+            split_mask_scatter(yr + 1, m, vi2, ci);
+        }
+    }
+#endif
+    for (; k < nz; k++)
+    {
+        const ALPHA_INT c = idx[k];
+        if (c < lo || c >= hi)
+            continue;
+        const ALPHA_Float ai = sign * im[k];
+        y[c].real += re[k] * s.real - ai * s.imag;
+        y[c].imag += re[k] * s.imag + ai * s.real;
+    }
+}
+
+// y[0, n) += s * x[0, n) for interleaved x and y, s comes in parts so no lane extracts it
+SPLIT_INLINE void split_caxpy_dense(const ALPHA_INT n,
+                                    const ALPHA_Float sr,
+                                    const ALPHA_Float si,
+                                    const ALPHA_Complex *x,
+                                    ALPHA_Complex *y)
+{
+    ALPHA_INT k = 0;
+#ifdef SPLIT_W
+    const ALPHA_Float *xp = (const ALPHA_Float *)x;
+    ALPHA_Float *yp = (ALPHA_Float *)y;
+    // (-si, si) over the parts, the swapped x then adds -si * x.imag to real and si * x.real to imag
+    ALPHA_Float alt[SPLIT_W];
+    for (ALPHA_INT l = 0; l < SPLIT_W; l++)
+        alt[l] = (l & 1) ? si : -si;
+    const split_vec_t vr = split_set1(sr), vi = split_loadu(alt);
+    for (; k + SPLIT_W / 2 <= n; k += SPLIT_W / 2)
+    {
+        const split_vec_t b = split_loadu(xp + 2 * k);
+        split_vec_t c = split_loadu(yp + 2 * k);
+        c = split_fmadd(vr, b, c);
+        c = split_fmadd(vi, split_swap(b), c);
+        split_storeu(yp + 2 * k, c);
+    }
+#endif
+    for (; k < n; k++)
+    {
+        const ALPHA_Float br = x[k].real, bi = x[k].imag;
+        y[k].real += sr * br - si * bi;
+        y[k].imag += sr * bi + si * br;
+    }
+}
+
+// entry of column col in a row, zero when it is not stored
+SPLIT_INLINE ALPHA_Complex split_diag(const ALPHA_OFFSET nz,
+                                      const ALPHA_Float *re,
+                                      const ALPHA_Float *im,
+                                      const ALPHA_INT *idx,
+                                      const ALPHA_INT col,
+                                      const bool conj)
+{
+    ALPHA_Complex d = {0, 0};
+    for (ALPHA_OFFSET k = 0; k < nz; k++)
+        if (idx[k] == col)
+        {
+            d.real = re[k];
+            d.imag = conj ? -im[k] : im[k];
+        }
+    return d;
+}
+
+/*
+* Bodies shared by the split kernels of one routine, instantiated with
+* constant flags by every variant.
+*/
+
+typedef struct
+{
+    ALPHA_Complex alpha;
+    ALPHA_INT m;
+    const ALPHA_OFFSET *rows_start;
+    const ALPHA_OFFSET *rows_end;
+    const ALPHA_INT *col_indx;
+    const ALPHA_Float *re;
+    const ALPHA_Float *im;
+    const ALPHA_Complex *x;
+    bool lower;
+    bool unit;
+    bool trans;
+    ALPHA_Complex *tmp;
+} split_herm_rows_t;
+
+// rows [begin, end) and their mirrored updates into the partial y of the executing thread
+static inline void split_herm_rows(void *arg, const ALPHA_INT tid, const ALPHA_INT begin, const ALPHA_INT end)
+{
+    const split_herm_rows_t *p = arg;
+    const ALPHA_INT m = p->m;
+    ALPHA_Complex *local_y = p->tmp + (size_t)tid * m;
+    for (ALPHA_INT i = begin; i < end; i++)
+    {
+        const ALPHA_OFFSET rs = p->rows_start[i];
+        const ALPHA_OFFSET nz = p->rows_end[i] - rs;
+        const ALPHA_INT lo = p->lower ? 0 : i + 1;
+        const ALPHA_INT hi = p->lower ? i : m;
+        ALPHA_Complex sum = split_dot_range(nz, p->re + rs, p->im + rs, p->col_indx + rs, p->x, lo, hi, p->trans);
+        ALPHA_Complex diag = {1, 0};
+        if (!p->unit)
+            diag = split_diag(nz, p->re + rs, p->im + rs, p->col_indx + rs, i, p->trans);
+        alpha_madde(sum, diag, p->x[i]);
+        ALPHA_Complex s;
+        alpha_mul(s, p->alpha, p->x[i]);
+        split_axpy_range(nz, p->re + rs, p->im + rs, p->col_indx + rs, s, lo, hi, !p->trans, local_y);
+        alpha_madde(local_y[i], p->alpha, sum);
+    }
+}
+
+/*
+* y := alpha * A * x + beta * y for hermitian A with one triangle stored
+* (lower), the mirrored entries are conj(a). trans multiplies by A^T = conj(A).
+* A row adds its own sum and its mirrored updates to other rows, so every
+* thread works into a partial y as in split_gemv_csr_trans and the partials
+* are summed at the end.
+*/
+SPLIT_INLINE alphasparse_status_t split_hermv_csr(const ALPHA_Complex alpha,
+                                                  const ALPHA_INT m,
+                                                  const ALPHA_OFFSET *rows_start,
+                                                  const ALPHA_OFFSET *rows_end,
+                                                  const ALPHA_INT *col_indx,
+                                                  const ALPHA_Float *re,
+                                                  const ALPHA_Float *im,
+                                                  const ALPHA_Complex *x,
+                                                  const ALPHA_Complex beta,
+                                                  ALPHA_Complex *y,
+                                                  const bool lower,
+                                                  const bool unit,
+                                                  const bool trans)
+{
+    const ALPHA_INT thread_num = alpha_get_thread_num();
+    // one partial y per thread, taken from the workspace of the execution context when there is one
+    const size_t tmp_size = sizeof(ALPHA_Complex) * (size_t)m * thread_num;
+    ALPHA_Complex *tmp = (ALPHA_Complex *)alpha_exec_workspace(tmp_size);
+    const bool tmp_owned = tmp == NULL;
+    if (tmp_owned)
+        tmp = (ALPHA_Complex *)malloc(tmp_size);
+    check_null_return(tmp, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+    for (size_t i = 0; i < (size_t)m * thread_num; ++i)
+        alpha_setzero(tmp[i]);
+    split_herm_rows_t rows = {alpha, m, rows_start, rows_end, col_indx, re, im, x, lower, unit, trans, tmp};
+    alpha_steal_for_offset(thread_num, m, rows_start, rows_end, split_herm_rows, &rows);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+    for (ALPHA_INT i = 0; i < m; ++i)
+    {
+        ALPHA_Complex sum;
+        alpha_setzero(sum);
+        for (ALPHA_INT j = 0; j < thread_num; ++j)
+            alpha_adde(sum, tmp[(size_t)j * m + i]);
+        alpha_mule(y[i], beta);
+        alpha_adde(y[i], sum);
+    }
+    if (tmp_owned)
+        free(tmp);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+/*
+* solve op(A) * y = alpha * x for triangular A (lower or upper part), op is
+* A, A^T or A^H. The plain solve takes the dot product of every row with the
+* solved entries. The transposed solves sweep the rows the other way and
+* push each solved entry into the rows it still affects, which needs no
+* transposed copy of A.
+*/
+SPLIT_INLINE alphasparse_status_t split_trsv_csr(const ALPHA_Complex alpha,
+                                                 const ALPHA_INT m,
+                                                 const ALPHA_OFFSET *rows_start,
+                                                 const ALPHA_OFFSET *rows_end,
+                                                 const ALPHA_INT *col_indx,
+                                                 const ALPHA_Float *re,
+                                                 const ALPHA_Float *im,
+                                                 const ALPHA_Complex *x,
+                                                 ALPHA_Complex *y,
+                                                 const bool lower,
+                                                 const bool unit,
+                                                 const alphasparse_operation_t op)
+{
+    const bool conj = op == ALPHA_SPARSE_OPERATION_CONJUGATE_TRANSPOSE;
+    if (op == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        for (ALPHA_INT t = 0; t < m; t++)
+        {
+            const ALPHA_INT i = lower ? t : m - 1 - t;
+            const ALPHA_OFFSET rs = rows_start[i];
+            const ALPHA_OFFSET nz = rows_end[i] - rs;
+            const ALPHA_Complex sum = split_dot_range(nz, re + rs, im + rs, col_indx + rs, y, lower ? 0 : i + 1, lower ? i : m, false);
+            ALPHA_Complex r;
+            alpha_mul(r, alpha, x[i]);
+            alpha_sube(r, sum);
+            if (unit)
+                y[i] = r;
+            else
+            {
+                const ALPHA_Complex diag = split_diag(nz, re + rs, im + rs, col_indx + rs, i, false);
+                alpha_div(y[i], r, diag);
+            }
+        }
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    }
+    for (ALPHA_INT i = 0; i < m; i++)
+        alpha_mul(y[i], alpha, x[i]);
+    for (ALPHA_INT t = 0; t < m; t++)
+    {
+        // op(A) of a lower A is upper, so its last row is solved first
+        const ALPHA_INT i = lower ? m - 1 - t : t;
+        const ALPHA_OFFSET rs = rows_start[i];
+        const ALPHA_OFFSET nz = rows_end[i] - rs;
+        if (!unit)
+        {
+            const ALPHA_Complex diag = split_diag(nz, re + rs, im + rs, col_indx + rs, i, conj);
+            const ALPHA_Complex r = y[i];
+            alpha_div(y[i], r, diag);
+        }
+        ALPHA_Complex s = {-y[i].real, -y[i].imag};
+        split_axpy_range(nz, re + rs, im + rs, col_indx + rs, s, lower ? 0 : i + 1, lower ? i : m, conj, y);
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+typedef struct
+{
+    const ALPHA_OFFSET *rows_start;
+    const ALPHA_OFFSET *rows_end;
+    const ALPHA_INT *col_indx;
+    const ALPHA_Float *re;
+    const ALPHA_Float *im;
+    const ALPHA_Complex *x;
+    ALPHA_INT cols;
+    bool conj;
+    ALPHA_Complex *tmp;
+} split_trans_rows_t;
+
+// scatter rows [begin, end) into the partial y of the executing thread
+static inline void split_trans_rows(void *arg, const ALPHA_INT tid, const ALPHA_INT begin, const ALPHA_INT end)
+{
+    const split_trans_rows_t *p = arg;
+    ALPHA_Complex *local_y = p->tmp + (size_t)tid * p->cols;
+    for (ALPHA_INT i = begin; i < end; i++)
+    {
+        const ALPHA_OFFSET rs = p->rows_start[i];
+        split_axpy_range(p->rows_end[i] - rs, p->re + rs, p->im + rs, p->col_indx + rs, p->x[i], 0, p->cols, p->conj, local_y);
+    }
+}
+
+/*
+* y := alpha * A^T * x + beta * y, or A^H with conj. Every thread scatters
+* its rows into a partial y, the partials are summed at the end.
+*/
+SPLIT_INLINE alphasparse_status_t split_gemv_csr_trans(const ALPHA_Complex alpha,
+                                                       const ALPHA_INT m,
+                                                       const ALPHA_INT n,
+                                                       const ALPHA_OFFSET *rows_start,
+                                                       const ALPHA_OFFSET *rows_end,
+                                                       const ALPHA_INT *col_indx,
+                                                       const ALPHA_Float *re,
+                                                       const ALPHA_Float *im,
+                                                       const ALPHA_Complex *x,
+                                                       const ALPHA_Complex beta,
+                                                       ALPHA_Complex *y,
+                                                       const bool conj)
+{
+    const ALPHA_INT thread_num = alpha_get_thread_num();
+    // one partial y per thread, taken from the workspace of the execution context when there is one
+    const size_t tmp_size = sizeof(ALPHA_Complex) * (size_t)n * thread_num;
+    ALPHA_Complex *tmp = (ALPHA_Complex *)alpha_exec_workspace(tmp_size);
+    const bool tmp_owned = tmp == NULL;
+    if (tmp_owned)
+        tmp = (ALPHA_Complex *)malloc(tmp_size);
+    check_null_return(tmp, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+    for (size_t i = 0; i < (size_t)n * thread_num; ++i)
+        alpha_setzero(tmp[i]);
+    split_trans_rows_t rows = {rows_start, rows_end, col_indx, re, im, x, n, conj, tmp};
+    alpha_steal_for_offset(thread_num, m, rows_start, rows_end, split_trans_rows, &rows);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+    for (ALPHA_INT i = 0; i < n; ++i)
+    {
+        ALPHA_Complex sum;
+        alpha_setzero(sum);
+        for (ALPHA_INT j = 0; j < thread_num; ++j)
+            alpha_adde(sum, tmp[(size_t)j * n + i]);
+        alpha_mule(y[i], beta);
+        alpha_madde(y[i], alpha, sum);
+    }
+    if (tmp_owned)
+        free(tmp);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+/*
+* y := alpha * A^T * x + beta * y for row major dense x and y, or A^H with
+* conj. Row i of A adds a multiple of row i of x to the rows of y its
+* columns name, so the threads split the dense columns rather than the rows.
+*/
+SPLIT_INLINE alphasparse_status_t split_gemm_csr_row_trans(const ALPHA_Complex alpha,
+                                                           const ALPHA_INT m,
+                                                           const ALPHA_INT n,
+                                                           const ALPHA_OFFSET *rows_start,
+                                                           const ALPHA_OFFSET *rows_end,
+                                                           const ALPHA_INT *col_indx,
+                                                           const ALPHA_Float *re,
+                                                           const ALPHA_Float *im,
+                                                           const ALPHA_Complex *x,
+                                                           const ALPHA_INT columns,
+                                                           const ALPHA_INT ldx,
+                                                           const ALPHA_Complex beta,
+                                                           ALPHA_Complex *y,
+                                                           const ALPHA_INT ldy,
+                                                           const bool conj)
+{
+    const ALPHA_INT thread_num = alpha_min(alpha_get_thread_num(), alpha_max(columns, 1));
+    const ALPHA_Float sign = conj ? -1 : 1;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num)
+#endif
+    {
+        const ALPHA_INT tid = alpha_get_thread_id();
+        const ALPHA_INT c0 = (ALPHA_INT)((ALPHA_INT64)columns * tid / thread_num);
+        const ALPHA_INT c1 = (ALPHA_INT)((ALPHA_INT64)columns * (tid + 1) / thread_num);
+        for (ALPHA_INT r = 0; r < n; r++)
+            for (ALPHA_INT c = c0; c < c1; c++)
+                alpha_mule(y[(size_t)r * ldy + c], beta);
+        for (ALPHA_INT i = 0; i < m; i++)
+        {
+            const ALPHA_Complex *X = x + (size_t)i * ldx + c0;
+            for (ALPHA_OFFSET ai = rows_start[i]; ai < rows_end[i]; ai++)
+            {
+                const ALPHA_Float ar = re[ai], aim = sign * im[ai];
+                const ALPHA_Float sr = alpha.real * ar - alpha.imag * aim;
+                const ALPHA_Float si = alpha.real * aim + alpha.imag * ar;
+                split_caxpy_dense(c1 - c0, sr, si, X, y + (size_t)col_indx[ai] * ldy + c0);
+            }
+        }
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
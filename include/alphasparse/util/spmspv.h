@@ -0,0 +1,68 @@
+#pragma once
+
+/**
+ * @brief header for the structure shared by the traversals of spmspv and semiring spmspv
+ *
+ * Both traversals are planned for thread_num parts. The parts are logical: a
+ * parallel region that gets a smaller team than asked for runs part t on
+ * thread t % team, so no phase depends on the size of the team.
+ */
+
+#include "../spdef.h"
+#include "../types.h"
+
+/*
+* push, op(A) grouped by column in ptr/idx, idx holding rows
+*
+* parts         Parts the entries of x are cut into
+* bucket_num    Buckets of bucket_rows consecutive rows
+* total         Products selected by x
+* first         Entries of x of part t are [first[t], first[t + 1])
+* slot          Start of the products of part t in bucket b at b * parts + t, slot[bucket_num * parts] is total
+* fill          Next free product of part t in bucket b at t * bucket_num + b, set to its slot
+* bucket_out    Left to the merge, rows each bucket folds to at b + 1
+* mark          Zeroed marks of each part, bucket_rows each
+* touched       Rows touched in a bucket by each part, bucket_rows each
+*/
+typedef struct
+{
+    ALPHA_INT parts;
+    ALPHA_INT bucket_rows;
+    ALPHA_INT bucket_num;
+    ALPHA_INT64 total;
+    ALPHA_INT *first;
+    ALPHA_INT64 *slot;
+    ALPHA_INT64 *fill;
+    ALPHA_INT64 *bucket_out;
+    char *mark;
+    ALPHA_INT *touched;
+} alpha_spmspv_push_t;
+
+/*
+* pull, op(A) grouped by row in ptr
+*
+* partition     Rows of part t are [partition[t], partition[t + 1])
+* found         Rows part t reached at t + 1, their prefix after alpha_spmspv_pull_found
+*/
+typedef struct
+{
+    ALPHA_INT parts;
+    ALPHA_INT *partition;
+    ALPHA_INT *found;
+} alpha_spmspv_pull_t;
+
+// cut and count the products of the entries indx[0, nz) of x, nothing is left allocated on failure
+alphasparse_status_t alpha_spmspv_push_plan(const ALPHA_OFFSET *ptr, const ALPHA_INT *idx, const ALPHA_INT *indx, const ALPHA_INT nz, const ALPHA_INT base,
+                                            const ALPHA_INT rows, const ALPHA_INT bucket_rows, const ALPHA_INT parts, alpha_spmspv_push_t *plan);
+
+// prefix sum of bucket_out, returns the rows of y
+ALPHA_INT64 alpha_spmspv_push_out(alpha_spmspv_push_t *plan);
+
+void alpha_spmspv_push_destroy(alpha_spmspv_push_t *plan);
+
+alphasparse_status_t alpha_spmspv_pull_plan(const ALPHA_OFFSET *ptr, const ALPHA_INT rows, const ALPHA_INT parts, alpha_spmspv_pull_t *plan);
+
+// prefix sum of found, returns the rows of y
+ALPHA_INT alpha_spmspv_pull_found(alpha_spmspv_pull_t *plan);
+
+void alpha_spmspv_pull_destroy(alpha_spmspv_pull_t *plan);
@@ -0,0 +1,58 @@
+#pragma once
+
+/**
+ * @brief header for the work-stealing row scheduler
+ *
+ * Rows are cut into blocks of about equal estimated cost, several per thread,
+ * and every thread starts with a contiguous run of blocks in its own deque
+ * (Chase-Lev: the owner pops from the bottom, thieves take from the top).
+ * A thread whose deque runs dry steals the far end of another thread's run,
+ * so rows whose cost the estimate got wrong are rebalanced at run time.
+ */
+
+#include "../spdef.h"
+#include "../types.h"
+
+// blocks cut per thread, more blocks balance better at the price of more scheduling
+#define ALPHA_STEAL_BLOCKS_PER_THREAD 8
+
+/*
+* load balance of the scheduled loops
+*
+* loops         Loops run through the scheduler since the last reset
+* blocks        Row blocks executed
+* steals        Blocks executed by a thread other than the one they were given to
+* failed        Steal attempts that found the victim empty or lost the race for its block
+* thread_num    Threads of the last loop
+* busy_max      Seconds the busiest thread of the last loop spent in blocks
+* busy_mean     Mean of the same over the threads
+* imbalance     busy_max / busy_mean of the last loop, 1 for a perfect balance
+*/
+typedef struct
+{
+    ALPHA_INT64 loops;
+    ALPHA_INT64 blocks;
+    ALPHA_INT64 steals;
+    ALPHA_INT64 failed;
+    ALPHA_INT thread_num;
+    double busy_max;
+    double busy_mean;
+    double imbalance;
+} alphasparse_steal_stats_t;
+
+// body of a loop, run for rows [begin, end) by thread tid of the team
+typedef void (*alpha_steal_fn_t)(void *arg, const ALPHA_INT tid, const ALPHA_INT begin, const ALPHA_INT end);
+
+/*
+* Run fn over rows [0, rows) with thread_num threads. cost is the inclusive
+* prefix sum of the estimated cost of each row, e.g. a flop count.
+*/
+void alpha_steal_for(const ALPHA_INT thread_num, const ALPHA_INT rows, const ALPHA_INT64 *cost, alpha_steal_fn_t fn, void *arg);
+
+// the same with the row offsets of a CSR-like structure as cost, i.e. balanced by entries,
+// rows are contiguous so only rows_start[0] is read from rows_start
+void alpha_steal_for_offset(const ALPHA_INT thread_num, const ALPHA_INT rows, const ALPHA_OFFSET *rows_start, const ALPHA_OFFSET *rows_end, alpha_steal_fn_t fn, void *arg);
+
+void alpha_steal_stats(alphasparse_steal_stats_t *stats);
+
+void alpha_steal_stats_reset();
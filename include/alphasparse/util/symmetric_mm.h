@@ -0,0 +1,308 @@
+#pragma once
+
+/**
+ * @brief header for the threaded symm and hermm kernels on compressed storage
+ *
+ * The stored triangle is read as rows of a compressed matrix, rows of CSR
+ * or BSR or columns of CSC. An entry a_rc of row r gives a direct product into
+ * Y(r, :) and a mirrored product into Y(c, :). Rows are split into one
+ * block per thread balanced by entries, a thread owns the rows of Y in its
+ * block and mirrored products that land outside it go to a spill buffer of
+ * the thread covering the rows they reach. The spill buffers are added to
+ * Y by the owners of those rows once every block is done, so no row of Y is
+ * written by two threads.
+ *
+ * The dense columns are walked in tiles of SYMM_MM_TILE with the direct
+ * products of a row kept in an accumulator, Y(r, :) is scaled by beta when
+ * the accumulator is stored. Rows run in the order that finishes a row
+ * before any mirrored product reaches it, ascending when the stored
+ * entries lie below the diagonal of the rows and descending above it.
+ *
+ * BSR rows are block rows: blocks of threads and spill ranges are cut at
+ * block row boundaries and every scalar row of a block row is run on its own.
+ * COO has no row offsets to cut blocks by, and the DIA and SKY kernels walk
+ * diagonals and skylines, so those formats keep their own serial loops.
+ *
+ * Included by the _x_ and _c_ kernels, ALPHA_Number is the type being
+ * compiled.
+ */
+
+#include "../types.h"
+#include "../compute.h"
+#include "../util.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SYMM_MM_INLINE static inline __attribute__((always_inline))
+
+// dense columns per tile
+#define SYMM_MM_TILE 16
+// the spill buffers of all threads may hold this many copies of Y, fewer threads are used beyond it
+#define SYMM_MM_SPILL_RATIO 4
+
+SYMM_MM_INLINE ALPHA_Number symm_mm_value(const ALPHA_Number a, const bool conj)
+{
+#ifdef COMPLEX
+    ALPHA_Number v = a;
+    if (conj)
+        v.imag = -v.imag;
+    return v;
+#else
+    return a;
+#endif
+}
+
+/*
+* the stored triangle as rows, offsets in start and end for CSR and BSR or in start_int and end_int for CSC.
+* For BSR block_size is set, rows and idx count blocks and the blocks are stored column major when
+* block_col_major; block_size 0 stands for scalar entries.
+*/
+typedef struct
+{
+    const ALPHA_OFFSET *start;
+    const ALPHA_OFFSET *end;
+    const ALPHA_INT *start_int;
+    const ALPHA_INT *end_int;
+    const ALPHA_INT *idx;
+    const ALPHA_Number *values;
+    ALPHA_INT block_size;
+    bool block_col_major;
+} symm_mm_rows_t;
+
+SYMM_MM_INLINE ALPHA_INT symm_mm_block_size(const symm_mm_rows_t *A)
+{
+    return A->block_size > 0 ? A->block_size : 1;
+}
+
+SYMM_MM_INLINE ALPHA_OFFSET symm_mm_begin(const symm_mm_rows_t *A, const ALPHA_INT r)
+{
+    return A->start != NULL ? A->start[r] : A->start_int[r];
+}
+
+SYMM_MM_INLINE ALPHA_OFFSET symm_mm_end(const symm_mm_rows_t *A, const ALPHA_INT r)
+{
+    return A->end != NULL ? A->end[r] : A->end_int[r];
+}
+
+SYMM_MM_INLINE size_t symm_mm_at(const bool row_major, const ALPHA_INT ld, const ALPHA_INT i, const ALPHA_INT k)
+{
+    return row_major ? (size_t)i * ld + k : (size_t)k * ld + i;
+}
+
+/*
+* rows [lo, hi) of A whose rows of Y the mirrored products of block [r0, r1) reach outside it, lo == hi when none
+*/
+SYMM_MM_INLINE void symm_mm_spill_range(const symm_mm_rows_t *A,
+                                        const ALPHA_INT r0,
+                                        const ALPHA_INT r1,
+                                        const bool lower,
+                                        ALPHA_INT *lo,
+                                        ALPHA_INT *hi)
+{
+    ALPHA_INT first = lower ? r0 : r1, last = lower ? r0 : r1;
+    for (ALPHA_INT r = r0; r < r1; r++)
+        for (ALPHA_OFFSET ai = symm_mm_begin(A, r); ai < symm_mm_end(A, r); ai++)
+        {
+            const ALPHA_INT c = A->idx[ai];
+            if (lower && c < first)
+                first = c;
+            else if (!lower && c >= last)
+                last = c + 1;
+        }
+    *lo = first;
+    *hi = last;
+}
+
+/*
+* partition the rows into thread_num blocks and find their spill ranges, returns the spill size
+*/
+SYMM_MM_INLINE size_t symm_mm_blocks(const symm_mm_rows_t *A,
+                                     const ALPHA_INT m,
+                                     const ALPHA_INT columns,
+                                     const bool lower,
+                                     const ALPHA_INT thread_num,
+                                     ALPHA_INT *partition,
+                                     ALPHA_INT *spill_lo,
+                                     ALPHA_INT *spill_hi)
+{
+    if (A->end != NULL)
+        balanced_partition_row_by_offset(A->end, m, thread_num, partition);
+    else
+        balanced_partition_row_by_nnz(A->end_int, m, thread_num, partition);
+    size_t total = 0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) reduction(+ : total)
+#endif
+    for (ALPHA_INT b = 0; b < thread_num; b++)
+    {
+        symm_mm_spill_range(A, partition[b], partition[b + 1], lower, &spill_lo[b], &spill_hi[b]);
+        total += (size_t)(spill_hi[b] - spill_lo[b]) * symm_mm_block_size(A) * columns;
+    }
+    return total;
+}
+
+/*
+* Y(i, :) = beta * Y(i, :) + alpha * (row i of the symmetric matrix) * X for the rows of Y of block [r0, r1) of A
+*/
+SYMM_MM_INLINE void symm_mm_block(const ALPHA_Number alpha,
+                                  const symm_mm_rows_t *A,
+                                  const ALPHA_Number *x,
+                                  const ALPHA_INT columns,
+                                  const ALPHA_INT ldx,
+                                  const ALPHA_Number beta,
+                                  ALPHA_Number *y,
+                                  const ALPHA_INT ldy,
+                                  const ALPHA_INT r0,
+                                  const ALPHA_INT r1,
+                                  ALPHA_Number *spill,
+                                  const ALPHA_INT spill_lo,
+                                  const bool lower,
+                                  const bool unit,
+                                  const bool row_major,
+                                  const bool conj_direct,
+                                  const bool conj_mirror,
+                                  const bool conj_diag)
+{
+    const ALPHA_INT *idx = A->idx;
+    const ALPHA_Number *values = A->values;
+    const ALPHA_INT bs = symm_mm_block_size(A);
+    const size_t bs2 = (size_t)bs * bs;
+    const ALPHA_INT i0 = r0 * bs, i1 = r1 * bs;
+    ALPHA_Number acc[SYMM_MM_TILE], ax[SYMM_MM_TILE];
+    for (ALPHA_INT step = 0; step < i1 - i0; step++)
+    {
+        const ALPHA_INT i = lower ? i0 + step : i1 - 1 - step;
+        const ALPHA_INT r = i / bs, lr = i - r * bs;
+        for (ALPHA_INT c0 = 0; c0 < columns; c0 += SYMM_MM_TILE)
+        {
+            const ALPHA_INT w = alpha_min(SYMM_MM_TILE, columns - c0);
+            for (ALPHA_INT k = 0; k < w; k++)
+            {
+                if (unit)
+                    acc[k] = x[symm_mm_at(row_major, ldx, i, c0 + k)];
+                else
+                    alpha_setzero(acc[k]);
+                alpha_mul(ax[k], alpha, x[symm_mm_at(row_major, ldx, i, c0 + k)]);
+            }
+            const ALPHA_OFFSET begin = symm_mm_begin(A, r), end = symm_mm_end(A, r);
+            for (ALPHA_OFFSET ai = begin; ai < end; ai++)
+                for (ALPHA_INT lc = 0; lc < bs; lc++)
+                {
+                    const ALPHA_INT c = idx[ai] * bs + lc;
+                    const ALPHA_Number v = values[ai * bs2 + (A->block_col_major ? (size_t)lc * bs + lr : (size_t)lr * bs + lc)];
+                    if (lower ? c < i : c > i)
+                    {
+                        const ALPHA_Number a = symm_mm_value(v, conj_direct);
+                        const ALPHA_Number am = symm_mm_value(v, conj_mirror);
+                        for (ALPHA_INT k = 0; k < w; k++)
+                            alpha_madde(acc[k], a, x[symm_mm_at(row_major, ldx, c, c0 + k)]);
+                        if (c >= i0 && c < i1)
+                        {
+                            for (ALPHA_INT k = 0; k < w; k++)
+                                alpha_madde(y[symm_mm_at(row_major, ldy, c, c0 + k)], am, ax[k]);
+                        }
+                        else
+                        {
+                            ALPHA_Number *S = spill + (size_t)(c - spill_lo * bs) * columns + c0;
+                            for (ALPHA_INT k = 0; k < w; k++)
+                                alpha_madde(S[k], am, ax[k]);
+                        }
+                    }
+                    else if (c == i && !unit)
+                    {
+                        const ALPHA_Number a = symm_mm_value(v, conj_diag);
+                        for (ALPHA_INT k = 0; k < w; k++)
+                            alpha_madde(acc[k], a, x[symm_mm_at(row_major, ldx, i, c0 + k)]);
+                    }
+                }
+            for (ALPHA_INT k = 0; k < w; k++)
+            {
+                ALPHA_Number *Y = &y[symm_mm_at(row_major, ldy, i, c0 + k)];
+                alpha_mule(Y[0], beta);
+                alpha_madde(Y[0], alpha, acc[k]);
+            }
+        }
+    }
+}
+
+/*
+* Y = beta * Y + alpha * S * X, S the symmetric (or hermitian) matrix of the triangle stored in the m
+* rows of A (block rows for BSR), below the diagonal when lower. The entries of the other triangle
+* are skipped and unit takes 1 for the diagonal. conj_direct takes conj(a_rc) for S(r, c), conj_mirror
+* conj(a_rc) for S(c, r) and conj_diag conj(a_rr) for the diagonal.
+*/
+SYMM_MM_INLINE alphasparse_status_t symm_mm_compressed(const ALPHA_Number alpha,
+                                                       const ALPHA_INT m,
+                                                       const symm_mm_rows_t A,
+                                                       const ALPHA_Number *x,
+                                                       const ALPHA_INT columns,
+                                                       const ALPHA_INT ldx,
+                                                       const ALPHA_Number beta,
+                                                       ALPHA_Number *y,
+                                                       const ALPHA_INT ldy,
+                                                       const bool lower,
+                                                       const bool unit,
+                                                       const bool row_major,
+                                                       const bool conj_direct,
+                                                       const bool conj_mirror,
+                                                       const bool conj_diag)
+{
+    if (m <= 0 || columns <= 0)
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    ALPHA_INT thread_num = alpha_max(1, alpha_min(alpha_get_thread_num(), m));
+    ALPHA_INT *partition = alpha_malloc(sizeof(ALPHA_INT) * (thread_num + 1) * 3);
+    ALPHA_INT *spill_lo = partition + thread_num + 1;
+    ALPHA_INT *spill_hi = spill_lo + thread_num + 1;
+
+    size_t total = symm_mm_blocks(&A, m, columns, lower, thread_num, partition, spill_lo, spill_hi);
+    const ALPHA_INT bs = symm_mm_block_size(&A);
+    const size_t budget = (size_t)SYMM_MM_SPILL_RATIO * m * bs * columns;
+    if (thread_num > 1 && total > budget)
+    {
+        // wide spill ranges, as many threads as the budget affords
+        thread_num = alpha_max(1, (ALPHA_INT)((double)thread_num * budget / total));
+        total = symm_mm_blocks(&A, m, columns, lower, thread_num, partition, spill_lo, spill_hi);
+    }
+    // a single block spills nothing
+    ALPHA_Number *spill = thread_num > 1 && total > 0 ? alpha_memalign(sizeof(ALPHA_Number) * total, DEFAULT_ALIGNMENT) : NULL;
+    size_t *spill_offset = alpha_malloc(sizeof(size_t) * (thread_num + 1));
+    spill_offset[0] = 0;
+    for (ALPHA_INT b = 0; b < thread_num; b++)
+        spill_offset[b + 1] = spill_offset[b] + (size_t)(spill_hi[b] - spill_lo[b]) * bs * columns;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static, 1)
+#endif
+    for (ALPHA_INT b = 0; b < thread_num; b++)
+    {
+        ALPHA_Number *S = spill == NULL ? NULL : spill + spill_offset[b];
+        if (S != NULL)
+            memset(S, 0, sizeof(ALPHA_Number) * (spill_offset[b + 1] - spill_offset[b]));
+        symm_mm_block(alpha, &A, x, columns, ldx, beta, y, ldy, partition[b], partition[b + 1],
+                      S, spill_lo[b], lower, unit, row_major, conj_direct, conj_mirror, conj_diag);
+    }
+    if (thread_num > 1)
+    {
+        // the owner of each row adds the spills that reach it
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static, 1)
+#endif
+        for (ALPHA_INT b = 0; b < thread_num; b++)
+            for (ALPHA_INT s = 0; s < thread_num; s++)
+            {
+                const ALPHA_INT lo = alpha_max(partition[b], spill_lo[s]) * bs;
+                const ALPHA_INT hi = alpha_min(partition[b + 1], spill_hi[s]) * bs;
+                for (ALPHA_INT i = lo; i < hi; i++)
+                {
+                    const ALPHA_Number *S = spill + spill_offset[s] + (size_t)(i - spill_lo[s] * bs) * columns;
+                    for (ALPHA_INT k = 0; k < columns; k++)
+                        alpha_adde(y[symm_mm_at(row_major, ldy, i, k)], S[k]);
+                }
+            }
+    }
+    alpha_release(spill_offset);
+    alpha_release(spill);
+    alpha_release(partition);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -2,17 +2,78 @@
 
 /**
  * @brief header for multithread utils
- */ 
+ */
 #ifdef _OPENMP
 #include <omp.h>
 #endif
+#include "../spdef.h"
+#include <stdbool.h>
+#include <stddef.h>
 
 int alpha_get_core_num();
 
+// ids of the cores the process may run on (its affinity mask), at most max of them, returns their count
+int alpha_get_cores(int *cores, const int max);
+
+/*
+* Thread count of the kernels. Inside a call governed by an execution context
+* these read and change the count of that call only, otherwise the process
+* wide default.
+*/
 void alpha_set_thread_num(const int num);
 
 int alpha_get_thread_num();
 
 int alpha_get_thread_id();
 
+/*
+* execution context behind alphasparse_exec_context_t
+*
+* thread_num        Threads of every call it governs
+* cores/core_num    Cores the threads are bound to, NULL when unbound
+* policy            Placement of the threads over cores
+* version           Bumped when the cores change, so bound teams rebind
+* workspace         Scratch memory of the kernels, one call at a time
+* workspace_owned   workspace was allocated by the context and grows on demand
+*/
+struct alpha_exec_context
+{
+    int thread_num;
+    int core_num;
+    int *cores;
+    alphasparse_bind_policy_t policy;
+    unsigned version;
+    void *workspace;
+    size_t workspace_size;
+    bool workspace_owned;
+};
+
+// context and thread count a call replaced, restored by alpha_exec_leave,
+// with the affinity of the calling thread when the call bound it (a cpu_set_t)
+typedef struct
+{
+    struct alpha_exec_context *ctx;
+    struct alpha_exec_context *prev_ctx;
+    int prev_thread_num;
+    bool caller_bound;
+    unsigned long caller_mask[1024 / (8 * sizeof(unsigned long))];
+} alpha_exec_scope_t;
+
+/*
+* Enter the context of a call on the calling thread: the one set with
+* alphasparse_set_thread_exec_context if any, else matrix_ctx, the one
+* attached to the matrix. Without either nothing changes, except that the
+* workers a bound call pinned get their own affinity back first; the same
+* holds for a context without cores.
+*/
+void alpha_exec_enter(alpha_exec_scope_t *scope, struct alpha_exec_context *matrix_ctx);
+
+void alpha_exec_leave(const alpha_exec_scope_t *scope);
+
+// context set for the calling thread, NULL for none
+struct alpha_exec_context *alpha_exec_thread_context();
+
+void alpha_exec_set_thread_context(struct alpha_exec_context *ctx);
 
+// at least size bytes of the workspace of the call in flight, NULL outside a context or when a user workspace is smaller
+void *alpha_exec_workspace(const size_t size);
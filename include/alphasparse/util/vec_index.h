@@ -0,0 +1,117 @@
+#pragma once
+
+/**
+ * @brief header for the building blocks of the level-1 sparse vector kernels
+ *
+ * The vector helpers move whole vectors of entries through indx with the
+ * gather and scatter instructions of the target and return how many entries
+ * from the front they handled, the caller finishes the remainder in its own
+ * element type. They handle nothing when the target has no such instructions.
+ */
+
+#include "../spdef.h"
+#include "../types.h"
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+// below this many entries a kernel runs on the calling thread alone, above each thread gets at least as many
+#define ALPHA_LEVEL1_PARALLEL_NZ 32768
+// entries handed to a thread at a time
+#define ALPHA_LEVEL1_BLOCK 4096
+
+typedef enum
+{
+    ALPHA_INDEX_CONTIGUOUS = 0, // indx[i] == indx[0] + i
+    ALPHA_INDEX_SORTED = 1,     // strictly increasing, so no entry of y is touched twice
+    ALPHA_INDEX_UNSORTED = 2,
+} alpha_index_order_t;
+
+// order of indx[0..nz), unsorted indices are told apart after a few entries
+alpha_index_order_t alpha_index_order(const ALPHA_INT nz, const ALPHA_INT *indx);
+
+// whether indx[0..nz) is contiguous, only indices spanning exactly nz entries are scanned
+bool alpha_index_contiguous(const ALPHA_INT nz, const ALPHA_INT *indx);
+
+// threads for a kernel over nz entries
+ALPHA_INT alpha_level1_thread_num(const ALPHA_INT nz);
+
+// x[i] = y[indx[i]] for 4 byte entries
+static inline ALPHA_INT vec_gather_b32(const ALPHA_INT nz, const void *y, void *x, const ALPHA_INT *indx)
+{
+    ALPHA_INT i = 0;
+    if (sizeof(ALPHA_INT) != 4)
+        return 0;
+#if defined(__AVX512F__)
+    for (; i + 16 <= nz; i += 16)
+    {
+        const __m512i vi = _mm512_loadu_si512((const void *)(indx + i));
+        _mm512_storeu_si512((void *)((int32_t *)x + i), _mm512_i32gather_epi32(vi, y, 4));
+    }
+#elif defined(__AVX2__)
+    for (; i + 8 <= nz; i += 8)
+    {
+        const __m256i vi = _mm256_loadu_si256((const __m256i *)(indx + i));
+        _mm256_storeu_si256((__m256i *)((int32_t *)x + i), _mm256_i32gather_epi32((const int *)y, vi, 4));
+    }
+#endif
+    return i;
+}
+
+// x[i] = y[indx[i]] for 8 byte entries
+static inline ALPHA_INT vec_gather_b64(const ALPHA_INT nz, const void *y, void *x, const ALPHA_INT *indx)
+{
+    ALPHA_INT i = 0;
+    if (sizeof(ALPHA_INT) != 4)
+        return 0;
+#if defined(__AVX512F__)
+    for (; i + 8 <= nz; i += 8)
+    {
+        const __m256i vi = _mm256_loadu_si256((const __m256i *)(indx + i));
+        _mm512_storeu_si512((void *)((int64_t *)x + i), _mm512_i32gather_epi64(vi, y, 8));
+    }
+#elif defined(__AVX2__)
+    for (; i + 4 <= nz; i += 4)
+    {
+        const __m128i vi = _mm_loadu_si128((const __m128i *)(indx + i));
+        _mm256_storeu_si256((__m256i *)((int64_t *)x + i), _mm256_i32gather_epi64((const long long *)y, vi, 8));
+    }
+#endif
+    return i;
+}
+
+/*
+* y[indx[i]] = x[i] for 4 byte entries. Lanes storing to the same entry are
+* written in lane order, so repeated indices end with the last value as in a
+* sequential loop.
+*/
+static inline ALPHA_INT vec_scatter_b32(const ALPHA_INT nz, const void *x, const ALPHA_INT *indx, void *y)
+{
+    ALPHA_INT i = 0;
+    if (sizeof(ALPHA_INT) != 4)
+        return 0;
+#if defined(__AVX512F__)
+    for (; i + 16 <= nz; i += 16)
+    {
+        const __m512i vi = _mm512_loadu_si512((const void *)(indx + i));
+        _mm512_i32scatter_epi32(y, vi, _mm512_loadu_si512((const void *)((const int32_t *)x + i)), 4);
+    }
+#endif
+    return i;
+}
+
+// y[indx[i]] = x[i] for 8 byte entries, in lane order as above
+static inline ALPHA_INT vec_scatter_b64(const ALPHA_INT nz, const void *x, const ALPHA_INT *indx, void *y)
+{
+    ALPHA_INT i = 0;
+    if (sizeof(ALPHA_INT) != 4)
+        return 0;
+#if defined(__AVX512F__)
+    for (; i + 8 <= nz; i += 8)
+    {
+        const __m256i vi = _mm256_loadu_si256((const __m256i *)(indx + i));
+        _mm512_i32scatter_epi64(y, vi, _mm512_loadu_si512((const void *)((const int64_t *)x + i)), 8);
+    }
+#endif
+    return i;
+}
@@ -15,6 +15,7 @@ alphasparse_status_t ONAME(alphasparse_matrix_t *A,
 {
     alphasparse_matrix* AA = alpha_malloc(sizeof(alphasparse_matrix));
     *A = AA;
+    AA->inspector = NULL;
     ALPHA_SPMAT_COO *mat = alpha_malloc(sizeof(ALPHA_SPMAT_COO));
     AA->format = ALPHA_SPARSE_FORMAT_COO;
     AA->datatype = ALPHA_SPARSE_DATATYPE;
@@ -0,0 +1,11 @@
+#include "alphasparse.h"
+#include "alphasparse/builder.h"
+
+alphasparse_status_t ONAME(alphasparse_csr_builder_t *builder,
+                          const ALPHA_INT rows,
+                          const ALPHA_INT cols,
+                          const ALPHA_INT *row_nnz,
+                          const ALPHA_OFFSET nnz_hint)
+{
+    return alpha_csr_builder_init(builder, ALPHA_SPARSE_DATATYPE, sizeof(ALPHA_Number), rows, cols, row_nnz, nnz_hint);
+}
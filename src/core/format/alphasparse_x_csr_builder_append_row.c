@@ -0,0 +1,12 @@
+#include "alphasparse.h"
+#include "alphasparse/builder.h"
+
+alphasparse_status_t ONAME(alphasparse_csr_range_t range,
+                          const ALPHA_INT nnz,
+                          const ALPHA_INT *col_indx,
+                          const ALPHA_Number *values)
+{
+    check_null_return(range, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(range->builder->datatype != ALPHA_SPARSE_DATATYPE, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    return alpha_csr_builder_append(range, nnz, col_indx, values);
+}
@@ -6,8 +6,8 @@ alphasparse_status_t ONAME(const alphasparse_matrix_t source,
                           alphasparse_index_base_t *indexing, /* indexing: C-style or Fortran-style */
                           ALPHA_INT *rows,
                           ALPHA_INT *cols,
-                          ALPHA_INT **rows_start,
-                          ALPHA_INT **rows_end,
+                          ALPHA_OFFSET **rows_start,
+                          ALPHA_OFFSET **rows_end,
                           ALPHA_INT **col_indx,
                           ALPHA_Number **values)
 {
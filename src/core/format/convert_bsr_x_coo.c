@@ -4,6 +4,80 @@
 #include <alphasparse/util.h>
 #include <memory.h>
 
+typedef struct
+{
+    const ALPHA_SPMAT_CSR *csr;
+    ALPHA_SPMAT_BSR *mat;
+    const ALPHA_OFFSET *pos;
+    ALPHA_INT bcl;
+    ALPHA_INT ldp;
+} bsr_coo_rows_t;
+
+// fill block rows [lrs, lrh) of mat, whose block counts are already known
+static void bsr_coo_rows(void *arg, const ALPHA_INT tid, const ALPHA_INT lrs, const ALPHA_INT lrh)
+{
+    const bsr_coo_rows_t *rows = arg;
+    const ALPHA_SPMAT_CSR *csr = rows->csr;
+    ALPHA_SPMAT_BSR *mat = rows->mat;
+    const ALPHA_OFFSET *pos = rows->pos;
+    const ALPHA_INT bcl = rows->bcl;
+    const ALPHA_INT ldp = rows->ldp;
+    const ALPHA_INT block_size = mat->block_size;
+    const alphasparse_layout_t block_layout = mat->block_layout;
+    ALPHA_INT *col_indx = &mat->col_indx[mat->rows_start[lrs]];
+    ALPHA_Number *values = &mat->values[mat->rows_start[lrs] * block_size * block_size];
+    ALPHA_OFFSET count = mat->rows_end[lrh - 1] - mat->rows_start[lrs];
+    ALPHA_OFFSET index = 0;
+    memset(values, '\0', count * block_size * block_size * sizeof(ALPHA_Number));
+    for (ALPHA_INT brs = lrs * block_size; brs < lrh * block_size; brs += block_size)
+    {
+        ALPHA_INT bre = brs + block_size;
+        for (ALPHA_INT bi = 0; bi < bcl; bi++)
+        {
+            bool has_non_zero = false;
+            for (ALPHA_INT r = brs; r < bre; r++)
+            {
+                if (pos[index2(r, bi + 1, ldp)] - pos[index2(r, bi, ldp)] > 0)
+                {
+                    has_non_zero = true;
+                    break;
+                }
+            }
+            if (has_non_zero)
+            {
+                col_indx[index] = bi;
+                ALPHA_Number *block_values = values + index * block_size * block_size;
+                if (block_layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR)
+                {
+                    for (ALPHA_INT r = brs; r < bre; r++)
+                    {
+                        for (ALPHA_OFFSET ai = pos[index2(r, bi, ldp)]; ai < pos[index2(r, bi + 1, ldp)]; ai++)
+                        {
+                            ALPHA_INT ac = csr->col_indx[ai];
+                            block_values[ac - bi * block_size] = csr->values[ai];
+                        }
+                        block_values += block_size;
+                    }
+                }
+                else
+                {
+                    for (ALPHA_INT r = brs; r < bre; r++)
+                    {
+                        ALPHA_INT block_row_index = r - brs;
+                        for (ALPHA_OFFSET ai = pos[index2(r, bi, ldp)]; ai < pos[index2(r, bi + 1, ldp)]; ai++)
+                        {
+                            ALPHA_INT ac = csr->col_indx[ai];
+                            ALPHA_INT block_col_index = ac - bi * block_size;
+                            block_values[index2(block_col_index, block_row_index, block_size)] = csr->values[ai];
+                        }
+                    }
+                }
+                index += 1;
+            }
+        }
+    }
+}
+
 alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_BSR **dest, const ALPHA_INT block_size, const alphasparse_layout_t block_layout)
 {
     ALPHA_INT m = source->rows;
@@ -18,7 +92,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_BSR **dest
     *dest = mat;
     ALPHA_INT block_rows = m / block_size;
     ALPHA_INT block_cols = n / block_size;
-    ALPHA_INT *block_row_offset = alpha_memalign((block_rows + 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    ALPHA_OFFSET *block_row_offset = alpha_memalign((block_rows + 1) * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
     mat->rows = block_rows;
     mat->cols = block_cols;
     mat->block_size = block_size;
@@ -27,11 +101,11 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_BSR **dest
     mat->rows_end = block_row_offset + 1;
     ALPHA_SPMAT_CSR *csr;
     check_error_return(convert_csr_coo(source, &csr));
-    ALPHA_INT *pos;
+    ALPHA_OFFSET *pos;
     ALPHA_INT bcl, ldp;
     csr_col_partition(csr, 0, m, block_size, &pos, &bcl, &ldp);
     mat->rows_start[0] = 0;
-    ALPHA_INT block_nnz = 0;
+    ALPHA_OFFSET block_nnz = 0;
     for (ALPHA_INT br = 0, brs = 0; brs < m; br += 1, brs += block_size)
     {
         ALPHA_INT bre = brs + block_size;
@@ -55,71 +129,9 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_BSR **dest
     }
     mat->col_indx = alpha_memalign(block_nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
     mat->values = alpha_memalign(block_nnz * block_size * block_size * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
-    ALPHA_INT num_threads = alpha_get_thread_num();
-    ALPHA_INT* partition = alpha_malloc(sizeof(ALPHA_INT)*(num_threads+1));
-    balanced_partition_row_by_nnz(mat->rows_end, block_rows, num_threads, partition);
-#ifdef _OPENMP
-#pragma omp parallel num_threads(num_threads)
-#endif
-    {
-        ALPHA_INT tid = alpha_get_thread_id();
-        ALPHA_INT lrs = partition[tid];
-        ALPHA_INT lrh = partition[tid + 1];
-        ALPHA_INT *col_indx = &mat->col_indx[mat->rows_start[lrs]];
-        ALPHA_Number *values = &mat->values[mat->rows_start[lrs] * block_size * block_size];
-        ALPHA_INT count = mat->rows_end[lrh - 1] - mat->rows_start[lrs];
-        ALPHA_INT index = 0;
-        memset(values, '\0', count * block_size * block_size * sizeof(ALPHA_Number));
-        for (ALPHA_INT brs = lrs * block_size; brs < lrh * block_size; brs += block_size)
-        {
-            ALPHA_INT bre = alpha_min(brs + block_size, lrh * block_size);
-            for (ALPHA_INT bi = 0; bi < bcl; bi++)
-            {
-                bool has_non_zero = false;
-                for (ALPHA_INT r = brs; r < bre; r++)
-                {
-                    if (pos[index2(r, bi + 1, ldp)] - pos[index2(r, bi, ldp)] > 0)
-                    {
-                        has_non_zero = true;
-                        break;
-                    }
-                }
-                if (has_non_zero)
-                {
-                    col_indx[index] = bi;
-                    ALPHA_Number *block_values = values + index * block_size * block_size;
-                    if (block_layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR)
-                    {
-                        for (ALPHA_INT r = brs; r < bre; r++)
-                        {
-                            for (ALPHA_INT ai = pos[index2(r, bi, ldp)]; ai < pos[index2(r, bi + 1, ldp)]; ai++)
-                            {
-                                ALPHA_INT ac = csr->col_indx[ai];
-                                block_values[ac - bi * block_size] = csr->values[ai];
-                            }
-                            block_values += block_size;
-                        }
-                    }
-                    else
-                    {
-                        for (ALPHA_INT r = brs; r < bre; r++)
-                        {
-                            ALPHA_INT block_row_index = r - brs;
-                            for (ALPHA_INT ai = pos[index2(r, bi, ldp)]; ai < pos[index2(r, bi + 1, ldp)]; ai++)
-                            {
-                                ALPHA_INT ac = csr->col_indx[ai];
-                                ALPHA_INT block_col_index = ac - bi * block_size;
-                                block_values[index2(block_col_index, block_row_index, block_size)] = csr->values[ai];
-                            }
-                        }
-                    }
-                    index += 1;
-                }
-            }
-        }
-    }
+    bsr_coo_rows_t rows = {csr, mat, pos, bcl, ldp};
+    alpha_steal_for_offset(alpha_get_thread_num(), block_rows, mat->rows_start, mat->rows_end, bsr_coo_rows, &rows);
     destroy_csr(csr);
     alpha_free(pos);
-    alpha_free(partition);
     return ALPHA_SPARSE_STATUS_SUCCESS;
 }
@@ -15,26 +15,34 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *source, ALPHA_SPMAT_COO **dest
   *dest = mat;
   ALPHA_INT m = source->rows;
   ALPHA_INT n = source->cols;
-  ALPHA_INT nnz = source->rows_end[m - 1];
   ALPHA_INT num_threads = alpha_get_thread_num();
+  // rows are read through rows_start and rows_end, a view of rows does not start at 0,
+  // pos[r] is where row r lands in the COO arrays
+  ALPHA_OFFSET *pos = alpha_malloc((uint64_t)(m + 1) * sizeof(ALPHA_OFFSET));
+  pos[0] = 0;
+  for (ALPHA_INT r = 0; r < m; r++)
+    pos[r + 1] = pos[r] + source->rows_end[r] - source->rows_start[r];
+  ALPHA_OFFSET nnz = pos[m];
   mat->rows = m;
   mat->cols = n;
-  ALPHA_INT *rows_indx = alpha_memalign((uint64_t)(nnz) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
-  ALPHA_INT *cols_indx = alpha_memalign((uint64_t)(nnz) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
-  mat->values = alpha_memalign((uint64_t)nnz * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
+  ALPHA_INT *rows_indx = alpha_memalign((uint64_t)alpha_max(nnz, 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+  ALPHA_INT *cols_indx = alpha_memalign((uint64_t)alpha_max(nnz, 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+  mat->values = alpha_memalign((uint64_t)alpha_max(nnz, 1) * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
   mat->row_indx = rows_indx;
   mat->col_indx = cols_indx;
 #ifdef _OPENMP
 #pragma omp parallel for num_threads(num_threads)
 #endif
   for (ALPHA_INT r = 0; r < m; r++) {
-    for (ALPHA_INT ai = source->rows_start[r]; ai < source->rows_end[r]; ai++) {
-      rows_indx[ai] = r;
+    ALPHA_OFFSET dst = pos[r];
+    for (ALPHA_OFFSET ai = source->rows_start[r]; ai < source->rows_end[r]; ai++, dst++) {
+      rows_indx[dst] = r;
+      cols_indx[dst] = source->col_indx[ai];
+      mat->values[dst] = source->values[ai];
     }
   }
+  alpha_release(pos);
 
-  memcpy(cols_indx, source->col_indx, (uint64_t)sizeof(ALPHA_INT) * nnz);
-  memcpy(mat->values, source->values, (uint64_t)sizeof(ALPHA_Number) * nnz);
   mat->nnz = nnz;
 #ifdef __DCU__
   mat->ordered = source->ordered;
@@ -24,14 +24,16 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_CSC **dest
     {
         points[i].x = source->row_indx[i];
         points[i].y = source->col_indx[i];
-        points[i].v = source->values[i];
+        if (source->values != NULL)
+            points[i].v = source->values[i];
     }
     qsort(points, nnz, sizeof(ALPHA_Point), (__compar_fn_t)col_first_cmp);
     mat->rows = m;
     mat->cols = n;
     ALPHA_INT *cols_offset = alpha_memalign((n + 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
     mat->row_indx = alpha_memalign(nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
-    mat->values = alpha_memalign(nnz * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
+    // pattern-only matrices stay pattern-only
+    mat->values = source->values == NULL ? NULL : alpha_memalign(nnz * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
     mat->cols_start = cols_offset;
     mat->cols_end = cols_offset + 1;
     mat->cols_start[0] = 0;
@@ -70,7 +72,8 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_CSC **dest
             for (ALPHA_INT ai = mat->cols_start[ac]; ai < mat->cols_end[ac]; ++ai)
             {
                 mat->row_indx[ai] = points[ai].x;
-                mat->values[ai] = points[ai].v;
+                if (mat->values != NULL)
+                    mat->values[ai] = points[ai].v;
             }
         }
     }
@@ -30,15 +30,20 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, ALPHA_SPMAT_CSR5 **dst) {
 
     B->num_rows = A->rows; 
     B->num_cols = A->cols;
-    B->nnz = A->rows_end[A->rows - 1];
+    // a view of rows starts at rows_start[0], the arrays below are taken from there
+    const ALPHA_OFFSET first = A->rows > 0 ? A->rows_start[0] : 0;
+    const ALPHA_INT *col_indx = A->col_indx + first;
+    const ALPHA_Number *values = A->values + first;
+    B->nnz = A->rows > 0 ? A->rows_end[A->rows - 1] - first : 0;
 
     B->val     = alpha_memalign((uint64_t)(B->nnz) * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
     B->row_ptr = alpha_memalign((uint64_t)(A->rows + 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
     B->col_idx = alpha_memalign((uint64_t)(B->nnz) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
 
-    for( ALPHA_INT i=0; i < B->num_rows+1; i++) {
-        B->row_ptr[i] = A->rows_start[i];
+    for( ALPHA_INT i=0; i < B->num_rows; i++) {
+        B->row_ptr[i] = A->rows_start[i] - first;
     }
+    B->row_ptr[B->num_rows] = B->nnz;
 
     // compute sigma
     int r = 4;
@@ -448,8 +453,8 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, ALPHA_SPMAT_CSR5 **dst) {
             for (int idx = 0; idx < ALPHA_CSR5_OMEGA * B->csr5_sigma; idx++) {
                 int src_idx = par_id * ALPHA_CSR5_OMEGA
                             * B->csr5_sigma + idx;
-                B->col_idx[src_idx] = A->col_indx[src_idx];
-                B->val[src_idx] = A->values[src_idx];
+                B->col_idx[src_idx] = col_indx[src_idx];
+                B->val[src_idx] = values[src_idx];
             }
             continue;
         }
@@ -464,14 +469,14 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, ALPHA_SPMAT_CSR5 **dst) {
                             * B->csr5_sigma + idx_y
                             * ALPHA_CSR5_OMEGA + idx_x;
 
-                B->col_idx[dst_idx] = A->col_indx[src_idx];
-                B->val[dst_idx] = A->values[src_idx];
+                B->col_idx[dst_idx] = col_indx[src_idx];
+                B->val[dst_idx] = values[src_idx];
             }
         }
         else { // the last tile
             for (int idx = par_id * ALPHA_CSR5_OMEGA * B->csr5_sigma; idx < B->nnz; idx++) {
-                B->col_idx[idx] = A->col_indx[idx];
-                B->val[idx] = A->values[idx];
+                B->col_idx[idx] = col_indx[idx];
+                B->val[idx] = values[idx];
             }
         }
     }
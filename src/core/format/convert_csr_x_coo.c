@@ -24,14 +24,16 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_CSR **dest
     {
         points[i].x = source->row_indx[i];
         points[i].y = source->col_indx[i];
-        points[i].v = source->values[i];
+        if (source->values != NULL)
+            points[i].v = source->values[i];
     }
     qsort(points, nnz, sizeof(ALPHA_Point), (__compar_fn_t)row_first_cmp);
     mat->rows = m;
     mat->cols = n;
-    ALPHA_INT *rows_offset = alpha_memalign((m + 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    ALPHA_OFFSET *rows_offset = alpha_memalign((m + 1) * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
     mat->col_indx = alpha_memalign(nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
-    mat->values = alpha_memalign(nnz * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
+    // pattern-only matrices stay pattern-only
+    mat->values = source->values == NULL ? NULL : alpha_memalign(nnz * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
     mat->rows_start = rows_offset;
     mat->rows_end = rows_offset + 1;
     mat->rows_start[0] = 0;
@@ -58,7 +60,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_CSR **dest
 
     ALPHA_INT num_threads = alpha_get_thread_num();
     ALPHA_INT partition[num_threads + 1];
-    balanced_partition_row_by_nnz(mat->rows_end, mat->rows, num_threads, partition);
+    balanced_partition_row_by_offset(mat->rows_end, mat->rows, num_threads, partition);
 
 #ifdef _OPENMP
 #pragma omp parallel num_threads(num_threads)
@@ -69,10 +71,11 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_CSR **dest
         ALPHA_INT lrh = partition[tid + 1];
         for (ALPHA_INT ar = lrs; ar < lrh; ar++)
         {
-            for (ALPHA_INT ai = mat->rows_start[ar]; ai < mat->rows_end[ar]; ++ai)
+            for (ALPHA_OFFSET ai = mat->rows_start[ar]; ai < mat->rows_end[ar]; ++ai)
             {
                 mat->col_indx[ai] = points[ai].y;
-                mat->values[ai] = points[ai].v;
+                if (mat->values != NULL)
+                    mat->values[ai] = points[ai].v;
             }
         }
     }
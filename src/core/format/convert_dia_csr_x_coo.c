@@ -0,0 +1,110 @@
+#include "alphasparse/format.h"
+#include <stdlib.h>
+#include <alphasparse/opt.h>
+#include <alphasparse/util.h>
+#include <memory.h>
+
+static int row_first_cmp(const ALPHA_Point *a, const ALPHA_Point *b)
+{
+    if (a->x != b->x)
+        return a->x - b->x;
+    return a->y - b->y;
+}
+
+/*
+* A diagonal goes to DIA when its entries fill more than fill_threshold of its length,
+* a DIA diagonal costs a full row of values so a few stray entries would otherwise add
+* whole diagonals. Everything else lands in the CSR tail, duplicates on a DIA diagonal
+* are summed as the tail sums them in a product. The fill counts distinct positions,
+* so duplicates never push a diagonal over its length.
+*/
+alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, const double fill_threshold, ALPHA_SPMAT_DIA_CSR **dest)
+{
+    ALPHA_SPMAT_DIA_CSR *mat = alpha_malloc(sizeof(ALPHA_SPMAT_DIA_CSR));
+    *dest = mat;
+    const ALPHA_INT rows = source->rows;
+    const ALPHA_INT cols = source->cols;
+    const ALPHA_INT nnz = source->nnz;
+    const ALPHA_INT diag_num = rows + cols - 1;
+    mat->rows = rows;
+    mat->cols = cols;
+
+    // row first order puts the duplicates of a position next to each other and the tail in CSR order
+    ALPHA_Point *points = alpha_malloc(sizeof(ALPHA_Point) * alpha_max(nnz, 1));
+    for (ALPHA_INT i = 0; i < nnz; i++)
+    {
+        points[i].x = source->row_indx[i];
+        points[i].y = source->col_indx[i];
+        points[i].v = source->values[i];
+    }
+    qsort(points, nnz, sizeof(ALPHA_Point), (__compar_fn_t)row_first_cmp);
+
+    ALPHA_INT *count = alpha_malloc(sizeof(ALPHA_INT) * diag_num);
+    memset(count, 0, sizeof(ALPHA_INT) * diag_num);
+    for (ALPHA_INT i = 0; i < nnz; i++)
+        if (i == 0 || points[i].x != points[i - 1].x || points[i].y != points[i - 1].y)
+            count[points[i].y - points[i].x + rows - 1] += 1;
+
+    // count becomes the position of a kept diagonal in dia, -1 for the tail
+    ALPHA_SPMAT_DIA *dia = alpha_malloc(sizeof(ALPHA_SPMAT_DIA));
+    mat->dia = dia;
+    dia->rows = rows;
+    dia->cols = cols;
+    dia->lval = rows;
+    dia->ndiag = 0;
+    for (ALPHA_INT i = 0; i < diag_num; i++)
+    {
+        const ALPHA_INT d = i - rows + 1;
+        const ALPHA_INT len = alpha_min(rows - alpha_max(0, -d), cols - alpha_max(0, d));
+        if (count[i] > 0 && count[i] > fill_threshold * len)
+            count[i] = dia->ndiag++;
+        else
+            count[i] = -1;
+    }
+    dia->distance = alpha_malloc(sizeof(ALPHA_INT) * alpha_max(dia->ndiag, 1));
+    for (ALPHA_INT i = 0; i < diag_num; i++)
+        if (count[i] >= 0)
+            dia->distance[count[i]] = i - rows + 1;
+    dia->values = alpha_malloc(sizeof(ALPHA_Number) * alpha_max((size_t)dia->ndiag * dia->lval, 1));
+    memset(dia->values, 0, sizeof(ALPHA_Number) * dia->ndiag * dia->lval);
+
+    // the tail is compacted to the front of points, it keeps the row first order
+    ALPHA_INT tail = 0;
+    for (ALPHA_INT i = 0; i < nnz; i++)
+    {
+        const ALPHA_INT row = points[i].x;
+        const ALPHA_INT pos = count[points[i].y - row + rows - 1];
+        if (pos >= 0)
+        {
+            alpha_adde(dia->values[index2(pos, row, dia->lval)], points[i].v);
+        }
+        else
+            points[tail++] = points[i];
+    }
+    alpha_free(count);
+
+    ALPHA_SPMAT_CSR *csr = alpha_malloc(sizeof(ALPHA_SPMAT_CSR));
+    mat->csr = csr;
+    csr->rows = rows;
+    csr->cols = cols;
+    csr->ordered = true;
+    csr->d_values = NULL;
+    csr->d_row_ptr = NULL;
+    csr->d_col_indx = NULL;
+    ALPHA_OFFSET *rows_offset = alpha_memalign((rows + 1) * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
+    csr->rows_start = rows_offset;
+    csr->rows_end = rows_offset + 1;
+    csr->col_indx = alpha_memalign(alpha_max(tail, 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    csr->values = alpha_memalign(alpha_max(tail, 1) * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
+    memset(rows_offset, 0, (rows + 1) * sizeof(ALPHA_OFFSET));
+    for (ALPHA_INT t = 0; t < tail; t++)
+    {
+        rows_offset[points[t].x + 1] += 1;
+        csr->col_indx[t] = points[t].y;
+        csr->values[t] = points[t].v;
+    }
+    for (ALPHA_INT r = 0; r < rows; r++)
+        rows_offset[r + 1] += rows_offset[r];
+    alpha_free(points);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
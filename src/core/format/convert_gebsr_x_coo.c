@@ -72,8 +72,8 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_GEBSR **de
 #pragma omp for
 #endif
     for (ALPHA_INT row = 0; row < m; row += block_row_dim) {
-      const ALPHA_INT start = csr->rows_start[row];
-      const ALPHA_INT end = csr->rows_end[row + block_row_dim - 1];
+      const ALPHA_OFFSET start = csr->rows_start[row];
+      const ALPHA_OFFSET end = csr->rows_end[row + block_row_dim - 1];
       ALPHA_INT nz_blk_num =
           set_clear_bit_batch_sht_index(bitmap, &csr->col_indx[start], end - start, blk_sft);
       // printf("br %d has %d nnz_block\n", row >> blk_sft, nz_blk_num);
@@ -121,26 +121,27 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_GEBSR **de
     ALPHA_INT lrh = partition[tid + 1];
     ALPHA_Number *values = &mat->values[mat->rows_start[lrs] * block_row_dim * block_col_dim];
     // count: nnz_block
-    ALPHA_INT count = mat->rows_end[lrh - 1] - mat->rows_start[lrs];
+    ALPHA_OFFSET count = mat->rows_end[lrh - 1] - mat->rows_start[lrs];
     memset(values, '\0', (uint64_t)count * block_row_dim * block_col_dim * sizeof(ALPHA_Number));
     // alpha_timing_start(&timer);
     for (ALPHA_INT br = lrs; br < lrh; br++) {
       ALPHA_Number *values_current_rowblk =
           &mat->values[mat->rows_start[br] * block_row_dim * block_col_dim];
       const ALPHA_INT row_s = br * block_row_dim;
-      const ALPHA_INT total_nnz = csr->rows_end[row_s + block_row_dim - 1] - csr->rows_start[row_s];
+      const ALPHA_OFFSET total_nnz = csr->rows_end[row_s + block_row_dim - 1] - csr->rows_start[row_s];
       if (total_nnz == 0) {
         continue;
       }
       coord_t *points_current_rowblk = (coord_t *)alpha_malloc(sizeof(coord_t) * total_nnz);
       ALPHA_INT *bsr_col_index = &mat->col_indx[mat->rows_start[br]];
       // points_current_rowblk 存储原始矩阵的列坐标 / block_size
-      for (ALPHA_INT ir = 0, nnz = 0; ir < block_row_dim; ir++) {
+      ALPHA_OFFSET nnz = 0;
+      for (ALPHA_INT ir = 0; ir < block_row_dim; ir++) {
         ALPHA_INT r = br * block_row_dim + ir;
-        ALPHA_INT start = csr->rows_start[r];
-        ALPHA_INT end = csr->rows_end[r];
+        ALPHA_OFFSET start = csr->rows_start[r];
+        ALPHA_OFFSET end = csr->rows_end[r];
 
-        for (ALPHA_INT ai = start; ai < end; ai++) {
+        for (ALPHA_OFFSET ai = start; ai < end; ai++) {
           points_current_rowblk[nnz].col_idx = csr->col_indx[ai];
           points_current_rowblk[nnz].row_idx = r;
           points_current_rowblk[nnz].value = csr->values[ai];
@@ -164,7 +165,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_GEBSR **de
       if (block_layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR) {
         values_current_blk[ir * block_col_dim + ic] = points_current_rowblk[0].value;
         //  points_current_rowblk存储每个nnz对应 bsr当前行中具体哪一个块
-        for (ALPHA_INT nnz = 1; nnz < total_nnz; nnz++) {
+        for (ALPHA_OFFSET nnz = 1; nnz < total_nnz; nnz++) {
           // next blk
           if (pre != points_current_rowblk[nnz].col_idx / block_col_dim) {
             idx++;
@@ -185,7 +186,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_GEBSR **de
       } else {
         values_current_blk[ic * block_row_dim + ir] = points_current_rowblk->value;
         //  points_current_rowblk存储每个nnz对应 bsr当前行中具体哪一个块
-        for (ALPHA_INT nnz = 1; nnz < total_nnz; nnz++) {
+        for (ALPHA_OFFSET nnz = 1; nnz < total_nnz; nnz++) {
           if (pre != points_current_rowblk[nnz].col_idx / block_col_dim) {
             idx++;
             values_current_blk += block_col_dim * block_row_dim;
@@ -197,11 +198,11 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_GEBSR **de
           values_current_blk[ic * block_row_dim + ir] = points_current_rowblk[nnz].value;
         }
       }
-      const ALPHA_INT block_nnz_br = mat->rows_end[br] - mat->rows_start[br];
+      const ALPHA_OFFSET block_nnz_br = mat->rows_end[br] - mat->rows_start[br];
       if (idx != block_nnz_br - 1) {
         fprintf(stderr,
-                "god, some error occurs, block_nnz of current br %d wrong expected %d, got %d \n",
-                br, block_nnz_br, idx + 1);
+                "god, some error occurs, block_nnz of current br %d wrong expected %lld, got %d \n",
+                br, (long long)block_nnz_br, idx + 1);
         exit(-1);
       }
       alpha_free(points_current_rowblk);
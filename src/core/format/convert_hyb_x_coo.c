@@ -71,8 +71,8 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_HYB **dest
     {
         for (ALPHA_INT j = 0; j < m; j++)
         {
-            ALPHA_INT csr_rs = csr->rows_start[j];
-            ALPHA_INT csr_re = csr->rows_end[j];
+            ALPHA_OFFSET csr_rs = csr->rows_start[j];
+            ALPHA_OFFSET csr_re = csr->rows_end[j];
             if (csr_rs + i < csr_re)
             {
                 ell_values  [i * m + j] = csr->values[csr_rs + i];
@@ -85,8 +85,8 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_HYB **dest
     {
         for (ALPHA_INT j = 0; j < m; j++)
         {
-            ALPHA_INT csr_rs = csr->rows_start[j];
-            ALPHA_INT csr_re = csr->rows_end[j];
+            ALPHA_OFFSET csr_rs = csr->rows_start[j];
+            ALPHA_OFFSET csr_re = csr->rows_end[j];
             if (csr_rs + i < csr_re)
             {
                 coo_values  [idx] = csr->values[csr_rs + i];
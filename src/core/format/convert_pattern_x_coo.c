@@ -0,0 +1,37 @@
+#include "alphasparse/format.h"
+#include <stdlib.h>
+#include <alphasparse/opt.h>
+#include <alphasparse/util.h>
+#include <memory.h>
+
+alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *source, ALPHA_SPMAT_COO **dest)
+{
+    ALPHA_INT nnz = source->nnz;
+    // only an all-ones matrix may drop its values
+    ALPHA_INT not_one = 0;
+    if (source->values != NULL)
+    {
+        ALPHA_INT num_threads = alpha_get_thread_num();
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) reduction(+ : not_one)
+#endif
+        for (ALPHA_INT i = 0; i < nnz; i++)
+        {
+            if (!alpha_isone(source->values[i]))
+                not_one += 1;
+        }
+    }
+    check_return(not_one != 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    ALPHA_SPMAT_COO *mat = alpha_malloc(sizeof(ALPHA_SPMAT_COO));
+    *dest = mat;
+    mat->rows = source->rows;
+    mat->cols = source->cols;
+    mat->nnz = nnz;
+    mat->row_indx = alpha_memalign(sizeof(ALPHA_INT) * nnz, DEFAULT_ALIGNMENT);
+    mat->col_indx = alpha_memalign(sizeof(ALPHA_INT) * nnz, DEFAULT_ALIGNMENT);
+    mat->values = NULL;
+    memcpy(mat->row_indx, source->row_indx, sizeof(ALPHA_INT) * nnz);
+    memcpy(mat->col_indx, source->col_indx, sizeof(ALPHA_INT) * nnz);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
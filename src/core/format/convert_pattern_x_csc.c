@@ -0,0 +1,47 @@
+#include "alphasparse/format.h"
+#include <stdlib.h>
+#include <alphasparse/opt.h>
+#include <alphasparse/util.h>
+#include <memory.h>
+
+// columns are copied one by one, so a source whose columns do not follow each other compacts
+alphasparse_status_t ONAME(const ALPHA_SPMAT_CSC *source, ALPHA_SPMAT_CSC **dest)
+{
+    ALPHA_INT n = source->cols;
+    ALPHA_INT num_threads = alpha_get_thread_num();
+    // only an all-ones matrix may drop its values
+    ALPHA_INT not_one = 0;
+    if (source->values != NULL)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) reduction(+ : not_one)
+#endif
+        for (ALPHA_INT c = 0; c < n; c++)
+            for (ALPHA_INT i = source->cols_start[c]; i < source->cols_end[c]; i++)
+            {
+                if (!alpha_isone(source->values[i]))
+                    not_one += 1;
+            }
+    }
+    check_return(not_one != 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    ALPHA_SPMAT_CSC *mat = alpha_malloc(sizeof(ALPHA_SPMAT_CSC));
+    *dest = mat;
+    mat->rows = source->rows;
+    mat->cols = n;
+    ALPHA_INT *cols_offset = alpha_memalign((n + 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    mat->cols_start = cols_offset;
+    mat->cols_end = cols_offset + 1;
+    cols_offset[0] = 0;
+    for (ALPHA_INT c = 0; c < n; c++)
+        cols_offset[c + 1] = cols_offset[c] + source->cols_end[c] - source->cols_start[c];
+    const ALPHA_INT nnz = cols_offset[n];
+    mat->row_indx = alpha_memalign(alpha_max(nnz, 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    mat->values = NULL;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads)
+#endif
+    for (ALPHA_INT c = 0; c < n; c++)
+        memcpy(&mat->row_indx[cols_offset[c]], &source->row_indx[source->cols_start[c]], (cols_offset[c + 1] - cols_offset[c]) * sizeof(ALPHA_INT));
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
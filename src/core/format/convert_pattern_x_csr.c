@@ -0,0 +1,47 @@
+#include "alphasparse/format.h"
+#include <stdlib.h>
+#include <alphasparse/opt.h>
+#include <alphasparse/util.h>
+#include <memory.h>
+
+// rows are copied one by one, so a source whose rows do not follow each other (a row view) compacts
+alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *source, ALPHA_SPMAT_CSR **dest)
+{
+    ALPHA_INT m = source->rows;
+    ALPHA_INT num_threads = alpha_get_thread_num();
+    // only an all-ones matrix may drop its values
+    ALPHA_OFFSET not_one = 0;
+    if (source->values != NULL)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) reduction(+ : not_one)
+#endif
+        for (ALPHA_INT r = 0; r < m; r++)
+            for (ALPHA_OFFSET i = source->rows_start[r]; i < source->rows_end[r]; i++)
+            {
+                if (!alpha_isone(source->values[i]))
+                    not_one += 1;
+            }
+    }
+    check_return(not_one != 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    ALPHA_SPMAT_CSR *mat = alpha_malloc(sizeof(ALPHA_SPMAT_CSR));
+    *dest = mat;
+    mat->rows = m;
+    mat->cols = source->cols;
+    ALPHA_OFFSET *rows_offset = alpha_memalign((m + 1) * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
+    mat->rows_start = rows_offset;
+    mat->rows_end = rows_offset + 1;
+    rows_offset[0] = 0;
+    for (ALPHA_INT r = 0; r < m; r++)
+        rows_offset[r + 1] = rows_offset[r] + source->rows_end[r] - source->rows_start[r];
+    const ALPHA_OFFSET nnz = rows_offset[m];
+    mat->col_indx = alpha_memalign(alpha_max(nnz, 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    mat->values = NULL;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads)
+#endif
+    for (ALPHA_INT r = 0; r < m; r++)
+        memcpy(&mat->col_indx[rows_offset[r]], &source->col_indx[source->rows_start[r]], (rows_offset[r + 1] - rows_offset[r]) * sizeof(ALPHA_INT));
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
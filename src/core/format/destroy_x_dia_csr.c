@@ -0,0 +1,11 @@
+#include "alphasparse/format.h"
+#include <alphasparse/util.h>
+
+alphasparse_status_t ONAME(ALPHA_SPMAT_DIA_CSR *A)
+{
+    destroy_dia(A->dia);
+    destroy_csr(A->csr);
+
+    alpha_free(A);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
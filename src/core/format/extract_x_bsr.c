@@ -0,0 +1,156 @@
+#include "alphasparse/format.h"
+#include <stdlib.h>
+#include <alphasparse/opt.h>
+#include <alphasparse/util.h>
+#include <memory.h>
+
+typedef struct
+{
+    ALPHA_INT col;
+    ALPHA_OFFSET pos;
+} block_entry_t;
+
+static int block_col_cmp(const block_entry_t *a, const block_entry_t *b)
+{
+    return (a->col > b->col) - (a->col < b->col);
+}
+
+/*
+* extract_X_csr on block rows and block columns, B(i, j) = A(row_indx[i], c) for
+* col_map[c] = j with whole blocks copied in the block layout of A. A block row whose
+* columns move out of order gathers its blocks in sorted order instead of sorting
+* them after the copy.
+*/
+alphasparse_status_t ONAME(const ALPHA_SPMAT_BSR *A,
+                           const ALPHA_INT rows,
+                           const ALPHA_INT *row_indx,
+                           const ALPHA_INT cols,
+                           const ALPHA_INT *col_map,
+                           ALPHA_SPMAT_BSR **dest)
+{
+    bool keep_all = true, monotone = true;
+    if (col_map != NULL)
+    {
+        ALPHA_INT last = -1;
+        for (ALPHA_INT c = 0; c < A->cols; c++)
+        {
+            if (col_map[c] < 0)
+            {
+                keep_all = false;
+                continue;
+            }
+            monotone = monotone && col_map[c] > last;
+            last = col_map[c];
+        }
+    }
+    const ALPHA_INT block_size = A->block_size;
+    const size_t block_len = (size_t)block_size * block_size;
+    ALPHA_SPMAT_BSR *mat = alpha_malloc(sizeof(ALPHA_SPMAT_BSR));
+    *dest = mat;
+    mat->rows = rows;
+    mat->cols = cols;
+    mat->block_size = block_size;
+    mat->block_layout = A->block_layout;
+    mat->ordered = monotone ? A->ordered : true;
+    mat->d_values = NULL;
+    mat->d_rows_ptr = NULL;
+    mat->d_col_indx = NULL;
+    ALPHA_OFFSET *rows_offset = alpha_memalign((rows + 1) * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
+    mat->rows_start = rows_offset;
+    mat->rows_end = rows_offset + 1;
+    const ALPHA_INT num_threads = alpha_get_thread_num();
+    rows_offset[0] = 0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads)
+#endif
+    for (ALPHA_INT i = 0; i < rows; i++)
+    {
+        const ALPHA_INT r = row_indx == NULL ? i : row_indx[i];
+        if (keep_all)
+            rows_offset[i + 1] = A->rows_end[r] - A->rows_start[r];
+        else
+        {
+            ALPHA_INT len = 0;
+            for (ALPHA_OFFSET ai = A->rows_start[r]; ai < A->rows_end[r]; ai++)
+                len += col_map[A->col_indx[ai]] >= 0;
+            rows_offset[i + 1] = len;
+        }
+    }
+    for (ALPHA_INT i = 0; i < rows; i++)
+        rows_offset[i + 1] += rows_offset[i];
+    const ALPHA_OFFSET nnz = rows_offset[rows];
+    mat->col_indx = alpha_memalign(alpha_max(nnz, 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    mat->values = alpha_memalign(alpha_max(nnz, 1) * block_len * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
+
+    ALPHA_INT partition[num_threads + 1];
+    balanced_partition_row_by_offset(mat->rows_end, rows, num_threads, partition);
+    alphasparse_status_t status = ALPHA_SPARSE_STATUS_SUCCESS;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+        const ALPHA_INT tid = alpha_get_thread_id();
+        block_entry_t *buf = NULL;
+        ALPHA_INT buf_len = 0;
+        for (ALPHA_INT i = partition[tid]; i < partition[tid + 1]; i++)
+        {
+            const ALPHA_INT r = row_indx == NULL ? i : row_indx[i];
+            const ALPHA_OFFSET to = mat->rows_start[i];
+            const ALPHA_INT len = mat->rows_end[i] - to;
+            if (keep_all && monotone)
+            {
+                const ALPHA_OFFSET from = A->rows_start[r];
+                if (col_map == NULL)
+                    memcpy(&mat->col_indx[to], &A->col_indx[from], sizeof(ALPHA_INT) * len);
+                else
+                    for (ALPHA_INT k = 0; k < len; k++)
+                        mat->col_indx[to + k] = col_map[A->col_indx[from + k]];
+                memcpy(&mat->values[to * block_len], &A->values[from * block_len], sizeof(ALPHA_Number) * block_len * len);
+                continue;
+            }
+            if (monotone)
+            {
+                ALPHA_OFFSET bi = to;
+                for (ALPHA_OFFSET ai = A->rows_start[r]; ai < A->rows_end[r]; ai++)
+                {
+                    const ALPHA_INT c = col_map[A->col_indx[ai]];
+                    if (c < 0)
+                        continue;
+                    mat->col_indx[bi] = c;
+                    memcpy(&mat->values[bi * block_len], &A->values[ai * block_len], sizeof(ALPHA_Number) * block_len);
+                    bi++;
+                }
+                continue;
+            }
+            if (len > buf_len)
+            {
+                free(buf);
+                buf = malloc(sizeof(block_entry_t) * len);
+                buf_len = buf == NULL ? 0 : len;
+                if (buf == NULL)
+                {
+                    status = ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+                    break;
+                }
+            }
+            ALPHA_INT k = 0;
+            for (ALPHA_OFFSET ai = A->rows_start[r]; ai < A->rows_end[r]; ai++)
+            {
+                const ALPHA_INT c = col_map[A->col_indx[ai]];
+                if (c < 0)
+                    continue;
+                buf[k].col = c;
+                buf[k].pos = ai;
+                k++;
+            }
+            qsort(buf, len, sizeof(block_entry_t), (__compar_fn_t)block_col_cmp);
+            for (k = 0; k < len; k++)
+            {
+                mat->col_indx[to + k] = buf[k].col;
+                memcpy(&mat->values[(to + k) * block_len], &A->values[buf[k].pos * block_len], sizeof(ALPHA_Number) * block_len);
+            }
+        }
+        free(buf);
+    }
+    return status;
+}
@@ -0,0 +1,163 @@
+#include "alphasparse/format.h"
+#include <stdlib.h>
+#include <alphasparse/opt.h>
+#include <alphasparse/util.h>
+#include <memory.h>
+
+static int row_first_cmp(const ALPHA_Point *a, const ALPHA_Point *b)
+{
+    return (a->x > b->x) - (a->x < b->x);
+}
+
+// rows of one column into increasing order, by insertion for short columns or without a buffer
+static void sort_col(ALPHA_INT *row, ALPHA_Number *val, const ALPHA_INT len, ALPHA_Point *buf)
+{
+    if (len <= 32 || buf == NULL)
+    {
+        for (ALPHA_INT i = 1; i < len; i++)
+        {
+            const ALPHA_INT r = row[i];
+            ALPHA_Number v;
+            if (val != NULL)
+                v = val[i];
+            ALPHA_INT j = i - 1;
+            for (; j >= 0 && row[j] > r; j--)
+            {
+                row[j + 1] = row[j];
+                if (val != NULL)
+                    val[j + 1] = val[j];
+            }
+            row[j + 1] = r;
+            if (val != NULL)
+                val[j + 1] = v;
+        }
+        return;
+    }
+    for (ALPHA_INT i = 0; i < len; i++)
+    {
+        buf[i].x = row[i];
+        if (val != NULL)
+            buf[i].v = val[i];
+    }
+    qsort(buf, len, sizeof(ALPHA_Point), (__compar_fn_t)row_first_cmp);
+    for (ALPHA_INT i = 0; i < len; i++)
+    {
+        row[i] = buf[i].x;
+        if (val != NULL)
+            val[i] = buf[i].v;
+    }
+}
+
+/*
+* B(i, j) = A(r, col_indx[j]) for row_map[r] = i, the column counterpart of extract_X_csr.
+* col_indx NULL takes the columns of A in order, row_map NULL keeps every row and
+* row_map[r] < 0 drops row r. Columns may repeat, kept rows may not share a target.
+*/
+alphasparse_status_t ONAME(const ALPHA_SPMAT_CSC *A,
+                           const ALPHA_INT rows,
+                           const ALPHA_INT *row_map,
+                           const ALPHA_INT cols,
+                           const ALPHA_INT *col_indx,
+                           ALPHA_SPMAT_CSC **dest)
+{
+    bool keep_all = true, monotone = true;
+    if (row_map != NULL)
+    {
+        ALPHA_INT last = -1;
+        for (ALPHA_INT r = 0; r < A->rows; r++)
+        {
+            if (row_map[r] < 0)
+            {
+                keep_all = false;
+                continue;
+            }
+            monotone = monotone && row_map[r] > last;
+            last = row_map[r];
+        }
+    }
+    ALPHA_SPMAT_CSC *mat = alpha_malloc(sizeof(ALPHA_SPMAT_CSC));
+    *dest = mat;
+    mat->rows = rows;
+    mat->cols = cols;
+    mat->ordered = monotone ? A->ordered : true;
+    ALPHA_INT *cols_offset = alpha_memalign((cols + 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    mat->cols_start = cols_offset;
+    mat->cols_end = cols_offset + 1;
+    const ALPHA_INT num_threads = alpha_get_thread_num();
+    cols_offset[0] = 0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads)
+#endif
+    for (ALPHA_INT j = 0; j < cols; j++)
+    {
+        const ALPHA_INT c = col_indx == NULL ? j : col_indx[j];
+        if (keep_all)
+            cols_offset[j + 1] = A->cols_end[c] - A->cols_start[c];
+        else
+        {
+            ALPHA_INT len = 0;
+            for (ALPHA_INT ai = A->cols_start[c]; ai < A->cols_end[c]; ai++)
+                len += row_map[A->row_indx[ai]] >= 0;
+            cols_offset[j + 1] = len;
+        }
+    }
+    for (ALPHA_INT j = 0; j < cols; j++)
+        cols_offset[j + 1] += cols_offset[j];
+    const ALPHA_INT nnz = cols_offset[cols];
+    mat->row_indx = alpha_memalign(alpha_max(nnz, 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    // pattern-only matrices stay pattern-only
+    mat->values = A->values == NULL ? NULL : alpha_memalign(alpha_max(nnz, 1) * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
+
+    ALPHA_INT partition[num_threads + 1];
+    balanced_partition_row_by_nnz(mat->cols_end, cols, num_threads, partition);
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+        const ALPHA_INT tid = alpha_get_thread_id();
+        ALPHA_Point *buf = NULL;
+        ALPHA_INT buf_len = 0;
+        for (ALPHA_INT j = partition[tid]; j < partition[tid + 1]; j++)
+        {
+            const ALPHA_INT c = col_indx == NULL ? j : col_indx[j];
+            const ALPHA_INT to = mat->cols_start[j];
+            const ALPHA_INT len = mat->cols_end[j] - to;
+            if (keep_all)
+            {
+                const ALPHA_INT from = A->cols_start[c];
+                if (row_map == NULL)
+                    memcpy(&mat->row_indx[to], &A->row_indx[from], sizeof(ALPHA_INT) * len);
+                else
+                    for (ALPHA_INT k = 0; k < len; k++)
+                        mat->row_indx[to + k] = row_map[A->row_indx[from + k]];
+                if (mat->values != NULL)
+                    memcpy(&mat->values[to], &A->values[from], sizeof(ALPHA_Number) * len);
+            }
+            else
+            {
+                ALPHA_INT bi = to;
+                for (ALPHA_INT ai = A->cols_start[c]; ai < A->cols_end[c]; ai++)
+                {
+                    const ALPHA_INT r = row_map[A->row_indx[ai]];
+                    if (r < 0)
+                        continue;
+                    mat->row_indx[bi] = r;
+                    if (mat->values != NULL)
+                        mat->values[bi] = A->values[ai];
+                    bi++;
+                }
+            }
+            if (monotone)
+                continue;
+            if (len > 32 && len > buf_len)
+            {
+                free(buf);
+                buf = malloc(sizeof(ALPHA_Point) * len);
+                buf_len = buf == NULL ? 0 : len;
+            }
+            sort_col(&mat->row_indx[to], mat->values == NULL ? NULL : &mat->values[to], len, len <= buf_len ? buf : NULL);
+        }
+        free(buf);
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -0,0 +1,169 @@
+#include "alphasparse/format.h"
+#include <stdlib.h>
+#include <alphasparse/opt.h>
+#include <alphasparse/util.h>
+#include <memory.h>
+
+static int col_first_cmp(const ALPHA_Point *a, const ALPHA_Point *b)
+{
+    return (a->y > b->y) - (a->y < b->y);
+}
+
+// columns of one row into increasing order, by insertion for short rows or without a buffer
+static void sort_row(ALPHA_INT *col, ALPHA_Number *val, const ALPHA_INT len, ALPHA_Point *buf)
+{
+    if (len <= 32 || buf == NULL)
+    {
+        for (ALPHA_INT i = 1; i < len; i++)
+        {
+            const ALPHA_INT c = col[i];
+            ALPHA_Number v;
+            if (val != NULL)
+                v = val[i];
+            ALPHA_INT j = i - 1;
+            for (; j >= 0 && col[j] > c; j--)
+            {
+                col[j + 1] = col[j];
+                if (val != NULL)
+                    val[j + 1] = val[j];
+            }
+            col[j + 1] = c;
+            if (val != NULL)
+                val[j + 1] = v;
+        }
+        return;
+    }
+    for (ALPHA_INT i = 0; i < len; i++)
+    {
+        buf[i].y = col[i];
+        if (val != NULL)
+            buf[i].v = val[i];
+    }
+    qsort(buf, len, sizeof(ALPHA_Point), (__compar_fn_t)col_first_cmp);
+    for (ALPHA_INT i = 0; i < len; i++)
+    {
+        col[i] = buf[i].y;
+        if (val != NULL)
+            val[i] = buf[i].v;
+    }
+}
+
+/*
+* B(i, j) = A(row_indx[i], c) for col_map[c] = j. row_indx NULL takes the rows of A in
+* order, col_map NULL keeps every column and col_map[c] < 0 drops column c. Rows may
+* repeat, kept columns may not share a target. B = P A Q^T when both are permutations.
+*
+* Row lengths are counted first and the rows then filled in parallel. A row is sorted
+* again only when col_map does not keep the kept columns in increasing order.
+*/
+alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A,
+                           const ALPHA_INT rows,
+                           const ALPHA_INT *row_indx,
+                           const ALPHA_INT cols,
+                           const ALPHA_INT *col_map,
+                           ALPHA_SPMAT_CSR **dest)
+{
+    bool keep_all = true, monotone = true;
+    if (col_map != NULL)
+    {
+        ALPHA_INT last = -1;
+        for (ALPHA_INT c = 0; c < A->cols; c++)
+        {
+            if (col_map[c] < 0)
+            {
+                keep_all = false;
+                continue;
+            }
+            monotone = monotone && col_map[c] > last;
+            last = col_map[c];
+        }
+    }
+    ALPHA_SPMAT_CSR *mat = alpha_malloc(sizeof(ALPHA_SPMAT_CSR));
+    *dest = mat;
+    mat->rows = rows;
+    mat->cols = cols;
+    mat->ordered = monotone ? A->ordered : true;
+    mat->d_values = NULL;
+    mat->d_row_ptr = NULL;
+    mat->d_col_indx = NULL;
+    ALPHA_OFFSET *rows_offset = alpha_memalign((rows + 1) * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
+    mat->rows_start = rows_offset;
+    mat->rows_end = rows_offset + 1;
+    const ALPHA_INT num_threads = alpha_get_thread_num();
+    rows_offset[0] = 0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads)
+#endif
+    for (ALPHA_INT i = 0; i < rows; i++)
+    {
+        const ALPHA_INT r = row_indx == NULL ? i : row_indx[i];
+        if (keep_all)
+            rows_offset[i + 1] = A->rows_end[r] - A->rows_start[r];
+        else
+        {
+            ALPHA_INT len = 0;
+            for (ALPHA_OFFSET ai = A->rows_start[r]; ai < A->rows_end[r]; ai++)
+                len += col_map[A->col_indx[ai]] >= 0;
+            rows_offset[i + 1] = len;
+        }
+    }
+    for (ALPHA_INT i = 0; i < rows; i++)
+        rows_offset[i + 1] += rows_offset[i];
+    const ALPHA_OFFSET nnz = rows_offset[rows];
+    mat->col_indx = alpha_memalign(alpha_max(nnz, 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    // pattern-only matrices stay pattern-only
+    mat->values = A->values == NULL ? NULL : alpha_memalign(alpha_max(nnz, 1) * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
+
+    ALPHA_INT partition[num_threads + 1];
+    balanced_partition_row_by_offset(mat->rows_end, rows, num_threads, partition);
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+        const ALPHA_INT tid = alpha_get_thread_id();
+        ALPHA_Point *buf = NULL;
+        ALPHA_INT buf_len = 0;
+        for (ALPHA_INT i = partition[tid]; i < partition[tid + 1]; i++)
+        {
+            const ALPHA_INT r = row_indx == NULL ? i : row_indx[i];
+            const ALPHA_OFFSET to = mat->rows_start[i];
+            const ALPHA_INT len = mat->rows_end[i] - to;
+            if (keep_all)
+            {
+                const ALPHA_OFFSET from = A->rows_start[r];
+                if (col_map == NULL)
+                    memcpy(&mat->col_indx[to], &A->col_indx[from], sizeof(ALPHA_INT) * len);
+                else
+                    for (ALPHA_INT k = 0; k < len; k++)
+                        mat->col_indx[to + k] = col_map[A->col_indx[from + k]];
+                if (mat->values != NULL)
+                    memcpy(&mat->values[to], &A->values[from], sizeof(ALPHA_Number) * len);
+            }
+            else
+            {
+                ALPHA_OFFSET bi = to;
+                for (ALPHA_OFFSET ai = A->rows_start[r]; ai < A->rows_end[r]; ai++)
+                {
+                    const ALPHA_INT c = col_map[A->col_indx[ai]];
+                    if (c < 0)
+                        continue;
+                    mat->col_indx[bi] = c;
+                    if (mat->values != NULL)
+                        mat->values[bi] = A->values[ai];
+                    bi++;
+                }
+            }
+            if (monotone)
+                continue;
+            if (len > 32 && len > buf_len)
+            {
+                free(buf);
+                buf = malloc(sizeof(ALPHA_Point) * len);
+                buf_len = buf == NULL ? 0 : len;
+            }
+            sort_row(&mat->col_indx[to], mat->values == NULL ? NULL : &mat->values[to], len, len <= buf_len ? buf : NULL);
+        }
+        free(buf);
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -0,0 +1,32 @@
+#include "alphasparse/format.h"
+#include <alphasparse/util.h>
+#include <string.h>
+
+alphasparse_status_t ONAME(const alpha_binary_header_t *header, ALPHA_SPMAT_BSR **dest)
+{
+    const ALPHA_INT m = (ALPHA_INT)header->rows;
+    const ALPHA_OFFSET nnz = (ALPHA_OFFSET)header->nnz;
+    check_return(header->block_size <= 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    const size_t block_bytes = (size_t)header->block_size * header->block_size * sizeof(ALPHA_Number);
+    ALPHA_OFFSET *rows_offset = alpha_binary_section(header, ALPHA_BINARY_SECTION_ROWS_OFFSET, (m + 1) * sizeof(ALPHA_OFFSET));
+    ALPHA_INT *col_indx = alpha_binary_section(header, ALPHA_BINARY_SECTION_COL_INDX, nnz * sizeof(ALPHA_INT));
+    ALPHA_Number *values = alpha_binary_section(header, ALPHA_BINARY_SECTION_VALUES, nnz * block_bytes);
+    check_null_return(rows_offset, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_null_return(col_indx, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_null_return(values, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(rows_offset[0] != 0 || rows_offset[m] != nnz, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    // arrays stay in the mapping
+    ALPHA_SPMAT_BSR *mat = alpha_malloc(sizeof(ALPHA_SPMAT_BSR));
+    memset(mat, 0, sizeof(ALPHA_SPMAT_BSR));
+    mat->rows = m;
+    mat->cols = (ALPHA_INT)header->cols;
+    mat->block_size = (ALPHA_INT)header->block_size;
+    mat->block_layout = (alphasparse_layout_t)header->block_layout;
+    mat->rows_start = rows_offset;
+    mat->rows_end = rows_offset + 1;
+    mat->col_indx = col_indx;
+    mat->values = values;
+    *dest = mat;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -0,0 +1,29 @@
+#include "alphasparse/format.h"
+#include <alphasparse/util.h>
+#include <string.h>
+
+alphasparse_status_t ONAME(const alpha_binary_header_t *header, ALPHA_SPMAT_CSR **dest)
+{
+    const ALPHA_INT m = (ALPHA_INT)header->rows;
+    const ALPHA_OFFSET nnz = (ALPHA_OFFSET)header->nnz;
+    ALPHA_OFFSET *rows_offset = alpha_binary_section(header, ALPHA_BINARY_SECTION_ROWS_OFFSET, (m + 1) * sizeof(ALPHA_OFFSET));
+    ALPHA_INT *col_indx = alpha_binary_section(header, ALPHA_BINARY_SECTION_COL_INDX, nnz * sizeof(ALPHA_INT));
+    ALPHA_Number *values = alpha_binary_section(header, ALPHA_BINARY_SECTION_VALUES, nnz * sizeof(ALPHA_Number));
+    check_null_return(rows_offset, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_null_return(col_indx, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(rows_offset[0] != 0 || rows_offset[m] != nnz, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    // only pattern-only matrices may come without values
+    check_return(values == NULL && header->format != ALPHA_SPARSE_FORMAT_CSR_PATTERN, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    // arrays stay in the mapping
+    ALPHA_SPMAT_CSR *mat = alpha_malloc(sizeof(ALPHA_SPMAT_CSR));
+    memset(mat, 0, sizeof(ALPHA_SPMAT_CSR));
+    mat->rows = m;
+    mat->cols = (ALPHA_INT)header->cols;
+    mat->rows_start = rows_offset;
+    mat->rows_end = rows_offset + 1;
+    mat->col_indx = col_indx;
+    mat->values = header->format == ALPHA_SPARSE_FORMAT_CSR_PATTERN ? NULL : values;
+    *dest = mat;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
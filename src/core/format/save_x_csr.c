@@ -0,0 +1,56 @@
+#include "alphasparse/format.h"
+#include <alphasparse/util.h>
+#include <string.h>
+
+alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, FILE *fp, alpha_binary_header_t *header)
+{
+    const ALPHA_INT m = A->rows;
+    ALPHA_OFFSET nnz = 0;
+    for (ALPHA_INT r = 0; r < m; r++)
+        nnz += A->rows_end[r] - A->rows_start[r];
+    header->rows = A->rows;
+    header->cols = A->cols;
+    header->nnz = nnz;
+
+    // the file keeps 3-array offsets, rows are packed unless the handle already is
+    const ALPHA_OFFSET *rows_offset = A->rows_start;
+    const ALPHA_INT *col_indx = A->col_indx;
+    const ALPHA_Number *values = A->values;
+    ALPHA_OFFSET *packed_offset = NULL;
+    ALPHA_INT *packed_col = NULL;
+    ALPHA_Number *packed_values = NULL;
+    if (A->rows_end != A->rows_start + 1 || (m > 0 && A->rows_start[0] != 0))
+    {
+        packed_offset = alpha_memalign((m + 1) * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
+        packed_col = alpha_memalign(nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+        packed_values = A->values == NULL ? NULL : alpha_memalign(nnz * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
+        packed_offset[0] = 0;
+        for (ALPHA_INT r = 0; r < m; r++)
+        {
+            ALPHA_OFFSET len = A->rows_end[r] - A->rows_start[r];
+            packed_offset[r + 1] = packed_offset[r] + len;
+            memcpy(packed_col + packed_offset[r], A->col_indx + A->rows_start[r], len * sizeof(ALPHA_INT));
+            if (packed_values != NULL)
+                memcpy(packed_values + packed_offset[r], A->values + A->rows_start[r], len * sizeof(ALPHA_Number));
+        }
+        rows_offset = packed_offset;
+        col_indx = packed_col;
+        values = packed_values;
+        header->flags |= ALPHA_BINARY_FLAG_REPACKED;
+    }
+
+    alphasparse_status_t status = alpha_binary_write_section(fp, header, ALPHA_BINARY_SECTION_ROWS_OFFSET, rows_offset, (m + 1) * sizeof(ALPHA_OFFSET));
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS)
+        status = alpha_binary_write_section(fp, header, ALPHA_BINARY_SECTION_COL_INDX, col_indx, nnz * sizeof(ALPHA_INT));
+    // pattern-only matrices have no values section
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS && values != NULL)
+        status = alpha_binary_write_section(fp, header, ALPHA_BINARY_SECTION_VALUES, values, nnz * sizeof(ALPHA_Number));
+
+    if (packed_offset != NULL)
+    {
+        alpha_free(packed_offset);
+        alpha_free(packed_col);
+        alpha_free(packed_values);
+    }
+    return status;
+}
@@ -18,19 +18,21 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_BSR *A, ALPHA_SPMAT_BSR **B)
     mat->cols = A->rows;
     mat->block_size = block_size;
     mat->block_layout = A->block_layout;
-    ALPHA_INT block_nnz = A->rows_end[block_rowA-1];
-    ALPHA_INT *rows_offset = alpha_memalign((block_colA + 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    // rows are read through rows_start and rows_end, a view of rows does not start at 0
+    ALPHA_OFFSET block_nnz = 0;
+    for (ALPHA_INT r = 0; r < block_rowA; ++r)
+        block_nnz += A->rows_end[r] - A->rows_start[r];
+    ALPHA_OFFSET *rows_offset = alpha_memalign((block_colA + 1) * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
     mat->rows_start = rows_offset;
     mat->rows_end = rows_offset + 1;
-    mat->col_indx = alpha_memalign(block_nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
-    mat->values = alpha_memalign(block_nnz * block_size * block_size * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
-    ALPHA_INT col_counter[block_colA];
-    ALPHA_INT row_offset[block_colA];
-    memset(col_counter, '\0', block_colA * sizeof(ALPHA_INT));
-    for (ALPHA_INT i = 0; i < block_nnz; ++i)
-    {
-        col_counter[A->col_indx[i]] += 1;
-    }
+    mat->col_indx = alpha_memalign(alpha_max(block_nnz, 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    mat->values = alpha_memalign(alpha_max(block_nnz, 1) * block_size * block_size * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
+    ALPHA_OFFSET col_counter[block_colA];
+    ALPHA_OFFSET row_offset[block_colA];
+    memset(col_counter, '\0', block_colA * sizeof(ALPHA_OFFSET));
+    for (ALPHA_INT r = 0; r < block_rowA; ++r)
+        for (ALPHA_OFFSET ai = A->rows_start[r]; ai < A->rows_end[r]; ++ai)
+            col_counter[A->col_indx[ai]] += 1;
     row_offset[0] = 0;
     mat->rows_start[0] = 0;
     for (ALPHA_INT i = 1; i < block_colA; ++i)
@@ -41,10 +43,10 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_BSR *A, ALPHA_SPMAT_BSR **B)
     mat->rows_end[block_colA - 1] = block_nnz;
     for (ALPHA_INT r = 0; r < block_rowA; ++r)
     {
-        for (ALPHA_INT ai = A->rows_start[r]; ai < A->rows_end[r]; ++ai)
+        for (ALPHA_OFFSET ai = A->rows_start[r]; ai < A->rows_end[r]; ++ai)
         {
             ALPHA_INT ac = A->col_indx[ai];
-            ALPHA_INT index = row_offset[ac];
+            ALPHA_OFFSET index = row_offset[ac];
             mat->col_indx[index] = r;
             const ALPHA_Number* A_values = A->values + ai * block_size * block_size;
             ALPHA_Number* B_values = mat->values + index * block_size * block_size;
@@ -23,7 +23,8 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *s, ALPHA_SPMAT_COO **d)
     {
         points[i].x = s->col_indx[i];
         points[i].y = s->row_indx[i];
-        points[i].v = s->values[i];
+        if (s->values != NULL)
+            points[i].v = s->values[i];
     }
     qsort(points, nnz, sizeof(ALPHA_Point), (__compar_fn_t)row_first_cmp);
     ALPHA_SPMAT_COO *mat = alpha_malloc(sizeof(ALPHA_SPMAT_COO));
@@ -33,7 +34,8 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *s, ALPHA_SPMAT_COO **d)
     mat->nnz = s->nnz;
     mat->row_indx = alpha_memalign(sizeof(ALPHA_INT) * nnz, DEFAULT_ALIGNMENT);
     mat->col_indx = alpha_memalign(sizeof(ALPHA_INT) * nnz, DEFAULT_ALIGNMENT);
-    mat->values = alpha_memalign(sizeof(ALPHA_Number) * nnz, DEFAULT_ALIGNMENT);
+    // pattern-only matrices stay pattern-only
+    mat->values = s->values == NULL ? NULL : alpha_memalign(sizeof(ALPHA_Number) * nnz, DEFAULT_ALIGNMENT);
 #ifdef _OPENMP
 #pragma omp parallel for num_threads(num_threads)
 #endif
@@ -41,7 +43,8 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_COO *s, ALPHA_SPMAT_COO **d)
     {
         mat->row_indx[i] = points[i].x;
         mat->col_indx[i] = points[i].y;
-        mat->values[i] = points[i].v;
+        if (mat->values != NULL)
+            mat->values[i] = points[i].v;
     }
     alpha_free(points);
     return ALPHA_SPARSE_STATUS_SUCCESS;
@@ -17,7 +17,8 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSC *A, ALPHA_SPMAT_CSC **B)
     mat->cols_start = cols_offset;
     mat->cols_end = cols_offset + 1;
     mat->row_indx = alpha_memalign(nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
-    mat->values = alpha_memalign(nnz * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
+    // pattern-only matrices stay pattern-only
+    mat->values = A->values == NULL ? NULL : alpha_memalign(nnz * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
     ALPHA_INT row_counter[rowA];
     ALPHA_INT col_offset[mat->cols];
     memset(row_counter, '\0', rowA * sizeof(ALPHA_INT));
@@ -52,7 +53,8 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSC *A, ALPHA_SPMAT_CSC **B)
                     continue;
                 ALPHA_INT index = col_offset[bc];
                 mat->row_indx[index] = ac;
-                mat->values[index] = A->values[ai];
+                if (mat->values != NULL)
+                    mat->values[index] = A->values[ai];
                 col_offset[bc] += 1;
             }
         }
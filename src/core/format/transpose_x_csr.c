@@ -13,19 +13,22 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, ALPHA_SPMAT_CSR **B)
     ALPHA_INT colA = A->cols;
     mat->rows = colA;
     mat->cols = rowA;
-    ALPHA_INT nnz = A->rows_end[rowA - 1];
-    ALPHA_INT *rows_offset = alpha_memalign((mat->rows + 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    // rows are read through rows_start and rows_end, a view of rows does not start at 0
+    ALPHA_OFFSET nnz = 0;
+    for (ALPHA_INT r = 0; r < rowA; ++r)
+        nnz += A->rows_end[r] - A->rows_start[r];
+    ALPHA_OFFSET *rows_offset = alpha_memalign((mat->rows + 1) * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
     mat->rows_start = rows_offset;
     mat->rows_end = rows_offset + 1;
-    mat->col_indx = alpha_memalign(nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
-    mat->values = alpha_memalign(nnz * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
-    ALPHA_INT col_counter[colA];
-    ALPHA_INT row_offset[colA];
-    memset(col_counter, '\0', colA * sizeof(ALPHA_INT));
-    for (ALPHA_INT i = 0; i < nnz; ++i)
-    {
-        col_counter[A->col_indx[i]] += 1;
-    }
+    mat->col_indx = alpha_memalign(alpha_max(nnz, 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    // pattern-only matrices stay pattern-only
+    mat->values = A->values == NULL ? NULL : alpha_memalign(alpha_max(nnz, 1) * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
+    ALPHA_OFFSET col_counter[colA];
+    ALPHA_OFFSET row_offset[colA];
+    memset(col_counter, '\0', colA * sizeof(ALPHA_OFFSET));
+    for (ALPHA_INT r = 0; r < rowA; ++r)
+        for (ALPHA_OFFSET ai = A->rows_start[r]; ai < A->rows_end[r]; ++ai)
+            col_counter[A->col_indx[ai]] += 1;
     row_offset[0] = 0;
     mat->rows_start[0] = 0;
     for (ALPHA_INT i = 1; i < colA; ++i)
@@ -36,7 +39,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, ALPHA_SPMAT_CSR **B)
     mat->rows_end[colA - 1] = nnz;
     ALPHA_INT num_threads = alpha_get_thread_num();
     ALPHA_INT partition[num_threads + 1];
-    balanced_partition_row_by_nnz(mat->rows_end, mat->rows, num_threads, partition);
+    balanced_partition_row_by_offset(mat->rows_end, mat->rows, num_threads, partition);
 #ifdef _OPENMP
 #pragma omp parallel num_threads(num_threads)
 #endif
@@ -46,14 +49,15 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, ALPHA_SPMAT_CSR **B)
         ALPHA_INT lrh = partition[tid + 1];
         for (ALPHA_INT r = 0; r < rowA; ++r)
         {
-            for (ALPHA_INT ai = A->rows_start[r]; ai < A->rows_end[r]; ++ai)
+            for (ALPHA_OFFSET ai = A->rows_start[r]; ai < A->rows_end[r]; ++ai)
             {
                 ALPHA_INT ac = A->col_indx[ai];
                 if (ac < lrs || ac >= lrh)
                     continue;
-                ALPHA_INT index = row_offset[ac];
+                ALPHA_OFFSET index = row_offset[ac];
                 mat->col_indx[index] = r;
-                mat->values[index] = A->values[ai];
+                if (mat->values != NULL)
+                    mat->values[index] = A->values[ai];
                 row_offset[ac] += 1;
             }
         }
@@ -0,0 +1,30 @@
+#include "alphasparse/spapi.h"
+#include "alphasparse/kernel.h"
+/*
+* 
+* Scatter the elements of a compressed vector into a full storage vector by index
+*
+* details:
+* y[indx[i]] = x[i], for i=0,1,... ,nz-1
+*
+* x         Sparse vector in compressed format
+* y         full storage vector
+* indx      The element index of x, stored in an array, with a length of at least nz
+*
+* input:
+* x         Stored in an array, length is at least nz
+* y         Stored as an array, length is at least max(indx[i])
+* nz        Number of elements in vectors x and indx
+* indx      The element index of x, stored in an array, with a length of at least nz
+* 
+* output:
+* y         the updated y
+*
+*/
+alphasparse_status_t ONAME(const ALPHA_INT nz,
+                          const ALPHA_Number *x,
+                          const ALPHA_INT *indx,
+                          ALPHA_Number *y)
+{
+    return sctr(nz, x, indx, y);
+}
@@ -0,0 +1,40 @@
+#include "alphasparse/spvec.h"
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/vec_index.h"
+
+alphasparse_status_t ONAME(const ALPHA_Number alpha, const struct alpha_spvec *x, const ALPHA_Number beta, ALPHA_Number *y)
+{
+    if (!alpha_isone(beta))
+    {
+        const ALPHA_INT thread_num = alpha_level1_thread_num(x->size);
+        const bool zero = alpha_iszero(beta);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static)
+#endif
+        for (ALPHA_INT i = 0; i < x->size; ++i)
+        {
+            if (zero)
+            {
+                alpha_setzero(y[i]);
+            }
+            else
+            {
+                alpha_mule(y[i], beta);
+            }
+        }
+    }
+    if (x->nnz <= 0 || alpha_iszero(alpha))
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    // the kernel indexes y from 0, a one-based vector subtracts its base here
+    if (x->indexing == ALPHA_SPARSE_INDEX_BASE_ONE)
+    {
+        const ALPHA_Number *values = (const ALPHA_Number *)x->values;
+        for (ALPHA_INT i = 0; i < x->nnz; i++)
+        {
+            alpha_madde(y[x->indx[i] - 1], alpha, values[i]);
+        }
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    }
+    return axpy(x->nnz, alpha, (const ALPHA_Number *)x->values, x->indx, y);
+}
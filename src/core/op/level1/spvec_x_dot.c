@@ -0,0 +1,41 @@
+#include "alphasparse/spvec.h"
+#include "alphasparse/kernel.h"
+
+alphasparse_status_t ONAME(const alphasparse_operation_t operation, const struct alpha_spvec *x, const ALPHA_Number *y, ALPHA_Number *result)
+{
+    const ALPHA_Number *values = (const ALPHA_Number *)x->values;
+    // the kernels reject empty vectors
+    if (x->nnz <= 0)
+    {
+        alpha_setzero(*result);
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    }
+    // the kernels index y from 0, a one-based vector subtracts its base here
+    if (x->indexing == ALPHA_SPARSE_INDEX_BASE_ONE)
+    {
+        ALPHA_Number sum;
+        alpha_setzero(sum);
+        for (ALPHA_INT i = 0; i < x->nnz; i++)
+        {
+            ALPHA_Number v = values[i];
+#ifdef COMPLEX
+            if (operation == ALPHA_SPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+            {
+                alpha_conj(v, values[i]);
+            }
+#endif
+            alpha_madde(sum, v, y[x->indx[i] - 1]);
+        }
+        *result = sum;
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    }
+#ifdef COMPLEX
+    if (operation == ALPHA_SPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+        dotci_sub(x->nnz, values, x->indx, y, result);
+    else
+        dotui_sub(x->nnz, values, x->indx, y, result);
+#else
+    *result = doti(x->nnz, values, x->indx, y);
+#endif
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -0,0 +1,15 @@
+#include "alphasparse/spvec.h"
+#include "alphasparse/kernel.h"
+
+alphasparse_status_t ONAME(const struct alpha_spvec *x, ALPHA_Number *y)
+{
+    const ALPHA_Number *values = (const ALPHA_Number *)x->values;
+    // the kernel indexes y from 0, a one-based vector subtracts its base here
+    if (x->indexing == ALPHA_SPARSE_INDEX_BASE_ONE)
+    {
+        for (ALPHA_INT i = 0; i < x->nnz; i++)
+            y[x->indx[i] - 1] = values[i];
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    }
+    return sctr(x->nnz, values, x->indx, y);
+}
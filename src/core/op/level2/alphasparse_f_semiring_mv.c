@@ -0,0 +1,134 @@
+#include "alphasparse/spapi.h"
+#include "alphasparse/semiring.h"
+#include "alphasparse/inspector.h"
+#include "alphasparse/util.h"
+#include "alphasparse/opt.h"
+#include <stdlib.h>
+
+/*
+*
+* y := op(A) add.multiply x over a semiring, y_i is the add of a_ij * x_j
+* over the entries of row i of op(A), the identity of add for an empty row
+*
+* Rows of a CSR matrix are read in place, every other case pulls over the
+* grouping of op(A) by row kept in the inspector. Rows run through the
+* work-stealing scheduler by their entries, a row stops early once add is
+* absorbed.
+*
+*/
+
+typedef struct
+{
+    const ALPHA_OFFSET *begin;
+    const ALPHA_OFFSET *end;
+    const ALPHA_INT *idx;
+    const ALPHA_OFFSET *pos; // NULL when values are in line order
+    const ALPHA_Number *values;
+    const ALPHA_Number *x;
+    ALPHA_Number *y;
+} semiring_mv_t;
+
+ALPHA_SEMIRING_INLINE void semiring_mv_rows(const semiring_mv_t *p,
+                                            const ALPHA_INT first,
+                                            const ALPHA_INT last,
+                                            const alpha_semiring_op_t add,
+                                            const alpha_semiring_op_t mul,
+                                            const ALPHA_Number zero,
+                                            const alpha_semiring_absorbed_t absorbed)
+{
+    const ALPHA_INT *idx = p->idx;
+    const ALPHA_Number *values = p->values;
+    const ALPHA_Number *x = p->x;
+    for (ALPHA_INT r = first; r < last; r++)
+    {
+        ALPHA_Number acc = zero;
+        if (p->pos == NULL)
+        {
+            for (ALPHA_OFFSET e = p->begin[r]; e < p->end[r]; e++)
+            {
+                acc = add(acc, mul(values[e], x[idx[e]]));
+                if (absorbed(acc))
+                    break;
+            }
+        }
+        else
+        {
+            for (ALPHA_OFFSET e = p->begin[r]; e < p->end[r]; e++)
+            {
+                acc = add(acc, mul(values[p->pos[e]], x[idx[e]]));
+                if (absorbed(acc))
+                    break;
+            }
+        }
+        p->y[r] = acc;
+    }
+}
+
+// one scheduler task per semiring, the operators are constants inside it
+#define SEMIRING_MV(NAME, ADD, MUL, ZERO, ABSORBED)                                                            \
+    static void semiring_mv_##NAME(void *arg, const ALPHA_INT tid, const ALPHA_INT first, const ALPHA_INT last) \
+    {                                                                                                          \
+        semiring_mv_rows(arg, first, last, ADD, MUL, ZERO, ABSORBED);                                          \
+    }
+ALPHA_SEMIRING_LIST(SEMIRING_MV)
+#undef SEMIRING_MV
+
+alphasparse_status_t ONAME(const alphasparse_semiring_t semiring,
+                           const alphasparse_operation_t operation,
+                           const alphasparse_matrix_t A,
+                           const ALPHA_Number *x,
+                           ALPHA_Number *y)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(x == NULL || y == NULL, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(A->datatype != ALPHA_SPARSE_DATATYPE, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(operation != ALPHA_SPARSE_OPERATION_NON_TRANSPOSE && operation != ALPHA_SPARSE_OPERATION_TRANSPOSE,
+                 ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(semiring < ALPHA_SPARSE_SEMIRING_PLUS_TIMES || semiring > ALPHA_SPARSE_SEMIRING_PLUS_MIN, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    semiring_mv_t task = {.x = x, .y = y};
+    if (A->format == ALPHA_SPARSE_FORMAT_CSR)
+        task.values = ((ALPHA_SPMAT_CSR *)A->mat)->values;
+    else if (A->format == ALPHA_SPARSE_FORMAT_CSC)
+        task.values = ((ALPHA_SPMAT_CSC *)A->mat)->values;
+    else if (A->format == ALPHA_SPARSE_FORMAT_COO)
+        task.values = ((ALPHA_SPMAT_COO *)A->mat)->values;
+    else
+        return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
+
+    ALPHA_INT n;
+    if (A->format == ALPHA_SPARSE_FORMAT_CSR && operation == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        const ALPHA_SPMAT_CSR *mat = A->mat;
+        n = mat->rows;
+        task.begin = mat->rows_start;
+        task.end = mat->rows_end;
+        task.idx = mat->col_indx;
+        task.pos = NULL;
+    }
+    else
+    {
+        // rows of op(A) are columns of A under a transpose
+        alpha_value_index_t *lines;
+        check_error_return(alphasparse_inspector_lines(A, operation == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &lines));
+        n = lines->n;
+        task.begin = lines->ptr;
+        task.end = lines->ptr + 1;
+        task.idx = lines->idx;
+        task.pos = lines->pos;
+    }
+
+    alpha_steal_fn_t rows_fn = NULL;
+    switch (semiring)
+    {
+#define SEMIRING_CASE(NAME, ADD, MUL, ZERO, ABSORBED) \
+    case ALPHA_SPARSE_SEMIRING_##NAME:                \
+        rows_fn = semiring_mv_##NAME;                 \
+        break;
+        ALPHA_SEMIRING_LIST(SEMIRING_CASE)
+#undef SEMIRING_CASE
+    }
+    alpha_steal_for_offset(alpha_get_thread_num(), n, task.begin, task.end, rows_fn, &task);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -0,0 +1,447 @@
+#include "alphasparse/spapi.h"
+#include "alphasparse/spvec.h"
+#include "alphasparse/semiring.h"
+#include "alphasparse/inspector.h"
+#include "alphasparse/util.h"
+#include "alphasparse/opt.h"
+#include "alphasparse/util/spmspv.h"
+#include <stdlib.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*
+*
+* y := op(A) add.multiply x over a semiring for a sparse x, the traversals of
+* alphasparse_?_spmspv with add and multiply of the semiring
+*
+* push      The products of the columns x selects are dealt into buckets of
+*           consecutive rows and every bucket is folded with add on a dense
+*           accumulator, a row already absorbed takes no further products.
+* pull      Every row of op(A) is folded over the entries x selects and stops
+*           once add is absorbed, e.g. at the first path found under LOR_LAND.
+*
+* y is a new sorted vector with the indexing of x holding every row an entry
+* of x reaches, released with alphasparse_destroy_spvec.
+*
+*/
+
+// rows of a push bucket, kept small enough for the accumulator to stay in cache
+#define SEMIRING_BUCKET_ROWS 4096
+
+static alphasparse_status_t semiring_output(const ALPHA_INT size, const ALPHA_INT nnz, const alphasparse_index_base_t indexing, alphasparse_spvec_t *y)
+{
+    struct alpha_spvec *vec = malloc(sizeof(struct alpha_spvec));
+    check_null_return(vec, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+    vec->datatype = ALPHA_SPARSE_DATATYPE;
+    vec->indexing = indexing;
+    vec->size = size;
+    vec->nnz = nnz;
+    vec->indx = malloc(sizeof(ALPHA_INT) * (nnz > 0 ? nnz : 1));
+    vec->values = malloc(sizeof(ALPHA_Number) * (nnz > 0 ? nnz : 1));
+    vec->owned = true;
+    if (vec->indx == NULL || vec->values == NULL)
+    {
+        free(vec->indx);
+        free(vec->values);
+        free(vec);
+        return ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    }
+    *y = vec;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+static int semiring_int_cmp(const void *a, const void *b)
+{
+    const ALPHA_INT l = *(const ALPHA_INT *)a, r = *(const ALPHA_INT *)b;
+    return l < r ? -1 : (l > r);
+}
+
+/*
+* state shared by the phases of a call, the phases touching values are the
+* per-semiring tasks below and are called once per thread or per bucket
+*
+* push          Cut of x into parts, their slots in the buckets and the marks of each thread
+* spa           Dense accumulator of each thread, bucket_rows each
+* pull          Rows of each part under pull and the rows each one reached
+*/
+typedef struct
+{
+    const alpha_value_index_t *lines;
+    const ALPHA_Number *values;
+    const struct alpha_spvec *x;
+    ALPHA_INT base;
+    ALPHA_INT rows;
+    // push
+    alpha_spmspv_push_t *push;
+    ALPHA_INT *pair_row;
+    ALPHA_Number *pair_val;
+    ALPHA_Number *spa;
+    // pull
+    alpha_spmspv_pull_t *pull;
+    const ALPHA_Number *dense;
+    const char *mask;
+    ALPHA_INT *tmp_row;
+    ALPHA_Number *tmp_val;
+} semiring_spmspv_t;
+
+// the products of the entries [first, last) of x into the buckets of part t
+ALPHA_SEMIRING_INLINE void semiring_deal(const semiring_spmspv_t *p, const ALPHA_INT t, const ALPHA_INT first, const ALPHA_INT last,
+                                         const alpha_semiring_op_t mul)
+{
+    const alpha_value_index_t *cols = p->lines;
+    const ALPHA_INT bucket_rows = p->push->bucket_rows;
+    ALPHA_INT64 *fill = p->push->fill + (size_t)t * p->push->bucket_num;
+    for (ALPHA_INT k = first; k < last; k++)
+    {
+        const ALPHA_INT j = p->x->indx[k] - p->base;
+        const ALPHA_Number xj = ((const ALPHA_Number *)p->x->values)[k];
+        for (ALPHA_OFFSET e = cols->ptr[j]; e < cols->ptr[j + 1]; e++)
+        {
+            const ALPHA_INT64 dst = fill[cols->idx[e] / bucket_rows]++;
+            p->pair_row[dst] = cols->idx[e];
+            p->pair_val[dst] = mul(p->values[cols->pos[e]], xj);
+        }
+    }
+}
+
+// fold the buckets [first, last) with add, the folded rows overwrite the front of their bucket
+ALPHA_SEMIRING_INLINE void semiring_merge(const semiring_spmspv_t *p, const ALPHA_INT tid, const ALPHA_INT first, const ALPHA_INT last,
+                                          const alpha_semiring_op_t add, const alpha_semiring_absorbed_t absorbed)
+{
+    const alpha_spmspv_push_t *plan = p->push;
+    const ALPHA_INT bucket_rows = plan->bucket_rows;
+    ALPHA_Number *spa = p->spa + (size_t)tid * bucket_rows;
+    char *mark = plan->mark + (size_t)tid * bucket_rows;
+    ALPHA_INT *touched = plan->touched + (size_t)tid * bucket_rows;
+    for (ALPHA_INT b = first; b < last; b++)
+    {
+        const ALPHA_INT64 lo = plan->slot[(ALPHA_INT64)b * plan->parts], hi = plan->slot[(ALPHA_INT64)(b + 1) * plan->parts];
+        const ALPHA_INT row0 = b * bucket_rows;
+        const ALPHA_INT span = alpha_min(bucket_rows, p->rows - row0);
+        ALPHA_INT cnt = 0;
+        for (ALPHA_INT64 i = lo; i < hi; i++)
+        {
+            const ALPHA_INT r = p->pair_row[i] - row0;
+            if (!mark[r])
+            {
+                mark[r] = 1;
+                touched[cnt++] = r;
+                spa[r] = p->pair_val[i];
+            }
+            else if (!absorbed(spa[r]))
+                spa[r] = add(spa[r], p->pair_val[i]);
+        }
+        // few rows are sorted, many are collected by a sweep over the bucket
+        if ((ALPHA_INT64)cnt * 8 < span)
+            qsort(touched, cnt, sizeof(ALPHA_INT), semiring_int_cmp);
+        else
+        {
+            cnt = 0;
+            for (ALPHA_INT r = 0; r < span; r++)
+                if (mark[r])
+                    touched[cnt++] = r;
+        }
+        for (ALPHA_INT i = 0; i < cnt; i++)
+        {
+            const ALPHA_INT r = touched[i];
+            p->pair_row[lo + i] = r + row0;
+            p->pair_val[lo + i] = spa[r];
+            mark[r] = 0;
+        }
+        plan->bucket_out[b + 1] = cnt;
+    }
+}
+
+// rows [first, last) of op(A) masked by x, the rows reached by part t are compacted from tmp[first]
+ALPHA_SEMIRING_INLINE void semiring_pull(const semiring_spmspv_t *p, const ALPHA_INT t, const ALPHA_INT first, const ALPHA_INT last,
+                                         const alpha_semiring_op_t add, const alpha_semiring_op_t mul,
+                                         const ALPHA_Number zero, const alpha_semiring_absorbed_t absorbed)
+{
+    const alpha_value_index_t *lines = p->lines;
+    ALPHA_INT cnt = first;
+    for (ALPHA_INT r = first; r < last; r++)
+    {
+        ALPHA_Number acc = zero;
+        bool hit = false;
+        for (ALPHA_OFFSET e = lines->ptr[r]; e < lines->ptr[r + 1]; e++)
+        {
+            const ALPHA_INT j = lines->idx[e];
+            if (!p->mask[j])
+                continue;
+            hit = true;
+            acc = add(acc, mul(p->values[lines->pos[e]], p->dense[j]));
+            if (absorbed(acc))
+                break;
+        }
+        if (hit)
+        {
+            p->tmp_row[cnt] = r;
+            p->tmp_val[cnt] = acc;
+            cnt++;
+        }
+    }
+    p->pull->found[t + 1] = cnt - first;
+}
+
+typedef struct
+{
+    alpha_steal_fn_t deal;
+    alpha_steal_fn_t merge;
+    alpha_steal_fn_t pull;
+    alpha_semiring_op_t add; // folds repeated entries of x under pull
+} semiring_spmspv_ops_t;
+
+#define SEMIRING_SPMSPV(NAME, ADD, MUL, ZERO, ABSORBED)                                                                 \
+    static void semiring_deal_##NAME(void *arg, const ALPHA_INT tid, const ALPHA_INT first, const ALPHA_INT last)  \
+    {                                                                                                               \
+        semiring_deal(arg, tid, first, last, MUL);                                                                  \
+    }                                                                                                               \
+    static void semiring_merge_##NAME(void *arg, const ALPHA_INT tid, const ALPHA_INT first, const ALPHA_INT last) \
+    {                                                                                                               \
+        semiring_merge(arg, tid, first, last, ADD, ABSORBED);                                                       \
+    }                                                                                                               \
+    static void semiring_pull_##NAME(void *arg, const ALPHA_INT tid, const ALPHA_INT first, const ALPHA_INT last)  \
+    {                                                                                                               \
+        semiring_pull(arg, tid, first, last, ADD, MUL, ZERO, ABSORBED);                                             \
+    }                                                                                                               \
+    static ALPHA_Number semiring_add_##NAME(const ALPHA_Number a, const ALPHA_Number b) { return ADD(a, b); }
+ALPHA_SEMIRING_LIST(SEMIRING_SPMSPV)
+#undef SEMIRING_SPMSPV
+
+static const semiring_spmspv_ops_t semiring_spmspv_ops[] = {
+#define SEMIRING_OPS(NAME, ADD, MUL, ZERO, ABSORBED) \
+    [ALPHA_SPARSE_SEMIRING_##NAME] = {semiring_deal_##NAME, semiring_merge_##NAME, semiring_pull_##NAME, semiring_add_##NAME},
+    ALPHA_SEMIRING_LIST(SEMIRING_OPS)
+#undef SEMIRING_OPS
+};
+
+/*
+* push over cols, the grouping of op(A) by column. The entries of x are cut
+* into parts by the products they select, every part deals its products into
+* the buckets in its own slot, and the buckets are folded through the
+* work-stealing scheduler.
+*/
+static alphasparse_status_t semiring_push(const semiring_spmspv_ops_t *ops,
+                                          const alpha_value_index_t *cols,
+                                          const ALPHA_Number *values,
+                                          const ALPHA_INT rows,
+                                          const struct alpha_spvec *x,
+                                          alphasparse_spvec_t *y)
+{
+    semiring_spmspv_t p = {.lines = cols, .values = values, .x = x, .rows = rows};
+    p.base = x->indexing == ALPHA_SPARSE_INDEX_BASE_ONE ? 1 : 0;
+    const ALPHA_INT thread_num = alpha_get_thread_num();
+    const ALPHA_INT bucket_rows = alpha_min(SEMIRING_BUCKET_ROWS, alpha_max(rows, 1));
+
+    alpha_spmspv_push_t plan;
+    check_error_return(alpha_spmspv_push_plan(cols->ptr, cols->idx, x->indx, x->nnz, p.base, rows, bucket_rows, thread_num, &plan));
+    p.push = &plan;
+    const ALPHA_INT bucket_num = plan.bucket_num;
+    const ALPHA_INT64 total = plan.total;
+    const ALPHA_INT *first = plan.first;
+    ALPHA_INT64 *bucket_cost = malloc(sizeof(ALPHA_INT64) * (bucket_num > 0 ? bucket_num : 1));
+    p.spa = malloc(sizeof(ALPHA_Number) * (size_t)thread_num * bucket_rows);
+    p.pair_row = malloc(sizeof(ALPHA_INT) * (total > 0 ? total : 1));
+    p.pair_val = malloc(sizeof(ALPHA_Number) * (total > 0 ? total : 1));
+    alphasparse_status_t status = ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    if (bucket_cost == NULL || p.spa == NULL || p.pair_row == NULL || p.pair_val == NULL)
+        goto out;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num)
+#endif
+    {
+        const ALPHA_INT tid = alpha_get_thread_id();
+#ifdef _OPENMP
+        const ALPHA_INT team = omp_get_num_threads();
+#else
+        const ALPHA_INT team = 1;
+#endif
+        for (ALPHA_INT t = tid; t < thread_num; t += team)
+            ops->deal(&p, t, first[t], first[t + 1]);
+    }
+    // a bucket costs its products and a sweep
+    for (ALPHA_INT b = 0; b < bucket_num; b++)
+        bucket_cost[b] = plan.slot[(ALPHA_INT64)(b + 1) * thread_num] + (ALPHA_INT64)(b + 1) * (bucket_rows / 8);
+    alpha_steal_for(thread_num, bucket_num, bucket_cost, ops->merge, &p);
+
+    const ALPHA_INT64 *bucket_out = plan.bucket_out;
+    status = semiring_output(rows, (ALPHA_INT)alpha_spmspv_push_out(&plan), x->indexing, y);
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS)
+    {
+        ALPHA_INT *yi = (*y)->indx;
+        ALPHA_Number *yv = (*y)->values;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+        for (ALPHA_INT b = 0; b < bucket_num; b++)
+        {
+            const ALPHA_INT64 src = plan.slot[(ALPHA_INT64)b * thread_num];
+            for (ALPHA_INT64 i = bucket_out[b]; i < bucket_out[b + 1]; i++)
+            {
+                yi[i] = p.pair_row[src + i - bucket_out[b]] + p.base;
+                yv[i] = p.pair_val[src + i - bucket_out[b]];
+            }
+        }
+    }
+out:
+    free(p.pair_row);
+    free(p.pair_val);
+    free(bucket_cost);
+    free(p.spa);
+    alpha_spmspv_push_destroy(&plan);
+    return status;
+}
+
+/*
+* pull over lines, the grouping of op(A) by row. x is spread into a dense
+* array with a mask, the rows are cut into parts by their entries and every
+* part compacts the rows it reached into its range of a scratch array.
+*/
+static alphasparse_status_t semiring_pull_rows(const semiring_spmspv_ops_t *ops,
+                                               const alpha_value_index_t *lines,
+                                               const ALPHA_Number *values,
+                                               const ALPHA_INT cols,
+                                               const struct alpha_spvec *x,
+                                               alphasparse_spvec_t *y)
+{
+    semiring_spmspv_t p = {.lines = lines, .values = values, .x = x, .rows = lines->n};
+    p.base = x->indexing == ALPHA_SPARSE_INDEX_BASE_ONE ? 1 : 0;
+    const ALPHA_INT rows = p.rows, thread_num = alpha_get_thread_num();
+    alpha_spmspv_pull_t plan;
+    check_error_return(alpha_spmspv_pull_plan(lines->ptr, rows, thread_num, &plan));
+    p.pull = &plan;
+    const ALPHA_INT *partition = plan.partition;
+    const ALPHA_INT *found = plan.found;
+    ALPHA_Number *dense = malloc(sizeof(ALPHA_Number) * (cols > 0 ? cols : 1));
+    char *mask = calloc(cols > 0 ? cols : 1, sizeof(char));
+    p.tmp_row = malloc(sizeof(ALPHA_INT) * (rows > 0 ? rows : 1));
+    p.tmp_val = malloc(sizeof(ALPHA_Number) * (rows > 0 ? rows : 1));
+    alphasparse_status_t status = ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    if (dense == NULL || mask == NULL || p.tmp_row == NULL || p.tmp_val == NULL)
+        goto out;
+    // repeated entries of x are folded with add
+    for (ALPHA_INT k = 0; k < x->nnz; k++)
+    {
+        const ALPHA_INT j = x->indx[k] - p.base;
+        const ALPHA_Number xk = ((const ALPHA_Number *)x->values)[k];
+        dense[j] = mask[j] ? ops->add(dense[j], xk) : xk;
+        mask[j] = 1;
+    }
+    p.dense = dense;
+    p.mask = mask;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num)
+#endif
+    {
+        const ALPHA_INT tid = alpha_get_thread_id();
+#ifdef _OPENMP
+        const ALPHA_INT team = omp_get_num_threads();
+#else
+        const ALPHA_INT team = 1;
+#endif
+        for (ALPHA_INT t = tid; t < thread_num; t += team)
+            ops->pull(&p, t, partition[t], partition[t + 1]);
+    }
+
+    status = semiring_output(rows, alpha_spmspv_pull_found(&plan), x->indexing, y);
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS)
+    {
+        ALPHA_INT *yi = (*y)->indx;
+        ALPHA_Number *yv = (*y)->values;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+        for (ALPHA_INT t = 0; t < thread_num; t++)
+        {
+            for (ALPHA_INT i = found[t]; i < found[t + 1]; i++)
+            {
+                yi[i] = p.tmp_row[partition[t] + i - found[t]] + p.base;
+                yv[i] = p.tmp_val[partition[t] + i - found[t]];
+            }
+        }
+    }
+out:
+    free(dense);
+    free(mask);
+    free(p.tmp_row);
+    free(p.tmp_val);
+    alpha_spmspv_pull_destroy(&plan);
+    return status;
+}
+
+alphasparse_status_t ONAME(const alphasparse_semiring_t semiring,
+                           const alphasparse_operation_t operation,
+                           const alphasparse_matrix_t A,
+                           const alphasparse_spvec_t x,
+                           const alphasparse_spmspv_alg_t alg,
+                           alphasparse_spvec_t *y)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(x, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(y, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(A->datatype != ALPHA_SPARSE_DATATYPE || x->datatype != ALPHA_SPARSE_DATATYPE, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(alg != ALPHA_SPARSE_SPMSPV_AUTO && alg != ALPHA_SPARSE_SPMSPV_PUSH && alg != ALPHA_SPARSE_SPMSPV_PULL, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(operation != ALPHA_SPARSE_OPERATION_NON_TRANSPOSE && operation != ALPHA_SPARSE_OPERATION_TRANSPOSE,
+                 ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(semiring < ALPHA_SPARSE_SEMIRING_PLUS_TIMES || semiring > ALPHA_SPARSE_SEMIRING_PLUS_MIN, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    ALPHA_INT rows, cols;
+    const ALPHA_Number *values;
+    if (A->format == ALPHA_SPARSE_FORMAT_CSR)
+    {
+        const ALPHA_SPMAT_CSR *mat = A->mat;
+        rows = mat->rows, cols = mat->cols, values = mat->values;
+    }
+    else if (A->format == ALPHA_SPARSE_FORMAT_CSC)
+    {
+        const ALPHA_SPMAT_CSC *mat = A->mat;
+        rows = mat->rows, cols = mat->cols, values = mat->values;
+    }
+    else if (A->format == ALPHA_SPARSE_FORMAT_COO)
+    {
+        const ALPHA_SPMAT_COO *mat = A->mat;
+        rows = mat->rows, cols = mat->cols, values = mat->values;
+    }
+    else
+        return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
+    const bool trans = operation == ALPHA_SPARSE_OPERATION_TRANSPOSE;
+    const ALPHA_INT op_rows = trans ? cols : rows;
+    const ALPHA_INT op_cols = trans ? rows : cols;
+    check_return(x->size != op_cols, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    const ALPHA_INT base = x->indexing == ALPHA_SPARSE_INDEX_BASE_ONE ? 1 : 0;
+    for (ALPHA_INT k = 0; k < x->nnz; k++)
+        check_return(x->indx[k] - base < 0 || x->indx[k] - base >= op_cols, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    // columns of op(A) are rows of A under a transpose
+    bool push = alg == ALPHA_SPARSE_SPMSPV_PUSH;
+    if (alg == ALPHA_SPARSE_SPMSPV_AUTO)
+    {
+        alpha_value_index_t *index;
+        check_error_return(alphasparse_inspector_lines(A, A->format != ALPHA_SPARSE_FORMAT_CSC, &index));
+        const ALPHA_INT64 nnz = index->nnz;
+        const alpha_value_index_t *col_lines = alphasparse_inspector_lines_built(A, trans);
+        ALPHA_INT64 work = 0;
+        if (col_lines != NULL)
+        {
+            for (ALPHA_INT k = 0; k < x->nnz; k++)
+            {
+                const ALPHA_INT j = x->indx[k] - base;
+                work += col_lines->ptr[j + 1] - col_lines->ptr[j];
+            }
+        }
+        else if (op_cols > 0)
+            work = (ALPHA_INT64)x->nnz * nnz / op_cols;
+        push = work * ALPHA_SPMSPV_PUSH_FACTOR < nnz;
+    }
+
+    alpha_value_index_t *lines;
+    check_error_return(alphasparse_inspector_lines(A, push ? trans : !trans, &lines));
+    const semiring_spmspv_ops_t *ops = &semiring_spmspv_ops[semiring];
+    if (push)
+        return semiring_push(ops, lines, values, op_rows, x, y);
+    return semiring_pull_rows(ops, lines, values, op_cols, x, y);
+}
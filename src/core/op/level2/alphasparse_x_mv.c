@@ -2,6 +2,8 @@
 #include "alphasparse/opt.h"
 #include "alphasparse/spapi.h"
 #include "alphasparse/kernel.h"
+#include "alphasparse/inspector.h"
+#include "alphasparse/graph.h"
 
 
 /*
@@ -1659,7 +1661,117 @@ static alphasparse_status_t (*diagmv_dia_diag[])(const ALPHA_Number alpha,
     diagmv_dia_u,
 };
 
-alphasparse_status_t ONAME(const alphasparse_operation_t operation,
+/*
+* 
+* Compute the dot product of a pattern-only sparse matrix with a vector
+*
+* details:
+* gemv_csr_pattern          General matrics defined in csr storage format, every stored entry is one
+* gemv_csr_pattern_trans    Transpose of general matrics defined in csr storage format, every stored entry is one
+* 
+* The implicit ones are real, so the conjugate transpose reuses the transpose kernel.
+*
+*/
+
+static alphasparse_status_t (*gemv_csr_pattern_operation[])(const ALPHA_Number alpha,
+                                                    const ALPHA_SPMAT_CSR *A,
+                                                    const ALPHA_Number *x,
+                                                    const ALPHA_Number beta,
+                                                    ALPHA_Number *y) = {
+    gemv_csr_pattern,
+    gemv_csr_pattern_trans,
+#ifdef COMPLEX
+    gemv_csr_pattern_trans,
+#endif
+};
+
+static alphasparse_status_t (*gemv_coo_pattern_operation[])(const ALPHA_Number alpha,
+                                                    const ALPHA_SPMAT_COO *A,
+                                                    const ALPHA_Number *x,
+                                                    const ALPHA_Number beta,
+                                                    ALPHA_Number *y) = {
+    gemv_coo_pattern,
+    gemv_coo_pattern_trans,
+#ifdef COMPLEX
+    gemv_coo_pattern_trans,
+#endif
+};
+
+static alphasparse_status_t (*gemv_csc_pattern_operation[])(const ALPHA_Number alpha,
+                                                    const ALPHA_SPMAT_CSC *A,
+                                                    const ALPHA_Number *x,
+                                                    const ALPHA_Number beta,
+                                                    ALPHA_Number *y) = {
+    gemv_csc_pattern,
+    gemv_csc_pattern_trans,
+#ifdef COMPLEX
+    gemv_csc_pattern_trans,
+#endif
+};
+
+/*
+*
+* Compute the dot product of a DIA+CSR matrix with a vector, the diagonals and the CSR
+* tail are read in one pass over each tile of y
+*
+*/
+
+static alphasparse_status_t (*gemv_dia_csr_operation[])(const ALPHA_Number alpha,
+                                                    const ALPHA_SPMAT_DIA_CSR *A,
+                                                    const ALPHA_Number *x,
+                                                    const ALPHA_Number beta,
+                                                    ALPHA_Number *y) = {
+    gemv_dia_csr,
+    gemv_dia_csr_trans,
+#ifdef COMPLEX
+    gemv_dia_csr_conj,
+#endif
+};
+
+#ifdef COMPLEX
+/*
+*
+* The same products for a matrix with split values (alphasparse_set_complex_layout_hint),
+* re and im hold the real and imaginary parts of A->values. A hermitian A equals A^H, so
+* its conjugate transpose runs the plain kernels.
+*
+*/
+
+static alphasparse_status_t (*gemv_csr_split_operation[])(const ALPHA_Number alpha,
+                                                    const ALPHA_SPMAT_CSR *A,
+                                                    const ALPHA_Float *re,
+                                                    const ALPHA_Float *im,
+                                                    const ALPHA_Number *x,
+                                                    const ALPHA_Number beta,
+                                                    ALPHA_Number *y) = {
+    gemv_csr_split,
+    gemv_csr_split_trans,
+    gemv_csr_split_conj,
+};
+
+static alphasparse_status_t (*hermv_csr_split_diag_fill_operation[])(const ALPHA_Number alpha,
+                                                              const ALPHA_SPMAT_CSR *A,
+                                                              const ALPHA_Float *re,
+                                                              const ALPHA_Float *im,
+                                                              const ALPHA_Number *x,
+                                                              const ALPHA_Number beta,
+                                                              ALPHA_Number *y) = {
+    hermv_csr_split_n_lo,
+    hermv_csr_split_u_lo,
+    hermv_csr_split_n_hi,
+    hermv_csr_split_u_hi,
+    hermv_csr_split_n_lo_trans,
+    hermv_csr_split_u_lo_trans,
+    hermv_csr_split_n_hi_trans,
+    hermv_csr_split_u_hi_trans,
+    hermv_csr_split_n_lo,
+    hermv_csr_split_u_lo,
+    hermv_csr_split_n_hi,
+    hermv_csr_split_u_hi,
+};
+#endif
+
+static alphasparse_status_t mv_dispatch(const alphasparse_operation_t operation,
                           const ALPHA_Number alpha,
                           const alphasparse_matrix_t A,
                           const struct alpha_matrix_descr descr, /* alphasparse_matrix_type_t + alphasparse_fill_mode_t + alphasparse_diag_type_t */
@@ -1682,6 +1794,37 @@ alphasparse_status_t ONAME(const alphasparse_operation_t operation,
         // check if it is a square matrix 
         check_return(!check_equal_row_col(A),ALPHA_SPARSE_STATUS_INVALID_VALUE);
 
+#ifdef COMPLEX
+    const alpha_split_values_t *split = alpha_matrix_split_values(A);
+    if (split != NULL)
+    {
+        if (A->format == ALPHA_SPARSE_FORMAT_CSR && descr.type == ALPHA_SPARSE_MATRIX_TYPE_GENERAL)
+        {
+            alpha_trace_kernel_path("_split");
+            return gemv_csr_split_operation[operation](alpha, A->mat, split->real, split->imag, x, beta, y);
+        }
+        if (A->format == ALPHA_SPARSE_FORMAT_CSR && descr.type == ALPHA_SPARSE_MATRIX_TYPE_HERMITIAN)
+        {
+            alpha_trace_kernel_path("_split");
+            return hermv_csr_split_diag_fill_operation[index3(operation, descr.mode, descr.diag, ALPHA_SPARSE_FILL_MODE_NUM, ALPHA_SPARSE_DIAG_TYPE_NUM)](alpha, A->mat, split->real, split->imag, x, beta, y);
+        }
+        if (A->format == ALPHA_SPARSE_FORMAT_BSR && descr.type == ALPHA_SPARSE_MATRIX_TYPE_GENERAL && operation == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE)
+        {
+            alpha_trace_kernel_path("_split");
+            return gemv_bsr_split(alpha, A->mat, split->real, split->imag, x, beta, y);
+        }
+    }
+#endif
+
+    if (A->format == ALPHA_SPARSE_FORMAT_CSR && descr.type == ALPHA_SPARSE_MATRIX_TYPE_GENERAL && operation == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        const alpha_csr_tiles_t *tiles = alpha_matrix_csr_tiles(A);
+        if (tiles != NULL)
+        {
+            alpha_trace_kernel_path("_tiled");
+            return gemv_csr_tiled(alpha, A->mat, tiles, x, beta, y);
+        }
+    }
 
     if (A->format == ALPHA_SPARSE_FORMAT_CSR)
     {
@@ -1875,8 +2018,57 @@ alphasparse_status_t ONAME(const alphasparse_operation_t operation,
             return ALPHA_SPARSE_STATUS_INVALID_VALUE;
         }
     }
+    else if (A->format == ALPHA_SPARSE_FORMAT_DIA_CSR)
+    {
+        // the hybrid format carries general kernels only
+        check_return(descr.type != ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+        return gemv_dia_csr_operation[operation](alpha, A->mat, x, beta, y);
+    }
+    else if (A->format == ALPHA_SPARSE_FORMAT_CSR_PATTERN)
+    {
+        // pattern-only matrices carry general kernels only
+        check_return(descr.type != ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+        return gemv_csr_pattern_operation[operation](alpha, A->mat, x, beta, y);
+    }
+    else if (A->format == ALPHA_SPARSE_FORMAT_COO_PATTERN)
+    {
+        // pattern-only matrices carry general kernels only
+        check_return(descr.type != ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+        return gemv_coo_pattern_operation[operation](alpha, A->mat, x, beta, y);
+    }
+    else if (A->format == ALPHA_SPARSE_FORMAT_CSC_PATTERN)
+    {
+        // pattern-only matrices carry general kernels only
+        check_return(descr.type != ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+        return gemv_csc_pattern_operation[operation](alpha, A->mat, x, beta, y);
+    }
     else
     {
         return ALPHA_SPARSE_STATUS_INVALID_VALUE;
     }
 }
+
+alphasparse_status_t ONAME(const alphasparse_operation_t operation,
+                          const ALPHA_Number alpha,
+                          const alphasparse_matrix_t A,
+                          const struct alpha_matrix_descr descr, /* alphasparse_matrix_type_t + alphasparse_fill_mode_t + alphasparse_diag_type_t */
+                          const ALPHA_Number *x,
+                          const ALPHA_Number beta,
+                          ALPHA_Number *y)
+{
+    if (alpha_graph_capturing())
+        return alpha_graph_record_mv(alpha_graph_capture, operation, alpha, A, descr, x, beta, y);
+    alpha_exec_scope_t scope;
+    alpha_exec_enter(&scope, alpha_matrix_exec_context(A));
+    alphasparse_status_t status;
+    if (!alpha_trace_on())
+        status = mv_dispatch(operation, alpha, A, descr, x, beta, y);
+    else
+    {
+        const double start = alpha_trace_begin();
+        status = mv_dispatch(operation, alpha, A, descr, x, beta, y);
+        alpha_trace_end(ALPHA_TRACE_MV, A, operation, descr, ALPHA_SPARSE_LAYOUT_ROW_MAJOR, 1, status, start);
+    }
+    alpha_exec_leave(&scope);
+    return status;
+}
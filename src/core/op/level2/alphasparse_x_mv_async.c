@@ -0,0 +1,49 @@
+/**
+ * @brief implement for alphasparse_?_mv_async interface
+ */
+
+#include "alphasparse/util.h"
+#include "alphasparse/spapi.h"
+#include "alphasparse/async.h"
+#include <stdlib.h>
+
+typedef struct
+{
+    alphasparse_operation_t operation;
+    ALPHA_Number alpha;
+    alphasparse_matrix_t A;
+    struct alpha_matrix_descr descr;
+    const ALPHA_Number *x;
+    ALPHA_Number beta;
+    ALPHA_Number *y;
+} mv_async_args_t;
+
+static alphasparse_status_t mv_async_run(void *p)
+{
+    const mv_async_args_t *args = p;
+    return alpha_async_mv(args->operation, args->alpha, args->A, args->descr, args->x, args->beta, args->y);
+}
+
+alphasparse_status_t ONAME(const alphasparse_operation_t operation,
+                          const ALPHA_Number alpha,
+                          const alphasparse_matrix_t A,
+                          const struct alpha_matrix_descr descr, /* alphasparse_matrix_type_t + alphasparse_fill_mode_t + alphasparse_diag_type_t */
+                          const ALPHA_Number *x,
+                          const ALPHA_Number beta,
+                          ALPHA_Number *y,
+                          const ALPHA_INT dep_num,
+                          const alphasparse_future_t *deps,
+                          alphasparse_future_t *future)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    mv_async_args_t *args = malloc(sizeof(mv_async_args_t));
+    check_null_return(args, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+    args->operation = operation;
+    args->alpha = alpha;
+    args->A = A;
+    args->descr = descr;
+    args->x = x;
+    args->beta = beta;
+    args->y = y;
+    return alpha_async_submit(mv_async_run, args, dep_num, deps, future);
+}
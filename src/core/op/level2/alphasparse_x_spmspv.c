@@ -0,0 +1,420 @@
+#include "alphasparse/spapi.h"
+#include "alphasparse/spvec.h"
+#include "alphasparse/inspector.h"
+#include "alphasparse/util.h"
+#include "alphasparse/opt.h"
+#include "alphasparse/util/spmspv.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*
+*
+* Multiply a sparse matrix by a sparse vector, y := alpha * op(A) * x
+*
+* push      For every entry x_j, the entries of column j of op(A) are added
+*           into their rows. The (row, value) pairs are first dealt into
+*           buckets of consecutive rows, then every bucket is merged on its
+*           own dense accumulator, so the cost follows the entries x selects.
+* pull      Every row of op(A) is walked and only entries whose column has
+*           an entry in x are added, the cost follows nnz(A).
+*
+* Both traversals run over the (row, col) -> position index of the inspector,
+* the other grouping is built from it on first use and kept with the matrix.
+* y is a new vector with the indexing of x, sorted, holding every row some
+* entry of x reached. It owns its arrays and is released with
+* alphasparse_destroy_spvec.
+*
+*/
+
+// rows of a push bucket, kept small enough for the accumulator to stay in cache
+#define SPMSPV_BUCKET_ROWS 4096
+
+typedef struct
+{
+    ALPHA_INT rows;
+    ALPHA_INT cols;
+    const ALPHA_Number *values;
+    bool row_major; // value_index groups by row
+} spmspv_matrix_t;
+
+static alphasparse_status_t spmspv_matrix(const alphasparse_matrix_t A, spmspv_matrix_t *mat)
+{
+    if (A->format == ALPHA_SPARSE_FORMAT_CSR)
+    {
+        const ALPHA_SPMAT_CSR *csr = (ALPHA_SPMAT_CSR *)A->mat;
+        mat->rows = csr->rows;
+        mat->cols = csr->cols;
+        mat->values = csr->values;
+        mat->row_major = true;
+    }
+    else if (A->format == ALPHA_SPARSE_FORMAT_CSC)
+    {
+        const ALPHA_SPMAT_CSC *csc = (ALPHA_SPMAT_CSC *)A->mat;
+        mat->rows = csc->rows;
+        mat->cols = csc->cols;
+        mat->values = csc->values;
+        mat->row_major = false;
+    }
+    else if (A->format == ALPHA_SPARSE_FORMAT_COO)
+    {
+        const ALPHA_SPMAT_COO *coo = (ALPHA_SPMAT_COO *)A->mat;
+        mat->rows = coo->rows;
+        mat->cols = coo->cols;
+        mat->values = coo->values;
+        mat->row_major = true;
+    }
+    else
+        return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+static inline void spmspv_entry(ALPHA_Number *acc, const ALPHA_Number a, const ALPHA_Number x, const bool conj)
+{
+#ifdef COMPLEX
+    if (conj)
+    {
+        alpha_madde_2c(*acc, a, x);
+    }
+    else
+    {
+        alpha_madde(*acc, a, x);
+    }
+#else
+    alpha_madde(*acc, a, x);
+#endif
+}
+
+static int spmspv_int_cmp(const void *a, const void *b)
+{
+    const ALPHA_INT l = *(const ALPHA_INT *)a, r = *(const ALPHA_INT *)b;
+    return l < r ? -1 : (l > r);
+}
+
+static alphasparse_status_t spmspv_output(const ALPHA_INT size, const ALPHA_INT nnz, const alphasparse_index_base_t indexing, alphasparse_spvec_t *y)
+{
+    struct alpha_spvec *vec = malloc(sizeof(struct alpha_spvec));
+    check_null_return(vec, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+    vec->datatype = ALPHA_SPARSE_DATATYPE;
+    vec->indexing = indexing;
+    vec->size = size;
+    vec->nnz = nnz;
+    vec->indx = malloc(sizeof(ALPHA_INT) * (nnz > 0 ? nnz : 1));
+    vec->values = malloc(sizeof(ALPHA_Number) * (nnz > 0 ? nnz : 1));
+    vec->owned = true;
+    if (vec->indx == NULL || vec->values == NULL)
+    {
+        free(vec->indx);
+        free(vec->values);
+        free(vec);
+        return ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    }
+    *y = vec;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+/*
+* push over cols, the grouping of op(A) by column. The entries of x are cut
+* into parts by the work they select, every part deals its pairs into the
+* buckets in its own slot, and a bucket is then merged by one thread.
+*/
+static alphasparse_status_t spmspv_push(const ALPHA_Number alpha,
+                                        const alpha_value_index_t *cols,
+                                        const ALPHA_Number *values,
+                                        const bool conj,
+                                        const ALPHA_INT rows,
+                                        const struct alpha_spvec *x,
+                                        alphasparse_spvec_t *y)
+{
+    const ALPHA_INT base = x->indexing == ALPHA_SPARSE_INDEX_BASE_ONE ? 1 : 0;
+    const ALPHA_Number *xv = x->values;
+    const ALPHA_INT thread_num = alpha_get_thread_num();
+    const ALPHA_INT bucket_rows = alpha_min(SPMSPV_BUCKET_ROWS, alpha_max(rows, 1));
+
+    alpha_spmspv_push_t plan;
+    check_error_return(alpha_spmspv_push_plan(cols->ptr, cols->idx, x->indx, x->nnz, base, rows, bucket_rows, thread_num, &plan));
+    const ALPHA_INT bucket_num = plan.bucket_num;
+    const ALPHA_INT64 total = plan.total;
+    const ALPHA_INT *first = plan.first;
+    const ALPHA_INT64 *slot = plan.slot;
+    ALPHA_INT *pair_row = malloc(sizeof(ALPHA_INT) * (total > 0 ? total : 1));
+    ALPHA_Number *pair_val = malloc(sizeof(ALPHA_Number) * (total > 0 ? total : 1));
+    ALPHA_Number *spa = malloc(sizeof(ALPHA_Number) * (size_t)thread_num * bucket_rows);
+    alphasparse_status_t status = ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    if (pair_row == NULL || pair_val == NULL || spa == NULL)
+        goto out;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num)
+#endif
+    {
+        const ALPHA_INT tid = alpha_get_thread_id();
+#ifdef _OPENMP
+        const ALPHA_INT team = omp_get_num_threads();
+#else
+        const ALPHA_INT team = 1;
+#endif
+        for (ALPHA_INT t = tid; t < thread_num; t += team)
+        {
+            ALPHA_INT64 *fill = plan.fill + (size_t)t * bucket_num;
+            for (ALPHA_INT k = first[t]; k < first[t + 1]; k++)
+            {
+                const ALPHA_INT j = x->indx[k] - base;
+                const ALPHA_Number xj = xv[k];
+                for (ALPHA_OFFSET e = cols->ptr[j]; e < cols->ptr[j + 1]; e++)
+                {
+                    const ALPHA_INT64 dst = fill[cols->idx[e] / bucket_rows]++;
+                    pair_row[dst] = cols->idx[e];
+                    alpha_setzero(pair_val[dst]);
+                    spmspv_entry(&pair_val[dst], values[cols->pos[e]], xj, conj);
+                }
+            }
+        }
+#ifdef _OPENMP
+#pragma omp barrier
+#endif
+
+        // merge every bucket on a dense accumulator, the merged pairs overwrite the front of the bucket
+        ALPHA_Number *acc = spa + (size_t)tid * bucket_rows;
+        char *mark = plan.mark + (size_t)tid * bucket_rows;
+        ALPHA_INT *touched = plan.touched + (size_t)tid * bucket_rows;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for (ALPHA_INT b = 0; b < bucket_num; b++)
+        {
+            const ALPHA_INT64 lo = slot[(ALPHA_INT64)b * thread_num], hi = slot[(ALPHA_INT64)(b + 1) * thread_num];
+            const ALPHA_INT row0 = b * bucket_rows;
+            const ALPHA_INT span = alpha_min(bucket_rows, rows - row0);
+            ALPHA_INT cnt = 0;
+            for (ALPHA_INT64 p = lo; p < hi; p++)
+            {
+                const ALPHA_INT r = pair_row[p] - row0;
+                if (!mark[r])
+                {
+                    mark[r] = 1;
+                    touched[cnt++] = r;
+                    acc[r] = pair_val[p];
+                }
+                else
+                    alpha_adde(acc[r], pair_val[p]);
+            }
+            // few rows are sorted, many are collected by a sweep over the bucket
+            if ((ALPHA_INT64)cnt * 8 < span)
+                qsort(touched, cnt, sizeof(ALPHA_INT), spmspv_int_cmp);
+            else
+            {
+                cnt = 0;
+                for (ALPHA_INT r = 0; r < span; r++)
+                    if (mark[r])
+                        touched[cnt++] = r;
+            }
+            for (ALPHA_INT i = 0; i < cnt; i++)
+            {
+                const ALPHA_INT r = touched[i];
+                pair_row[lo + i] = r + row0;
+                alpha_mul(pair_val[lo + i], alpha, acc[r]);
+                mark[r] = 0;
+            }
+            plan.bucket_out[b + 1] = cnt;
+        }
+    }
+
+    const ALPHA_INT64 *bucket_out = plan.bucket_out;
+    status = spmspv_output(rows, (ALPHA_INT)alpha_spmspv_push_out(&plan), x->indexing, y);
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS)
+    {
+        ALPHA_INT *yi = (*y)->indx;
+        ALPHA_Number *yv = (*y)->values;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+        for (ALPHA_INT b = 0; b < bucket_num; b++)
+        {
+            const ALPHA_INT64 src = slot[(ALPHA_INT64)b * thread_num];
+            for (ALPHA_INT64 i = bucket_out[b]; i < bucket_out[b + 1]; i++)
+            {
+                yi[i] = pair_row[src + i - bucket_out[b]] + base;
+                yv[i] = pair_val[src + i - bucket_out[b]];
+            }
+        }
+    }
+out:
+    free(pair_row);
+    free(pair_val);
+    free(spa);
+    alpha_spmspv_push_destroy(&plan);
+    return status;
+}
+
+/*
+* pull over lines, the grouping of op(A) by row. x is spread into a dense
+* array with a mask, the rows are cut into parts by their entries and every
+* part compacts the rows it reached into its range of a scratch array.
+*/
+static alphasparse_status_t spmspv_pull(const ALPHA_Number alpha,
+                                        const alpha_value_index_t *lines,
+                                        const ALPHA_Number *values,
+                                        const bool conj,
+                                        const ALPHA_INT cols,
+                                        const struct alpha_spvec *x,
+                                        alphasparse_spvec_t *y)
+{
+    const ALPHA_INT base = x->indexing == ALPHA_SPARSE_INDEX_BASE_ONE ? 1 : 0;
+    const ALPHA_INT rows = lines->n;
+    const ALPHA_INT thread_num = alpha_get_thread_num();
+    alpha_spmspv_pull_t plan;
+    check_error_return(alpha_spmspv_pull_plan(lines->ptr, rows, thread_num, &plan));
+    const ALPHA_INT *partition = plan.partition;
+    ALPHA_INT *found = plan.found;
+    ALPHA_Number *dense = malloc(sizeof(ALPHA_Number) * (cols > 0 ? cols : 1));
+    char *mask = calloc(cols > 0 ? cols : 1, sizeof(char));
+    ALPHA_INT *tmp_row = malloc(sizeof(ALPHA_INT) * (rows > 0 ? rows : 1));
+    ALPHA_Number *tmp_val = malloc(sizeof(ALPHA_Number) * (rows > 0 ? rows : 1));
+    alphasparse_status_t status = ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    if (dense == NULL || mask == NULL || tmp_row == NULL || tmp_val == NULL)
+        goto out;
+    // repeated entries of x add up, as they would under push
+    for (ALPHA_INT k = 0; k < x->nnz; k++)
+    {
+        const ALPHA_INT j = x->indx[k] - base;
+        if (!mask[j])
+        {
+            mask[j] = 1;
+            dense[j] = ((const ALPHA_Number *)x->values)[k];
+        }
+        else
+            alpha_adde(dense[j], ((const ALPHA_Number *)x->values)[k]);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num)
+#endif
+    {
+        const ALPHA_INT tid = alpha_get_thread_id();
+#ifdef _OPENMP
+        const ALPHA_INT team = omp_get_num_threads();
+#else
+        const ALPHA_INT team = 1;
+#endif
+        for (ALPHA_INT t = tid; t < thread_num; t += team)
+        {
+            ALPHA_INT cnt = partition[t];
+            for (ALPHA_INT r = partition[t]; r < partition[t + 1]; r++)
+            {
+                ALPHA_Number acc;
+                alpha_setzero(acc);
+                bool hit = false;
+                for (ALPHA_OFFSET e = lines->ptr[r]; e < lines->ptr[r + 1]; e++)
+                {
+                    const ALPHA_INT j = lines->idx[e];
+                    if (!mask[j])
+                        continue;
+                    hit = true;
+                    spmspv_entry(&acc, values[lines->pos[e]], dense[j], conj);
+                }
+                if (hit)
+                {
+                    tmp_row[cnt] = r;
+                    alpha_mul(tmp_val[cnt], alpha, acc);
+                    cnt++;
+                }
+            }
+            found[t + 1] = cnt - partition[t];
+        }
+    }
+
+    status = spmspv_output(rows, alpha_spmspv_pull_found(&plan), x->indexing, y);
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS)
+    {
+        ALPHA_INT *yi = (*y)->indx;
+        ALPHA_Number *yv = (*y)->values;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+        for (ALPHA_INT t = 0; t < thread_num; t++)
+        {
+            for (ALPHA_INT i = found[t]; i < found[t + 1]; i++)
+            {
+                yi[i] = tmp_row[partition[t] + i - found[t]] + base;
+                yv[i] = tmp_val[partition[t] + i - found[t]];
+            }
+        }
+    }
+out:
+    free(dense);
+    free(mask);
+    free(tmp_row);
+    free(tmp_val);
+    alpha_spmspv_pull_destroy(&plan);
+    return status;
+}
+
+alphasparse_status_t ONAME(const alphasparse_operation_t operation,
+                           const ALPHA_Number alpha,
+                           const alphasparse_matrix_t A,
+                           const alphasparse_spvec_t x,
+                           const alphasparse_spmspv_alg_t alg,
+                           alphasparse_spvec_t *y)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(x, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(y, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(A->datatype != ALPHA_SPARSE_DATATYPE || x->datatype != ALPHA_SPARSE_DATATYPE, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(alg != ALPHA_SPARSE_SPMSPV_AUTO && alg != ALPHA_SPARSE_SPMSPV_PUSH && alg != ALPHA_SPARSE_SPMSPV_PULL, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+#ifdef COMPLEX
+    check_return(operation != ALPHA_SPARSE_OPERATION_NON_TRANSPOSE && operation != ALPHA_SPARSE_OPERATION_TRANSPOSE &&
+                     operation != ALPHA_SPARSE_OPERATION_CONJUGATE_TRANSPOSE,
+                 ALPHA_SPARSE_STATUS_INVALID_VALUE);
+#else
+    check_return(operation != ALPHA_SPARSE_OPERATION_NON_TRANSPOSE && operation != ALPHA_SPARSE_OPERATION_TRANSPOSE,
+                 ALPHA_SPARSE_STATUS_INVALID_VALUE);
+#endif
+
+    spmspv_matrix_t mat;
+    check_error_return(spmspv_matrix(A, &mat));
+    const bool trans = operation != ALPHA_SPARSE_OPERATION_NON_TRANSPOSE;
+    const bool conj = operation == ALPHA_SPARSE_OPERATION_CONJUGATE_TRANSPOSE;
+    const ALPHA_INT op_rows = trans ? mat.cols : mat.rows;
+    const ALPHA_INT op_cols = trans ? mat.rows : mat.cols;
+    check_return(x->size != op_cols, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    const ALPHA_INT base = x->indexing == ALPHA_SPARSE_INDEX_BASE_ONE ? 1 : 0;
+    for (ALPHA_INT k = 0; k < x->nnz; k++)
+        check_return(x->indx[k] - base < 0 || x->indx[k] - base >= op_cols, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    // columns of op(A) are rows of A under a transpose
+    const bool push_by_row = trans;
+    bool push = alg == ALPHA_SPARSE_SPMSPV_PUSH;
+    if (alg == ALPHA_SPARSE_SPMSPV_AUTO)
+    {
+        // the grouping by the major index is needed either way and gives nnz(A)
+        alpha_value_index_t *index;
+        check_error_return(alphasparse_inspector_lines(A, mat.row_major, &index));
+        const ALPHA_INT64 nnz = index->nnz;
+        const alpha_value_index_t *cols = alphasparse_inspector_lines_built(A, push_by_row);
+        ALPHA_INT64 work = 0;
+        if (cols != NULL)
+        {
+            for (ALPHA_INT k = 0; k < x->nnz; k++)
+            {
+                const ALPHA_INT j = x->indx[k] - base;
+                work += cols->ptr[j + 1] - cols->ptr[j];
+            }
+        }
+        else if (op_cols > 0)
+            work = (ALPHA_INT64)x->nnz * nnz / op_cols;
+        push = work * ALPHA_SPMSPV_PUSH_FACTOR < nnz;
+    }
+
+    alpha_value_index_t *lines;
+    if (push)
+    {
+        check_error_return(alphasparse_inspector_lines(A, push_by_row, &lines));
+        return spmspv_push(alpha, lines, mat.values, conj, op_rows, x, y);
+    }
+    check_error_return(alphasparse_inspector_lines(A, !push_by_row, &lines));
+    return spmspv_pull(alpha, lines, mat.values, conj, op_cols, x, y);
+}
@@ -2,6 +2,7 @@
 #include "alphasparse/opt.h"
 #include "alphasparse/spapi.h"
 #include "alphasparse/kernel.h"
+#include "alphasparse/inspector.h"
 #include "alphasparse/spdef.h"
 
 /*
@@ -60,6 +61,35 @@ static alphasparse_status_t (*trsv_csr_diag_fill_operation[])(const ALPHA_Number
 #endif
 };
 
+#ifdef COMPLEX
+/*
+*
+* The same solves for a matrix with split values (alphasparse_set_complex_layout_hint),
+* re and im hold the real and imaginary parts of A->values
+*
+*/
+
+static alphasparse_status_t (*trsv_csr_split_diag_fill_operation[])(const ALPHA_Number alpha,
+                                                              const ALPHA_SPMAT_CSR *A,
+                                                              const ALPHA_Float *re,
+                                                              const ALPHA_Float *im,
+                                                              const ALPHA_Number *x,
+                                                              ALPHA_Number *y) = {
+    trsv_csr_split_n_lo,
+    trsv_csr_split_u_lo,
+    trsv_csr_split_n_hi,
+    trsv_csr_split_u_hi,
+    trsv_csr_split_n_lo_trans,
+    trsv_csr_split_u_lo_trans,
+    trsv_csr_split_n_hi_trans,
+    trsv_csr_split_u_hi_trans,
+    trsv_csr_split_n_lo_conj,
+    trsv_csr_split_u_lo_conj,
+    trsv_csr_split_n_hi_conj,
+    trsv_csr_split_u_hi_conj,
+};
+#endif
+
 /*
 * 
 * Solve a set of equations in which a sparse matrix and a dense vector are multiplied
@@ -569,7 +599,7 @@ static alphasparse_status_t (*diagsv_dia_diag[])(const ALPHA_Number alpha,
     diagsv_dia_u,
 };
 
-alphasparse_status_t ONAME(const alphasparse_operation_t operation, const ALPHA_Number alpha, const alphasparse_matrix_t A, const struct alpha_matrix_descr descr, /* alphasparse_matrix_type_t + alphasparse_fill_mode_t + alphasparse_diag_type_t */
+static alphasparse_status_t trsv_dispatch(const alphasparse_operation_t operation, const ALPHA_Number alpha, const alphasparse_matrix_t A, const struct alpha_matrix_descr descr, /* alphasparse_matrix_type_t + alphasparse_fill_mode_t + alphasparse_diag_type_t */
                                       const ALPHA_Number *x, ALPHA_Number *y)
 {
     check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
@@ -585,6 +615,15 @@ alphasparse_status_t ONAME(const alphasparse_operation_t operation, const ALPHA_
     // Check if it is a square matrix 
     check_return(!check_equal_row_col(A),ALPHA_SPARSE_STATUS_INVALID_VALUE);
 
+#ifdef COMPLEX
+    const alpha_split_values_t *split = alpha_matrix_split_values(A);
+    if (split != NULL && A->format == ALPHA_SPARSE_FORMAT_CSR && descr.type == ALPHA_SPARSE_MATRIX_TYPE_TRIANGULAR)
+    {
+        alpha_trace_kernel_path("_split");
+        return trsv_csr_split_diag_fill_operation[index3(operation, descr.mode, descr.diag, ALPHA_SPARSE_FILL_MODE_NUM, ALPHA_SPARSE_DIAG_TYPE_NUM)](alpha, A->mat, split->real, split->imag, x, y);
+    }
+#endif
+
     if(A->format == ALPHA_SPARSE_FORMAT_CSR)
     {
         if (descr.type == ALPHA_SPARSE_MATRIX_TYPE_TRIANGULAR)
@@ -686,3 +725,21 @@ alphasparse_status_t ONAME(const alphasparse_operation_t operation, const ALPHA_
         return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
     }  
 }
+
+alphasparse_status_t ONAME(const alphasparse_operation_t operation, const ALPHA_Number alpha, const alphasparse_matrix_t A, const struct alpha_matrix_descr descr, /* alphasparse_matrix_type_t + alphasparse_fill_mode_t + alphasparse_diag_type_t */
+                                      const ALPHA_Number *x, ALPHA_Number *y)
+{
+    alpha_exec_scope_t scope;
+    alpha_exec_enter(&scope, alpha_matrix_exec_context(A));
+    alphasparse_status_t status;
+    if (!alpha_trace_on())
+        status = trsv_dispatch(operation, alpha, A, descr, x, y);
+    else
+    {
+        const double start = alpha_trace_begin();
+        status = trsv_dispatch(operation, alpha, A, descr, x, y);
+        alpha_trace_end(ALPHA_TRACE_SV, A, operation, descr, ALPHA_SPARSE_LAYOUT_ROW_MAJOR, 1, status, start);
+    }
+    alpha_exec_leave(&scope);
+    return status;
+}
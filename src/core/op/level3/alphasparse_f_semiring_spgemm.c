@@ -0,0 +1,215 @@
+#include "alphasparse/spapi.h"
+#include "alphasparse/semiring.h"
+#include "alphasparse/util.h"
+#include "alphasparse/opt.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+*
+* C := A add.multiply B over a semiring for CSR A and B, C is a new CSR
+* matrix with sorted columns and an entry wherever some a_ik b_kj pair meets
+*
+* Both passes run the rows through the work-stealing scheduler balanced by
+* their products. A thread keeps a dense accumulator over the columns of B
+* with a stamp per column, so no row clears it, and an entry of C already
+* absorbed by add skips its remaining products.
+*
+*/
+
+typedef struct
+{
+    const ALPHA_SPMAT_CSR *A;
+    const ALPHA_SPMAT_CSR *B;
+    ALPHA_SPMAT_CSR *C;
+    ALPHA_INT *stamp;  // n per thread, row + 1 that last touched the column
+    ALPHA_INT *touched; // n per thread
+    ALPHA_Number *acc; // n per thread
+} semiring_spgemm_t;
+
+static int semiring_spgemm_cmp(const void *a, const void *b)
+{
+    const ALPHA_INT l = *(const ALPHA_INT *)a, r = *(const ALPHA_INT *)b;
+    return l < r ? -1 : (l > r);
+}
+
+// number of distinct columns of each C row, into rows_end
+static void semiring_spgemm_count(void *arg, const ALPHA_INT tid, const ALPHA_INT begin, const ALPHA_INT end)
+{
+    const semiring_spgemm_t *p = arg;
+    const ALPHA_SPMAT_CSR *A = p->A, *B = p->B;
+    const ALPHA_INT n = B->cols;
+    ALPHA_INT *stamp = p->stamp + (size_t)tid * n;
+    for (ALPHA_INT ar = begin; ar < end; ar++)
+    {
+        ALPHA_OFFSET cnt = 0;
+        for (ALPHA_OFFSET ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
+        {
+            const ALPHA_INT br = A->col_indx[ai];
+            for (ALPHA_OFFSET bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
+            {
+                const ALPHA_INT c = B->col_indx[bi];
+                if (stamp[c] != ar + 1)
+                {
+                    stamp[c] = ar + 1;
+                    cnt++;
+                }
+            }
+        }
+        p->C->rows_end[ar] = cnt;
+    }
+}
+
+ALPHA_SEMIRING_INLINE void semiring_spgemm_body(const semiring_spgemm_t *p,
+                                                const ALPHA_INT tid,
+                                                const ALPHA_INT begin,
+                                                const ALPHA_INT end,
+                                                const alpha_semiring_op_t add,
+                                                const alpha_semiring_op_t mul,
+                                                const alpha_semiring_absorbed_t absorbed)
+{
+    const ALPHA_SPMAT_CSR *A = p->A, *B = p->B;
+    ALPHA_SPMAT_CSR *C = p->C;
+    const ALPHA_INT n = B->cols;
+    ALPHA_INT *stamp = p->stamp + (size_t)tid * n;
+    ALPHA_INT *touched = p->touched + (size_t)tid * n;
+    ALPHA_Number *acc = p->acc + (size_t)tid * n;
+    for (ALPHA_INT ar = begin; ar < end; ar++)
+    {
+        // the count pass left stamps of rows up to ar + 1, the compute pass marks with negatives
+        const ALPHA_INT mark = -(ar + 1);
+        ALPHA_INT cnt = 0;
+        for (ALPHA_OFFSET ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
+        {
+            const ALPHA_INT br = A->col_indx[ai];
+            const ALPHA_Number av = A->values[ai];
+            for (ALPHA_OFFSET bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
+            {
+                const ALPHA_INT c = B->col_indx[bi];
+                if (stamp[c] != mark)
+                {
+                    stamp[c] = mark;
+                    touched[cnt++] = c;
+                    acc[c] = mul(av, B->values[bi]);
+                }
+                else if (!absorbed(acc[c]))
+                    acc[c] = add(acc[c], mul(av, B->values[bi]));
+            }
+        }
+        // few columns are sorted, many are collected by a sweep over the row
+        if ((ALPHA_INT64)cnt * 8 < n)
+            qsort(touched, cnt, sizeof(ALPHA_INT), semiring_spgemm_cmp);
+        else
+        {
+            cnt = 0;
+            for (ALPHA_INT c = 0; c < n; c++)
+                if (stamp[c] == mark)
+                    touched[cnt++] = c;
+        }
+        ALPHA_OFFSET dst = C->rows_start[ar];
+        for (ALPHA_INT i = 0; i < cnt; i++, dst++)
+        {
+            C->col_indx[dst] = touched[i];
+            C->values[dst] = acc[touched[i]];
+        }
+    }
+}
+
+#define SEMIRING_SPGEMM(NAME, ADD, MUL, ZERO, ABSORBED)                                                 \
+    static void semiring_spgemm_##NAME(void *arg, const ALPHA_INT tid, const ALPHA_INT begin, const ALPHA_INT end) \
+    {                                                                                                   \
+        semiring_spgemm_body(arg, tid, begin, end, ADD, MUL, ABSORBED);                                 \
+    }
+ALPHA_SEMIRING_LIST(SEMIRING_SPGEMM)
+#undef SEMIRING_SPGEMM
+
+alphasparse_status_t ONAME(const alphasparse_semiring_t semiring,
+                           const alphasparse_matrix_t A,
+                           const alphasparse_matrix_t B,
+                           alphasparse_matrix_t *C)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(B, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(B->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(C, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(A->datatype != ALPHA_SPARSE_DATATYPE || B->datatype != ALPHA_SPARSE_DATATYPE, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(A->format != ALPHA_SPARSE_FORMAT_CSR || B->format != ALPHA_SPARSE_FORMAT_CSR, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+    check_return(semiring < ALPHA_SPARSE_SEMIRING_PLUS_TIMES || semiring > ALPHA_SPARSE_SEMIRING_PLUS_MIN, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    const ALPHA_SPMAT_CSR *matA = A->mat, *matB = B->mat;
+    check_return(matA->cols != matB->rows, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    const ALPHA_INT m = matA->rows, n = matB->cols;
+    const ALPHA_INT thread_num = alpha_get_thread_num();
+    ALPHA_SPMAT_CSR *mat = alpha_malloc(sizeof(ALPHA_SPMAT_CSR));
+    memset(mat, 0, sizeof(ALPHA_SPMAT_CSR));
+    mat->rows = m;
+    mat->cols = n;
+    mat->ordered = true;
+    ALPHA_OFFSET *row_offset = alpha_memalign(sizeof(ALPHA_OFFSET) * (m + 1), DEFAULT_ALIGNMENT);
+    memset(row_offset, 0, sizeof(ALPHA_OFFSET) * (m + 1));
+    mat->rows_start = row_offset;
+    mat->rows_end = row_offset + 1;
+
+    semiring_spgemm_t task = {matA, matB, mat, NULL, NULL, NULL};
+    ALPHA_INT64 *flop = malloc(sizeof(ALPHA_INT64) * (m > 0 ? m : 1));
+    task.stamp = malloc(sizeof(ALPHA_INT) * ((size_t)thread_num * n + 1));
+    task.touched = malloc(sizeof(ALPHA_INT) * ((size_t)thread_num * n + 1));
+    task.acc = malloc(sizeof(ALPHA_Number) * ((size_t)thread_num * n + 1));
+    if (flop == NULL || task.stamp == NULL || task.touched == NULL || task.acc == NULL)
+    {
+        free(flop);
+        free(task.stamp);
+        free(task.touched);
+        free(task.acc);
+        alpha_free(row_offset);
+        alpha_free(mat);
+        return ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    }
+    memset(task.stamp, 0, sizeof(ALPHA_INT) * ((size_t)thread_num * n + 1));
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+    for (ALPHA_INT ar = 0; ar < m; ar++)
+    {
+        ALPHA_INT64 row_flop = 1;
+        for (ALPHA_OFFSET ai = matA->rows_start[ar]; ai < matA->rows_end[ar]; ai++)
+        {
+            const ALPHA_INT br = matA->col_indx[ai];
+            row_flop += matB->rows_end[br] - matB->rows_start[br];
+        }
+        flop[ar] = row_flop;
+    }
+    for (ALPHA_INT i = 1; i < m; i++)
+        flop[i] += flop[i - 1];
+
+    alpha_steal_for(thread_num, m, flop, semiring_spgemm_count, &task);
+    for (ALPHA_INT i = 1; i < m; i++)
+        mat->rows_end[i] += mat->rows_end[i - 1];
+    const ALPHA_OFFSET nnz = m > 0 ? mat->rows_end[m - 1] : 0;
+    mat->col_indx = alpha_memalign(sizeof(ALPHA_INT) * (nnz > 0 ? nnz : 1), DEFAULT_ALIGNMENT);
+    mat->values = alpha_memalign(sizeof(ALPHA_Number) * (nnz > 0 ? nnz : 1), DEFAULT_ALIGNMENT);
+
+    switch (semiring)
+    {
+#define SEMIRING_CASE(NAME, ADD, MUL, ZERO, ABSORBED)                                  \
+    case ALPHA_SPARSE_SEMIRING_##NAME:                                                 \
+        alpha_steal_for(thread_num, m, flop, semiring_spgemm_##NAME, &task);           \
+        break;
+        ALPHA_SEMIRING_LIST(SEMIRING_CASE)
+#undef SEMIRING_CASE
+    }
+    free(flop);
+    free(task.stamp);
+    free(task.touched);
+    free(task.acc);
+
+    alphasparse_matrix *CC = alpha_malloc(sizeof(alphasparse_matrix));
+    CC->mat = mat;
+    CC->format = ALPHA_SPARSE_FORMAT_CSR;
+    CC->datatype = ALPHA_SPARSE_DATATYPE;
+    CC->inspector = NULL;
+    CC->dcu_info = NULL;
+    *C = CC;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -2,6 +2,7 @@
 #include "alphasparse/opt.h"
 #include "alphasparse/spapi.h"
 #include "alphasparse/kernel.h"
+#include "alphasparse/inspector.h"
 #include "alphasparse/spdef.h"
 
 /*
@@ -2302,7 +2303,119 @@ static alphasparse_status_t (*diagmm_dia_diag_layout[])(const ALPHA_Number alpha
     diagmm_dia_u_col,
 };
 
-alphasparse_status_t ONAME(const alphasparse_operation_t operation,
+/*
+* 
+* Compute the dot product of a pattern-only sparse matrix with a matrix
+*
+* details:
+* gemm_csr_pattern_row          General row major matrics defined in csr storage format, every stored entry is one
+* gemm_csr_pattern_col          General column major matrics defined in csr storage format, every stored entry is one
+* 
+* The implicit ones are real, so the conjugate transpose reuses the transpose kernels.
+*
+*/
+
+static alphasparse_status_t (*gemm_csr_pattern_layout_operation[])(const ALPHA_Number alpha,
+                                                                 const ALPHA_SPMAT_CSR *mat,
+                                                                 const ALPHA_Number *x,
+                                                                 const ALPHA_INT columns,
+                                                                 const ALPHA_INT ldx,
+                                                                 const ALPHA_Number beta,
+                                                                 ALPHA_Number *y,
+                                                                 const ALPHA_INT ldy) = {
+    gemm_csr_pattern_row,
+    gemm_csr_pattern_col,
+    gemm_csr_pattern_row_trans,
+    gemm_csr_pattern_col_trans,
+#ifdef COMPLEX
+    gemm_csr_pattern_row_trans,
+    gemm_csr_pattern_col_trans,
+#endif
+};
+
+static alphasparse_status_t (*gemm_coo_pattern_layout_operation[])(const ALPHA_Number alpha,
+                                                                 const ALPHA_SPMAT_COO *mat,
+                                                                 const ALPHA_Number *x,
+                                                                 const ALPHA_INT columns,
+                                                                 const ALPHA_INT ldx,
+                                                                 const ALPHA_Number beta,
+                                                                 ALPHA_Number *y,
+                                                                 const ALPHA_INT ldy) = {
+    gemm_coo_pattern_row,
+    gemm_coo_pattern_col,
+    gemm_coo_pattern_row_trans,
+    gemm_coo_pattern_col_trans,
+#ifdef COMPLEX
+    gemm_coo_pattern_row_trans,
+    gemm_coo_pattern_col_trans,
+#endif
+};
+
+static alphasparse_status_t (*gemm_csc_pattern_layout_operation[])(const ALPHA_Number alpha,
+                                                                 const ALPHA_SPMAT_CSC *mat,
+                                                                 const ALPHA_Number *x,
+                                                                 const ALPHA_INT columns,
+                                                                 const ALPHA_INT ldx,
+                                                                 const ALPHA_Number beta,
+                                                                 ALPHA_Number *y,
+                                                                 const ALPHA_INT ldy) = {
+    gemm_csc_pattern_row,
+    gemm_csc_pattern_col,
+    gemm_csc_pattern_row_trans,
+    gemm_csc_pattern_col_trans,
+#ifdef COMPLEX
+    gemm_csc_pattern_row_trans,
+    gemm_csc_pattern_col_trans,
+#endif
+};
+
+static alphasparse_status_t (*gemm_dia_csr_layout_operation[])(const ALPHA_Number alpha,
+                                                             const ALPHA_SPMAT_DIA_CSR *mat,
+                                                             const ALPHA_Number *x,
+                                                             const ALPHA_INT columns,
+                                                             const ALPHA_INT ldx,
+                                                             const ALPHA_Number beta,
+                                                             ALPHA_Number *y,
+                                                             const ALPHA_INT ldy) = {
+    gemm_dia_csr_row,
+    gemm_dia_csr_col,
+    NULL,
+    NULL,
+#ifdef COMPLEX
+    NULL,
+    NULL,
+#endif
+};
+
+#ifdef COMPLEX
+/*
+*
+* The same products for a matrix with split values (alphasparse_set_complex_layout_hint),
+* re and im hold the real and imaginary parts of A->values. Column major x only has the
+* non-transposed kernel, the rest run on the interleaved values.
+*
+*/
+
+static alphasparse_status_t (*gemm_csr_split_layout_operation[])(const ALPHA_Number alpha,
+                                                               const ALPHA_SPMAT_CSR *mat,
+                                                               const ALPHA_Float *re,
+                                                               const ALPHA_Float *im,
+                                                               const ALPHA_Number *x,
+                                                               const ALPHA_INT columns,
+                                                               const ALPHA_INT ldx,
+                                                               const ALPHA_Number beta,
+                                                               ALPHA_Number *y,
+                                                               const ALPHA_INT ldy) = {
+    gemm_csr_split_row,
+    gemm_csr_split_col,
+    gemm_csr_split_row_trans,
+    NULL,
+    gemm_csr_split_row_conj,
+    NULL,
+};
+#endif
+
+static alphasparse_status_t mm_dispatch(const alphasparse_operation_t operation,
                           const ALPHA_Number alpha,
                           const alphasparse_matrix_t A,
                           const struct alpha_matrix_descr descr, /* alphasparse_matrix_type_t + alphasparse_fill_mode_t + alphasparse_diag_type_t */
@@ -2330,6 +2443,16 @@ alphasparse_status_t ONAME(const alphasparse_operation_t operation,
         // check if it is a square matrix 
         check_return(!check_equal_row_col(A),ALPHA_SPARSE_STATUS_INVALID_VALUE);
 
+#ifdef COMPLEX
+    const alpha_split_values_t *split = alpha_matrix_split_values(A);
+    if (split != NULL && A->format == ALPHA_SPARSE_FORMAT_CSR && descr.type == ALPHA_SPARSE_MATRIX_TYPE_GENERAL &&
+        gemm_csr_split_layout_operation[index2(operation, layout, ALPHA_SPARSE_LAYOUT_NUM)] != NULL)
+    {
+        alpha_trace_kernel_path("_split");
+        return gemm_csr_split_layout_operation[index2(operation, layout, ALPHA_SPARSE_LAYOUT_NUM)](alpha, A->mat, split->real, split->imag, x, columns, ldx, beta, y, ldy);
+    }
+#endif
+
     if (A->format == ALPHA_SPARSE_FORMAT_CSR)
     {
         if (descr.type == ALPHA_SPARSE_MATRIX_TYPE_GENERAL)
@@ -2521,8 +2644,60 @@ alphasparse_status_t ONAME(const alphasparse_operation_t operation,
             return ALPHA_SPARSE_STATUS_INVALID_VALUE;
         }
     }
+    else if (A->format == ALPHA_SPARSE_FORMAT_DIA_CSR)
+    {
+        // the hybrid format carries general kernels only
+        check_return(descr.type != ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+        check_null_return(gemm_dia_csr_layout_operation[index2(operation, layout, ALPHA_SPARSE_LAYOUT_NUM)], ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+        return gemm_dia_csr_layout_operation[index2(operation, layout, ALPHA_SPARSE_LAYOUT_NUM)](alpha, A->mat, x, columns, ldx, beta, y, ldy);
+    }
+    else if (A->format == ALPHA_SPARSE_FORMAT_CSR_PATTERN)
+    {
+        // pattern-only matrices carry general kernels only
+        check_return(descr.type != ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+        return gemm_csr_pattern_layout_operation[index2(operation, layout, ALPHA_SPARSE_LAYOUT_NUM)](alpha, A->mat, x, columns, ldx, beta, y, ldy);
+    }
+    else if (A->format == ALPHA_SPARSE_FORMAT_COO_PATTERN)
+    {
+        // pattern-only matrices carry general kernels only
+        check_return(descr.type != ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+        return gemm_coo_pattern_layout_operation[index2(operation, layout, ALPHA_SPARSE_LAYOUT_NUM)](alpha, A->mat, x, columns, ldx, beta, y, ldy);
+    }
+    else if (A->format == ALPHA_SPARSE_FORMAT_CSC_PATTERN)
+    {
+        // pattern-only matrices carry general kernels only
+        check_return(descr.type != ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+        return gemm_csc_pattern_layout_operation[index2(operation, layout, ALPHA_SPARSE_LAYOUT_NUM)](alpha, A->mat, x, columns, ldx, beta, y, ldy);
+    }
     else
     {
         return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
     }
 }
+
+alphasparse_status_t ONAME(const alphasparse_operation_t operation,
+                          const ALPHA_Number alpha,
+                          const alphasparse_matrix_t A,
+                          const struct alpha_matrix_descr descr, /* alphasparse_matrix_type_t + alphasparse_fill_mode_t + alphasparse_diag_type_t */
+                          const alphasparse_layout_t layout,    /* storage scheme for the dense matrix: C-style or Fortran-style */
+                          const ALPHA_Number *x,
+                          const ALPHA_INT columns,
+                          const ALPHA_INT ldx,
+                          const ALPHA_Number beta,
+                          ALPHA_Number *y,
+                          const ALPHA_INT ldy)
+{
+    alpha_exec_scope_t scope;
+    alpha_exec_enter(&scope, alpha_matrix_exec_context(A));
+    alphasparse_status_t status;
+    if (!alpha_trace_on())
+        status = mm_dispatch(operation, alpha, A, descr, layout, x, columns, ldx, beta, y, ldy);
+    else
+    {
+        const double start = alpha_trace_begin();
+        status = mm_dispatch(operation, alpha, A, descr, layout, x, columns, ldx, beta, y, ldy);
+        alpha_trace_end(ALPHA_TRACE_MM, A, operation, descr, layout, columns, status, start);
+    }
+    alpha_exec_leave(&scope);
+    return status;
+}
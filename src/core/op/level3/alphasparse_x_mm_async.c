@@ -0,0 +1,61 @@
+/**
+ * @brief implement for alphasparse_?_mm_async interface
+ */
+
+#include "alphasparse/util.h"
+#include "alphasparse/spapi.h"
+#include "alphasparse/async.h"
+#include <stdlib.h>
+
+typedef struct
+{
+    alphasparse_operation_t operation;
+    ALPHA_Number alpha;
+    alphasparse_matrix_t A;
+    struct alpha_matrix_descr descr;
+    alphasparse_layout_t layout;
+    const ALPHA_Number *x;
+    ALPHA_INT columns;
+    ALPHA_INT ldx;
+    ALPHA_Number beta;
+    ALPHA_Number *y;
+    ALPHA_INT ldy;
+} mm_async_args_t;
+
+static alphasparse_status_t mm_async_run(void *p)
+{
+    const mm_async_args_t *args = p;
+    return alpha_async_mm(args->operation, args->alpha, args->A, args->descr, args->layout, args->x, args->columns, args->ldx, args->beta, args->y, args->ldy);
+}
+
+alphasparse_status_t ONAME(const alphasparse_operation_t operation,
+                          const ALPHA_Number alpha,
+                          const alphasparse_matrix_t A,
+                          const struct alpha_matrix_descr descr, /* alphasparse_matrix_type_t + alphasparse_fill_mode_t + alphasparse_diag_type_t */
+                          const alphasparse_layout_t layout,    /* storage scheme for the dense matrix: C-style or Fortran-style */
+                          const ALPHA_Number *x,
+                          const ALPHA_INT columns,
+                          const ALPHA_INT ldx,
+                          const ALPHA_Number beta,
+                          ALPHA_Number *y,
+                          const ALPHA_INT ldy,
+                          const ALPHA_INT dep_num,
+                          const alphasparse_future_t *deps,
+                          alphasparse_future_t *future)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    mm_async_args_t *args = malloc(sizeof(mm_async_args_t));
+    check_null_return(args, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+    args->operation = operation;
+    args->alpha = alpha;
+    args->A = A;
+    args->descr = descr;
+    args->layout = layout;
+    args->x = x;
+    args->columns = columns;
+    args->ldx = ldx;
+    args->beta = beta;
+    args->y = y;
+    args->ldy = ldy;
+    return alpha_async_submit(mm_async_run, args, dep_num, deps, future);
+}
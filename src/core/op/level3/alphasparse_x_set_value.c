@@ -2,6 +2,7 @@
 #include "alphasparse/kernel.h"
 #include "alphasparse/util.h"
 #include "alphasparse/opt.h"
+#include "alphasparse/inspector.h"
 
 alphasparse_status_t ONAME (alphasparse_matrix_t A, 
                         const ALPHA_INT row, 
@@ -13,7 +14,9 @@ alphasparse_status_t ONAME (alphasparse_matrix_t A,
 
     if(A->format == ALPHA_SPARSE_FORMAT_CSR)
     {
-        return set_value_csr(A->mat, row, col, value);
+        const alphasparse_status_t status = set_value_csr(A->mat, row, col, value);
+        alphasparse_inspector_values_changed(A);
+        return status;
     }
     else if(A->format == ALPHA_SPARSE_FORMAT_CSC)
     {
@@ -2,6 +2,7 @@
 #include "alphasparse/opt.h"
 #include "alphasparse/spapi.h"
 #include "alphasparse/kernel.h"
+#include "alphasparse/inspector.h"
 
 /*
 * 
@@ -129,7 +130,7 @@ static alphasparse_status_t (*spmmd_bsr_layout_operation[])(const ALPHA_SPMAT_BS
 #endif
 };
 
-alphasparse_status_t ONAME(const alphasparse_operation_t operation,
+static alphasparse_status_t spmmd_dispatch(const alphasparse_operation_t operation,
                                              const alphasparse_matrix_t A,
                                              const alphasparse_matrix_t B,
                                              const alphasparse_layout_t layout, /* storage scheme for the output dense matrix: C-style or Fortran-style */
@@ -169,3 +170,18 @@ alphasparse_status_t ONAME(const alphasparse_operation_t operation,
     else
         return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
 }
+
+alphasparse_status_t ONAME(const alphasparse_operation_t operation,
+                          const alphasparse_matrix_t A,
+                          const alphasparse_matrix_t B,
+                          const alphasparse_layout_t layout, /* storage scheme for the output dense matrix: C-style or Fortran-style */
+                          ALPHA_Number *matC,
+                          const ALPHA_INT ldc)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    alpha_exec_scope_t scope;
+    alpha_exec_enter(&scope, alpha_matrix_exec_context(A));
+    const alphasparse_status_t status = spmmd_dispatch(operation, A, B, layout, matC, ldc);
+    alpha_exec_leave(&scope);
+    return status;
+}
@@ -2,6 +2,7 @@
 #include "alphasparse/opt.h"
 #include "alphasparse/spapi.h"
 #include "alphasparse/kernel.h"
+#include "alphasparse/inspector.h"
 
 /*
 * 
@@ -846,7 +847,7 @@ static alphasparse_status_t (*diagsm_dia_diag_layout[])(const ALPHA_Number alpha
     diagsm_dia_u_col,
 };
 
-alphasparse_status_t ONAME(const alphasparse_operation_t operation,
+static alphasparse_status_t trsm_dispatch(const alphasparse_operation_t operation,
                                             const ALPHA_Number alpha,
                                             const alphasparse_matrix_t A,
                                             const struct alpha_matrix_descr descr, /* alphasparse_matrix_type_t + alphasparse_fill_mode_t + alphasparse_diag_type_t */
@@ -977,3 +978,29 @@ alphasparse_status_t ONAME(const alphasparse_operation_t operation,
         return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
     }
 }
+
+alphasparse_status_t ONAME(const alphasparse_operation_t operation,
+                                            const ALPHA_Number alpha,
+                                            const alphasparse_matrix_t A,
+                                            const struct alpha_matrix_descr descr, /* alphasparse_matrix_type_t + alphasparse_fill_mode_t + alphasparse_diag_type_t */
+                                            const alphasparse_layout_t layout,    /* storage scheme for the dense matrix: C-style or Fortran-style */
+                                            const ALPHA_Number *x,
+                                            const ALPHA_INT columns,
+                                            const ALPHA_INT ldx,
+                                            ALPHA_Number *y,
+                                            const ALPHA_INT ldy)
+{
+    alpha_exec_scope_t scope;
+    alpha_exec_enter(&scope, alpha_matrix_exec_context(A));
+    alphasparse_status_t status;
+    if (!alpha_trace_on())
+        status = trsm_dispatch(operation, alpha, A, descr, layout, x, columns, ldx, y, ldy);
+    else
+    {
+        const double start = alpha_trace_begin();
+        status = trsm_dispatch(operation, alpha, A, descr, layout, x, columns, ldx, y, ldy);
+        alpha_trace_end(ALPHA_TRACE_SM, A, operation, descr, layout, columns, status, start);
+    }
+    alpha_exec_leave(&scope);
+    return status;
+}
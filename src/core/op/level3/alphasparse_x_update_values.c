@@ -1,21 +1,82 @@
 #include "alphasparse/spapi.h"
 #include "alphasparse/kernel.h"
+#include "alphasparse/inspector.h"
 #include "alphasparse/util.h"
 #include "alphasparse/opt.h"
 
-alphasparse_status_t ONAME (alphasparse_matrix_t A, 
-                        const ALPHA_INT nvalues, 
-                        const ALPHA_INT *indx, 
-                        const ALPHA_INT *indy, 
+// build the (row, col) -> values position index of A once, later calls reuse it
+static alphasparse_status_t value_index_prepare(alphasparse_matrix_t A, alpha_value_index_t **index)
+{
+    alphasparse_inspector_t inspector = alphasparse_inspector_get(A);
+    if (inspector->value_index == NULL)
+    {
+        alphasparse_status_t status;
+        if (A->format == ALPHA_SPARSE_FORMAT_CSR)
+        {
+            ALPHA_SPMAT_CSR *mat = (ALPHA_SPMAT_CSR *)A->mat;
+            status = alpha_value_index_build_compressed(mat->rows, mat->rows_start, mat->rows_end, mat->col_indx, &inspector->value_index);
+        }
+        else if (A->format == ALPHA_SPARSE_FORMAT_CSC)
+        {
+            ALPHA_SPMAT_CSC *mat = (ALPHA_SPMAT_CSC *)A->mat;
+            status = alpha_value_index_build_compressed_int(mat->cols, mat->cols_start, mat->cols_end, mat->row_indx, &inspector->value_index);
+        }
+        else if (A->format == ALPHA_SPARSE_FORMAT_COO)
+        {
+            ALPHA_SPMAT_COO *mat = (ALPHA_SPMAT_COO *)A->mat;
+            status = alpha_value_index_build_coo(mat->rows, mat->nnz, mat->row_indx, mat->col_indx, &inspector->value_index);
+        }
+        else if (A->format == ALPHA_SPARSE_FORMAT_BSR)
+        {
+            ALPHA_SPMAT_BSR *mat = (ALPHA_SPMAT_BSR *)A->mat;
+            status = alpha_value_index_build_compressed(mat->rows, mat->rows_start, mat->rows_end, mat->col_indx, &inspector->value_index);
+        }
+        else
+            return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
+        check_error_return(status);
+    }
+    *index = inspector->value_index;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t ONAME (alphasparse_matrix_t A,
+                        const ALPHA_INT nvalues,
+                        const ALPHA_INT *indx,
+                        const ALPHA_INT *indy,
                         ALPHA_Number *values)
 {
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
     check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(values, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
     check_return(A->datatype != ALPHA_SPARSE_DATATYPE, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(nvalues < 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    // indx and indy are both given or both NULL (replace all values in storage order)
+    check_return((indx == NULL) != (indy == NULL), ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    alpha_value_index_t *index = NULL;
+    if (indx != NULL)
+        check_error_return(value_index_prepare(A, &index));
 
-    // if(A->format == ALPHA_SPARSE_FORMAT_BSR)
-    // {
-    //     return update_values_bsr(A->mat, nvalues, indx, indy, values);
-    // }
-    // else
+    alphasparse_status_t status;
+    if(A->format == ALPHA_SPARSE_FORMAT_CSR)
+    {
+        status = update_values_csr(A->mat, index, nvalues, indx, indy, values);
+    }
+    else if(A->format == ALPHA_SPARSE_FORMAT_CSC)
+    {
+        status = update_values_csc(A->mat, index, nvalues, indx, indy, values);
+    }
+    else if(A->format == ALPHA_SPARSE_FORMAT_COO)
+    {
+        status = update_values_coo(A->mat, index, nvalues, indx, indy, values);
+    }
+    else if(A->format == ALPHA_SPARSE_FORMAT_BSR)
+    {
+        status = update_values_bsr(A->mat, index, nvalues, indx, indy, values);
+    }
+    else
         return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
-}
\ No newline at end of file
+    // copies of the values follow them, also when the update stopped at an entry not in the pattern
+    alphasparse_inspector_values_changed(A);
+    return status;
+}
@@ -0,0 +1,406 @@
+/**
+ * @brief implement for the asynchronous routines and their executor
+ */
+
+#include "alphasparse.h"
+#include "alphasparse/async.h"
+#include "alphasparse/util.h"
+#include <pthread.h>
+#include <stdlib.h>
+
+typedef enum
+{
+    FUTURE_PENDING = 0,
+    FUTURE_RUNNING = 1,
+    FUTURE_DONE = 2,
+} future_state_t;
+
+struct alpha_future
+{
+    alpha_async_fn_t fn;
+    void *args;
+    ALPHA_INT dep_num;
+    struct alpha_future **deps;
+    future_state_t state;
+    alphasparse_status_t status;
+    // held by the user handle, by the executor until completion and by every pending dependent
+    int refs;
+    struct alpha_future *next;
+};
+
+// guards the queue, the requests and the worker set
+static pthread_mutex_t async_lock = PTHREAD_MUTEX_INITIALIZER;
+// a future was queued or completed, workers look for a ready one
+static pthread_cond_t async_ready = PTHREAD_COND_INITIALIZER;
+// a future completed, for alphasparse_future_wait
+static pthread_cond_t async_done = PTHREAD_COND_INITIALIZER;
+// serializes alphasparse_set_async_teams
+static pthread_mutex_t async_config_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static struct alpha_future *queue_head = NULL;
+static struct alpha_future *queue_tail = NULL;
+static ALPHA_INT team_request = 0;
+static ALPHA_INT worker_num = 0;
+static pthread_t *workers = NULL;
+static alphasparse_exec_context_t *team_ctx = NULL;
+static bool stopping = false;
+
+static void future_release(struct alpha_future *r)
+{
+    if (--r->refs == 0)
+        free(r);
+}
+
+// first queued future whose dependencies have all completed, unlinked from the queue
+static struct alpha_future *take_ready()
+{
+    struct alpha_future *prev = NULL;
+    for (struct alpha_future *r = queue_head; r != NULL; prev = r, r = r->next)
+    {
+        bool ready = true;
+        for (ALPHA_INT i = 0; i < r->dep_num && ready; i++)
+            ready = r->deps[i]->state == FUTURE_DONE;
+        if (!ready)
+            continue;
+        if (prev == NULL)
+            queue_head = r->next;
+        else
+            prev->next = r->next;
+        if (queue_tail == r)
+            queue_tail = prev;
+        r->next = NULL;
+        return r;
+    }
+    return NULL;
+}
+
+static void *worker_main(void *arg)
+{
+    alpha_exec_set_thread_context((alphasparse_exec_context_t)arg);
+    pthread_mutex_lock(&async_lock);
+    for (;;)
+    {
+        struct alpha_future *r = take_ready();
+        if (r == NULL)
+        {
+            // dependencies of queued requests are queued or running, so a stopping executor still drains
+            if (stopping && queue_head == NULL)
+                break;
+            pthread_cond_wait(&async_ready, &async_lock);
+            continue;
+        }
+        r->state = FUTURE_RUNNING;
+        alphasparse_status_t status = ALPHA_SPARSE_STATUS_SUCCESS;
+        for (ALPHA_INT i = 0; i < r->dep_num; i++)
+            if (r->deps[i]->status != ALPHA_SPARSE_STATUS_SUCCESS)
+                status = ALPHA_SPARSE_STATUS_EXECUTION_FAILED;
+        pthread_mutex_unlock(&async_lock);
+
+        if (status == ALPHA_SPARSE_STATUS_SUCCESS)
+            status = r->fn(r->args);
+        free(r->args);
+        r->args = NULL;
+
+        pthread_mutex_lock(&async_lock);
+        r->status = status;
+        r->state = FUTURE_DONE;
+        for (ALPHA_INT i = 0; i < r->dep_num; i++)
+            future_release(r->deps[i]);
+        free(r->deps);
+        r->deps = NULL;
+        r->dep_num = 0;
+        future_release(r);
+        pthread_cond_broadcast(&async_ready);
+        pthread_cond_broadcast(&async_done);
+    }
+    pthread_mutex_unlock(&async_lock);
+    alpha_exec_set_thread_context(NULL);
+    return NULL;
+}
+
+/*
+* Start the workers when none are running, with async_lock held. Teams split
+* the thread count of alpha_get_thread_num and, when there are enough of them,
+* the cores, team t being bound to its own contiguous block.
+*/
+static void executor_start()
+{
+    if (worker_num > 0)
+        return;
+    const ALPHA_INT core_num = alpha_get_core_num();
+    const ALPHA_INT thread_num = alpha_get_thread_num();
+    ALPHA_INT teams = team_request > 0 ? team_request : alpha_min(2, core_num);
+    if (teams < 1)
+        teams = 1;
+    workers = malloc(sizeof(pthread_t) * teams);
+    team_ctx = malloc(sizeof(alphasparse_exec_context_t) * teams);
+    if (workers == NULL || team_ctx == NULL)
+    {
+        free(workers);
+        free(team_ctx);
+        workers = NULL;
+        team_ctx = NULL;
+        return;
+    }
+    // the cores of the process affinity mask, not 0..core_num-1 which it may not allow
+    int allowed[core_num > 0 ? core_num : 1];
+    const ALPHA_INT allowed_num = alpha_get_cores(allowed, core_num);
+    for (ALPHA_INT t = 0; t < teams; t++)
+    {
+        const ALPHA_INT team_threads = alpha_max(1, thread_num / teams);
+        if (alphasparse_create_exec_context(&team_ctx[t], team_threads) != ALPHA_SPARSE_STATUS_SUCCESS)
+            break;
+        if (allowed_num >= teams)
+        {
+            const ALPHA_INT first = (ALPHA_INT)((long long)t * allowed_num / teams);
+            const ALPHA_INT last = (ALPHA_INT)((long long)(t + 1) * allowed_num / teams);
+            ALPHA_INT cores[last - first];
+            for (ALPHA_INT c = first; c < last; c++)
+                cores[c - first] = allowed[c];
+            // a rejected core list leaves the context unbound, the team then runs wherever the process may
+            alphasparse_exec_context_set_cores(team_ctx[t], last - first, cores, ALPHA_SPARSE_BIND_CLOSE);
+        }
+        if (pthread_create(&workers[t], NULL, worker_main, team_ctx[t]) != 0)
+        {
+            alphasparse_destroy_exec_context(team_ctx[t]);
+            break;
+        }
+        worker_num++;
+    }
+}
+
+alphasparse_status_t alpha_async_submit(alpha_async_fn_t fn,
+                                        void *args,
+                                        const ALPHA_INT dep_num,
+                                        const alphasparse_future_t *deps,
+                                        alphasparse_future_t *future)
+{
+    if (fn == NULL || args == NULL || future == NULL || dep_num < 0 || (dep_num > 0 && deps == NULL))
+    {
+        free(args);
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+    for (ALPHA_INT i = 0; i < dep_num; i++)
+        if (deps[i] == NULL)
+        {
+            free(args);
+            return ALPHA_SPARSE_STATUS_NOT_INITIALIZED;
+        }
+    struct alpha_future *r = malloc(sizeof(struct alpha_future));
+    struct alpha_future **r_deps = dep_num > 0 ? malloc(sizeof(struct alpha_future *) * dep_num) : NULL;
+    if (r == NULL || (dep_num > 0 && r_deps == NULL))
+    {
+        free(r);
+        free(r_deps);
+        free(args);
+        return ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    }
+    r->fn = fn;
+    r->args = args;
+    r->dep_num = dep_num;
+    r->deps = r_deps;
+    r->state = FUTURE_PENDING;
+    r->status = ALPHA_SPARSE_STATUS_SUCCESS;
+    r->refs = 2;
+    r->next = NULL;
+
+    pthread_mutex_lock(&async_lock);
+    executor_start();
+    if (worker_num == 0)
+    {
+        pthread_mutex_unlock(&async_lock);
+        free(r);
+        free(r_deps);
+        free(args);
+        return ALPHA_SPARSE_STATUS_INTERNAL_ERROR;
+    }
+    for (ALPHA_INT i = 0; i < dep_num; i++)
+    {
+        r_deps[i] = deps[i];
+        r_deps[i]->refs++;
+    }
+    if (queue_tail == NULL)
+        queue_head = r;
+    else
+        queue_tail->next = r;
+    queue_tail = r;
+    pthread_cond_broadcast(&async_ready);
+    pthread_mutex_unlock(&async_lock);
+    *future = r;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_set_async_teams(const ALPHA_INT team_num)
+{
+    check_return(team_num < 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    pthread_mutex_lock(&async_config_lock);
+    pthread_mutex_lock(&async_lock);
+    const ALPHA_INT stopped_num = worker_num;
+    pthread_t *stopped = workers;
+    alphasparse_exec_context_t *stopped_ctx = team_ctx;
+    team_request = team_num;
+    stopping = true;
+    pthread_cond_broadcast(&async_ready);
+    pthread_mutex_unlock(&async_lock);
+
+    for (ALPHA_INT t = 0; t < stopped_num; t++)
+        pthread_join(stopped[t], NULL);
+    for (ALPHA_INT t = 0; t < stopped_num; t++)
+        alphasparse_destroy_exec_context(stopped_ctx[t]);
+    free(stopped);
+    free(stopped_ctx);
+
+    pthread_mutex_lock(&async_lock);
+    stopping = false;
+    workers = NULL;
+    team_ctx = NULL;
+    worker_num = 0;
+    // requests queued after the old workers left
+    if (queue_head != NULL)
+        executor_start();
+    pthread_mutex_unlock(&async_lock);
+    pthread_mutex_unlock(&async_config_lock);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_future_wait(alphasparse_future_t future)
+{
+    check_null_return(future, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    pthread_mutex_lock(&async_lock);
+    while (future->state != FUTURE_DONE)
+        pthread_cond_wait(&async_done, &async_lock);
+    const alphasparse_status_t status = future->status;
+    pthread_mutex_unlock(&async_lock);
+    return status;
+}
+
+alphasparse_status_t alphasparse_future_test(alphasparse_future_t future, bool *completed)
+{
+    check_null_return(future, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(completed, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    pthread_mutex_lock(&async_lock);
+    *completed = future->state == FUTURE_DONE;
+    pthread_mutex_unlock(&async_lock);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_future_destroy(alphasparse_future_t future)
+{
+    check_null_return(future, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    pthread_mutex_lock(&async_lock);
+    future_release(future);
+    pthread_mutex_unlock(&async_lock);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+/*
+* Routines producing a matrix hand out its handle right away, empty until the
+* future completes, so that later requests depending on it can take it as an
+* operand. The result is moved into the handle when the operation finished.
+*/
+static alphasparse_matrix_t matrix_placeholder(const alphasparse_matrix_t like)
+{
+    alphasparse_matrix_t M = alpha_malloc(sizeof(alphasparse_matrix));
+    M->mat = NULL;
+    M->format = like->format;
+    M->datatype = like->datatype;
+    M->inspector = NULL;
+    M->dcu_info = NULL;
+    return M;
+}
+
+// both handles come from alpha_malloc, the emptied one of the result goes back with alpha_release
+static void matrix_fill(alphasparse_matrix_t placeholder, alphasparse_matrix_t result)
+{
+    *placeholder = *result;
+    alpha_release(result);
+}
+
+typedef struct
+{
+    alphasparse_operation_t operation;
+    alphasparse_matrix_t A;
+    alphasparse_matrix_t B;
+    alphasparse_matrix_t C;
+} spmm_async_args_t;
+
+static alphasparse_status_t spmm_async_run(void *p)
+{
+    spmm_async_args_t *args = p;
+    alphasparse_matrix_t result = NULL;
+    const alphasparse_status_t status = alphasparse_spmm(args->operation, args->A, args->B, &result);
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS)
+        matrix_fill(args->C, result);
+    return status;
+}
+
+alphasparse_status_t alphasparse_spmm_async(const alphasparse_operation_t operation,
+                                           const alphasparse_matrix_t A,
+                                           const alphasparse_matrix_t B,
+                                           alphasparse_matrix_t *C,
+                                           const ALPHA_INT dep_num,
+                                           const alphasparse_future_t *deps,
+                                           alphasparse_future_t *future)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(B, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(C, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    spmm_async_args_t *args = malloc(sizeof(spmm_async_args_t));
+    check_null_return(args, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+    args->operation = operation;
+    args->A = A;
+    args->B = B;
+    args->C = matrix_placeholder(A);
+    alphasparse_matrix_t placeholder = args->C;
+    const alphasparse_status_t status = alpha_async_submit(spmm_async_run, args, dep_num, deps, future);
+    if (status != ALPHA_SPARSE_STATUS_SUCCESS)
+    {
+        alpha_release(placeholder);
+        return status;
+    }
+    *C = placeholder;
+    return status;
+}
+
+typedef struct
+{
+    alphasparse_operation_t operation;
+    alphasparse_matrix_t source;
+    alphasparse_matrix_t dest;
+} convert_async_args_t;
+
+static alphasparse_status_t convert_csr_async_run(void *p)
+{
+    convert_async_args_t *args = p;
+    alphasparse_matrix_t result = NULL;
+    const alphasparse_status_t status = alphasparse_convert_csr(args->source, args->operation, &result);
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS)
+        matrix_fill(args->dest, result);
+    return status;
+}
+
+alphasparse_status_t alphasparse_convert_csr_async(const alphasparse_matrix_t source,
+                                                  const alphasparse_operation_t operation,
+                                                  alphasparse_matrix_t *dest,
+                                                  const ALPHA_INT dep_num,
+                                                  const alphasparse_future_t *deps,
+                                                  alphasparse_future_t *future)
+{
+    check_null_return(source, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(dest, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    convert_async_args_t *args = malloc(sizeof(convert_async_args_t));
+    check_null_return(args, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+    args->operation = operation;
+    args->source = source;
+    args->dest = matrix_placeholder(source);
+    args->dest->format = ALPHA_SPARSE_FORMAT_CSR;
+    alphasparse_matrix_t placeholder = args->dest;
+    const alphasparse_status_t status = alpha_async_submit(convert_csr_async_run, args, dep_num, deps, future);
+    if (status != ALPHA_SPARSE_STATUS_SUCCESS)
+    {
+        alpha_release(placeholder);
+        return status;
+    }
+    *dest = placeholder;
+    return status;
+}
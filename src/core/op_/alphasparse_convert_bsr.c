@@ -154,6 +154,7 @@ alphasparse_status_t alphasparse_convert_bsr(const alphasparse_matrix_t source,
     check_return(block_size <= 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
     alphasparse_matrix* dest_ = alpha_malloc(sizeof(alphasparse_matrix));
     *dest = dest_;
+    dest_->inspector = NULL;
     dest_->format = ALPHA_SPARSE_FORMAT_BSR;
     dest_->datatype = source->datatype;
 
@@ -167,6 +167,7 @@ alphasparse_status_t alphasparse_convert_coo(
   }
   alphasparse_matrix *dest_ = alpha_malloc(sizeof(alphasparse_matrix));
   *dest = dest_;
+  dest_->inspector = NULL;
   dest_->dcu_info = NULL;
   dest_->format = ALPHA_SPARSE_FORMAT_COO;
   dest_->datatype = source->datatype;
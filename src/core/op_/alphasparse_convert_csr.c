@@ -100,7 +100,7 @@ alphasparse_status_t convert_csr_datatype_coo(const alpha_internal_spmat *source
 
 alphasparse_status_t convert_csr_datatype_format(const alpha_internal_spmat *source, alpha_internal_spmat **dest, alphasparse_datatype_t datatype, alphasparse_format_t format)
 {
-    if (format == ALPHA_SPARSE_FORMAT_COO)
+    if (format == ALPHA_SPARSE_FORMAT_COO || format == ALPHA_SPARSE_FORMAT_COO_PATTERN)
     {
         return convert_csr_datatype_coo(source, dest, datatype);
     }
@@ -130,7 +130,9 @@ alphasparse_status_t alphasparse_convert_csr(const alphasparse_matrix_t source,
     check_null_return(source->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
     alphasparse_matrix* dest_ = alpha_malloc(sizeof(alphasparse_matrix));
     *dest = dest_;
-    dest_->format = ALPHA_SPARSE_FORMAT_CSR;
+    dest_->inspector = NULL;
+    // a pattern-only source keeps omitting values
+    dest_->format = source->format == ALPHA_SPARSE_FORMAT_COO_PATTERN ? ALPHA_SPARSE_FORMAT_CSR_PATTERN : ALPHA_SPARSE_FORMAT_CSR;
     dest_->datatype = source->datatype;
 
     alphasparse_status_t status;
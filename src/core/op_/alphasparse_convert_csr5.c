@@ -1,6 +1,7 @@
 #include "alphasparse/format.h"
 #include "alphasparse/spmat.h"
 #include "alphasparse/util/check.h"
+#include "alphasparse/util/malloc.h"
 
 #include <stdio.h>
 
@@ -41,6 +42,7 @@ alphasparse_status_t alphasparse_convert_csr5(
   check_null_return(source->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
   alphasparse_matrix *dest_ = alpha_malloc(sizeof(alphasparse_matrix));
   *dest = dest_;
+  dest_->inspector = NULL;
   dest_->dcu_info = NULL;
   dest_->format = ALPHA_SPARSE_FORMAT_CSR5;
   dest_->datatype = source->datatype;
@@ -133,6 +133,7 @@ alphasparse_status_t alphasparse_convert_dia(const alphasparse_matrix_t source,
     check_null_return(source->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
     alphasparse_matrix* dest_ = alpha_malloc(sizeof(alphasparse_matrix));
     *dest = dest_;
+    dest_->inspector = NULL;
     dest_->format = ALPHA_SPARSE_FORMAT_DIA;
     dest_->datatype = source->datatype;
 
@@ -0,0 +1,69 @@
+#include "alphasparse.h"
+#include "alphasparse/format.h"
+#include "alphasparse/spmat.h"
+
+alphasparse_status_t convert_dia_csr_datatype_coo(const alpha_internal_spmat *source, const double fill_threshold, alpha_internal_spmat **dest, alphasparse_datatype_t datatype)
+{
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+    {
+        return convert_dia_csr_s_coo((spmat_coo_s_t *)source, fill_threshold, (spmat_dia_csr_s_t **)dest);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+    {
+        return convert_dia_csr_d_coo((spmat_coo_d_t *)source, fill_threshold, (spmat_dia_csr_d_t **)dest);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+    {
+        return convert_dia_csr_c_coo((spmat_coo_c_t *)source, fill_threshold, (spmat_dia_csr_c_t **)dest);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX)
+    {
+        return convert_dia_csr_z_coo((spmat_coo_z_t *)source, fill_threshold, (spmat_dia_csr_z_t **)dest);
+    }
+    else
+    {
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+}
+
+alphasparse_status_t alphasparse_convert_dia_csr(const alphasparse_matrix_t source,
+                                               const alphasparse_operation_t operation,
+                                               const double fill_threshold,
+                                               alphasparse_matrix_t *dest)
+{
+    check_null_return(source, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(source->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(dest, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(!(fill_threshold >= 0. && fill_threshold <= 1.), ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(operation != ALPHA_SPARSE_OPERATION_NON_TRANSPOSE && operation != ALPHA_SPARSE_OPERATION_TRANSPOSE, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+
+    // a transpose goes through alphasparse_transpose and a CSR source through COO first
+    alphasparse_matrix_t trans = NULL, coo = NULL;
+    alphasparse_matrix_t from = source;
+    if (operation == ALPHA_SPARSE_OPERATION_TRANSPOSE)
+    {
+        check_error_return(alphasparse_transpose(from, &trans));
+        from = trans;
+    }
+    if (from->format != ALPHA_SPARSE_FORMAT_COO)
+    {
+        alphasparse_status_t status = alphasparse_convert_coo(from, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &coo);
+        if (status != ALPHA_SPARSE_STATUS_SUCCESS)
+        {
+            alphasparse_destroy(trans);
+            return status;
+        }
+        from = coo;
+    }
+
+    alphasparse_matrix *dest_ = alpha_malloc(sizeof(alphasparse_matrix));
+    *dest = dest_;
+    dest_->inspector = NULL;
+    dest_->dcu_info = NULL;
+    dest_->format = ALPHA_SPARSE_FORMAT_DIA_CSR;
+    dest_->datatype = source->datatype;
+    alphasparse_status_t status = convert_dia_csr_datatype_coo((const alpha_internal_spmat *)from->mat, fill_threshold, (alpha_internal_spmat **)&dest_->mat, from->datatype);
+    alphasparse_destroy(coo);
+    alphasparse_destroy(trans);
+    return status;
+}
@@ -131,6 +131,7 @@ alphasparse_status_t alphasparse_convert_ell(
   }
   alphasparse_matrix *dest_ = alpha_malloc(sizeof(alphasparse_matrix));
   *dest = dest_;
+  dest_->inspector = NULL;
   dest_->dcu_info = NULL;
   dest_->format = ALPHA_SPARSE_FORMAT_ELL;
   dest_->datatype = source->datatype;
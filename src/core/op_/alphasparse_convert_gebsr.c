@@ -164,6 +164,7 @@ alphasparse_status_t alphasparse_convert_gebsr(
   check_return(block_col_dim <= 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
   alphasparse_matrix *dest_ = alpha_malloc(sizeof(alphasparse_matrix));
   *dest = dest_;
+  dest_->inspector = NULL;
   dest_->dcu_info = NULL;
   dest_->format = ALPHA_SPARSE_FORMAT_GEBSR;
   dest_->datatype = source->datatype;
@@ -146,6 +146,7 @@ alphasparse_status_t alphasparse_convert_hyb(const alphasparse_matrix_t source,
     return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
   }
   *dest = dest_;
+  dest_->inspector = NULL;
   dest_->dcu_info = NULL;
   dest_->format = ALPHA_SPARSE_FORMAT_HYB;
   dest_->datatype = source->datatype;
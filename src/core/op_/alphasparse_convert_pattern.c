@@ -0,0 +1,94 @@
+#include "alphasparse.h"
+#include "alphasparse/format.h"
+#include "alphasparse/spmat.h"
+#include "alphasparse/util/check.h"
+
+#include <stdio.h>
+
+alphasparse_status_t convert_pattern_datatype_coo(const alpha_internal_spmat *source,
+                                                 alpha_internal_spmat **dest,
+                                                 alphasparse_datatype_t datatype) {
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT) {
+        return convert_pattern_s_coo((spmat_coo_s_t *)source, (spmat_coo_s_t **)dest);
+    } else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE) {
+        return convert_pattern_d_coo((spmat_coo_d_t *)source, (spmat_coo_d_t **)dest);
+    } else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX) {
+        return convert_pattern_c_coo((spmat_coo_c_t *)source, (spmat_coo_c_t **)dest);
+    } else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX) {
+        return convert_pattern_z_coo((spmat_coo_z_t *)source, (spmat_coo_z_t **)dest);
+    } else {
+        printf("convert_pattern_datatype_coo\n");
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+}
+
+alphasparse_status_t convert_pattern_datatype_csr(const alpha_internal_spmat *source,
+                                                 alpha_internal_spmat **dest,
+                                                 alphasparse_datatype_t datatype) {
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT) {
+        return convert_pattern_s_csr((spmat_csr_s_t *)source, (spmat_csr_s_t **)dest);
+    } else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE) {
+        return convert_pattern_d_csr((spmat_csr_d_t *)source, (spmat_csr_d_t **)dest);
+    } else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX) {
+        return convert_pattern_c_csr((spmat_csr_c_t *)source, (spmat_csr_c_t **)dest);
+    } else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX) {
+        return convert_pattern_z_csr((spmat_csr_z_t *)source, (spmat_csr_z_t **)dest);
+    } else {
+        printf("convert_pattern_datatype_csr\n");
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+}
+
+alphasparse_status_t convert_pattern_datatype_csc(const alpha_internal_spmat *source,
+                                                 alpha_internal_spmat **dest,
+                                                 alphasparse_datatype_t datatype) {
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT) {
+        return convert_pattern_s_csc((spmat_csc_s_t *)source, (spmat_csc_s_t **)dest);
+    } else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE) {
+        return convert_pattern_d_csc((spmat_csc_d_t *)source, (spmat_csc_d_t **)dest);
+    } else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX) {
+        return convert_pattern_c_csc((spmat_csc_c_t *)source, (spmat_csc_c_t **)dest);
+    } else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX) {
+        return convert_pattern_z_csc((spmat_csc_z_t *)source, (spmat_csc_z_t **)dest);
+    } else {
+        printf("convert_pattern_datatype_csc\n");
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+}
+
+alphasparse_status_t alphasparse_convert_pattern(
+        const alphasparse_matrix_t source, /* COO, CSR or CSC matrix whose stored values are all one */
+        alphasparse_matrix_t *dest) {
+    check_null_return(source, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(source->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    alphasparse_format_t format;
+    if (source->format == ALPHA_SPARSE_FORMAT_COO || source->format == ALPHA_SPARSE_FORMAT_COO_PATTERN) {
+        format = ALPHA_SPARSE_FORMAT_COO_PATTERN;
+    } else if (source->format == ALPHA_SPARSE_FORMAT_CSR || source->format == ALPHA_SPARSE_FORMAT_CSR_PATTERN) {
+        format = ALPHA_SPARSE_FORMAT_CSR_PATTERN;
+    } else if (source->format == ALPHA_SPARSE_FORMAT_CSC || source->format == ALPHA_SPARSE_FORMAT_CSC_PATTERN) {
+        format = ALPHA_SPARSE_FORMAT_CSC_PATTERN;
+    } else {
+        return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    alpha_internal_spmat *mat = NULL;
+    alphasparse_status_t status;
+    if (format == ALPHA_SPARSE_FORMAT_COO_PATTERN) {
+        status = convert_pattern_datatype_coo((const alpha_internal_spmat *)source->mat, &mat, source->datatype);
+    } else if (format == ALPHA_SPARSE_FORMAT_CSR_PATTERN) {
+        status = convert_pattern_datatype_csr((const alpha_internal_spmat *)source->mat, &mat, source->datatype);
+    } else {
+        status = convert_pattern_datatype_csc((const alpha_internal_spmat *)source->mat, &mat, source->datatype);
+    }
+    // a value other than one leaves dest untouched
+    check_error_return(status);
+
+    alphasparse_matrix *dest_ = alpha_malloc(sizeof(alphasparse_matrix));
+    *dest = dest_;
+    dest_->inspector = NULL;
+    dest_->format = format;
+    dest_->datatype = source->datatype;
+    dest_->mat = mat;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
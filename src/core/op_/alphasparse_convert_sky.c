@@ -130,6 +130,7 @@ alphasparse_status_t alphasparse_convert_sky(const alphasparse_matrix_t source,
     return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
   }
   *dest = dest_;
+  dest_->inspector = NULL;
   dest_->dcu_info = NULL;
   dest_->format = ALPHA_SPARSE_FORMAT_SKY;
   dest_->datatype = source->datatype;
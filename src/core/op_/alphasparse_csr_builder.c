@@ -0,0 +1,284 @@
+/**
+ * @brief implement for the incremental CSR builder
+ */
+
+#include "alphasparse.h"
+#include "alphasparse/builder.h"
+#include "alphasparse/spmat.h"
+#include <stdlib.h>
+#include <string.h>
+
+// first buffer of a range that comes without any hint
+#define BUILDER_MIN_CAPACITY 64
+
+alphasparse_status_t alpha_csr_builder_init(alphasparse_csr_builder_t *builder_p,
+                                            const alphasparse_datatype_t datatype,
+                                            const size_t value_size,
+                                            const ALPHA_INT rows,
+                                            const ALPHA_INT cols,
+                                            const ALPHA_INT *row_nnz,
+                                            const ALPHA_OFFSET nnz_hint)
+{
+    check_null_return(builder_p, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(rows < 0 || cols < 0 || nnz_hint < 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    struct alpha_csr_builder *builder = alpha_malloc(sizeof(struct alpha_csr_builder));
+    memset(builder, 0, sizeof(struct alpha_csr_builder));
+    builder->datatype = datatype;
+    builder->value_size = value_size;
+    builder->rows = rows;
+    builder->cols = cols;
+    builder->nnz_hint = nnz_hint;
+    builder->rows_offset = alpha_memalign((rows + 1) * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
+    memset(builder->rows_offset, 0, (rows + 1) * sizeof(ALPHA_OFFSET));
+    if (row_nnz != NULL)
+    {
+        // exact sizes, allocate the final arrays once
+        builder->exact = true;
+        for (ALPHA_INT r = 0; r < rows; r++)
+        {
+            if (row_nnz[r] < 0)
+            {
+                alpha_release(builder->rows_offset);
+                alpha_release(builder);
+                return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+            }
+            builder->rows_offset[r + 1] = builder->rows_offset[r] + row_nnz[r];
+        }
+        ALPHA_OFFSET nnz = builder->rows_offset[rows];
+        builder->col_indx = alpha_memalign(nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+        builder->values = alpha_memalign(nnz * value_size, DEFAULT_ALIGNMENT);
+    }
+    *builder_p = builder;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_csr_builder_begin_rows(alphasparse_csr_builder_t builder,
+                                                        const ALPHA_INT row_begin,
+                                                        const ALPHA_INT row_end,
+                                                        const ALPHA_OFFSET nnz_hint,
+                                                        alphasparse_csr_range_t *range_p)
+{
+    check_null_return(builder, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(range_p, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(row_begin < 0 || row_end > builder->rows || row_begin > row_end || nnz_hint < 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    struct alpha_csr_builder_range *range = alpha_malloc(sizeof(struct alpha_csr_builder_range));
+    memset(range, 0, sizeof(struct alpha_csr_builder_range));
+    range->builder = builder;
+    range->row_begin = row_begin;
+    range->row_end = row_end;
+    range->next_row = row_begin;
+    if (!builder->exact)
+    {
+        ALPHA_OFFSET capacity = nnz_hint;
+        if (capacity == 0 && builder->rows > 0)
+            capacity = (ALPHA_OFFSET)((double)builder->nnz_hint * (row_end - row_begin) / builder->rows);
+        range->capacity = capacity < BUILDER_MIN_CAPACITY ? BUILDER_MIN_CAPACITY : capacity;
+        // aligned like every other CSR array, a range covering all rows is adopted as is
+        range->col_indx = alpha_memalign(range->capacity * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+        range->values = alpha_memalign(range->capacity * builder->value_size, DEFAULT_ALIGNMENT);
+    }
+
+    // producers may claim ranges concurrently, the range list is the only shared state
+    alphasparse_status_t status = ALPHA_SPARSE_STATUS_SUCCESS;
+#ifdef _OPENMP
+#pragma omp critical(alpha_csr_builder)
+#endif
+    {
+        for (ALPHA_INT i = 0; i < builder->range_num; i++)
+        {
+            const struct alpha_csr_builder_range *other = builder->ranges[i];
+            if (row_begin < other->row_end && other->row_begin < row_end)
+                status = ALPHA_SPARSE_STATUS_INVALID_VALUE;
+        }
+        if (status == ALPHA_SPARSE_STATUS_SUCCESS)
+        {
+            if (builder->range_num == builder->range_capacity)
+            {
+                builder->range_capacity = builder->range_capacity == 0 ? 16 : builder->range_capacity * 2;
+                struct alpha_csr_builder_range **ranges = alpha_malloc(builder->range_capacity * sizeof(struct alpha_csr_builder_range *));
+                if (builder->range_num > 0)
+                    memcpy(ranges, builder->ranges, builder->range_num * sizeof(struct alpha_csr_builder_range *));
+                alpha_release(builder->ranges);
+                builder->ranges = ranges;
+            }
+            builder->ranges[builder->range_num++] = range;
+        }
+    }
+    if (status != ALPHA_SPARSE_STATUS_SUCCESS)
+    {
+        alpha_release(range->col_indx);
+        alpha_release(range->values);
+        alpha_release(range);
+        return status;
+    }
+    *range_p = range;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alpha_csr_builder_append(alphasparse_csr_range_t range,
+                                              const ALPHA_INT nnz,
+                                              const ALPHA_INT *col_indx,
+                                              const void *values)
+{
+    struct alpha_csr_builder *builder = range->builder;
+    check_return(range->next_row >= range->row_end || nnz < 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    if (nnz > 0)
+    {
+        check_null_return(col_indx, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+        check_null_return(values, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    }
+    for (ALPHA_INT i = 0; i < nnz; i++)
+        check_return(col_indx[i] < 0 || col_indx[i] >= builder->cols, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    const ALPHA_INT row = range->next_row;
+    const size_t vsize = builder->value_size;
+    if (builder->exact)
+    {
+        const ALPHA_OFFSET start = builder->rows_offset[row];
+        check_return(builder->rows_offset[row + 1] - start != nnz, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+        memcpy(builder->col_indx + start, col_indx, nnz * sizeof(ALPHA_INT));
+        memcpy((char *)builder->values + start * vsize, values, nnz * vsize);
+    }
+    else
+    {
+        if (range->nnz + nnz > range->capacity)
+        {
+            ALPHA_OFFSET capacity = range->capacity * 2;
+            while (capacity < range->nnz + nnz)
+                capacity *= 2;
+            // no aligned realloc, grow by copy
+            ALPHA_INT *col = alpha_memalign(capacity * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+            void *val = alpha_memalign(capacity * vsize, DEFAULT_ALIGNMENT);
+            memcpy(col, range->col_indx, range->nnz * sizeof(ALPHA_INT));
+            memcpy(val, range->values, range->nnz * vsize);
+            alpha_release(range->col_indx);
+            alpha_release(range->values);
+            range->col_indx = col;
+            range->values = val;
+            range->capacity = capacity;
+        }
+        memcpy(range->col_indx + range->nnz, col_indx, nnz * sizeof(ALPHA_INT));
+        memcpy((char *)range->values + range->nnz * vsize, values, nnz * vsize);
+        // row lengths for now, finalize turns them into offsets
+        builder->rows_offset[row + 1] = nnz;
+    }
+    range->nnz += nnz;
+    range->next_row++;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+#define BUILDER_WRAP_CSR(SPMAT, NUMBER)                          \
+    {                                                            \
+        SPMAT *mat = alpha_malloc(sizeof(SPMAT));                \
+        memset(mat, 0, sizeof(SPMAT));                           \
+        mat->rows = builder->rows;                               \
+        mat->cols = builder->cols;                               \
+        mat->rows_start = builder->rows_offset;                  \
+        mat->rows_end = builder->rows_offset + 1;                \
+        mat->col_indx = col_indx;                                \
+        mat->values = (NUMBER *)values;                          \
+        A_->mat = mat;                                           \
+    }
+
+static void builder_free(alphasparse_csr_builder_t builder, const bool keep_arrays)
+{
+    for (ALPHA_INT i = 0; i < builder->range_num; i++)
+    {
+        alpha_release(builder->ranges[i]->col_indx);
+        alpha_release(builder->ranges[i]->values);
+        alpha_release(builder->ranges[i]);
+    }
+    alpha_release(builder->ranges);
+    if (!keep_arrays)
+    {
+        alpha_release(builder->rows_offset);
+        alpha_release(builder->col_indx);
+        alpha_release(builder->values);
+    }
+    alpha_release(builder);
+}
+
+alphasparse_status_t alphasparse_csr_builder_finalize(alphasparse_csr_builder_t builder, alphasparse_matrix_t *A)
+{
+    check_null_return(builder, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    // ranges never overlap, so full coverage is a matter of counting rows
+    ALPHA_INT covered = 0;
+    for (ALPHA_INT i = 0; i < builder->range_num; i++)
+    {
+        check_return(builder->ranges[i]->next_row != builder->ranges[i]->row_end, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+        covered += builder->ranges[i]->row_end - builder->ranges[i]->row_begin;
+    }
+    check_return(covered != builder->rows, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    const ALPHA_INT m = builder->rows;
+    const size_t vsize = builder->value_size;
+    ALPHA_INT *col_indx = builder->col_indx;
+    void *values = builder->values;
+    if (!builder->exact)
+    {
+        ALPHA_OFFSET *rows_offset = builder->rows_offset;
+        for (ALPHA_INT r = 0; r < m; r++)
+            rows_offset[r + 1] += rows_offset[r];
+        const ALPHA_OFFSET nnz = rows_offset[m];
+        struct alpha_csr_builder_range *whole = NULL;
+        for (ALPHA_INT i = 0; i < builder->range_num; i++)
+            if (builder->ranges[i]->row_end - builder->ranges[i]->row_begin == m)
+                whole = builder->ranges[i];
+        if (whole != NULL)
+        {
+            // one producer built everything, adopt its aligned buffers, trimming would mean a copy
+            col_indx = whole->col_indx;
+            values = whole->values;
+            whole->col_indx = NULL;
+            whole->values = NULL;
+        }
+        else
+        {
+            col_indx = alpha_memalign(nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+            values = alpha_memalign(nnz * vsize, DEFAULT_ALIGNMENT);
+            const ALPHA_INT range_num = builder->range_num;
+            ALPHA_INT num_threads = alpha_get_thread_num();
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic, 1)
+#endif
+            for (ALPHA_INT i = 0; i < range_num; i++)
+            {
+                struct alpha_csr_builder_range *range = builder->ranges[i];
+                const ALPHA_OFFSET start = rows_offset[range->row_begin];
+                memcpy(col_indx + start, range->col_indx, range->nnz * sizeof(ALPHA_INT));
+                memcpy((char *)values + start * vsize, range->values, range->nnz * vsize);
+                // release each range as soon as it is copied to keep the peak low
+                alpha_release(range->col_indx);
+                alpha_release(range->values);
+                range->col_indx = NULL;
+                range->values = NULL;
+            }
+        }
+    }
+
+    alphasparse_matrix *A_ = alpha_malloc(sizeof(alphasparse_matrix));
+    A_->format = ALPHA_SPARSE_FORMAT_CSR;
+    A_->datatype = builder->datatype;
+    A_->inspector = NULL;
+    A_->dcu_info = NULL;
+    if (builder->datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+        BUILDER_WRAP_CSR(spmat_csr_s_t, float)
+    else if (builder->datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+        BUILDER_WRAP_CSR(spmat_csr_d_t, double)
+    else if (builder->datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+        BUILDER_WRAP_CSR(spmat_csr_c_t, ALPHA_Complex8)
+    else
+        BUILDER_WRAP_CSR(spmat_csr_z_t, ALPHA_Complex16)
+    *A = A_;
+    builder_free(builder, true);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_csr_builder_destroy(alphasparse_csr_builder_t builder)
+{
+    check_null_return(builder, ALPHA_SPARSE_STATUS_SUCCESS);
+    builder_free(builder, false);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
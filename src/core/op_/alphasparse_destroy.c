@@ -6,6 +6,7 @@
 #include "alphasparse.h"
 #include "alphasparse/format.h"
 #include "alphasparse/spmat.h"
+#include "alphasparse/inspector.h"
 
 alphasparse_status_t destroy_datatype_coo(alpha_internal_spmat *mat, alphasparse_datatype_t datatype)
 {
@@ -151,17 +152,41 @@ alphasparse_status_t destroy_datatype_dia(alpha_internal_spmat *mat, alphasparse
     }
 }
 
+alphasparse_status_t destroy_datatype_dia_csr(alpha_internal_spmat *mat, alphasparse_datatype_t datatype)
+{
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+    {
+        return destroy_s_dia_csr((spmat_dia_csr_s_t *)mat);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+    {
+        return destroy_d_dia_csr((spmat_dia_csr_d_t *)mat);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+    {
+        return destroy_c_dia_csr((spmat_dia_csr_c_t *)mat);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX)
+    {
+        return destroy_z_dia_csr((spmat_dia_csr_z_t *)mat);
+    }
+    else
+    {
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+}
+
 alphasparse_status_t destroy_datatype_format(alpha_internal_spmat *mat, alphasparse_datatype_t datatype, alphasparse_format_t format)
 {
-    if (format == ALPHA_SPARSE_FORMAT_COO)
+    if (format == ALPHA_SPARSE_FORMAT_COO || format == ALPHA_SPARSE_FORMAT_COO_PATTERN)
     {
         return destroy_datatype_coo(mat, datatype);
     }
-    else if (format == ALPHA_SPARSE_FORMAT_CSR)
+    else if (format == ALPHA_SPARSE_FORMAT_CSR || format == ALPHA_SPARSE_FORMAT_CSR_PATTERN)
     {
         return destroy_datatype_csr(mat, datatype);
     }
-    else if (format == ALPHA_SPARSE_FORMAT_CSC)
+    else if (format == ALPHA_SPARSE_FORMAT_CSC || format == ALPHA_SPARSE_FORMAT_CSC_PATTERN)
     {
         return destroy_datatype_csc(mat, datatype);
     }
@@ -177,6 +202,10 @@ alphasparse_status_t destroy_datatype_format(alpha_internal_spmat *mat, alphaspa
     {
         return destroy_datatype_dia(mat, datatype);
     }
+    else if (format == ALPHA_SPARSE_FORMAT_DIA_CSR)
+    {
+        return destroy_datatype_dia_csr(mat, datatype);
+    }
     else
     {
         return ALPHA_SPARSE_STATUS_INVALID_VALUE;
@@ -186,10 +215,18 @@ alphasparse_status_t destroy_datatype_format(alpha_internal_spmat *mat, alphaspa
 alphasparse_status_t alphasparse_destroy(alphasparse_matrix_t A)
 {
     check_null_return(A, ALPHA_SPARSE_STATUS_SUCCESS);
-    if (A->mat != NULL)
+    alphasparse_inspector_t inspector = (alphasparse_inspector_t)A->inspector;
+    if (A->mat != NULL && inspector != NULL && (inspector->mapping != NULL || inspector->view))
+    {
+        // arrays of a loaded matrix belong to the mapping released with the inspector,
+        // those of a view to the matrix it was taken from
+        alpha_free(A->mat);
+    }
+    else if (A->mat != NULL)
     {
         destroy_datatype_format(A->mat, A->datatype, A->format);
     }
+    alphasparse_inspector_destroy(inspector);
     alpha_free(A);
     return ALPHA_SPARSE_STATUS_SUCCESS;
 }
@@ -0,0 +1,103 @@
+/**
+ * @brief implement for execution contexts, per-matrix and per-thread thread configuration
+ */
+
+#include "alphasparse.h"
+#include "alphasparse/inspector.h"
+#include <stdlib.h>
+
+alphasparse_status_t alphasparse_create_exec_context(alphasparse_exec_context_t *ctx, const ALPHA_INT thread_num)
+{
+    check_null_return(ctx, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(thread_num <= 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    alphasparse_exec_context_t context = malloc(sizeof(struct alpha_exec_context));
+    check_null_return(context, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+    context->thread_num = thread_num;
+    context->core_num = 0;
+    context->cores = NULL;
+    context->policy = ALPHA_SPARSE_BIND_NONE;
+    context->version = 0;
+    context->workspace = NULL;
+    context->workspace_size = 0;
+    context->workspace_owned = true;
+    *ctx = context;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_exec_context_set_cores(alphasparse_exec_context_t ctx,
+                                                       const ALPHA_INT core_num,
+                                                       const ALPHA_INT *cores,
+                                                       const alphasparse_bind_policy_t policy)
+{
+    check_null_return(ctx, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(core_num < 0 || (core_num > 0 && cores == NULL), ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(policy != ALPHA_SPARSE_BIND_NONE && policy != ALPHA_SPARSE_BIND_CLOSE && policy != ALPHA_SPARSE_BIND_SPREAD,
+                 ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    // every core has to be in the affinity mask of the process, binding to any other one fails
+    if (core_num > 0)
+    {
+        const int allowed_max = alpha_get_core_num();
+        int allowed[allowed_max];
+        const int allowed_num = alpha_get_cores(allowed, allowed_max);
+        for (ALPHA_INT i = 0; i < core_num; i++)
+        {
+            bool found = false;
+            for (int a = 0; a < allowed_num && !found; a++)
+                found = allowed[a] == cores[i];
+            check_return(!found, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+        }
+    }
+    int *copy = NULL;
+    if (core_num > 0)
+    {
+        copy = malloc(sizeof(int) * core_num);
+        check_null_return(copy, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+        for (ALPHA_INT i = 0; i < core_num; i++)
+            copy[i] = cores[i];
+    }
+    free(ctx->cores);
+    ctx->cores = copy;
+    ctx->core_num = core_num;
+    ctx->policy = core_num > 0 ? policy : ALPHA_SPARSE_BIND_NONE;
+    ctx->version++;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_exec_context_set_workspace(alphasparse_exec_context_t ctx, void *workspace, const size_t size)
+{
+    check_null_return(ctx, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(workspace == NULL && size != 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    if (ctx->workspace_owned)
+        free(ctx->workspace);
+    ctx->workspace = workspace;
+    ctx->workspace_size = workspace == NULL ? 0 : size;
+    ctx->workspace_owned = workspace == NULL;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_destroy_exec_context(alphasparse_exec_context_t ctx)
+{
+    check_null_return(ctx, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    if (alpha_exec_thread_context() == ctx)
+        alpha_exec_set_thread_context(NULL);
+    free(ctx->cores);
+    if (ctx->workspace_owned)
+        free(ctx->workspace);
+    free(ctx);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_set_exec_context(alphasparse_matrix_t A, alphasparse_exec_context_t ctx)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    if (ctx == NULL && A->inspector == NULL)
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    alphasparse_inspector_get(A)->exec_context = ctx;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_set_thread_exec_context(alphasparse_exec_context_t ctx)
+{
+    alpha_exec_set_thread_context(ctx);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -0,0 +1,300 @@
+/**
+ * @brief implement for alphasparse_permute, alphasparse_extract_submatrix and alphasparse_view_rows intelfaces
+ */
+
+#include "alphasparse.h"
+#include "alphasparse/format.h"
+#include "alphasparse/spmat.h"
+#include "alphasparse/inspector.h"
+#include "alphasparse/util.h"
+#include <stdlib.h>
+
+alphasparse_status_t extract_datatype_csr(const alpha_internal_spmat *source, const ALPHA_INT rows, const ALPHA_INT *row_indx, const ALPHA_INT cols, const ALPHA_INT *col_map, alpha_internal_spmat **dest, alphasparse_datatype_t datatype)
+{
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+    {
+        return extract_s_csr((const spmat_csr_s_t *)source, rows, row_indx, cols, col_map, (spmat_csr_s_t **)dest);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+    {
+        return extract_d_csr((const spmat_csr_d_t *)source, rows, row_indx, cols, col_map, (spmat_csr_d_t **)dest);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+    {
+        return extract_c_csr((const spmat_csr_c_t *)source, rows, row_indx, cols, col_map, (spmat_csr_c_t **)dest);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX)
+    {
+        return extract_z_csr((const spmat_csr_z_t *)source, rows, row_indx, cols, col_map, (spmat_csr_z_t **)dest);
+    }
+    else
+    {
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+}
+
+alphasparse_status_t extract_datatype_csc(const alpha_internal_spmat *source, const ALPHA_INT rows, const ALPHA_INT *row_map, const ALPHA_INT cols, const ALPHA_INT *col_indx, alpha_internal_spmat **dest, alphasparse_datatype_t datatype)
+{
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+    {
+        return extract_s_csc((const spmat_csc_s_t *)source, rows, row_map, cols, col_indx, (spmat_csc_s_t **)dest);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+    {
+        return extract_d_csc((const spmat_csc_d_t *)source, rows, row_map, cols, col_indx, (spmat_csc_d_t **)dest);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+    {
+        return extract_c_csc((const spmat_csc_c_t *)source, rows, row_map, cols, col_indx, (spmat_csc_c_t **)dest);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX)
+    {
+        return extract_z_csc((const spmat_csc_z_t *)source, rows, row_map, cols, col_indx, (spmat_csc_z_t **)dest);
+    }
+    else
+    {
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+}
+
+alphasparse_status_t extract_datatype_bsr(const alpha_internal_spmat *source, const ALPHA_INT rows, const ALPHA_INT *row_indx, const ALPHA_INT cols, const ALPHA_INT *col_map, alpha_internal_spmat **dest, alphasparse_datatype_t datatype)
+{
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+    {
+        return extract_s_bsr((const spmat_bsr_s_t *)source, rows, row_indx, cols, col_map, (spmat_bsr_s_t **)dest);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+    {
+        return extract_d_bsr((const spmat_bsr_d_t *)source, rows, row_indx, cols, col_map, (spmat_bsr_d_t **)dest);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+    {
+        return extract_c_bsr((const spmat_bsr_c_t *)source, rows, row_indx, cols, col_map, (spmat_bsr_c_t **)dest);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX)
+    {
+        return extract_z_bsr((const spmat_bsr_z_t *)source, rows, row_indx, cols, col_map, (spmat_bsr_z_t **)dest);
+    }
+    else
+    {
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+}
+
+// the dimensions every format keeps at the same place, in blocks for BSR
+static void extract_dims_datatype(const alphasparse_matrix_t A, ALPHA_INT *rows, ALPHA_INT *cols)
+{
+    if (A->format == ALPHA_SPARSE_FORMAT_CSC || A->format == ALPHA_SPARSE_FORMAT_CSC_PATTERN)
+    {
+        const spmat_csc_d_t *mat = (const spmat_csc_d_t *)A->mat;
+        *rows = mat->rows, *cols = mat->cols;
+    }
+    else if (A->format == ALPHA_SPARSE_FORMAT_BSR)
+    {
+        const spmat_bsr_d_t *mat = (const spmat_bsr_d_t *)A->mat;
+        *rows = mat->rows, *cols = mat->cols;
+    }
+    else
+    {
+        const spmat_csr_d_t *mat = (const spmat_csr_d_t *)A->mat;
+        *rows = mat->rows, *cols = mat->cols;
+    }
+}
+
+/*
+* map[indx[k]] = k and -1 for the indices not in indx, INVALID_VALUE when an index is
+* out of [0, n) or repeats. NULL indx leaves *map NULL, the identity.
+*/
+static alphasparse_status_t extract_index_map(const ALPHA_INT n, const ALPHA_INT count, const ALPHA_INT *indx, ALPHA_INT **map)
+{
+    *map = NULL;
+    if (indx == NULL)
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    ALPHA_INT *m = malloc(sizeof(ALPHA_INT) * alpha_max(n, 1));
+    check_null_return(m, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(alpha_get_thread_num())
+#endif
+    for (ALPHA_INT i = 0; i < n; i++)
+        m[i] = -1;
+    for (ALPHA_INT k = 0; k < count; k++)
+    {
+        if (indx[k] < 0 || indx[k] >= n || m[indx[k]] >= 0)
+        {
+            free(m);
+            return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+        }
+        m[indx[k]] = k;
+    }
+    *map = m;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+static alphasparse_status_t extract_check_indices(const ALPHA_INT n, const ALPHA_INT count, const ALPHA_INT *indx)
+{
+    if (indx == NULL)
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    for (ALPHA_INT k = 0; k < count; k++)
+        check_return(indx[k] < 0 || indx[k] >= n, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+/*
+* B(i, j) = A(row_indx[i], col_indx[j]) in the format of A. The major index set of the
+* format (rows for CSR/BSR, columns for CSC) goes to the kernel as is and may repeat,
+* the other one as a map from the old to the new index.
+*/
+static alphasparse_status_t extract_format(const alphasparse_matrix_t A,
+                                           const ALPHA_INT rows,
+                                           const ALPHA_INT *row_indx,
+                                           const ALPHA_INT cols,
+                                           const ALPHA_INT *col_indx,
+                                           alphasparse_matrix_t *B)
+{
+    ALPHA_INT rows_A, cols_A;
+    extract_dims_datatype(A, &rows_A, &cols_A);
+    const bool by_col = A->format == ALPHA_SPARSE_FORMAT_CSC || A->format == ALPHA_SPARSE_FORMAT_CSC_PATTERN;
+    ALPHA_INT *map;
+    if (by_col)
+    {
+        check_error_return(extract_check_indices(cols_A, cols, col_indx));
+        check_error_return(extract_index_map(rows_A, rows, row_indx, &map));
+    }
+    else
+    {
+        check_error_return(extract_check_indices(rows_A, rows, row_indx));
+        check_error_return(extract_index_map(cols_A, cols, col_indx, &map));
+    }
+
+    alphasparse_matrix *dest = alpha_malloc(sizeof(alphasparse_matrix));
+    *B = dest;
+    dest->inspector = NULL;
+    dest->dcu_info = NULL;
+    dest->format = A->format;
+    dest->datatype = A->datatype;
+    alphasparse_status_t status;
+    if (by_col)
+        status = extract_datatype_csc((const alpha_internal_spmat *)A->mat, rows, map, cols, col_indx, (alpha_internal_spmat **)&dest->mat, A->datatype);
+    else if (A->format == ALPHA_SPARSE_FORMAT_BSR)
+        status = extract_datatype_bsr((const alpha_internal_spmat *)A->mat, rows, row_indx, cols, map, (alpha_internal_spmat **)&dest->mat, A->datatype);
+    else
+        status = extract_datatype_csr((const alpha_internal_spmat *)A->mat, rows, row_indx, cols, map, (alpha_internal_spmat **)&dest->mat, A->datatype);
+    free(map);
+    return status;
+}
+
+static alphasparse_status_t extract_check_matrix(const alphasparse_matrix_t A)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(A->datatype < ALPHA_SPARSE_DATATYPE_FLOAT || A->datatype > ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(A->format != ALPHA_SPARSE_FORMAT_CSR && A->format != ALPHA_SPARSE_FORMAT_CSR_PATTERN &&
+                 A->format != ALPHA_SPARSE_FORMAT_CSC && A->format != ALPHA_SPARSE_FORMAT_CSC_PATTERN &&
+                 A->format != ALPHA_SPARSE_FORMAT_BSR,
+                 ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_permute(const alphasparse_matrix_t A,
+                                       const ALPHA_INT *row_perm,
+                                       const ALPHA_INT *col_perm,
+                                       alphasparse_matrix_t *B)
+{
+    check_error_return(extract_check_matrix(A));
+    check_null_return(B, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    ALPHA_INT rows, cols;
+    extract_dims_datatype(A, &rows, &cols);
+    // the index set the kernel takes as is must still be a permutation
+    const bool by_col = A->format == ALPHA_SPARSE_FORMAT_CSC || A->format == ALPHA_SPARSE_FORMAT_CSC_PATTERN;
+    ALPHA_INT *map;
+    check_error_return(extract_index_map(by_col ? cols : rows, by_col ? cols : rows, by_col ? col_perm : row_perm, &map));
+    free(map);
+    return extract_format(A, rows, row_perm, cols, col_perm, B);
+}
+
+alphasparse_status_t alphasparse_extract_submatrix(const alphasparse_matrix_t A,
+                                                 const ALPHA_INT rows,
+                                                 const ALPHA_INT *row_indx,
+                                                 const ALPHA_INT cols,
+                                                 const ALPHA_INT *col_indx,
+                                                 alphasparse_matrix_t *B)
+{
+    check_error_return(extract_check_matrix(A));
+    check_null_return(B, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    ALPHA_INT rows_A, cols_A;
+    extract_dims_datatype(A, &rows_A, &cols_A);
+    check_return(rows < 0 || cols < 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(row_indx == NULL && rows != rows_A, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(col_indx == NULL && cols != cols_A, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    return extract_format(A, rows, row_indx, cols, col_indx, B);
+}
+
+alphasparse_status_t alphasparse_view_rows(const alphasparse_matrix_t A,
+                                         const ALPHA_INT row_first,
+                                         const ALPHA_INT row_last,
+                                         alphasparse_matrix_t *B)
+{
+    check_error_return(extract_check_matrix(A));
+    check_null_return(B, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    ALPHA_INT rows, cols;
+    extract_dims_datatype(A, &rows, &cols);
+    ALPHA_INT block_size = 1;
+    if (A->format == ALPHA_SPARSE_FORMAT_BSR)
+        block_size = ((const spmat_bsr_d_t *)A->mat)->block_size;
+    const ALPHA_INT first = row_first / block_size, last = row_last / block_size;
+    check_return(row_first < 0 || row_first > row_last || last > rows, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(row_first % block_size != 0 || row_last % block_size != 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    if (A->format == ALPHA_SPARSE_FORMAT_CSC || A->format == ALPHA_SPARSE_FORMAT_CSC_PATTERN)
+    {
+        // the rows of a column are not contiguous, copy them out
+        ALPHA_INT *row_indx = malloc(sizeof(ALPHA_INT) * alpha_max(last - first, 1));
+        check_null_return(row_indx, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+        for (ALPHA_INT i = first; i < last; i++)
+            row_indx[i - first] = i;
+        alphasparse_status_t status = extract_format(A, last - first, row_indx, cols, NULL, B);
+        free(row_indx);
+        return status;
+    }
+
+    // rows_start and rows_end are separate, the view points into the arrays of A
+    alphasparse_matrix *dest = alpha_malloc(sizeof(alphasparse_matrix));
+    *B = dest;
+    dest->inspector = NULL;
+    dest->dcu_info = NULL;
+    dest->format = A->format;
+    dest->datatype = A->datatype;
+    if (A->format == ALPHA_SPARSE_FORMAT_BSR)
+    {
+        // every datatype keeps the arrays at the same place, only values differs in type
+        const spmat_bsr_d_t *mat = (const spmat_bsr_d_t *)A->mat;
+        spmat_bsr_d_t *view = alpha_malloc(sizeof(spmat_bsr_d_t));
+        *view = *mat;
+        view->rows = last - first;
+        view->rows_start = mat->rows_start + first;
+        view->rows_end = mat->rows_end + first;
+        view->d_values = NULL;
+        view->d_rows_ptr = NULL;
+        view->d_col_indx = NULL;
+        dest->mat = view;
+    }
+    else
+    {
+        // likewise for CSR and its pattern-only form, whose values are NULL
+        const spmat_csr_d_t *mat = (const spmat_csr_d_t *)A->mat;
+        spmat_csr_d_t *view = alpha_malloc(sizeof(spmat_csr_d_t));
+        *view = *mat;
+        view->rows = last - first;
+        view->rows_start = mat->rows_start + first;
+        view->rows_end = mat->rows_end + first;
+        view->d_values = NULL;
+        view->d_row_ptr = NULL;
+        view->d_col_indx = NULL;
+        dest->mat = view;
+    }
+    alphasparse_inspector_t inspector = alphasparse_inspector_get(dest);
+    inspector->view = true;
+    // the view runs on the execution context of A
+    inspector->exec_context = alpha_matrix_exec_context(A);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -0,0 +1,235 @@
+/**
+ * @brief implement for operation graphs: capture, dependency analysis and replay
+ */
+
+#include "alphasparse.h"
+#include "alphasparse/graph.h"
+#include "alphasparse/util.h"
+#include <stdlib.h>
+#include <string.h>
+
+_Thread_local struct alpha_graph *alpha_graph_capture = NULL;
+
+static void graph_clear_stages(struct alpha_graph *graph)
+{
+    for (ALPHA_INT s = 0; s < graph->stage_num; s++)
+        free(graph->stages[s].partition);
+    free(graph->stages);
+    free(graph->dot_partial);
+    graph->stages = NULL;
+    graph->stage_num = 0;
+    graph->dot_partial = NULL;
+    graph->dot_num = 0;
+    graph->finalized = false;
+}
+
+alphasparse_status_t alpha_graph_append(struct alpha_graph *graph, const alphasparse_datatype_t datatype, alpha_graph_node_t **node)
+{
+    check_return(graph->typed && graph->datatype != datatype, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    if (graph->node_num == graph->node_cap)
+    {
+        const ALPHA_INT cap = graph->node_cap == 0 ? 16 : graph->node_cap * 2;
+        alpha_graph_node_t *nodes = realloc(graph->nodes, sizeof(alpha_graph_node_t) * cap);
+        check_null_return(nodes, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+        graph->nodes = nodes;
+        graph->node_cap = cap;
+    }
+    graph->typed = true;
+    graph->datatype = datatype;
+    graph_clear_stages(graph);
+    *node = &graph->nodes[graph->node_num++];
+    memset(*node, 0, sizeof(alpha_graph_node_t));
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+/*
+* Whether node can join the stage made of nodes [first, last]. Rows of a stage
+* are split among the threads once, so a node may join when it works on the
+* same rows and no thread needs rows another thread produces in the stage:
+* an mv reads its x in full, so x must not be written in the stage, and no
+* node may overwrite an x an mv of the stage still reads. Operands are
+* compared by address, distinct vectors must not overlap.
+*/
+static bool stage_accepts(const struct alpha_graph *graph, const ALPHA_INT first, const ALPHA_INT last, const alpha_graph_node_t *node)
+{
+    for (ALPHA_INT i = first; i <= last; i++)
+    {
+        const alpha_graph_node_t *prev = &graph->nodes[i];
+        const void *prev_out = prev->op == ALPHA_GRAPH_DOT ? NULL : prev->out;
+        const void *node_out = node->op == ALPHA_GRAPH_DOT ? NULL : node->out;
+        if (node->op == ALPHA_GRAPH_MV && prev_out == node->in[0])
+            return false;
+        if (prev->op == ALPHA_GRAPH_MV && node_out != NULL && node_out == prev->in[0])
+            return false;
+    }
+    return true;
+}
+
+static void stage_partition(const struct alpha_graph *graph, alpha_graph_stage_t *stage, const ALPHA_INT thread_num)
+{
+    for (ALPHA_INT i = stage->first; i <= stage->last; i++)
+    {
+        const alpha_graph_node_t *node = &graph->nodes[i];
+        if (node->op == ALPHA_GRAPH_MV)
+        {
+            // the multiplies dominate the stage, balance by the entries of the first one
+            balanced_partition_row_by_offset(node->rows_end, stage->rows, thread_num, stage->partition);
+            return;
+        }
+    }
+    for (ALPHA_INT t = 0; t <= thread_num; t++)
+        stage->partition[t] = cross_block_low(t, thread_num, stage->rows);
+}
+
+alphasparse_status_t alpha_graph_finalize(struct alpha_graph *graph, const ALPHA_INT thread_num)
+{
+    graph_clear_stages(graph);
+    graph->stages = malloc(sizeof(alpha_graph_stage_t) * graph->node_num);
+    check_null_return(graph->stages, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+    for (ALPHA_INT i = 0; i < graph->node_num; i++)
+    {
+        const alpha_graph_node_t *node = &graph->nodes[i];
+        alpha_graph_stage_t *stage = graph->stage_num > 0 ? &graph->stages[graph->stage_num - 1] : NULL;
+        if (stage != NULL && stage->fused && node->fusable && stage->rows == node->rows &&
+            stage_accepts(graph, stage->first, stage->last, node))
+        {
+            stage->last = i;
+        }
+        else
+        {
+            stage = &graph->stages[graph->stage_num++];
+            stage->first = i;
+            stage->last = i;
+            stage->fused = node->fusable;
+            stage->rows = node->rows;
+            stage->partition = NULL;
+            stage->dot_first = graph->dot_num;
+            stage->region_end = -1;
+        }
+        if (node->op == ALPHA_GRAPH_DOT)
+            graph->dot_num++;
+    }
+    // consecutive fused stages share one parallel region, separated by barriers
+    for (ALPHA_INT s = 0; s < graph->stage_num;)
+    {
+        if (!graph->stages[s].fused)
+        {
+            s++;
+            continue;
+        }
+        ALPHA_INT e = s;
+        while (e + 1 < graph->stage_num && graph->stages[e + 1].fused)
+            e++;
+        graph->stages[s].region_end = e;
+        s = e + 1;
+    }
+    for (ALPHA_INT s = 0; s < graph->stage_num; s++)
+    {
+        alpha_graph_stage_t *stage = &graph->stages[s];
+        if (!stage->fused)
+            continue;
+        stage->partition = malloc(sizeof(ALPHA_INT) * (thread_num + 1));
+        if (stage->partition == NULL)
+        {
+            graph_clear_stages(graph);
+            return ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+        }
+        stage_partition(graph, stage, thread_num);
+    }
+    if (graph->dot_num > 0)
+    {
+        graph->dot_partial = malloc(sizeof(alpha_graph_scalar_t) * graph->dot_num * thread_num);
+        if (graph->dot_partial == NULL)
+        {
+            graph_clear_stages(graph);
+            return ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+        }
+    }
+    graph->thread_num = thread_num;
+    graph->finalized = true;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_graph_create(alphasparse_graph_t *graph)
+{
+    check_null_return(graph, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    struct alpha_graph *g = malloc(sizeof(struct alpha_graph));
+    check_null_return(g, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+    memset(g, 0, sizeof(struct alpha_graph));
+    *graph = g;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_graph_destroy(alphasparse_graph_t graph)
+{
+    check_null_return(graph, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    if (alpha_graph_capture == graph)
+        alpha_graph_capture = NULL;
+    graph_clear_stages(graph);
+    free(graph->nodes);
+    free(graph);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_graph_begin_capture(alphasparse_graph_t graph)
+{
+    check_null_return(graph, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(graph->capturing || alpha_graph_capturing(), ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    graph->capturing = true;
+    alpha_graph_capture = graph;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_graph_end_capture(alphasparse_graph_t graph)
+{
+    check_null_return(graph, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(alpha_graph_capture != graph, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    graph->capturing = false;
+    alpha_graph_capture = NULL;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+static alphasparse_status_t graph_prepare(alphasparse_graph_t graph)
+{
+    const ALPHA_INT thread_num = alpha_get_thread_num();
+    if (graph->finalized && graph->thread_num == thread_num)
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    return alpha_graph_finalize(graph, thread_num);
+}
+
+alphasparse_status_t alphasparse_graph_info(alphasparse_graph_t graph, ALPHA_INT *node_num, ALPHA_INT *stage_num, ALPHA_INT *region_num)
+{
+    check_null_return(graph, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(node_num == NULL || stage_num == NULL || region_num == NULL, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    const alphasparse_status_t status = graph_prepare(graph);
+    check_error_return(status);
+    *node_num = graph->node_num;
+    *stage_num = graph->stage_num;
+    *region_num = 0;
+    for (ALPHA_INT s = 0; s < graph->stage_num; s++)
+        if (!graph->stages[s].fused || graph->stages[s].region_end >= 0)
+            (*region_num)++;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_graph_execute(alphasparse_graph_t graph)
+{
+    check_null_return(graph, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(graph->capturing, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    if (graph->node_num == 0)
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    alphasparse_status_t status = graph_prepare(graph);
+    check_error_return(status);
+    // unfused nodes call the public routines, which must not be recorded by a capture of this thread
+    struct alpha_graph *capture = alpha_graph_capture;
+    alpha_graph_capture = NULL;
+    switch (graph->datatype)
+    {
+    case ALPHA_SPARSE_DATATYPE_FLOAT: status = graph_s_execute(graph); break;
+    case ALPHA_SPARSE_DATATYPE_DOUBLE: status = graph_d_execute(graph); break;
+    case ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX: status = graph_c_execute(graph); break;
+    default: status = graph_z_execute(graph); break;
+    }
+    alpha_graph_capture = capture;
+    return status;
+}
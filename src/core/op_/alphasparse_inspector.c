@@ -0,0 +1,451 @@
+/**
+ * @brief implement for per-matrix analysis data
+ */
+
+#include "alphasparse.h"
+#include "alphasparse/inspector.h"
+#include "alphasparse/util.h"
+#include "alphasparse/opt.h"
+#include <string.h>
+#include <sys/mman.h>
+
+typedef struct
+{
+    ALPHA_INT idx;
+    ALPHA_OFFSET pos;
+} value_index_pair_t;
+
+static int minor_first_cmp(const value_index_pair_t *a, const value_index_pair_t *b)
+{
+    if (a->idx != b->idx)
+        return a->idx < b->idx ? -1 : 1;
+    return a->pos < b->pos ? -1 : (a->pos > b->pos);
+}
+
+// sort one line of (idx, pos) by idx, most lines of an assembled matrix are already sorted
+static void value_index_sort_line(ALPHA_INT *idx, ALPHA_OFFSET *pos, const ALPHA_INT len)
+{
+    ALPHA_INT sorted = 1;
+    for (ALPHA_INT i = 1; i < len && sorted; i++)
+        sorted = idx[i - 1] <= idx[i];
+    if (sorted)
+        return;
+    value_index_pair_t *pairs = alpha_malloc(sizeof(value_index_pair_t) * len);
+    for (ALPHA_INT i = 0; i < len; i++)
+    {
+        pairs[i].idx = idx[i];
+        pairs[i].pos = pos[i];
+    }
+    qsort(pairs, len, sizeof(value_index_pair_t), (__compar_fn_t)minor_first_cmp);
+    for (ALPHA_INT i = 0; i < len; i++)
+    {
+        idx[i] = pairs[i].idx;
+        pos[i] = pairs[i].pos;
+    }
+    alpha_release(pairs);
+}
+
+static alpha_value_index_t *value_index_alloc(const ALPHA_INT n, const ALPHA_OFFSET nnz)
+{
+    alpha_value_index_t *index = alpha_malloc(sizeof(alpha_value_index_t));
+    index->n = n;
+    index->nnz = nnz;
+    index->ptr = alpha_memalign((n + 1) * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
+    index->idx = alpha_memalign(nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    index->pos = alpha_memalign(nnz * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
+    return index;
+}
+
+static void value_index_sort(alpha_value_index_t *index)
+{
+    ALPHA_INT num_threads = alpha_get_thread_num();
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic, 256)
+#endif
+    for (ALPHA_INT i = 0; i < index->n; i++)
+    {
+        ALPHA_OFFSET s = index->ptr[i];
+        value_index_sort_line(&index->idx[s], &index->pos[s], index->ptr[i + 1] - s);
+    }
+}
+
+alphasparse_status_t alpha_value_index_build_compressed(const ALPHA_INT n,
+                                                       const ALPHA_OFFSET *start,
+                                                       const ALPHA_OFFSET *end,
+                                                       const ALPHA_INT *indx,
+                                                       alpha_value_index_t **index_p)
+{
+    check_null_return(start, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(end, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(indx, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(n < 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    ALPHA_OFFSET nnz = 0;
+    for (ALPHA_INT i = 0; i < n; i++)
+        nnz += end[i] - start[i];
+    alpha_value_index_t *index = value_index_alloc(n, nnz);
+    index->ptr[0] = 0;
+    for (ALPHA_INT i = 0; i < n; i++)
+        index->ptr[i + 1] = index->ptr[i] + end[i] - start[i];
+
+    ALPHA_INT num_threads = alpha_get_thread_num();
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic, 256)
+#endif
+    for (ALPHA_INT i = 0; i < n; i++)
+    {
+        ALPHA_OFFSET dst = index->ptr[i];
+        for (ALPHA_OFFSET ai = start[i]; ai < end[i]; ai++, dst++)
+        {
+            index->idx[dst] = indx[ai];
+            index->pos[dst] = ai;
+        }
+    }
+    value_index_sort(index);
+    *index_p = index;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+// CSC keeps its offsets in ALPHA_INT, widen the n line bounds and share the build above
+alphasparse_status_t alpha_value_index_build_compressed_int(const ALPHA_INT n,
+                                                           const ALPHA_INT *start,
+                                                           const ALPHA_INT *end,
+                                                           const ALPHA_INT *indx,
+                                                           alpha_value_index_t **index_p)
+{
+    check_null_return(start, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(end, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(n < 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    ALPHA_OFFSET *bounds = alpha_malloc(2 * (n + 1) * sizeof(ALPHA_OFFSET));
+    for (ALPHA_INT i = 0; i < n; i++)
+    {
+        bounds[i] = start[i];
+        bounds[n + 1 + i] = end[i];
+    }
+    alphasparse_status_t status = alpha_value_index_build_compressed(n, bounds, bounds + n + 1, indx, index_p);
+    alpha_release(bounds);
+    return status;
+}
+
+alphasparse_status_t alpha_value_index_build_coo(const ALPHA_INT n,
+                                                const ALPHA_INT nnz,
+                                                const ALPHA_INT *major,
+                                                const ALPHA_INT *minor,
+                                                alpha_value_index_t **index_p)
+{
+    check_null_return(major, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(minor, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(n < 0 || nnz < 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    alpha_value_index_t *index = value_index_alloc(n, nnz);
+    ALPHA_OFFSET *fill = alpha_malloc((n + 1) * sizeof(ALPHA_OFFSET));
+    memset(index->ptr, 0, (n + 1) * sizeof(ALPHA_OFFSET));
+    for (ALPHA_INT i = 0; i < nnz; i++)
+    {
+        if (major[i] < 0 || major[i] >= n)
+        {
+            alpha_release(fill);
+            alpha_value_index_destroy(index);
+            return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+        }
+        index->ptr[major[i] + 1]++;
+    }
+    for (ALPHA_INT i = 0; i < n; i++)
+        index->ptr[i + 1] += index->ptr[i];
+    memcpy(fill, index->ptr, (n + 1) * sizeof(ALPHA_OFFSET));
+    for (ALPHA_INT i = 0; i < nnz; i++)
+    {
+        ALPHA_OFFSET dst = fill[major[i]]++;
+        index->idx[dst] = minor[i];
+        index->pos[dst] = i;
+    }
+    alpha_release(fill);
+    value_index_sort(index);
+    *index_p = index;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alpha_value_index_build_cross(const alpha_value_index_t *index,
+                                                  const ALPHA_INT n,
+                                                  alpha_value_index_t **cross_p)
+{
+    check_null_return(index, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(n < 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    alpha_value_index_t *cross = value_index_alloc(n, index->nnz);
+    ALPHA_OFFSET *fill = alpha_malloc((n + 1) * sizeof(ALPHA_OFFSET));
+    memset(cross->ptr, 0, (n + 1) * sizeof(ALPHA_OFFSET));
+    for (ALPHA_OFFSET k = 0; k < index->nnz; k++)
+    {
+        if (index->idx[k] < 0 || index->idx[k] >= n)
+        {
+            alpha_release(fill);
+            alpha_value_index_destroy(cross);
+            return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+        }
+        cross->ptr[index->idx[k] + 1]++;
+    }
+    for (ALPHA_INT i = 0; i < n; i++)
+        cross->ptr[i + 1] += cross->ptr[i];
+    memcpy(fill, cross->ptr, (n + 1) * sizeof(ALPHA_OFFSET));
+    // walking the major lines in order leaves every minor line sorted
+    for (ALPHA_INT i = 0; i < index->n; i++)
+    {
+        for (ALPHA_OFFSET k = index->ptr[i]; k < index->ptr[i + 1]; k++)
+        {
+            ALPHA_OFFSET dst = fill[index->idx[k]]++;
+            cross->idx[dst] = i;
+            cross->pos[dst] = index->pos[k];
+        }
+    }
+    alpha_release(fill);
+    *cross_p = cross;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+void alpha_value_index_destroy(alpha_value_index_t *index)
+{
+    if (index == NULL)
+        return;
+    alpha_release(index->ptr);
+    alpha_release(index->idx);
+    alpha_release(index->pos);
+    alpha_release(index);
+}
+
+alphasparse_inspector_t alphasparse_inspector_get(alphasparse_matrix_t A)
+{
+    if (A->inspector == NULL)
+    {
+        alphasparse_inspector_t inspector = alpha_malloc(sizeof(alphasparse_inspector));
+        inspector->value_index = NULL;
+        inspector->mapping = NULL;
+        inspector->mapping_size = 0;
+        inspector->exec_context = NULL;
+        inspector->cross_index = NULL;
+        inspector->complex_layout = ALPHA_SPARSE_COMPLEX_INTERLEAVED;
+        inspector->split_values = NULL;
+        inspector->view = false;
+        inspector->mv_tiling = ALPHA_SPARSE_MV_TILING_NONE;
+        inspector->csr_tiles = NULL;
+        inspector->value_index_mapped = false;
+        A->inspector = inspector;
+    }
+    return (alphasparse_inspector_t)A->inspector;
+}
+
+alphasparse_exec_context_t alpha_matrix_exec_context(const alphasparse_matrix_t A)
+{
+    if (A == NULL || A->inspector == NULL)
+        return NULL;
+    return ((alphasparse_inspector_t)A->inspector)->exec_context;
+}
+
+alphasparse_status_t alphasparse_inspector_lines(alphasparse_matrix_t A, const bool by_row, alpha_value_index_t **lines)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    // only the index arrays are read, their layout is the same for every datatype
+    ALPHA_INT minor_n;
+    bool row_major = true;
+    if (A->format == ALPHA_SPARSE_FORMAT_CSR)
+        minor_n = ((spmat_csr_s_t *)A->mat)->cols;
+    else if (A->format == ALPHA_SPARSE_FORMAT_CSC)
+    {
+        minor_n = ((spmat_csc_s_t *)A->mat)->rows;
+        row_major = false;
+    }
+    else if (A->format == ALPHA_SPARSE_FORMAT_COO)
+        minor_n = ((spmat_coo_s_t *)A->mat)->cols;
+    else
+        return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
+
+    alphasparse_inspector_t inspector = alphasparse_inspector_get(A);
+    if (inspector->value_index == NULL)
+    {
+        alphasparse_status_t status;
+        if (A->format == ALPHA_SPARSE_FORMAT_CSR)
+        {
+            const spmat_csr_s_t *mat = A->mat;
+            status = alpha_value_index_build_compressed(mat->rows, mat->rows_start, mat->rows_end, mat->col_indx, &inspector->value_index);
+        }
+        else if (A->format == ALPHA_SPARSE_FORMAT_CSC)
+        {
+            const spmat_csc_s_t *mat = A->mat;
+            status = alpha_value_index_build_compressed_int(mat->cols, mat->cols_start, mat->cols_end, mat->row_indx, &inspector->value_index);
+        }
+        else
+        {
+            const spmat_coo_s_t *mat = A->mat;
+            status = alpha_value_index_build_coo(mat->rows, mat->nnz, mat->row_indx, mat->col_indx, &inspector->value_index);
+        }
+        check_error_return(status);
+    }
+    if (by_row == row_major)
+    {
+        *lines = inspector->value_index;
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    }
+    if (inspector->cross_index == NULL)
+        check_error_return(alpha_value_index_build_cross(inspector->value_index, minor_n, &inspector->cross_index));
+    *lines = inspector->cross_index;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+const alpha_value_index_t *alphasparse_inspector_lines_built(const alphasparse_matrix_t A, const bool by_row)
+{
+    const alphasparse_inspector_t inspector = A->inspector;
+    if (inspector == NULL)
+        return NULL;
+    const bool row_major = A->format != ALPHA_SPARSE_FORMAT_CSC;
+    return by_row == row_major ? inspector->value_index : inspector->cross_index;
+}
+
+alphasparse_status_t alphasparse_inspector_split_values(alphasparse_matrix_t A)
+{
+    check_return(A->datatype != ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX && A->datatype != ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX,
+                 ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+    // the layout of the offsets and indices does not depend on the datatype
+    ALPHA_INT rows;
+    const ALPHA_OFFSET *rows_end;
+    const void *values;
+    ALPHA_OFFSET block = 1;
+    if (A->format == ALPHA_SPARSE_FORMAT_CSR)
+    {
+        const spmat_csr_c_t *mat = A->mat;
+        rows = mat->rows, rows_end = mat->rows_end, values = mat->values;
+    }
+    else if (A->format == ALPHA_SPARSE_FORMAT_BSR)
+    {
+        const spmat_bsr_c_t *mat = A->mat;
+        rows = mat->rows, rows_end = mat->rows_end, values = mat->values;
+        block = (ALPHA_OFFSET)mat->block_size * mat->block_size;
+    }
+    else
+        return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
+    // rows may leave gaps in the values, so the last used value bounds them
+    ALPHA_OFFSET nnz = 0;
+    for (ALPHA_INT r = 0; r < rows; r++)
+        nnz = alpha_max(nnz, rows_end[r]);
+    nnz *= block;
+
+    alphasparse_inspector_t inspector = alphasparse_inspector_get(A);
+    const bool is_double = A->datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX;
+    const size_t part = is_double ? sizeof(double) : sizeof(float);
+    alpha_split_values_t *split = inspector->split_values;
+    if (split != NULL && split->nnz != nnz)
+    {
+        alpha_split_values_destroy(split);
+        inspector->split_values = split = NULL;
+    }
+    if (split == NULL)
+    {
+        split = alpha_malloc(sizeof(alpha_split_values_t));
+        split->nnz = nnz;
+        split->real = alpha_memalign(part * (nnz > 0 ? nnz : 1), DEFAULT_ALIGNMENT);
+        split->imag = alpha_memalign(part * (nnz > 0 ? nnz : 1), DEFAULT_ALIGNMENT);
+        inspector->split_values = split;
+    }
+    if (is_double)
+    {
+        const ALPHA_Complex16 *v = values;
+        double *re = split->real, *im = split->imag;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(alpha_get_thread_num())
+#endif
+        for (ALPHA_OFFSET i = 0; i < nnz; i++)
+        {
+            re[i] = v[i].real;
+            im[i] = v[i].imag;
+        }
+    }
+    else
+    {
+        const ALPHA_Complex8 *v = values;
+        float *re = split->real, *im = split->imag;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(alpha_get_thread_num())
+#endif
+        for (ALPHA_OFFSET i = 0; i < nnz; i++)
+        {
+            re[i] = v[i].real;
+            im[i] = v[i].imag;
+        }
+    }
+    split->stale = false;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+const alpha_split_values_t *alpha_matrix_split_values(const alphasparse_matrix_t A)
+{
+    const alphasparse_inspector_t inspector = A->inspector;
+    if (inspector == NULL || inspector->split_values == NULL || inspector->split_values->stale)
+        return NULL;
+    return inspector->split_values;
+}
+
+alphasparse_status_t alphasparse_inspector_csr_tiles(alphasparse_matrix_t A)
+{
+    check_return(A->format != ALPHA_SPARSE_FORMAT_CSR, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+    // the layout of the offsets and indices does not depend on the datatype
+    const spmat_csr_s_t *mat = A->mat;
+    const size_t value_size = A->datatype == ALPHA_SPARSE_DATATYPE_FLOAT ? sizeof(float)
+                              : A->datatype == ALPHA_SPARSE_DATATYPE_DOUBLE ? sizeof(double)
+                              : A->datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX ? sizeof(ALPHA_Complex8)
+                                                                                   : sizeof(ALPHA_Complex16);
+    alphasparse_inspector_t inspector = alphasparse_inspector_get(A);
+    alpha_csr_tiles_destroy(inspector->csr_tiles);
+    inspector->csr_tiles = NULL;
+    ALPHA_INT panel_cols, block_rows;
+    alpha_csr_tiles_size(mat->rows, value_size, alpha_get_thread_num(), &panel_cols, &block_rows);
+    // x fits the cache as it is
+    if (mat->cols <= panel_cols)
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    return alpha_csr_tiles_build(mat->rows, mat->cols, mat->rows_start, mat->rows_end, mat->col_indx, mat->values, value_size,
+                                 panel_cols, block_rows, &inspector->csr_tiles);
+}
+
+const alpha_csr_tiles_t *alpha_matrix_csr_tiles(const alphasparse_matrix_t A)
+{
+    const alphasparse_inspector_t inspector = A->inspector;
+    if (inspector == NULL)
+        return NULL;
+    return inspector->csr_tiles;
+}
+
+void alphasparse_inspector_values_changed(alphasparse_matrix_t A)
+{
+    const alphasparse_inspector_t inspector = A->inspector;
+    // the pattern is unchanged, so the split parts and the tiles are copied again into the arrays they have
+    if (inspector != NULL && inspector->split_values != NULL && alphasparse_inspector_split_values(A) != ALPHA_SPARSE_STATUS_SUCCESS)
+        inspector->split_values->stale = true;
+    if (inspector != NULL && inspector->csr_tiles != NULL)
+        alpha_csr_tiles_refresh(inspector->csr_tiles, ((const spmat_csr_s_t *)A->mat)->values);
+}
+
+void alpha_split_values_destroy(alpha_split_values_t *split)
+{
+    if (split == NULL)
+        return;
+    alpha_release(split->real);
+    alpha_release(split->imag);
+    alpha_release(split);
+}
+
+void alphasparse_inspector_destroy(alphasparse_inspector_t inspector)
+{
+    if (inspector == NULL)
+        return;
+    // a loaded index lives in the mapping, only its descriptor is ours, one built later is all ours
+    if (inspector->value_index_mapped)
+        alpha_release(inspector->value_index);
+    else
+        alpha_value_index_destroy(inspector->value_index);
+    if (inspector->mapping != NULL)
+        munmap(inspector->mapping, inspector->mapping_size);
+    alpha_value_index_destroy(inspector->cross_index);
+    alpha_split_values_destroy(inspector->split_values);
+    alpha_csr_tiles_destroy(inspector->csr_tiles);
+    alpha_release(inspector);
+}
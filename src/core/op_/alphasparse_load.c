@@ -0,0 +1,154 @@
+/**
+ * @brief implement for alphasparse_load intelface
+ */
+
+#include "alphasparse.h"
+#include "alphasparse/binary.h"
+#include "alphasparse/format.h"
+#include "alphasparse/inspector.h"
+#include "alphasparse/spmat.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+alphasparse_status_t load_datatype_csr(const alpha_binary_header_t *header, alpha_internal_spmat **mat, alphasparse_datatype_t datatype)
+{
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+    {
+        return load_s_csr(header, (spmat_csr_s_t **)mat);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+    {
+        return load_d_csr(header, (spmat_csr_d_t **)mat);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+    {
+        return load_c_csr(header, (spmat_csr_c_t **)mat);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX)
+    {
+        return load_z_csr(header, (spmat_csr_z_t **)mat);
+    }
+    else
+    {
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+}
+
+alphasparse_status_t load_datatype_bsr(const alpha_binary_header_t *header, alpha_internal_spmat **mat, alphasparse_datatype_t datatype)
+{
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+    {
+        return load_s_bsr(header, (spmat_bsr_s_t **)mat);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+    {
+        return load_d_bsr(header, (spmat_bsr_d_t **)mat);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+    {
+        return load_c_bsr(header, (spmat_bsr_c_t **)mat);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX)
+    {
+        return load_z_bsr(header, (spmat_bsr_z_t **)mat);
+    }
+    else
+    {
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+}
+
+alphasparse_status_t load_datatype_format(const alpha_binary_header_t *header, alpha_internal_spmat **mat, alphasparse_datatype_t datatype, alphasparse_format_t format)
+{
+    if (format == ALPHA_SPARSE_FORMAT_CSR || format == ALPHA_SPARSE_FORMAT_CSR_PATTERN)
+    {
+        return load_datatype_csr(header, mat, datatype);
+    }
+    else if (format == ALPHA_SPARSE_FORMAT_BSR)
+    {
+        return load_datatype_bsr(header, mat, datatype);
+    }
+    else
+    {
+        return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
+    }
+}
+
+static alphasparse_status_t load_check_header(const alpha_binary_header_t *header, const size_t size)
+{
+    check_return(size < sizeof(alpha_binary_header_t), ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(memcmp(header->magic, ALPHA_BINARY_MAGIC, sizeof(header->magic)) != 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(header->version == 0 || header->version > ALPHA_BINARY_VERSION, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+    // the arrays are used in place, so the writer must have had the same layout
+    check_return(header->endian != ALPHA_BINARY_ENDIAN, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+    check_return(header->int_size != sizeof(ALPHA_INT) || header->offset_size != sizeof(ALPHA_OFFSET), ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+    check_return(header->file_size != size, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(header->rows < 0 || header->cols < 0 || header->nnz < 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+// the index sections are optional, a handle without them builds its index on first use
+static alpha_value_index_t *load_value_index(const alpha_binary_header_t *header)
+{
+    const ALPHA_INT n = (ALPHA_INT)header->rows;
+    const ALPHA_OFFSET nnz = (ALPHA_OFFSET)header->nnz;
+    ALPHA_OFFSET *ptr = alpha_binary_section(header, ALPHA_BINARY_SECTION_INDEX_PTR, (n + 1) * sizeof(ALPHA_OFFSET));
+    ALPHA_INT *idx = alpha_binary_section(header, ALPHA_BINARY_SECTION_INDEX_IDX, nnz * sizeof(ALPHA_INT));
+    ALPHA_OFFSET *pos = alpha_binary_section(header, ALPHA_BINARY_SECTION_INDEX_POS, nnz * sizeof(ALPHA_OFFSET));
+    if (ptr == NULL || idx == NULL || pos == NULL)
+        return NULL;
+    alpha_value_index_t *index = alpha_malloc(sizeof(alpha_value_index_t));
+    index->n = n;
+    index->nnz = nnz;
+    index->ptr = ptr;
+    index->idx = idx;
+    index->pos = pos;
+    return index;
+}
+
+alphasparse_status_t alphasparse_load(const char *file, alphasparse_matrix_t *A)
+{
+    check_null_return(file, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_null_return(A, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    int fd = open(file, O_RDONLY);
+    check_return(fd < 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(alpha_binary_header_t))
+    {
+        close(fd);
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+    // private writable mapping, in place updates such as update_values never reach the file
+    void *mapping = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    check_return(mapping == MAP_FAILED, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+
+    const alpha_binary_header_t *header = (const alpha_binary_header_t *)mapping;
+    alpha_internal_spmat *mat = NULL;
+    alphasparse_status_t status = load_check_header(header, st.st_size);
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS)
+        status = load_datatype_format(header, &mat, header->datatype, header->format);
+    if (status != ALPHA_SPARSE_STATUS_SUCCESS)
+    {
+        munmap(mapping, st.st_size);
+        return status;
+    }
+
+    alphasparse_matrix *A_ = alpha_malloc(sizeof(alphasparse_matrix));
+    A_->format = header->format;
+    A_->datatype = header->datatype;
+    A_->mat = mat;
+    A_->inspector = NULL;
+    A_->dcu_info = NULL;
+    // the inspector owns the mapping and releases it in alphasparse_destroy
+    alphasparse_inspector_t inspector = alphasparse_inspector_get(A_);
+    inspector->mapping = mapping;
+    inspector->mapping_size = st.st_size;
+    inspector->value_index = load_value_index(header);
+    inspector->value_index_mapped = inspector->value_index != NULL;
+    *A = A_;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
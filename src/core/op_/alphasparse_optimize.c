@@ -0,0 +1,56 @@
+/**
+ * @brief implement for the optimization hints and alphasparse_optimize
+ */
+
+#include "alphasparse.h"
+#include "alphasparse/inspector.h"
+
+alphasparse_status_t alphasparse_set_complex_layout_hint(const alphasparse_matrix_t A, const alphasparse_complex_layout_t layout)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(layout != ALPHA_SPARSE_COMPLEX_INTERLEAVED && layout != ALPHA_SPARSE_COMPLEX_SPLIT, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    if (layout == ALPHA_SPARSE_COMPLEX_SPLIT)
+    {
+        check_return(A->datatype != ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX && A->datatype != ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX,
+                     ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+        check_return(A->format != ALPHA_SPARSE_FORMAT_CSR && A->format != ALPHA_SPARSE_FORMAT_BSR, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+    }
+    alphasparse_inspector_get(A)->complex_layout = layout;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_set_mv_tiling_hint(const alphasparse_matrix_t A, const alphasparse_mv_tiling_t tiling)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(tiling != ALPHA_SPARSE_MV_TILING_NONE && tiling != ALPHA_SPARSE_MV_TILING_2D, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    if (tiling == ALPHA_SPARSE_MV_TILING_2D)
+        check_return(A->format != ALPHA_SPARSE_FORMAT_CSR, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+    alphasparse_inspector_get(A)->mv_tiling = tiling;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_optimize(alphasparse_matrix_t A)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    alphasparse_inspector_t inspector = (alphasparse_inspector_t)A->inspector;
+    if (inspector == NULL)
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    if (inspector->complex_layout == ALPHA_SPARSE_COMPLEX_SPLIT)
+    {
+        check_error_return(alphasparse_inspector_split_values(A));
+    }
+    else
+    {
+        // back to the interleaved values alone
+        alpha_split_values_destroy(inspector->split_values);
+        inspector->split_values = NULL;
+    }
+    if (inspector->mv_tiling == ALPHA_SPARSE_MV_TILING_2D)
+        return alphasparse_inspector_csr_tiles(A);
+    alpha_csr_tiles_destroy(inspector->csr_tiles);
+    inspector->csr_tiles = NULL;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
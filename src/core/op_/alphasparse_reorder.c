@@ -0,0 +1,91 @@
+/**
+ * @brief implement for alphasparse_reorder intelface
+ */
+
+#include "alphasparse.h"
+#include "alphasparse/format.h"
+#include "alphasparse/spmat.h"
+#include "alphasparse/util/reorder.h"
+#include <stdlib.h>
+
+// the CSR arrays are at the same place for every datatype
+static void csr_structure_datatype(const alpha_internal_spmat *mat, alphasparse_datatype_t datatype,
+                                   ALPHA_INT *rows, ALPHA_INT *cols,
+                                   const ALPHA_OFFSET **rows_start, const ALPHA_OFFSET **rows_end, const ALPHA_INT **col_indx)
+{
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+    {
+        const spmat_csr_s_t *A = (const spmat_csr_s_t *)mat;
+        *rows = A->rows, *cols = A->cols, *rows_start = A->rows_start, *rows_end = A->rows_end, *col_indx = A->col_indx;
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+    {
+        const spmat_csr_d_t *A = (const spmat_csr_d_t *)mat;
+        *rows = A->rows, *cols = A->cols, *rows_start = A->rows_start, *rows_end = A->rows_end, *col_indx = A->col_indx;
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+    {
+        const spmat_csr_c_t *A = (const spmat_csr_c_t *)mat;
+        *rows = A->rows, *cols = A->cols, *rows_start = A->rows_start, *rows_end = A->rows_end, *col_indx = A->col_indx;
+    }
+    else
+    {
+        const spmat_csr_z_t *A = (const spmat_csr_z_t *)mat;
+        *rows = A->rows, *cols = A->cols, *rows_start = A->rows_start, *rows_end = A->rows_end, *col_indx = A->col_indx;
+    }
+}
+
+alphasparse_status_t alphasparse_reorder(const alphasparse_matrix_t A,
+                                       const alphasparse_reorder_t ordering,
+                                       const bool symmetric,
+                                       ALPHA_INT *perm,
+                                       ALPHA_INT *iperm,
+                                       alphasparse_matrix_t *B)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(perm, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(ordering < ALPHA_SPARSE_REORDER_RCM || ordering > ALPHA_SPARSE_REORDER_GORDER, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(A->format != ALPHA_SPARSE_FORMAT_CSR && A->format != ALPHA_SPARSE_FORMAT_CSR_PATTERN, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+    check_return(A->datatype < ALPHA_SPARSE_DATATYPE_FLOAT || A->datatype > ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    ALPHA_INT rows, cols;
+    const ALPHA_OFFSET *rows_start, *rows_end;
+    const ALPHA_INT *col_indx;
+    csr_structure_datatype((const alpha_internal_spmat *)A->mat, A->datatype, &rows, &cols, &rows_start, &rows_end, &col_indx);
+    check_return((symmetric || ordering != ALPHA_SPARSE_REORDER_DEGREE) && rows != cols, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    alphasparse_status_t status;
+    if (ordering == ALPHA_SPARSE_REORDER_DEGREE && !symmetric)
+    {
+        // only the rows move, their own lengths order them
+        check_error_return(alpha_reorder_degree(rows, rows_start, rows_end, perm));
+    }
+    else
+    {
+        ALPHA_OFFSET *ptr;
+        ALPHA_INT *idx;
+        check_error_return(alpha_reorder_graph(rows, rows_start, rows_end, col_indx, &ptr, &idx));
+        if (ordering == ALPHA_SPARSE_REORDER_RCM)
+            status = alpha_reorder_rcm(rows, ptr, idx, perm);
+        else if (ordering == ALPHA_SPARSE_REORDER_DEGREE)
+            status = alpha_reorder_degree(rows, ptr, ptr + 1, perm);
+        else
+            status = alpha_reorder_gorder(rows, ptr, idx, ALPHA_REORDER_GORDER_WINDOW, perm);
+        free(ptr);
+        free(idx);
+        check_error_return(status);
+    }
+
+    if (iperm != NULL)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(alpha_get_thread_num())
+#endif
+        for (ALPHA_INT i = 0; i < rows; i++)
+            iperm[perm[i]] = i;
+    }
+    if (B == NULL)
+        return ALPHA_SPARSE_STATUS_SUCCESS;
+    return alphasparse_permute(A, perm, symmetric ? perm : NULL, B);
+}
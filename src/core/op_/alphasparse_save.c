@@ -0,0 +1,127 @@
+/**
+ * @brief implement for alphasparse_save intelface
+ */
+
+#include "alphasparse.h"
+#include "alphasparse/binary.h"
+#include "alphasparse/format.h"
+#include "alphasparse/inspector.h"
+#include "alphasparse/spmat.h"
+#include <stdio.h>
+#include <string.h>
+
+alphasparse_status_t save_datatype_csr(const alpha_internal_spmat *mat, FILE *fp, alpha_binary_header_t *header, alphasparse_datatype_t datatype)
+{
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+    {
+        return save_s_csr((const spmat_csr_s_t *)mat, fp, header);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+    {
+        return save_d_csr((const spmat_csr_d_t *)mat, fp, header);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+    {
+        return save_c_csr((const spmat_csr_c_t *)mat, fp, header);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX)
+    {
+        return save_z_csr((const spmat_csr_z_t *)mat, fp, header);
+    }
+    else
+    {
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+}
+
+alphasparse_status_t save_datatype_bsr(const alpha_internal_spmat *mat, FILE *fp, alpha_binary_header_t *header, alphasparse_datatype_t datatype)
+{
+    if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+    {
+        return save_s_bsr((const spmat_bsr_s_t *)mat, fp, header);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+    {
+        return save_d_bsr((const spmat_bsr_d_t *)mat, fp, header);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+    {
+        return save_c_bsr((const spmat_bsr_c_t *)mat, fp, header);
+    }
+    else if (datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX)
+    {
+        return save_z_bsr((const spmat_bsr_z_t *)mat, fp, header);
+    }
+    else
+    {
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+}
+
+alphasparse_status_t save_datatype_format(const alpha_internal_spmat *mat, FILE *fp, alpha_binary_header_t *header, alphasparse_datatype_t datatype, alphasparse_format_t format)
+{
+    if (format == ALPHA_SPARSE_FORMAT_CSR || format == ALPHA_SPARSE_FORMAT_CSR_PATTERN)
+    {
+        return save_datatype_csr(mat, fp, header, datatype);
+    }
+    else if (format == ALPHA_SPARSE_FORMAT_BSR)
+    {
+        return save_datatype_bsr(mat, fp, header, datatype);
+    }
+    else
+    {
+        return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// the value index is saved as is, it refers to stored positions and needs no rebuild on load
+static alphasparse_status_t save_value_index(const alpha_value_index_t *index, FILE *fp, alpha_binary_header_t *header)
+{
+    alphasparse_status_t status = alpha_binary_write_section(fp, header, ALPHA_BINARY_SECTION_INDEX_PTR, index->ptr, (index->n + 1) * sizeof(ALPHA_OFFSET));
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS)
+        status = alpha_binary_write_section(fp, header, ALPHA_BINARY_SECTION_INDEX_IDX, index->idx, index->nnz * sizeof(ALPHA_INT));
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS)
+        status = alpha_binary_write_section(fp, header, ALPHA_BINARY_SECTION_INDEX_POS, index->pos, index->nnz * sizeof(ALPHA_OFFSET));
+    return status;
+}
+
+alphasparse_status_t alphasparse_save(const alphasparse_matrix_t A, const char *file)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(file, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(A->format != ALPHA_SPARSE_FORMAT_CSR && A->format != ALPHA_SPARSE_FORMAT_CSR_PATTERN && A->format != ALPHA_SPARSE_FORMAT_BSR,
+                 ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+
+    FILE *fp = fopen(file, "wb");
+    check_null_return(fp, ALPHA_SPARSE_STATUS_EXECUTION_FAILED);
+    alpha_binary_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ALPHA_BINARY_MAGIC, sizeof(header.magic));
+    header.version = ALPHA_BINARY_VERSION;
+    header.endian = ALPHA_BINARY_ENDIAN;
+    header.int_size = sizeof(ALPHA_INT);
+    header.offset_size = sizeof(ALPHA_OFFSET);
+    header.format = A->format;
+    header.datatype = A->datatype;
+
+    // header is rewritten once the section offsets are known
+    alphasparse_status_t status = ALPHA_SPARSE_STATUS_SUCCESS;
+    if (fwrite(&header, sizeof(header), 1, fp) != 1)
+        status = ALPHA_SPARSE_STATUS_EXECUTION_FAILED;
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS)
+        status = save_datatype_format(A->mat, fp, &header, A->datatype, A->format);
+    alphasparse_inspector_t inspector = (alphasparse_inspector_t)A->inspector;
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS && inspector != NULL && inspector->value_index != NULL && !(header.flags & ALPHA_BINARY_FLAG_REPACKED))
+        status = save_value_index(inspector->value_index, fp, &header);
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS)
+    {
+        long size = ftell(fp);
+        header.file_size = size < 0 ? 0 : (uint64_t)size;
+        if (size < 0 || fseek(fp, 0, SEEK_SET) != 0 || fwrite(&header, sizeof(header), 1, fp) != 1)
+            status = ALPHA_SPARSE_STATUS_EXECUTION_FAILED;
+    }
+    if (fclose(fp) != 0 && status == ALPHA_SPARSE_STATUS_SUCCESS)
+        status = ALPHA_SPARSE_STATUS_EXECUTION_FAILED;
+    return status;
+}
@@ -7,6 +7,7 @@
 #include "alphasparse/opt.h"
 #include "alphasparse/spapi.h"
 #include "alphasparse/kernel.h"
+#include "alphasparse/inspector.h"
 
 static alphasparse_status_t (*spmm_s_csr_operation[])(const spmat_csr_s_t *A,
                                               const spmat_csr_s_t *B,
@@ -116,13 +117,40 @@ alphasparse_status_t (*spmm_z_bsr_operation[])(const spmat_bsr_z_t *A,
     spmm_z_bsr_conj, 
 };
 
-alphasparse_status_t alphasparse_spmm(const alphasparse_operation_t operation, const alphasparse_matrix_t A, const alphasparse_matrix_t B, alphasparse_matrix_t *C)
+// at least one operand is pattern-only, its stored entries multiply as ones and C carries values
+static alphasparse_status_t spmm_pattern(const alphasparse_operation_t operation, const alphasparse_matrix_t A, const alphasparse_matrix_t B, alphasparse_matrix_t *C)
+{
+    check_return(operation != ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+    check_return(A->format != ALPHA_SPARSE_FORMAT_CSR && A->format != ALPHA_SPARSE_FORMAT_CSR_PATTERN, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+    check_return(B->format != ALPHA_SPARSE_FORMAT_CSR && B->format != ALPHA_SPARSE_FORMAT_CSR_PATTERN, ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+
+    alphasparse_matrix* CC = alpha_malloc(sizeof(alphasparse_matrix));
+    *C = CC;
+    CC->inspector = NULL;
+    CC->datatype = A->datatype;
+    CC->format = ALPHA_SPARSE_FORMAT_CSR;
+
+    if (A->datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+        return spmm_s_csr_pattern((const spmat_csr_s_t *)A->mat, (const spmat_csr_s_t *)B->mat, (spmat_csr_s_t **)&CC->mat);
+    else if (A->datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+        return spmm_d_csr_pattern((const spmat_csr_d_t *)A->mat, (const spmat_csr_d_t *)B->mat, (spmat_csr_d_t **)&CC->mat);
+    else if (A->datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+        return spmm_c_csr_pattern((const spmat_csr_c_t *)A->mat, (const spmat_csr_c_t *)B->mat, (spmat_csr_c_t **)&CC->mat);
+    else if (A->datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX)
+        return spmm_z_csr_pattern((const spmat_csr_z_t *)A->mat, (const spmat_csr_z_t *)B->mat, (spmat_csr_z_t **)&CC->mat);
+    else
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+}
+
+static alphasparse_status_t spmm_dispatch(const alphasparse_operation_t operation, const alphasparse_matrix_t A, const alphasparse_matrix_t B, alphasparse_matrix_t *C)
 {
     check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
     check_null_return(B->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
     check_null_return(C, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
 
     check_return(A->datatype != B->datatype, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    if (A->format == ALPHA_SPARSE_FORMAT_CSR_PATTERN || B->format == ALPHA_SPARSE_FORMAT_CSR_PATTERN)
+        return spmm_pattern(operation, A, B, C);
     check_return(A->format != B->format, ALPHA_SPARSE_STATUS_INVALID_VALUE);
 
     // // check if colA == rowB
@@ -133,6 +161,7 @@ alphasparse_status_t alphasparse_spmm(const alphasparse_operation_t operation, c
 
     alphasparse_matrix* CC = alpha_malloc(sizeof(alphasparse_matrix));
     *C = CC;
+    CC->inspector = NULL;
 
     CC->datatype = A->datatype;
     CC->format = A->format;
@@ -240,3 +269,13 @@ alphasparse_status_t alphasparse_spmm(const alphasparse_operation_t operation, c
     }
     return ALPHA_SPARSE_STATUS_INVALID_VALUE;
 }
+
+alphasparse_status_t alphasparse_spmm(const alphasparse_operation_t operation, const alphasparse_matrix_t A, const alphasparse_matrix_t B, alphasparse_matrix_t *C)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    alpha_exec_scope_t scope;
+    alpha_exec_enter(&scope, alpha_matrix_exec_context(A));
+    const alphasparse_status_t status = spmm_dispatch(operation, A, B, C);
+    alpha_exec_leave(&scope);
+    return status;
+}
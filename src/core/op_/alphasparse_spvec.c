@@ -0,0 +1,144 @@
+/**
+ * @brief implement for sparse vectors and the generic sparse vector and spmv routines
+ */
+
+#include "alphasparse.h"
+#include "alphasparse/spvec.h"
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include <stdlib.h>
+
+alphasparse_status_t alphasparse_create_spvec(alphasparse_spvec_t *x,
+                                            const alphasparse_datatype_t datatype,
+                                            const alphasparse_index_base_t indexing,
+                                            const ALPHA_INT size,
+                                            const ALPHA_INT nnz,
+                                            ALPHA_INT *indx,
+                                            void *values)
+{
+    check_null_return(x, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(datatype != ALPHA_SPARSE_DATATYPE_FLOAT && datatype != ALPHA_SPARSE_DATATYPE_DOUBLE &&
+                     datatype != ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX && datatype != ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX,
+                 ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(indexing != ALPHA_SPARSE_INDEX_BASE_ZERO && indexing != ALPHA_SPARSE_INDEX_BASE_ONE, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(size < 0 || nnz < 0 || nnz > size, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(nnz > 0 && (indx == NULL || values == NULL), ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    struct alpha_spvec *vec = malloc(sizeof(struct alpha_spvec));
+    check_null_return(vec, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+    vec->datatype = datatype;
+    vec->indexing = indexing;
+    vec->size = size;
+    vec->nnz = nnz;
+    vec->indx = indx;
+    vec->values = values;
+    vec->owned = false;
+    *x = vec;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_destroy_spvec(alphasparse_spvec_t x)
+{
+    check_null_return(x, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    if (x->owned)
+    {
+        free(x->indx);
+        free(x->values);
+    }
+    free(x);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_export_spvec(const alphasparse_spvec_t x,
+                                            alphasparse_index_base_t *indexing,
+                                            ALPHA_INT *size,
+                                            ALPHA_INT *nnz,
+                                            ALPHA_INT **indx,
+                                            void **values)
+{
+    check_null_return(x, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(indexing == NULL || size == NULL || nnz == NULL || indx == NULL || values == NULL, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    *indexing = x->indexing;
+    *size = x->size;
+    *nnz = x->nnz;
+    *indx = x->indx;
+    *values = x->values;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_spvv(const alphasparse_operation_t operation,
+                                    const alphasparse_spvec_t x,
+                                    const void *y,
+                                    void *result)
+{
+    check_null_return(x, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(y == NULL || result == NULL, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    switch (x->datatype)
+    {
+    case ALPHA_SPARSE_DATATYPE_FLOAT: return spvec_s_dot(operation, x, y, result);
+    case ALPHA_SPARSE_DATATYPE_DOUBLE: return spvec_d_dot(operation, x, y, result);
+    case ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX: return spvec_c_dot(operation, x, y, result);
+    default: return spvec_z_dot(operation, x, y, result);
+    }
+}
+
+alphasparse_status_t alphasparse_axpby(const void *alpha,
+                                     const alphasparse_spvec_t x,
+                                     const void *beta,
+                                     void *y)
+{
+    check_null_return(x, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(alpha == NULL || beta == NULL || y == NULL, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    switch (x->datatype)
+    {
+    case ALPHA_SPARSE_DATATYPE_FLOAT: return spvec_s_axpby(*(const float *)alpha, x, *(const float *)beta, y);
+    case ALPHA_SPARSE_DATATYPE_DOUBLE: return spvec_d_axpby(*(const double *)alpha, x, *(const double *)beta, y);
+    case ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX: return spvec_c_axpby(*(const ALPHA_Complex8 *)alpha, x, *(const ALPHA_Complex8 *)beta, y);
+    default: return spvec_z_axpby(*(const ALPHA_Complex16 *)alpha, x, *(const ALPHA_Complex16 *)beta, y);
+    }
+}
+
+alphasparse_status_t alphasparse_gather(const void *y, alphasparse_spvec_t x)
+{
+    check_null_return(x, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(y, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    switch (x->datatype)
+    {
+    case ALPHA_SPARSE_DATATYPE_FLOAT: return spvec_s_gather(y, x);
+    case ALPHA_SPARSE_DATATYPE_DOUBLE: return spvec_d_gather(y, x);
+    case ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX: return spvec_c_gather(y, x);
+    default: return spvec_z_gather(y, x);
+    }
+}
+
+alphasparse_status_t alphasparse_scatter(const alphasparse_spvec_t x, void *y)
+{
+    check_null_return(x, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(y, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    switch (x->datatype)
+    {
+    case ALPHA_SPARSE_DATATYPE_FLOAT: return spvec_s_scatter(x, y);
+    case ALPHA_SPARSE_DATATYPE_DOUBLE: return spvec_d_scatter(x, y);
+    case ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX: return spvec_c_scatter(x, y);
+    default: return spvec_z_scatter(x, y);
+    }
+}
+
+alphasparse_status_t alphasparse_spmv(const alphasparse_operation_t operation,
+                                    const void *alpha,
+                                    const alphasparse_matrix_t A,
+                                    const struct alpha_matrix_descr descr,
+                                    const void *x,
+                                    const void *beta,
+                                    void *y)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(alpha == NULL || beta == NULL, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    // the typed routine dispatches on the format
+    switch (A->datatype)
+    {
+    case ALPHA_SPARSE_DATATYPE_FLOAT: return alphasparse_s_mv(operation, *(const float *)alpha, A, descr, x, *(const float *)beta, y);
+    case ALPHA_SPARSE_DATATYPE_DOUBLE: return alphasparse_d_mv(operation, *(const double *)alpha, A, descr, x, *(const double *)beta, y);
+    case ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX: return alphasparse_c_mv(operation, *(const ALPHA_Complex8 *)alpha, A, descr, x, *(const ALPHA_Complex8 *)beta, y);
+    default: return alphasparse_z_mv(operation, *(const ALPHA_Complex16 *)alpha, A, descr, x, *(const ALPHA_Complex16 *)beta, y);
+    }
+}
@@ -0,0 +1,19 @@
+/**
+ * @brief implement for the load balance statistics of the work-stealing kernels
+ */
+
+#include "alphasparse.h"
+#include "alphasparse/util.h"
+
+alphasparse_status_t alphasparse_get_steal_stats(alphasparse_steal_stats_t *stats)
+{
+    check_null_return(stats, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    alpha_steal_stats(stats);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_reset_steal_stats()
+{
+    alpha_steal_stats_reset();
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
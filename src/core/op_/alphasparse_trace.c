@@ -0,0 +1,277 @@
+/**
+ * @brief implement for verbose mode, per-call tracing into a ring buffer
+ */
+
+#include "alphasparse.h"
+#include "alphasparse/trace.h"
+#include <stdio.h>
+#include <string.h>
+
+alpha_verbose_mode_t alpha_verbose = ALPHA_SPARSE_VERBOSE_OFF;
+
+// ring buffer, appended under the trace critical section
+static alphasparse_trace_record_t trace_records[ALPHA_SPARSE_TRACE_CAPACITY];
+static ALPHA_INT64 trace_seq = 0;
+
+// kernel time of each thread for the traced call in flight on the calling thread, negative when not reported
+static _Thread_local double trace_thread_times[ALPHA_SPARSE_TRACE_MAX_THREADS];
+
+_Thread_local const char *alpha_trace_path = "";
+// counter measurement of the traced call in flight on the calling thread
+static _Thread_local unsigned trace_perf_generation;
+
+static const char *format_name(const alphasparse_format_t format)
+{
+    switch (format)
+    {
+    case ALPHA_SPARSE_FORMAT_COO: return "coo";
+    case ALPHA_SPARSE_FORMAT_CSR: return "csr";
+    case ALPHA_SPARSE_FORMAT_CSC: return "csc";
+    case ALPHA_SPARSE_FORMAT_BSR: return "bsr";
+    case ALPHA_SPARSE_FORMAT_SKY: return "sky";
+    case ALPHA_SPARSE_FORMAT_DIA: return "dia";
+    case ALPHA_SPARSE_FORMAT_ELL: return "ell";
+    case ALPHA_SPARSE_FORMAT_GEBSR: return "gebsr";
+    case ALPHA_SPARSE_FORMAT_HYB: return "hyb";
+    case ALPHA_SPARSE_FORMAT_COO_AOS: return "coo_aos";
+    case ALPHA_SPARSE_FORMAT_CSR5: return "csr5";
+    case ALPHA_SPARSE_FORMAT_COO_PATTERN: return "coo_pattern";
+    case ALPHA_SPARSE_FORMAT_CSR_PATTERN: return "csr_pattern";
+    case ALPHA_SPARSE_FORMAT_CSC_PATTERN: return "csc_pattern";
+    case ALPHA_SPARSE_FORMAT_DIA_CSR: return "dia_csr";
+    default: return "unknown";
+    }
+}
+
+static const char *datatype_name(const alphasparse_datatype_t datatype)
+{
+    switch (datatype)
+    {
+    case ALPHA_SPARSE_DATATYPE_FLOAT: return "s";
+    case ALPHA_SPARSE_DATATYPE_DOUBLE: return "d";
+    case ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX: return "c";
+    case ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX: return "z";
+    default: return "unknown";
+    }
+}
+
+static size_t datatype_size(const alphasparse_datatype_t datatype)
+{
+    switch (datatype)
+    {
+    case ALPHA_SPARSE_DATATYPE_FLOAT: return sizeof(float);
+    case ALPHA_SPARSE_DATATYPE_DOUBLE: return sizeof(double);
+    case ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX: return sizeof(ALPHA_Complex8);
+    default: return sizeof(ALPHA_Complex16);
+    }
+}
+
+/*
+* Kernel names follow the dispatch tables of the op files:
+* {ge,sy,her,tr,diag}{mv,mm} and {tr,diag}{sv,sm}, then the format, the
+* n/u diagonal and lo/hi fill for structured types, row/col layout for the
+* level 3 ops and the trans/conj suffix.
+*/
+static void kernel_name(char *name, const size_t size, const alpha_trace_op_t op, const alphasparse_format_t format, const char *path,
+                        const alphasparse_operation_t operation, const struct alpha_matrix_descr descr, const alphasparse_layout_t layout)
+{
+    static const char *const mv_prefix[] = {"ge", "sy", "her", "tr", "diag", "tr", "diag"};
+    static const char *const op_name[] = {"mv", "sv", "mm", "sm"};
+    const char *prefix = (unsigned)descr.type < sizeof(mv_prefix) / sizeof(mv_prefix[0]) ? mv_prefix[descr.type] : "ge";
+    if (op == ALPHA_TRACE_SV || op == ALPHA_TRACE_SM)
+        prefix = descr.type == ALPHA_SPARSE_MATRIX_TYPE_DIAGONAL ? "diag" : "tr";
+
+    int len = snprintf(name, size, "%s%s_%s%s", prefix, op_name[op], format_name(format), path);
+    if (descr.type != ALPHA_SPARSE_MATRIX_TYPE_GENERAL || op == ALPHA_TRACE_SV || op == ALPHA_TRACE_SM)
+    {
+        len += snprintf(name + len, size - len, "_%s", descr.diag == ALPHA_SPARSE_DIAG_UNIT ? "u" : "n");
+        if (descr.type != ALPHA_SPARSE_MATRIX_TYPE_DIAGONAL)
+            len += snprintf(name + len, size - len, "_%s", descr.mode == ALPHA_SPARSE_FILL_MODE_UPPER ? "hi" : "lo");
+    }
+    if (op == ALPHA_TRACE_MM || op == ALPHA_TRACE_SM)
+        len += snprintf(name + len, size - len, "_%s", layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR ? "row" : "col");
+    if (operation == ALPHA_SPARSE_OPERATION_TRANSPOSE)
+        snprintf(name + len, size - len, "_trans");
+    else if (operation == ALPHA_SPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+        snprintf(name + len, size - len, "_conj");
+}
+
+double alpha_trace_begin()
+{
+    if (alpha_verbose == ALPHA_SPARSE_VERBOSE_EXTENDED)
+        for (int i = 0; i < ALPHA_SPARSE_TRACE_MAX_THREADS; i++)
+            trace_thread_times[i] = -1.;
+    alpha_trace_path = "";
+    // counters are read in parallel regions of their own, outside the timed span
+    trace_perf_generation = alpha_perf_begin(alpha_get_thread_num());
+    return alpha_timing_wtime();
+}
+
+double *alpha_trace_thread_times()
+{
+    return alpha_verbose == ALPHA_SPARSE_VERBOSE_EXTENDED ? trace_thread_times : NULL;
+}
+
+void alpha_trace_end(const alpha_trace_op_t op,
+                     const alphasparse_matrix_t A,
+                     const alphasparse_operation_t operation,
+                     const struct alpha_matrix_descr descr,
+                     const alphasparse_layout_t layout,
+                     const ALPHA_INT columns,
+                     const alphasparse_status_t status,
+                     const double start)
+{
+    alphasparse_trace_record_t record;
+    memset(&record, 0, sizeof(record));
+    record.time = alpha_timing_wtime() - start;
+    alpha_perf_end(alpha_get_thread_num(), trace_perf_generation, &record.counters);
+    record.status = status;
+    record.columns = columns;
+    record.thread_num = alpha_get_thread_num();
+    if (A != NULL && A->mat != NULL)
+    {
+        record.format = A->format;
+        record.datatype = A->datatype;
+        if (A->datatype == ALPHA_SPARSE_DATATYPE_FLOAT)
+            trace_s_shape(A->format, A->mat, &record.rows, &record.cols, &record.nnz);
+        else if (A->datatype == ALPHA_SPARSE_DATATYPE_DOUBLE)
+            trace_d_shape(A->format, A->mat, &record.rows, &record.cols, &record.nnz);
+        else if (A->datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX)
+            trace_c_shape(A->format, A->mat, &record.rows, &record.cols, &record.nnz);
+        else
+            trace_z_shape(A->format, A->mat, &record.rows, &record.cols, &record.nnz);
+    }
+    const char *path = status == ALPHA_SPARSE_STATUS_SUCCESS ? alpha_trace_path : "";
+    kernel_name(record.kernel, sizeof(record.kernel), op, record.format, path, operation, descr, layout);
+
+    if (status == ALPHA_SPARSE_STATUS_SUCCESS && record.time > 0)
+    {
+        const bool complex = record.datatype == ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX || record.datatype == ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX;
+        const double value = (double)datatype_size(record.datatype);
+        const double flops = (complex ? 8. : 2.) * record.nnz * columns;
+        const ALPHA_INT x_len = operation == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE ? record.cols : record.rows;
+        const ALPHA_INT y_len = operation == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE ? record.rows : record.cols;
+        const double bytes = record.nnz * (value + sizeof(ALPHA_INT)) + (record.rows + 1.) * sizeof(ALPHA_OFFSET) +
+                             (double)columns * (x_len + 2. * y_len) * value;
+        record.gflops = flops / record.time * 1e-9;
+        record.gbytes = bytes / record.time * 1e-9;
+    }
+
+    if (alpha_verbose == ALPHA_SPARSE_VERBOSE_EXTENDED)
+    {
+        double sum = 0.;
+        for (int i = 0; i < ALPHA_SPARSE_TRACE_MAX_THREADS; i++)
+        {
+            const double t = trace_thread_times[i];
+            if (t < 0.)
+                continue;
+            if (record.thread_count == 0 || t < record.thread_min)
+                record.thread_min = t;
+            if (record.thread_count == 0 || t > record.thread_max)
+                record.thread_max = t;
+            sum += t;
+            record.thread_count++;
+        }
+        if (record.thread_count > 0)
+            record.thread_mean = sum / record.thread_count;
+    }
+
+#ifdef _OPENMP
+#pragma omp critical(alpha_trace)
+#endif
+    {
+        record.seq = trace_seq;
+        trace_records[trace_seq % ALPHA_SPARSE_TRACE_CAPACITY] = record;
+        trace_seq++;
+    }
+}
+
+alphasparse_status_t alphasparse_set_verbose_mode(alpha_verbose_mode_t verbose)
+{
+    check_return(verbose != ALPHA_SPARSE_VERBOSE_OFF && verbose != ALPHA_SPARSE_VERBOSE_BASIC && verbose != ALPHA_SPARSE_VERBOSE_EXTENDED,
+                 ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    alpha_verbose = verbose;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_set_trace_counters(const bool enable)
+{
+    check_return(!alpha_perf_enable(enable), ALPHA_SPARSE_STATUS_NOT_SUPPORTED);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_trace_size(ALPHA_INT *size)
+{
+    check_null_return(size, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+#ifdef _OPENMP
+#pragma omp critical(alpha_trace)
+#endif
+    *size = trace_seq < ALPHA_SPARSE_TRACE_CAPACITY ? (ALPHA_INT)trace_seq : ALPHA_SPARSE_TRACE_CAPACITY;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alphasparse_trace_get(const ALPHA_INT index, alphasparse_trace_record_t *record)
+{
+    check_null_return(record, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    alphasparse_status_t status = ALPHA_SPARSE_STATUS_SUCCESS;
+#ifdef _OPENMP
+#pragma omp critical(alpha_trace)
+#endif
+    {
+        const ALPHA_INT64 held = trace_seq < ALPHA_SPARSE_TRACE_CAPACITY ? trace_seq : ALPHA_SPARSE_TRACE_CAPACITY;
+        if (index < 0 || index >= held)
+            status = ALPHA_SPARSE_STATUS_INVALID_VALUE;
+        else
+            *record = trace_records[(trace_seq - held + index) % ALPHA_SPARSE_TRACE_CAPACITY];
+    }
+    return status;
+}
+
+alphasparse_status_t alphasparse_trace_clear()
+{
+#ifdef _OPENMP
+#pragma omp critical(alpha_trace)
+#endif
+    trace_seq = 0;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+static void dump_record(FILE *fp, const alphasparse_trace_record_t *r)
+{
+    fprintf(fp, "{\"seq\":%lld,\"kernel\":\"%s\",\"format\":\"%s\",\"datatype\":\"%s\",\"status\":%d,", (long long)r->seq, r->kernel,
+            format_name(r->format), datatype_name(r->datatype), (int)r->status);
+    fprintf(fp, "\"rows\":%lld,\"cols\":%lld,\"columns\":%lld,\"nnz\":%lld,\"thread_num\":%d,", (long long)r->rows, (long long)r->cols,
+            (long long)r->columns, (long long)r->nnz, r->thread_num);
+    fprintf(fp, "\"time\":%.9e,\"gflops\":%.6f,\"gbytes\":%.6f", r->time, r->gflops, r->gbytes);
+    if (r->thread_count > 0)
+        fprintf(fp, ",\"thread_count\":%d,\"thread_min\":%.9e,\"thread_mean\":%.9e,\"thread_max\":%.9e", r->thread_count, r->thread_min,
+                r->thread_mean, r->thread_max);
+    for (int e = 0; e < ALPHA_PERF_EVENT_NUM; e++)
+        if (r->counters.value[e] >= 0)
+            fprintf(fp, ",\"%s\":%lld", alpha_perf_event_name[e], (long long)r->counters.value[e]);
+    fprintf(fp, "}");
+}
+
+alphasparse_status_t alphasparse_trace_dump_json(const char *file)
+{
+    FILE *fp = file == NULL ? stdout : fopen(file, "w");
+    check_null_return(fp, ALPHA_SPARSE_STATUS_EXECUTION_FAILED);
+    ALPHA_INT size;
+    alphasparse_trace_size(&size);
+    fprintf(fp, "[");
+    for (ALPHA_INT i = 0; i < size; i++)
+    {
+        alphasparse_trace_record_t record;
+        if (alphasparse_trace_get(i, &record) != ALPHA_SPARSE_STATUS_SUCCESS)
+            break;
+        fprintf(fp, i == 0 ? "\n  " : ",\n  ");
+        dump_record(fp, &record);
+    }
+    fprintf(fp, "\n]\n");
+    alphasparse_status_t status = ALPHA_SPARSE_STATUS_SUCCESS;
+    if (file == NULL)
+        fflush(fp);
+    else if (fclose(fp) != 0)
+        status = ALPHA_SPARSE_STATUS_EXECUTION_FAILED;
+    return status;
+}
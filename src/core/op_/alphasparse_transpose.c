@@ -153,15 +153,15 @@ alphasparse_status_t transpose_datatype_dia(const alpha_internal_spmat *source,
 
 alphasparse_status_t transpose_datatype_format(const alpha_internal_spmat *source, alpha_internal_spmat **dest, alphasparse_datatype_t datatype, alphasparse_format_t format)
 {
-    if (format == ALPHA_SPARSE_FORMAT_COO)
+    if (format == ALPHA_SPARSE_FORMAT_COO || format == ALPHA_SPARSE_FORMAT_COO_PATTERN)
     {
         return transpose_datatype_coo(source, dest, datatype);
     }
-    else if (format == ALPHA_SPARSE_FORMAT_CSR)
+    else if (format == ALPHA_SPARSE_FORMAT_CSR || format == ALPHA_SPARSE_FORMAT_CSR_PATTERN)
     {
         return transpose_datatype_csr(source, dest, datatype);
     }
-    else if (format == ALPHA_SPARSE_FORMAT_CSC)
+    else if (format == ALPHA_SPARSE_FORMAT_CSC || format == ALPHA_SPARSE_FORMAT_CSC_PATTERN)
     {
         return transpose_datatype_csc(source, dest, datatype);
     }
@@ -189,6 +189,7 @@ alphasparse_status_t alphasparse_transpose(const alphasparse_matrix_t source, al
     check_null_return(source->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
     alphasparse_matrix *dest_ = alpha_malloc(sizeof(alphasparse_matrix));
     *dest = dest_;
+    dest_->inspector = NULL;
     dest_->format = source->format;
     dest_->datatype = source->datatype;
     return transpose_datatype_format((const alpha_internal_spmat *)source->mat, (alpha_internal_spmat **)&dest_->mat, source->datatype, source->format);
@@ -0,0 +1,29 @@
+/**
+ * @brief implement for alphasparse_?_graph_axpby interface
+ */
+
+#include "alphasparse/graph.h"
+#include "alphasparse/util.h"
+
+alphasparse_status_t ONAME(alphasparse_graph_t graph,
+                           const ALPHA_INT n,
+                           const ALPHA_Number alpha,
+                           const ALPHA_Number *x,
+                           const ALPHA_Number beta,
+                           const ALPHA_Number *y,
+                           ALPHA_Number *w)
+{
+    check_null_return(graph, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(n < 0 || x == NULL || y == NULL || w == NULL, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    alpha_graph_node_t *node;
+    check_error_return(alpha_graph_append(graph, ALPHA_SPARSE_DATATYPE, &node));
+    node->op = ALPHA_GRAPH_AXPBY;
+    node->alpha.ALPHA_GRAPH_SCALAR = alpha;
+    node->beta.ALPHA_GRAPH_SCALAR = beta;
+    node->rows = n;
+    node->fusable = true;
+    node->in[0] = x;
+    node->in[1] = y;
+    node->out = w;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
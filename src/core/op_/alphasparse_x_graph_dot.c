@@ -0,0 +1,25 @@
+/**
+ * @brief implement for alphasparse_?_graph_dot interface
+ */
+
+#include "alphasparse/graph.h"
+#include "alphasparse/util.h"
+
+alphasparse_status_t ONAME(alphasparse_graph_t graph,
+                           const ALPHA_INT n,
+                           const ALPHA_Number *x,
+                           const ALPHA_Number *y,
+                           ALPHA_Number *result)
+{
+    check_null_return(graph, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_return(n < 0 || x == NULL || y == NULL || result == NULL, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    alpha_graph_node_t *node;
+    check_error_return(alpha_graph_append(graph, ALPHA_SPARSE_DATATYPE, &node));
+    node->op = ALPHA_GRAPH_DOT;
+    node->rows = n;
+    node->fusable = true;
+    node->in[0] = x;
+    node->in[1] = y;
+    node->out = result;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
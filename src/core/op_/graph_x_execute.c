@@ -0,0 +1,143 @@
+/**
+ * @brief implement for replaying an operation graph, one parallel region per run of fused stages
+ */
+
+#include "alphasparse/graph.h"
+#include "alphasparse/spapi.h"
+#include "alphasparse/util.h"
+#include "alphasparse/opt.h"
+#include "alphasparse/compute.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static void node_rows(const alpha_graph_node_t *node, const ALPHA_INT rs, const ALPHA_INT re, ALPHA_Number *dot)
+{
+    if (node->op == ALPHA_GRAPH_MV)
+    {
+        const ALPHA_SPMAT_CSR *A = node->A->mat;
+        const ALPHA_Number *x = node->in[0];
+        ALPHA_Number *y = node->out;
+        const ALPHA_Number alpha = node->alpha.ALPHA_GRAPH_SCALAR;
+        const ALPHA_Number beta = node->beta.ALPHA_GRAPH_SCALAR;
+        for (ALPHA_INT i = rs; i < re; i++)
+        {
+            ALPHA_Number tmp;
+            alpha_setzero(tmp);
+            for (ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ai++)
+                alpha_madde(tmp, A->values[ai], x[A->col_indx[ai]]);
+            alpha_mule(y[i], beta);
+            alpha_madde(y[i], alpha, tmp);
+        }
+    }
+    else if (node->op == ALPHA_GRAPH_AXPBY)
+    {
+        const ALPHA_Number *x = node->in[0];
+        const ALPHA_Number *y = node->in[1];
+        ALPHA_Number *w = node->out;
+        const ALPHA_Number alpha = node->alpha.ALPHA_GRAPH_SCALAR;
+        const ALPHA_Number beta = node->beta.ALPHA_GRAPH_SCALAR;
+        for (ALPHA_INT i = rs; i < re; i++)
+        {
+            // w may alias x or y
+            ALPHA_Number tmp;
+            alpha_mul(tmp, alpha, x[i]);
+            alpha_madde(tmp, beta, y[i]);
+            w[i] = tmp;
+        }
+    }
+    else
+    {
+        const ALPHA_Number *x = node->in[0];
+        const ALPHA_Number *y = node->in[1];
+        for (ALPHA_INT i = rs; i < re; i++)
+            alpha_madde(*dot, x[i], y[i]);
+    }
+}
+
+// rows of slot t of the stage partition, block by block through every node of the stage
+static void stage_rows(const struct alpha_graph *graph, const alpha_graph_stage_t *stage, const ALPHA_INT t)
+{
+    alpha_graph_scalar_t *partial = graph->dot_num > 0 ? graph->dot_partial + (size_t)t * graph->dot_num + stage->dot_first : NULL;
+    ALPHA_INT dots = 0;
+    for (ALPHA_INT n = stage->first; n <= stage->last; n++)
+        if (graph->nodes[n].op == ALPHA_GRAPH_DOT)
+        {
+            alpha_setzero(partial[dots].ALPHA_GRAPH_SCALAR);
+            dots++;
+        }
+    const ALPHA_INT rs = stage->partition[t];
+    const ALPHA_INT re = stage->partition[t + 1];
+    for (ALPHA_INT bs = rs; bs < re; bs += ALPHA_GRAPH_ROW_BLOCK)
+    {
+        const ALPHA_INT be = alpha_min(bs + ALPHA_GRAPH_ROW_BLOCK, re);
+        ALPHA_INT d = 0;
+        for (ALPHA_INT n = stage->first; n <= stage->last; n++)
+        {
+            const alpha_graph_node_t *node = &graph->nodes[n];
+            node_rows(node, bs, be, node->op == ALPHA_GRAPH_DOT ? &partial[d++].ALPHA_GRAPH_SCALAR : NULL);
+        }
+    }
+}
+
+// sum the per-thread partials of the dots in stages [first, last]
+static void reduce_dots(const struct alpha_graph *graph, const ALPHA_INT first, const ALPHA_INT last)
+{
+    ALPHA_INT d = graph->stages[first].dot_first;
+    for (ALPHA_INT n = graph->stages[first].first; n <= graph->stages[last].last; n++)
+    {
+        const alpha_graph_node_t *node = &graph->nodes[n];
+        if (node->op != ALPHA_GRAPH_DOT)
+            continue;
+        ALPHA_Number sum;
+        alpha_setzero(sum);
+        for (ALPHA_INT t = 0; t < graph->thread_num; t++)
+            alpha_adde(sum, graph->dot_partial[(size_t)t * graph->dot_num + d].ALPHA_GRAPH_SCALAR);
+        *(ALPHA_Number *)node->out = sum;
+        d++;
+    }
+}
+
+alphasparse_status_t ONAME(struct alpha_graph *graph)
+{
+    const ALPHA_INT thread_num = graph->thread_num;
+    for (ALPHA_INT s = 0; s < graph->stage_num;)
+    {
+        const alpha_graph_stage_t *stage = &graph->stages[s];
+        if (!stage->fused)
+        {
+            const alpha_graph_node_t *node = &graph->nodes[stage->first];
+            check_error_return(alpha_graph_mv(node->operation, node->alpha.ALPHA_GRAPH_SCALAR, node->A, node->descr,
+                                              node->in[0], node->beta.ALPHA_GRAPH_SCALAR, node->out));
+            s++;
+            continue;
+        }
+        const ALPHA_INT region_end = stage->region_end;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num)
+#endif
+        {
+#ifdef _OPENMP
+            const ALPHA_INT team = omp_get_num_threads();
+#else
+            const ALPHA_INT team = 1;
+#endif
+            const ALPHA_INT tid = alpha_get_thread_id();
+            for (ALPHA_INT r = s; r <= region_end; r++)
+            {
+                // a smaller team than planned covers the remaining partition slots in turn
+                for (ALPHA_INT t = tid; t < thread_num; t += team)
+                    stage_rows(graph, &graph->stages[r], t);
+                if (r < region_end)
+                {
+#ifdef _OPENMP
+#pragma omp barrier
+#endif
+                }
+            }
+        }
+        reduce_dots(graph, s, region_end);
+        s = region_end + 1;
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -0,0 +1,42 @@
+/**
+ * @brief implement for recording mv calls made while capturing into a graph
+ */
+
+#include "alphasparse/graph.h"
+#include "alphasparse/spmat.h"
+#include "alphasparse/util.h"
+
+alphasparse_status_t ONAME(struct alpha_graph *graph,
+                           const alphasparse_operation_t operation,
+                           const ALPHA_Number alpha,
+                           const alphasparse_matrix_t A,
+                           const struct alpha_matrix_descr descr,
+                           const ALPHA_Number *x,
+                           const ALPHA_Number beta,
+                           ALPHA_Number *y)
+{
+    check_null_return(A, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(A->mat, ALPHA_SPARSE_STATUS_NOT_INITIALIZED);
+    check_null_return(x, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_null_return(y, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    check_return(A->datatype != ALPHA_SPARSE_DATATYPE, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    alpha_graph_node_t *node;
+    check_error_return(alpha_graph_append(graph, ALPHA_SPARSE_DATATYPE, &node));
+    node->op = ALPHA_GRAPH_MV;
+    node->operation = operation;
+    node->A = A;
+    node->descr = descr;
+    node->alpha.ALPHA_GRAPH_SCALAR = alpha;
+    node->beta.ALPHA_GRAPH_SCALAR = beta;
+    node->in[0] = x;
+    node->out = y;
+    node->fusable = A->format == ALPHA_SPARSE_FORMAT_CSR && operation == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE &&
+                    descr.type == ALPHA_SPARSE_MATRIX_TYPE_GENERAL;
+    if (node->fusable)
+    {
+        const ALPHA_SPMAT_CSR *mat = A->mat;
+        node->rows = mat->rows;
+        node->rows_end = mat->rows_end;
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -0,0 +1,91 @@
+/**
+ * @brief implement for the matrix shape reported by traced calls
+ */
+
+#include "alphasparse/trace.h"
+#include "alphasparse/spmat.h"
+
+void ONAME(const alphasparse_format_t format, const void *mat, ALPHA_INT *rows, ALPHA_INT *cols, ALPHA_INT64 *nnz)
+{
+    *rows = *cols = 0;
+    *nnz = 0;
+    if (format == ALPHA_SPARSE_FORMAT_CSR || format == ALPHA_SPARSE_FORMAT_CSR_PATTERN)
+    {
+        const ALPHA_SPMAT_CSR *A = mat;
+        *rows = A->rows;
+        *cols = A->cols;
+        *nnz = A->rows > 0 ? A->rows_end[A->rows - 1] - A->rows_start[0] : 0;
+    }
+    else if (format == ALPHA_SPARSE_FORMAT_COO || format == ALPHA_SPARSE_FORMAT_COO_PATTERN)
+    {
+        const ALPHA_SPMAT_COO *A = mat;
+        *rows = A->rows;
+        *cols = A->cols;
+        *nnz = A->nnz;
+    }
+    else if (format == ALPHA_SPARSE_FORMAT_CSC || format == ALPHA_SPARSE_FORMAT_CSC_PATTERN)
+    {
+        const ALPHA_SPMAT_CSC *A = mat;
+        *rows = A->rows;
+        *cols = A->cols;
+        *nnz = A->cols > 0 ? A->cols_end[A->cols - 1] - A->cols_start[0] : 0;
+    }
+    else if (format == ALPHA_SPARSE_FORMAT_BSR)
+    {
+        const ALPHA_SPMAT_BSR *A = mat;
+        const ALPHA_INT64 block = (ALPHA_INT64)A->block_size * A->block_size;
+        *rows = A->rows * A->block_size;
+        *cols = A->cols * A->block_size;
+        *nnz = A->rows > 0 ? (A->rows_end[A->rows - 1] - A->rows_start[0]) * block : 0;
+    }
+    else if (format == ALPHA_SPARSE_FORMAT_GEBSR)
+    {
+        const ALPHA_SPMAT_GEBSR *A = mat;
+        const ALPHA_INT64 block = (ALPHA_INT64)A->row_block_dim * A->col_block_dim;
+        *rows = A->rows * A->row_block_dim;
+        *cols = A->cols * A->col_block_dim;
+        *nnz = A->rows > 0 ? (A->rows_end[A->rows - 1] - A->rows_start[0]) * block : 0;
+    }
+    else if (format == ALPHA_SPARSE_FORMAT_SKY)
+    {
+        const ALPHA_SPMAT_SKY *A = mat;
+        *rows = A->rows;
+        *cols = A->cols;
+        *nnz = A->pointers[A->rows] - A->pointers[0];
+    }
+    else if (format == ALPHA_SPARSE_FORMAT_DIA)
+    {
+        const ALPHA_SPMAT_DIA *A = mat;
+        *rows = A->rows;
+        *cols = A->cols;
+        *nnz = (ALPHA_INT64)A->ndiag * A->lval;
+    }
+    else if (format == ALPHA_SPARSE_FORMAT_DIA_CSR)
+    {
+        const ALPHA_SPMAT_DIA_CSR *A = mat;
+        *rows = A->rows;
+        *cols = A->cols;
+        *nnz = (ALPHA_INT64)A->dia->ndiag * A->dia->lval + (A->rows > 0 ? A->csr->rows_end[A->rows - 1] : 0);
+    }
+    else if (format == ALPHA_SPARSE_FORMAT_ELL)
+    {
+        const ALPHA_SPMAT_ELL *A = mat;
+        *rows = A->rows;
+        *cols = A->cols;
+        *nnz = (ALPHA_INT64)A->ld * A->rows;
+    }
+    else if (format == ALPHA_SPARSE_FORMAT_HYB)
+    {
+        const ALPHA_SPMAT_HYB *A = mat;
+        *rows = A->rows;
+        *cols = A->cols;
+        *nnz = (ALPHA_INT64)A->ell_width * A->rows + A->nnz;
+    }
+    else if (format == ALPHA_SPARSE_FORMAT_CSR5)
+    {
+        const ALPHA_SPMAT_CSR5 *A = mat;
+        *rows = A->num_rows;
+        *cols = A->num_cols;
+        *nnz = A->nnz;
+    }
+}
@@ -22,7 +22,7 @@ diagmv_x_csr_n_omp(const ALPHA_Number alpha,
     {
         register ALPHA_Number tmp;
         alpha_setzero(tmp);
-        for (ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
+        for (ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
         {
             if (A->col_indx[ai] == i)
             {
@@ -16,7 +16,7 @@ gemv_csr_trans_serial(const ALPHA_Number alpha,
     const ALPHA_INT m = A->rows;
     for (ALPHA_INT i = 0; i < m; ++i)
     {
-        for (ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ai++)
+        for (ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ai++)
         {
             ALPHA_Number val;
             cmp_conj(val, A->values[ai]);
@@ -38,7 +38,7 @@ gemv_csr_trans_omp(const ALPHA_Number alpha,
     const ALPHA_INT n = A->cols;
     const ALPHA_INT thread_num = alpha_get_thread_num();
     ALPHA_INT partition[thread_num + 1];
-    balanced_partition_row_by_nnz(A->rows_end, m, thread_num, partition);
+    balanced_partition_row_by_offset(A->rows_end, m, thread_num, partition);
     ALPHA_Number **tmp = (ALPHA_Number **)malloc(sizeof(ALPHA_Number *) * thread_num);
 #ifdef _OPENMP
 #pragma omp parallel num_threads(thread_num)
@@ -52,8 +52,8 @@ gemv_csr_trans_omp(const ALPHA_Number alpha,
         for (ALPHA_INT i = local_m_s; i < local_m_e; ++i)
         {
             const ALPHA_Number x_r = x[i];
-            int pkl = A->rows_start[i];
-            int pke = A->rows_end[i];
+            ALPHA_OFFSET pkl = A->rows_start[i];
+            ALPHA_OFFSET pke = A->rows_end[i];
             for (; pkl < pke - 3; pkl += 4)
             {
                 ALPHA_Number conj0, conj1, conj2, conj3;
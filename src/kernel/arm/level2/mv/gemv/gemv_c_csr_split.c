@@ -0,0 +1,42 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/trace.h"
+#include "alphasparse/util/split_complex.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// y := alpha * A * x + beta * y with the parts of A in re and im, every row is one gathered dot product
+alphasparse_status_t
+ONAME(const ALPHA_Complex alpha,
+      const ALPHA_SPMAT_CSR *A,
+      const ALPHA_Float *re,
+      const ALPHA_Float *im,
+      const ALPHA_Complex *x,
+      const ALPHA_Complex beta,
+      ALPHA_Complex *y)
+{
+    const ALPHA_INT m = A->rows;
+    const ALPHA_INT n = A->cols;
+    ALPHA_INT num_threads = alpha_get_thread_num();
+    ALPHA_INT partition[num_threads + 1];
+    balanced_partition_row_by_offset(A->rows_end, m, num_threads, partition);
+
+    alpha_trace_threads();
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+        ALPHA_INT tid = alpha_get_thread_id();
+        alpha_trace_thread_begin();
+        for (ALPHA_INT i = partition[tid]; i < partition[tid + 1]; i++)
+        {
+            const ALPHA_OFFSET rs = A->rows_start[i];
+            const ALPHA_Complex sum = split_dot_range(A->rows_end[i] - rs, re + rs, im + rs, A->col_indx + rs, x, 0, n, false);
+            alpha_mule(y[i], beta);
+            alpha_madde(y[i], alpha, sum);
+        }
+        alpha_trace_thread_end(tid);
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -0,0 +1,13 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/opt.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/dia_csr.h"
+
+alphasparse_status_t ONAME(const ALPHA_Number alpha,
+                           const ALPHA_SPMAT_DIA_CSR *A,
+                           const ALPHA_Number *x,
+                           const ALPHA_Number beta,
+                           ALPHA_Number *y)
+{
+    return dia_csr_gemv_trans(alpha, A, x, beta, y, true);
+}
@@ -26,7 +26,7 @@ gemv_bsr_for_each_thread(const ALPHA_Number alpha,
 	{
 		for (ALPHA_INT i = lrs, j = 0; i < lre; i++, j++)
 		{
-			for (ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ai++)
+			for (ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ai++)
 			{
 				//TODO Code here if unroll is needed
 				for (ALPHA_INT row_inner = 0; row_inner < bs; row_inner++)
@@ -45,7 +45,7 @@ gemv_bsr_for_each_thread(const ALPHA_Number alpha,
 	{
 		for (ALPHA_INT i = lrs, j = 0; i < lre; i++, j++)
 		{
-			for (ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ai++)
+			for (ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ai++)
 			{
 				// block[ai]: [i][A->cols[ai]]
 				for (ALPHA_INT col_inner = 0; col_inner < bs; col_inner++)
@@ -67,7 +67,7 @@ gemv_bsr_for_each_thread(const ALPHA_Number alpha,
 		alpha_mul(y[m], y[m], beta);
 		alpha_madde(y[m], tmp[m_t], alpha);
 	}
-	free(tmp);
+	alpha_release(tmp);
 	return ALPHA_SPARSE_STATUS_SUCCESS;
 }
 
@@ -82,7 +82,7 @@ gemv_bsr_omp(const ALPHA_Number alpha,
 	ALPHA_INT thread_num = alpha_get_thread_num();
 
 	ALPHA_INT partition[thread_num + 1];
-	balanced_partition_row_by_nnz(A->rows_end, m_inner, thread_num, partition);
+	balanced_partition_row_by_offset(A->rows_end, m_inner, thread_num, partition);
 #ifdef _OPENMP
 #pragma omp parallel num_threads(thread_num)
 #endif
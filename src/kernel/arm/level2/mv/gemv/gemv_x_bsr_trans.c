@@ -18,7 +18,7 @@ gemv_bsr_trans_omp(const ALPHA_Number alpha,
 	ALPHA_INT n_inner = A->cols;
     const ALPHA_INT thread_num = alpha_get_thread_num();
     ALPHA_INT partition[thread_num + 1];
-    balanced_partition_row_by_nnz(A->rows_end, m_inner, thread_num, partition);
+    balanced_partition_row_by_offset(A->rows_end, m_inner, thread_num, partition);
     ALPHA_Number** tmp = (ALPHA_Number**)malloc(sizeof(ALPHA_Number*) * thread_num);
 #ifdef _OPENMP
 #pragma omp parallel num_threads(thread_num)
@@ -33,7 +33,7 @@ gemv_bsr_trans_omp(const ALPHA_Number alpha,
 		if(A->block_layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR){
 			for (ALPHA_INT i = local_m_s; i < local_m_e; i++)
 			{
-				for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i];ai++)
+				for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i];ai++)
 				{
 					// A index is (bs * i + block_row, bs * A->col_indx[ai] + block_col)
 					// should multiplied by x[bs * i + block_row], 
@@ -48,7 +48,7 @@ gemv_bsr_trans_omp(const ALPHA_Number alpha,
 	  	else if (A->block_layout == ALPHA_SPARSE_LAYOUT_COLUMN_MAJOR){
 			for (ALPHA_INT i = local_m_s; i < local_m_e; i++)
 			{
-				for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i];ai++)
+				for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i];ai++)
 				{
 					// index is (bs * i + block_row, bs * A->col_indx[ai] + block_col)
 					// should multiplied by x[bs * i + block_row], 
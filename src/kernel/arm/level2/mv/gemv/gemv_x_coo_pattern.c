@@ -0,0 +1,68 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/opt.h"
+#include "alphasparse/util.h"
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static alphasparse_status_t
+gemv_coo_pattern_omp(const ALPHA_Number alpha,
+					 const ALPHA_SPMAT_COO *A,
+					 const ALPHA_Number *x,
+					 const ALPHA_Number beta,
+					 ALPHA_Number *y)
+{
+	const ALPHA_INT m = A->rows;
+	const ALPHA_INT nnz = A->nnz;
+	const ALPHA_INT thread_num = alpha_get_thread_num();
+
+	ALPHA_Number **tmp = (ALPHA_Number **)malloc(sizeof(ALPHA_Number *) * thread_num);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+	for (int i = 0; i < thread_num; ++i)
+	{
+		tmp[i] = malloc(sizeof(ALPHA_Number) * m);
+		memset(tmp[i], 0, sizeof(ALPHA_Number) * m);
+	}
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+	for (ALPHA_INT i = 0; i < nnz; i++)
+	{
+		const ALPHA_INT threadId = alpha_get_thread_id();
+		alpha_adde(tmp[threadId][A->row_indx[i]], x[A->col_indx[i]]);
+	}
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+	for (ALPHA_INT i = 0; i < m; ++i)
+	{
+		ALPHA_Number tmp_y;
+		alpha_setzero(tmp_y);
+		for (ALPHA_INT j = 0; j < thread_num; ++j)
+		{
+			alpha_adde(tmp_y, tmp[j][i]);
+		}
+		alpha_mule(y[i], beta);
+		alpha_madde(y[i], alpha, tmp_y);
+	}
+	for (ALPHA_INT i = 0; i < thread_num; ++i)
+	{
+		free(tmp[i]);
+	}
+	free(tmp);
+	return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t
+ONAME(const ALPHA_Number alpha,
+	  const ALPHA_SPMAT_COO *A,
+	  const ALPHA_Number *x,
+	  const ALPHA_Number beta,
+	  ALPHA_Number *y)
+{
+	return gemv_coo_pattern_omp(alpha, A, x, beta, y);
+}
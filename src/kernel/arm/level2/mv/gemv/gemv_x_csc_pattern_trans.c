@@ -0,0 +1,76 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/opt.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// every stored entry is one, the column product is a plain gather-sum of x
+static ALPHA_Number gemv_pattern_kernel_sum_unroll4(const ALPHA_INT ns, const ALPHA_INT *indx, const ALPHA_Number *x)
+{
+    ALPHA_INT ns4 = ((ns >> 2) << 2);
+    ALPHA_INT i;
+    ALPHA_Number tmp0, tmp1, tmp2, tmp3;
+    alpha_setzero(tmp0);
+    alpha_setzero(tmp1);
+    alpha_setzero(tmp2);
+    alpha_setzero(tmp3);
+    for (i = 0; i < ns4; i += 4)
+    {
+        alpha_adde(tmp0, x[indx[i]]);
+        alpha_adde(tmp1, x[indx[i + 1]]);
+        alpha_adde(tmp2, x[indx[i + 2]]);
+        alpha_adde(tmp3, x[indx[i + 3]]);
+    }
+    for (; i < ns; ++i)
+    {
+        alpha_adde(tmp0, x[indx[i]]);
+    }
+    alpha_adde(tmp0, tmp1);
+    alpha_adde(tmp2, tmp3);
+    alpha_adde(tmp0, tmp2);
+    return tmp0;
+}
+
+static alphasparse_status_t
+gemv_csc_pattern_trans_omp(const ALPHA_Number alpha,
+                           const ALPHA_SPMAT_CSC *A,
+                           const ALPHA_Number *x,
+                           const ALPHA_Number beta,
+                           ALPHA_Number *y)
+{
+    ALPHA_INT m = A->cols;
+
+    ALPHA_INT num_threads = alpha_get_thread_num();
+    ALPHA_INT partition[num_threads + 1];
+    balanced_partition_row_by_nnz(A->cols_end, m, num_threads, partition);
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+        ALPHA_INT tid = alpha_get_thread_id();
+
+        ALPHA_INT local_m_s = partition[tid];
+        ALPHA_INT local_m_e = partition[tid + 1];
+        for (ALPHA_INT i = local_m_s; i < local_m_e; i++)
+        {
+            ALPHA_INT pks = A->cols_start[i];
+            ALPHA_INT pke = A->cols_end[i];
+            ALPHA_Number tmp = gemv_pattern_kernel_sum_unroll4(pke - pks, &A->row_indx[pks], x);
+            alpha_mule(y[i], beta);
+            alpha_madde(y[i], alpha, tmp);
+        }
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t
+ONAME(const ALPHA_Number alpha,
+      const ALPHA_SPMAT_CSC *A,
+      const ALPHA_Number *x,
+      const ALPHA_Number beta,
+      ALPHA_Number *y)
+{
+    return gemv_csc_pattern_trans_omp(alpha, A, x, beta, y);
+}
@@ -18,8 +18,8 @@ gemv_csr_unroll4(const ALPHA_Number alpha,
 {
     for (ALPHA_INT i = lrs; i < lre; i++)
     {
-        ALPHA_INT pks = A->rows_start[i];
-        ALPHA_INT pke = A->rows_end[i];
+        ALPHA_OFFSET pks = A->rows_start[i];
+        ALPHA_OFFSET pke = A->rows_end[i];
         ALPHA_INT pkl = pke - pks;
         ALPHA_Number tmp = vec_doti(pkl, &A->values[pks], &A->col_indx[pks], x);
         alpha_mule(y[i], beta);
@@ -39,7 +39,7 @@ gemv_csr_omp(const ALPHA_Number alpha,
 
     ALPHA_INT num_threads = alpha_get_thread_num();
     ALPHA_INT partition[num_threads + 1];
-    balanced_partition_row_by_nnz(A->rows_end, m, num_threads, partition);
+    balanced_partition_row_by_offset(A->rows_end, m, num_threads, partition);
 
 #ifdef _OPENMP
 #pragma omp parallel num_threads(num_threads)
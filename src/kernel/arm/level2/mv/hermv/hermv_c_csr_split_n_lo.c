@@ -0,0 +1,15 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/split_complex.h"
+
+alphasparse_status_t
+ONAME(const ALPHA_Complex alpha,
+      const ALPHA_SPMAT_CSR *A,
+      const ALPHA_Float *re,
+      const ALPHA_Float *im,
+      const ALPHA_Complex *x,
+      const ALPHA_Complex beta,
+      ALPHA_Complex *y)
+{
+    return split_hermv_csr(alpha, A->rows, A->rows_start, A->rows_end, A->col_indx, re, im, x, beta, y, true, false, false);
+}
@@ -29,7 +29,7 @@ ONAME(const ALPHA_Number alpha,
     	for(int i = 0; i < m_inner; ++i)
     	{
 			int m_s = i*bs;
-    	    for(int ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
+    	    for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
     	    {
     	        const int col = A->col_indx[ai];
     	        if(col < i)
@@ -78,7 +78,7 @@ ONAME(const ALPHA_Number alpha,
 		for(int i = 0; i < m_inner; ++i)
     	{
 			int m_s = i*bs;
-    	    for(int ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
+    	    for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
     	    {
     	        const int col = A->col_indx[ai];
     	        if(col < i)
@@ -25,7 +25,7 @@ ONAME(const ALPHA_Number alpha,
 		return ALPHA_SPARSE_STATUS_INVALID_VALUE;
 	
 	ALPHA_INT partition[thread_num + 1];
-	balanced_partition_row_by_nnz(A->rows_end, b_rows, thread_num, partition);
+	balanced_partition_row_by_offset(A->rows_end, b_rows, thread_num, partition);
 	ALPHA_Number **tmp = (ALPHA_Number **)malloc(sizeof(ALPHA_Number *) * thread_num);
 
 #ifdef _OPENMP
@@ -43,7 +43,7 @@ ONAME(const ALPHA_Number alpha,
 			for (ALPHA_INT br = local_m_s; br < local_m_e; br++)
 			{
 				ALPHA_INT row = br * bs;
-				ALPHA_INT block_start = A->rows_start[br], block_end = A->rows_end[br];
+				ALPHA_OFFSET block_start = A->rows_start[br], block_end = A->rows_end[br];
 				ALPHA_INT upper_start = alpha_lower_bound(&A->col_indx[block_start], &A->col_indx[block_end], br) - A->col_indx;
 				for (ALPHA_INT ai = upper_start; ai < block_end; ai++)
 				{
@@ -83,7 +83,7 @@ ONAME(const ALPHA_Number alpha,
 			for (ALPHA_INT br = 0; br < b_rows; br++)
 			{
 				ALPHA_INT row = br * bs;
-				ALPHA_INT block_start = A->rows_start[br], block_end = A->rows_end[br];
+				ALPHA_OFFSET block_start = A->rows_start[br], block_end = A->rows_end[br];
 				ALPHA_INT upper_start = alpha_lower_bound(&A->col_indx[block_start], &A->col_indx[block_end], br) - A->col_indx;
 				for (ALPHA_INT ai = upper_start; ai < block_end; ai++)
 				{
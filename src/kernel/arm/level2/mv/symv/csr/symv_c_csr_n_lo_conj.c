@@ -42,7 +42,7 @@ symv_x_csr_n_lo_conj_omp(const ALPHA_Number alpha,
     {
 		ALPHA_INT tid = alpha_get_thread_id();	
 		ALPHA_Number tmp;	
-		for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
+		for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
 		{
 			const ALPHA_INT col = A->col_indx[ai];
 			if(col > i)
@@ -22,7 +22,7 @@ ONAME(const ALPHA_Number alpha,
 		ALPHA_INT diag_block = 0;
 		for (ALPHA_INT i = 0; i < m_inner; i++){
 			ALPHA_INT col = i*bs;
-			for (ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ai++){	
+			for (ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ai++){	
 				ALPHA_INT row = A->col_indx[ai];
 				ALPHA_INT m_s = row*bs;
 				if (row > i){
@@ -65,7 +65,7 @@ ONAME(const ALPHA_Number alpha,
         ALPHA_INT diag_block = 0;
 		for (ALPHA_INT i = 0; i < m_inner; i++){
 			ALPHA_INT col = i*bs;
-			for (ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ai++){	
+			for (ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ai++){	
 				ALPHA_INT row = A->col_indx[ai];
 				ALPHA_INT m_s = row*bs;
 				if (row > i ){
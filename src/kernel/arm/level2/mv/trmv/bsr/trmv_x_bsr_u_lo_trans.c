@@ -19,7 +19,7 @@ ONAME(const ALPHA_Number alpha,
     if(m_inner != n_inner) return ALPHA_SPARSE_STATUS_INVALID_VALUE;
     const ALPHA_INT thread_num = alpha_get_thread_num();
     ALPHA_INT partition[thread_num + 1];
-    balanced_partition_row_by_nnz(A->rows_end, m_inner, thread_num, partition);
+    balanced_partition_row_by_offset(A->rows_end, m_inner, thread_num, partition);
     ALPHA_Number** tmp = (ALPHA_Number**)malloc(sizeof(ALPHA_Number*) * thread_num);
 #ifdef _OPENMP
 #pragma omp parallel num_threads(thread_num)
@@ -34,7 +34,7 @@ ONAME(const ALPHA_Number alpha,
 	{
 		for (ALPHA_INT i = local_m_s; i < local_m_e; i++){
 			ALPHA_INT col = i*bs;
-			ALPHA_INT block_start = A->rows_start[i], block_end = A->rows_end[i];
+			ALPHA_OFFSET block_start = A->rows_start[i], block_end = A->rows_end[i];
 			ALPHA_INT lower_end = alpha_upper_bound(&A->col_indx[block_start], &A->col_indx[block_end], i) - A->col_indx;
 			for (ALPHA_INT ai = block_start; ai < lower_end; ai++){
 				ALPHA_INT row = A->col_indx[ai];
@@ -57,7 +57,7 @@ ONAME(const ALPHA_Number alpha,
 	}else if (A->block_layout == ALPHA_SPARSE_LAYOUT_COLUMN_MAJOR){
 		for (ALPHA_INT i = local_m_s; i < local_m_e; i++){
 			ALPHA_INT col = i*bs;
-			ALPHA_INT block_start = A->rows_start[i], block_end = A->rows_end[i];
+			ALPHA_OFFSET block_start = A->rows_start[i], block_end = A->rows_end[i];
 			ALPHA_INT lower_end = alpha_upper_bound(&A->col_indx[block_start], &A->col_indx[block_end], i) - A->col_indx;
 			for (ALPHA_INT ai = block_start; ai < lower_end; ai++){
 				ALPHA_INT row = A->col_indx[ai];
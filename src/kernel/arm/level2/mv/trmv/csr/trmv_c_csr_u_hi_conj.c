@@ -43,7 +43,7 @@ trmv_x_csr_u_hi_conj_omp(const ALPHA_Number alpha,
     {
 		ALPHA_INT tid = alpha_get_thread_id();	
 		ALPHA_Number tmp;	
-		for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
+		for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
 		{
 			const ALPHA_INT col = A->col_indx[ai];
 			if(col <= i)
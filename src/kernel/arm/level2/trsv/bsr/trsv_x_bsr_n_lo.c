@@ -13,7 +13,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *A, c
     
     for (ALPHA_INT ar = 0; ar < block_rowA; ++ar)
     {
-        for (ALPHA_INT ai = A->rows_start[ar]; ai < A->rows_end[ar]; ++ai)
+        for (ALPHA_OFFSET ai = A->rows_start[ar]; ai < A->rows_end[ar]; ++ai)
         {
             if (A->col_indx[ai] == ar)
             {
@@ -29,7 +29,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *A, c
     memset(temp, '\0', sizeof(ALPHA_Number)*rowA);
     for (ALPHA_INT r = 0; r < block_rowA; r++)
     {
-        for (ALPHA_INT ai = A->rows_start[r]; ai < A->rows_end[r]; ai++)
+        for (ALPHA_OFFSET ai = A->rows_start[r]; ai < A->rows_end[r]; ai++)
         {
             ALPHA_INT ac = A->col_indx[ai];
             if(ac == r) 
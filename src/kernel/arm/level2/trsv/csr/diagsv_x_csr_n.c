@@ -10,7 +10,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSR *A, c
 
     for (ALPHA_INT r = 0; r < A->rows; r++)
     {
-        for (ALPHA_INT ai = A->rows_start[r]; ai < A->rows_end[r]; ai++)
+        for (ALPHA_OFFSET ai = A->rows_start[r]; ai < A->rows_end[r]; ai++)
         {
             ALPHA_INT ac = A->col_indx[ai];
             if (ac == r)
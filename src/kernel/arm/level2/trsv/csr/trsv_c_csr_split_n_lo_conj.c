@@ -0,0 +1,8 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/split_complex.h"
+
+alphasparse_status_t ONAME(const ALPHA_Complex alpha, const ALPHA_SPMAT_CSR *A, const ALPHA_Float *re, const ALPHA_Float *im, const ALPHA_Complex *x, ALPHA_Complex *y)
+{
+    return split_trsv_csr(alpha, A->rows, A->rows_start, A->rows_end, A->col_indx, re, im, x, y, true, false, ALPHA_SPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+}
@@ -15,7 +15,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_Number alpha, c
     check_return(rowA != rowB, ALPHA_SPARSE_STATUS_INVALID_VALUE);
     check_return(colA != colB, ALPHA_SPARSE_STATUS_INVALID_VALUE);
 
-    ALPHA_INT *rows_offset = alpha_memalign((rowA + 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    ALPHA_OFFSET *rows_offset = alpha_memalign((rowA + 1) * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
     mat->rows = rowA;
     mat->cols = colB;
     mat->rows_start = rows_offset;
@@ -29,10 +29,10 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_Number alpha, c
 #endif
     for (ALPHA_INT r = 0; r < rowA; ++r)
     {
-        ALPHA_INT ai = A->rows_start[r];
-        ALPHA_INT rea = A->rows_end[r];
-        ALPHA_INT bi = B->rows_start[r];
-        ALPHA_INT reb = B->rows_end[r];
+        ALPHA_OFFSET ai = A->rows_start[r];
+        ALPHA_OFFSET rea = A->rows_end[r];
+        ALPHA_OFFSET bi = B->rows_start[r];
+        ALPHA_OFFSET reb = B->rows_end[r];
         while (ai < rea && bi < reb)
         {
             ALPHA_INT cb = B->col_indx[bi];
@@ -70,10 +70,10 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_Number alpha, c
 
     for (ALPHA_INT r = 0; r < rowA; ++r)
     {
-        ALPHA_INT ai = A->rows_start[r];
-        ALPHA_INT rea = A->rows_end[r];
-        ALPHA_INT bi = B->rows_start[r];
-        ALPHA_INT reb = B->rows_end[r];
+        ALPHA_OFFSET ai = A->rows_start[r];
+        ALPHA_OFFSET rea = A->rows_end[r];
+        ALPHA_OFFSET bi = B->rows_start[r];
+        ALPHA_OFFSET reb = B->rows_end[r];
         while (ai < rea && bi < reb)
         {
             ALPHA_INT ca = A->col_indx[ai];
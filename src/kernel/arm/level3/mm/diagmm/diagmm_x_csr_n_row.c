@@ -16,7 +16,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSR *mat,
         {
             alpha_mule(Y[c], beta);
         }
-        for (ALPHA_INT ai = mat->rows_start[r]; ai < mat->rows_end[r]; ai++)
+        for (ALPHA_OFFSET ai = mat->rows_start[r]; ai < mat->rows_end[r]; ai++)
         {
             if (mat->col_indx[ai] != r)
                 continue;
@@ -0,0 +1,8 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/split_complex.h"
+
+alphasparse_status_t ONAME(const ALPHA_Complex alpha, const ALPHA_SPMAT_CSR *mat, const ALPHA_Float *re, const ALPHA_Float *im, const ALPHA_Complex *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex beta, ALPHA_Complex *y, const ALPHA_INT ldy)
+{
+    return split_gemm_csr_row_trans(alpha, mat->rows, mat->cols, mat->rows_start, mat->rows_end, mat->col_indx, re, im, x, columns, ldx, beta, y, ldy, false);
+}
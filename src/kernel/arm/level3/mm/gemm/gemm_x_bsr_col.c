@@ -3,7 +3,8 @@
 
 alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat, const ALPHA_Number *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Number beta, ALPHA_Number *y, const ALPHA_INT ldy)
 {
-    ALPHA_INT m = mat->rows;
+    // rows counts block rows
+    ALPHA_INT m = mat->rows * mat->block_size;
     ALPHA_INT n = columns;
     ALPHA_INT ll = mat->block_size;
 
@@ -16,15 +17,14 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
     switch (mat->block_layout)
     {
     case ALPHA_SPARSE_LAYOUT_ROW_MAJOR:
-        for (ALPHA_INT c = 0; c < n; c += ll)
+        for (ALPHA_INT c = 0; c < n; ++c)
         { // choose a column from x
             for (ALPHA_INT r = 0; r < m; r += ll)
             { // choose a block of row
                 ALPHA_INT br = r / ll;
-                for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
+                for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
                 { // choose a block
                     ALPHA_Number *blk = &mat->values[ai * ll * ll];
-                    for (ALPHA_INT cc = 0; cc < ll; ++cc)
                     for (ALPHA_INT lr = 0; lr < ll; ++lr)
                     { // choose a inner row
 
@@ -34,9 +34,9 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
 
                         for (ALPHA_INT lc = 0; lc < ll; ++lc)
                         {
-                            alpha_madde(extra, blk[index2(lr, lc, ll)], x[index2(c + cc, ac + lc, ldx)]);
+                            alpha_madde(extra, blk[index2(lr, lc, ll)], x[index2(c, ac + lc, ldx)]);
                         }
-                        alpha_madde(y[index2(c + cc, r + lr, ldy)], alpha, extra);
+                        alpha_madde(y[index2(c, r + lr, ldy)], alpha, extra);
                     }
                 }
             }
@@ -44,14 +44,13 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
         break;
 
     case ALPHA_SPARSE_LAYOUT_COLUMN_MAJOR:
-        for (ALPHA_INT c = 0; c < n; c += ll)
+        for (ALPHA_INT c = 0; c < n; ++c)
         { // choose a column from x
             for (ALPHA_INT r = 0; r < m; r += ll)
             { // choose a block of row
                 ALPHA_INT br = r / ll;
-                for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
+                for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
                 { // choose a block
-                    for (ALPHA_INT cc = 0; cc < ll; ++cc)
                     for (ALPHA_INT lr = 0; lr < ll; ++lr)
                     { // choose a inner row
 
@@ -62,9 +61,9 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
 
                         for (ALPHA_INT lc = 0; lc < ll; ++lc)
                         {
-                            alpha_madde(extra, blk[index2(lc, lr, ll)], x[index2(c + cc, ac + lc, ldx)]);
+                            alpha_madde(extra, blk[index2(lc, lr, ll)], x[index2(c, ac + lc, ldx)]);
                         }
-                        alpha_madde(y[index2(c + cc, r + lr, ldy)], alpha, extra);
+                        alpha_madde(y[index2(c, r + lr, ldy)], alpha, extra);
                     }
                 }
             }
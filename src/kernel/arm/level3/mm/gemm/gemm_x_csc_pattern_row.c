@@ -0,0 +1,34 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+
+alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSC *mat, const ALPHA_Number *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Number beta, ALPHA_Number *y, const ALPHA_INT ldy)
+{
+    ALPHA_INT m = mat->rows;
+    ALPHA_INT n = mat->cols;
+    ALPHA_INT num_threads = alpha_get_thread_num();
+
+    // threads own disjoint slices of the dense columns, so the scatter needs no reduction
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+        ALPHA_INT tid = alpha_get_thread_id();
+        ALPHA_INT lcs = cross_block_low(tid, num_threads, columns);
+        ALPHA_INT lce = cross_block_high(tid, num_threads, columns);
+        for (ALPHA_INT r = 0; r < m; ++r)
+            for (ALPHA_INT cc = lcs; cc < lce; ++cc)
+                alpha_mule(y[index2(r, cc, ldy)], beta);
+
+        for (ALPHA_INT ac = 0; ac < n; ++ac)
+        {
+            const ALPHA_Number *X = &x[index2(ac, 0, ldx)];
+            for (ALPHA_INT ai = mat->cols_start[ac]; ai < mat->cols_end[ac]; ++ai)
+            {
+                ALPHA_Number *Y = &y[index2(mat->row_indx[ai], 0, ldy)];
+                for (ALPHA_INT cc = lcs; cc < lce; ++cc)
+                    alpha_madde(Y[cc], alpha, X[cc]);
+            }
+        }
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -13,7 +13,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSR *mat,
         {
             ALPHA_Number ctmp;
             alpha_setzero(ctmp);
-            for (ALPHA_INT ai = mat->rows_start[cr]; ai < mat->rows_end[cr]; ++ai)
+            for (ALPHA_OFFSET ai = mat->rows_start[cr]; ai < mat->rows_end[cr]; ++ai)
             {
                 alpha_madde(ctmp, mat->values[ai], x[index2(cc, mat->col_indx[ai], ldx)]);
             }
@@ -0,0 +1,31 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/opt.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/dia_csr.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// every column of x is a vector product of its own, a row tile runs all of them while its part of A is cached
+alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_DIA_CSR *mat, const ALPHA_Number *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Number beta, ALPHA_Number *y, const ALPHA_INT ldy)
+{
+    const ALPHA_INT m = mat->rows;
+    const ALPHA_INT tiles = (m + DIA_CSR_TILE - 1) / DIA_CSR_TILE;
+    const ALPHA_INT num_threads = alpha_min(alpha_get_thread_num(), alpha_max(tiles, 1));
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+#endif
+    for (ALPHA_INT t = 0; t < tiles; t++)
+    {
+        ALPHA_Number acc[DIA_CSR_TILE];
+        const ALPHA_INT r0 = t * DIA_CSR_TILE;
+        const ALPHA_INT r1 = alpha_min(m, r0 + DIA_CSR_TILE);
+        for (ALPHA_INT c = 0; c < columns; c++)
+        {
+            dia_csr_rows(mat, r0, r1, &x[index2(c, 0, ldx)], acc);
+            dia_csr_store(alpha, acc, r1 - r0, beta, &y[index2(c, r0, ldy)]);
+        }
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -1,18 +1,10 @@
 #include "alphasparse/kernel.h"
 #include "alphasparse/util.h"
+#include "alphasparse/util/symmetric_mm.h"
 
 alphasparse_status_t ONAME(const ALPHA_Complex alpha, const ALPHA_SPMAT_CSC *mat, const ALPHA_Complex *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex beta, ALPHA_Complex *y, const ALPHA_INT ldy)
 {
-    ALPHA_SPMAT_CSC *transposed_mat;
-    transpose_csc(mat, &transposed_mat);
-    for (ALPHA_INT c = 0; c < transposed_mat->cols; ++c){
-        for (ALPHA_INT i = transposed_mat->cols_start[c]; i < transposed_mat->cols_end[c]; ++i){
-            ALPHA_INT r = transposed_mat->row_indx[i];
-            if(r == c)
-                transposed_mat->values[i].imag = 0.0 - transposed_mat->values[i].imag;
-        }
-    }
-    alphasparse_status_t status = hermm_csc_n_hi_row(alpha, transposed_mat, x, columns, ldx, beta, y, ldy);
-    destroy_csc(transposed_mat);
-    return status;
-}
\ No newline at end of file
+    // column j of A is row j of A^T, the lower triangle of A lies above its diagonal
+    return symm_mm_compressed(alpha, mat->cols, (symm_mm_rows_t){NULL, NULL, mat->cols_start, mat->cols_end, mat->row_indx, mat->values},
+                              x, columns, ldx, beta, y, ldy, false, false, true, false, true, true);
+}
@@ -1,10 +1,9 @@
 #include "alphasparse/kernel.h"
-#include <stdio.h>
+#include "alphasparse/util.h"
+#include "alphasparse/util/symmetric_mm.h"
+
 alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSR *mat, const ALPHA_Number *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Number beta, ALPHA_Number *y, const ALPHA_INT ldy)
 {
-    ALPHA_SPMAT_CSR *conjugated_mat;
-    transpose_conj_csr(mat, &conjugated_mat);
-    alphasparse_status_t status = symm_csr_n_lo_col(alpha, conjugated_mat, x, columns, ldx, beta, y, ldy);
-    destroy_csr(conjugated_mat);
-    return status;
+    return symm_mm_compressed(alpha, mat->rows, (symm_mm_rows_t){mat->rows_start, mat->rows_end, NULL, NULL, mat->col_indx, mat->values},
+                              x, columns, ldx, beta, y, ldy, false, false, false, true, true, true);
 }
@@ -15,7 +15,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSR *mat,
             alpha_mule(y[index2(cc, cr, ldy)],beta);
             ALPHA_Number ctmp;
             alpha_setzero(ctmp);
-            for (ALPHA_INT ai = mat->rows_start[cr]; ai < mat->rows_end[cr]; ++ai)
+            for (ALPHA_OFFSET ai = mat->rows_start[cr]; ai < mat->rows_end[cr]; ++ai)
             {
                 ALPHA_INT ac = mat->col_indx[ai];
                 if (ac >= cr)
@@ -13,7 +13,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSR *mat,
 #endif
     for (ALPHA_INT ar = 0; ar < mat->rows; ar++)
     {
-        for (ALPHA_INT ai = mat->rows_start[ar]; ai < mat->rows_end[ar]; ai++)
+        for (ALPHA_OFFSET ai = mat->rows_start[ar]; ai < mat->rows_end[ar]; ai++)
         {
             if (mat->col_indx[ai] <= ar)
             {
@@ -39,7 +39,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSR *mat,
             ALPHA_Number *Y = &y[index2(r, 0, ldy)];
             for (ALPHA_INT c = 0; c <columns; c++)
                 alpha_mul(Y[c], Y[c], beta);
-            for (ALPHA_INT ai = mat->rows_start[r]; ai < mat->rows_end[r]; ai++)
+            for (ALPHA_OFFSET ai = mat->rows_start[r]; ai < mat->rows_end[r]; ai++)
             {
                 ALPHA_INT ac = mat->col_indx[ai];
                 if (ac <= r)
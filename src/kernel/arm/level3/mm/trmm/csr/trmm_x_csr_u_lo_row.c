@@ -15,7 +15,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSR *mat,
 #endif
     for (ALPHA_INT ar = 0; ar < mat->rows; ar++)
     {
-        for (ALPHA_INT ai = mat->rows_start[ar]; ai < mat->rows_end[ar]; ai++)
+        for (ALPHA_OFFSET ai = mat->rows_start[ar]; ai < mat->rows_end[ar]; ai++)
         {
             if (mat->col_indx[ai] < ar)
             {
@@ -49,7 +49,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSR *mat,
                 alpha_mul(ctmp, x[index2(r, c, ldx)], alpha);
                 alpha_add(Y[c], ctmp, Y[c]);
             }
-            for (ALPHA_INT ai = mat->rows_start[r]; ai < mat->rows_end[r]; ai++)
+            for (ALPHA_OFFSET ai = mat->rows_start[r]; ai < mat->rows_end[r]; ai++)
             {
                 ALPHA_INT ac = mat->col_indx[ai];
                 if (ac < r)
@@ -20,10 +20,10 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_SPMAT_CSR *B, A
     ALPHA_INT n = B->cols;
     ALPHA_INT64 flop[m];
     memset(flop,'\0',m*sizeof(ALPHA_INT64));
-    ALPHA_INT *row_offset = alpha_memalign(sizeof(ALPHA_INT) * (m + 1), DEFAULT_ALIGNMENT);
+    ALPHA_OFFSET *row_offset = alpha_memalign(sizeof(ALPHA_OFFSET) * (m + 1), DEFAULT_ALIGNMENT);
     mat->rows_start = row_offset;
     mat->rows_end = row_offset + 1;
-    memset(row_offset,'\0',sizeof(ALPHA_INT)*(m+1));
+    memset(row_offset,'\0',sizeof(ALPHA_OFFSET)*(m+1));
 
     ALPHA_INT num_thread = alpha_get_thread_num();
 #ifdef _OPENMP
@@ -33,11 +33,11 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_SPMAT_CSR *B, A
     {
         bool flag[n];
         memset(flag, '\0', sizeof(bool) * n);
-        for (ALPHA_INT ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
+        for (ALPHA_OFFSET ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
         {
             ALPHA_INT br = A->col_indx[ai];
             flop[ar] += B->rows_end[br] - B->rows_start[br];
-            for (ALPHA_INT bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
+            for (ALPHA_OFFSET bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
             {
                 if (!flag[B->col_indx[bi]])
                 {
@@ -53,7 +53,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_SPMAT_CSR *B, A
         flop[i] += flop[i - 1];
         mat->rows_end[i] += mat->rows_end[i-1];
     }
-    ALPHA_INT nnz = mat->rows_end[m-1];
+    ALPHA_OFFSET nnz = mat->rows_end[m-1];
 
     mat->col_indx = alpha_memalign(nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
     mat->values = alpha_memalign(nnz * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
@@ -67,12 +67,12 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_SPMAT_CSR *B, A
         memset(values, '\0', sizeof(ALPHA_Number) * n);
         bool write_back[n];
         memset(write_back, '\0', sizeof(bool) * n);
-        for (ALPHA_INT ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
+        for (ALPHA_OFFSET ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
         {
             ALPHA_INT br = A->col_indx[ai];
             ALPHA_Number av = A->values[ai];
-            ALPHA_INT bis = B->rows_start[br];
-            ALPHA_INT bie = B->rows_end[br];
+            ALPHA_OFFSET bis = B->rows_start[br];
+            ALPHA_OFFSET bie = B->rows_end[br];
             ALPHA_INT bil = bie-bis;
             const ALPHA_INT* B_col = &B->col_indx[bis];
             const ALPHA_Number* B_val = &B->values[bis];
@@ -105,7 +105,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_SPMAT_CSR *B, A
             }
         }
         
-        ALPHA_INT index = mat->rows_start[ar];
+        ALPHA_OFFSET index = mat->rows_start[ar];
         for (ALPHA_INT c = 0; c < n; c++)
         {
             if (write_back[c])
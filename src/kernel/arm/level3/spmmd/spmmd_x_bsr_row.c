@@ -40,10 +40,10 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_BSR *matA, const ALPHA_SPMAT_BSR *m
 #endif
     for (ALPHA_INT ar = 0; ar < A_block_rows; ar++)
     {
-        for (ALPHA_INT ai = matA->rows_start[ar]; ai < matA->rows_end[ar]; ai++)
+        for (ALPHA_OFFSET ai = matA->rows_start[ar]; ai < matA->rows_end[ar]; ai++)
         {
             ALPHA_INT br = matA->col_indx[ai];
-            for (ALPHA_INT bi = matB->rows_start[br]; bi < matB->rows_end[br]; bi++)
+            for (ALPHA_OFFSET bi = matB->rows_start[br]; bi < matB->rows_end[br]; bi++)
             {
                 ALPHA_INT bc = matB->col_indx[bi];
                 if(matA->block_layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR)
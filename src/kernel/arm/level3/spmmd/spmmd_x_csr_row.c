@@ -29,7 +29,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *matA, const ALPHA_SPMAT_CSR *m
 #endif
     for (ALPHA_INT ar = 0; ar < m; ar++)
     {
-        for (ALPHA_INT ai = matA->rows_start[ar]; ai < matA->rows_end[ar]; ai++)
+        for (ALPHA_OFFSET ai = matA->rows_start[ar]; ai < matA->rows_end[ar]; ai++)
         {
             ALPHA_INT br = matA->col_indx[ai];
             flop[ar] += matB->rows_end[br] - matB->rows_start[br];
@@ -52,11 +52,11 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *matA, const ALPHA_SPMAT_CSR *m
         ALPHA_INT local_m_e = partition[tid + 1];
         for (ALPHA_INT ar = local_m_s; ar < local_m_e; ar++)
         {
-            for (ALPHA_INT ai = matA->rows_start[ar]; ai < matA->rows_end[ar]; ai++)
+            for (ALPHA_OFFSET ai = matA->rows_start[ar]; ai < matA->rows_end[ar]; ai++)
             {
                 ALPHA_INT br = matA->col_indx[ai];
                 ALPHA_Number av = matA->values[ai];
-                for (ALPHA_INT bi = matB->rows_start[br]; bi < matB->rows_end[br]; bi++)
+                for (ALPHA_OFFSET bi = matB->rows_start[br]; bi < matB->rows_end[br]; bi++)
                 {
                     ALPHA_INT bc = matB->col_indx[bi];
                     ALPHA_Number bv = matB->values[bi];
@@ -30,7 +30,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *A, c
                 alpha_setzero(temp[i]);
             }
             ALPHA_INT diagBlock = -1;
-            for (ALPHA_INT ai = A->rows_start[br]; ai < A->rows_end[br]; ai++)
+            for (ALPHA_OFFSET ai = A->rows_start[br]; ai < A->rows_end[br]; ai++)
             {
                 ALPHA_INT bc = A->col_indx[ai];
                 if(bc > br)
@@ -16,7 +16,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSR *A, c
         {
             ALPHA_Number temp;
             alpha_setzero(temp);
-            for (ALPHA_INT ai = A->rows_start[r]; ai < A->rows_end[r]; ai++)
+            for (ALPHA_OFFSET ai = A->rows_start[r]; ai < A->rows_end[r]; ai++)
             {
                 ALPHA_INT ac = A->col_indx[ai];
                 if (ac > r)
@@ -6,47 +6,59 @@
 #include <omp.h>
 #endif
 
+/*
+* indx == NULL && indy == NULL  values holds all blocks in storage order, nnz * block_size^2 entries
+* otherwise                     entry i of values goes to (indx[i], indy[i]), index locates its block
+*/
 alphasparse_status_t
-ONAME(ALPHA_SPMAT_BSR *A, 
-	  const ALPHA_INT nvalues, 
-	  const ALPHA_INT *indx, 
-	  const ALPHA_INT *indy, 
-	  ALPHA_Number *values)
+ONAME(ALPHA_SPMAT_BSR *A,
+	  const alpha_value_index_t *index,
+	  const ALPHA_INT nvalues,
+	  const ALPHA_INT *indx,
+	  const ALPHA_INT *indy,
+	  const ALPHA_Number *values)
 {
 	ALPHA_INT num_thread = alpha_get_thread_num();
-	ALPHA_INT find = 0;
+	const ALPHA_INT bs = A->block_size;
+	const ALPHA_INT64 bs2 = (ALPHA_INT64)bs * bs;
 
+	if(indx == NULL && indy == NULL)
+	{
+		const ALPHA_INT64 nnz = A->rows == 0 ? 0 : (ALPHA_INT64)(A->rows_end[A->rows - 1] - A->rows_start[0]) * bs2;
+		check_return(nvalues != nnz, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+		ALPHA_Number *dst = &A->values[A->rows_start[0] * bs2];
 #ifdef _OPENMP
-#pragma omp parallel for num_threads(num_thread) reduction(+:find)
+#pragma omp parallel for num_threads(num_thread)
+#endif
+		for(ALPHA_INT64 i = 0; i < nnz; i++)
+			dst[i] = values[i];
+		return ALPHA_SPARSE_STATUS_SUCCESS;
+	}
+
+	ALPHA_INT miss = 0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_thread) reduction(+:miss)
 #endif
 	for(ALPHA_INT i = 0; i < nvalues; i++)
 	{
-		ALPHA_INT row = indx[i];
-		ALPHA_INT col = indy[i];
-		ALPHA_INT bs = A->block_size;
-		ALPHA_INT block_row = row / bs;
-		ALPHA_INT block_col = col / bs;
-		ALPHA_INT block_row_inside = row % bs;
-		ALPHA_INT block_col_inside = col % bs;
-		for(ALPHA_INT ai = A->rows_start[block_row]; ai < A->rows_end[block_row]; ai++)
+		const ALPHA_INT row = indx[i];
+		const ALPHA_INT col = indy[i];
+		const ALPHA_OFFSET ai = alpha_value_index_find(index, row / bs, col / bs);
+		if(ai < 0)
 		{
-			const ALPHA_INT ac = A->col_indx[ai];
-			if(ac == block_col)
-			{
-				ALPHA_INT idx = 0;
-				if(A->block_layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR)
-					idx = ai * bs * bs + block_row_inside * bs + block_col_inside;
-				else
-					idx = ai * bs * bs + block_row_inside + block_col_inside * bs;
-				
-				A->values[idx] = values[i];
-				find ++;
-				break;
-			}
+			miss++;
+			continue;
 		}
+		ALPHA_INT64 idx;
+		if(A->block_layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR)
+			idx = ai * bs2 + (row % bs) * bs + col % bs;
+		else
+			idx = ai * bs2 + (row % bs) + (col % bs) * bs;
+		A->values[idx] = values[i];
 	}
-	if(find)
-		return ALPHA_SPARSE_STATUS_SUCCESS;
+
+	if(miss)
+		return ALPHA_SPARSE_STATUS_INVALID_VALUE;
 	else
-		return ALPHA_SPARSE_STATUS_INVALID_VALUE;	
+		return ALPHA_SPARSE_STATUS_SUCCESS;
 }
@@ -0,0 +1,53 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/opt.h"
+#include "alphasparse/util.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*
+* indx == NULL && indy == NULL  values holds all nnz entries in storage order
+* otherwise                     entry i of values goes to (indx[i], indy[i]), located through index
+*/
+alphasparse_status_t
+ONAME(ALPHA_SPMAT_CSR *A,
+	  const alpha_value_index_t *index,
+	  const ALPHA_INT nvalues,
+	  const ALPHA_INT *indx,
+	  const ALPHA_INT *indy,
+	  const ALPHA_Number *values)
+{
+	ALPHA_INT num_thread = alpha_get_thread_num();
+
+	if(indx == NULL && indy == NULL)
+	{
+		const ALPHA_OFFSET nnz = A->rows == 0 ? 0 : A->rows_end[A->rows - 1] - A->rows_start[0];
+		check_return(nvalues != nnz, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+		ALPHA_Number *dst = &A->values[A->rows_start[0]];
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_thread)
+#endif
+		for(ALPHA_OFFSET i = 0; i < nnz; i++)
+			dst[i] = values[i];
+		return ALPHA_SPARSE_STATUS_SUCCESS;
+	}
+
+	ALPHA_INT miss = 0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_thread) reduction(+:miss)
+#endif
+	for(ALPHA_INT i = 0; i < nvalues; i++)
+	{
+		const ALPHA_OFFSET ai = alpha_value_index_find(index, indx[i], indy[i]);
+		if(ai < 0)
+			miss++;
+		else
+			A->values[ai] = values[i];
+	}
+
+	if(miss)
+		return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+	else
+		return ALPHA_SPARSE_STATUS_SUCCESS;
+}
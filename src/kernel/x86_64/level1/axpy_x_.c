@@ -1,4 +1,38 @@
 #include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/vec_index.h"
+
+// y[indx[i]] += a * x[i] for distinct indices, whole vectors are gathered, updated and scattered back
+static void axpy_block(const ALPHA_INT nz, const ALPHA_Number a, const ALPHA_Number *x, const ALPHA_INT *indx, ALPHA_Number *y)
+{
+	ALPHA_INT i = 0;
+#if defined(__AVX512F__) && (defined(S) || defined(D))
+	if (sizeof(ALPHA_INT) == 4)
+	{
+#ifdef S
+		const __m512 va = _mm512_set1_ps(a);
+		for (; i + 16 <= nz; i += 16)
+		{
+			const __m512i vi = _mm512_loadu_si512((const void *)(indx + i));
+			const __m512 vy = _mm512_i32gather_ps(vi, y, 4);
+			_mm512_i32scatter_ps(y, vi, _mm512_fmadd_ps(va, _mm512_loadu_ps(x + i), vy), 4);
+		}
+#else
+		const __m512d va = _mm512_set1_pd(a);
+		for (; i + 8 <= nz; i += 8)
+		{
+			const __m256i vi = _mm256_loadu_si256((const __m256i *)(indx + i));
+			const __m512d vy = _mm512_i32gather_pd(vi, y, 8);
+			_mm512_i32scatter_pd(y, vi, _mm512_fmadd_pd(va, _mm512_loadu_pd(x + i), vy), 8);
+		}
+#endif
+	}
+#endif
+	for (; i < nz; ++i)
+	{
+		alpha_madde(y[indx[i]], a, x[i]);
+	}
+}
 
 alphasparse_status_t
 ONAME(const ALPHA_INT nz,
@@ -7,9 +41,40 @@ ONAME(const ALPHA_INT nz,
 	  const ALPHA_INT *indx,
 	  ALPHA_Number *y)
 {
-	for (ALPHA_INT i = 0; i < nz; ++i)
+	if (nz <= 0)
+		return ALPHA_SPARSE_STATUS_SUCCESS;
+	const ALPHA_INT thread_num = alpha_level1_thread_num(nz);
+	const bool contiguous = alpha_index_contiguous(nz, indx);
+	// blocks may only run side by side when no index repeats, which a strictly increasing indx
+	// proves, the scan proving it is skipped when a single thread would run them anyway
+	if (!contiguous && (thread_num == 1 || alpha_index_order(nz, indx) != ALPHA_INDEX_SORTED))
 	{
-		alpha_madde(y[indx[i]], a, x[i]);
+		// a repeated index must accumulate every one of its terms
+		for (ALPHA_INT i = 0; i < nz; ++i)
+		{
+			alpha_madde(y[indx[i]], a, x[i]);
+		}
+		return ALPHA_SPARSE_STATUS_SUCCESS;
+	}
+	const ALPHA_INT block_num = (nz + ALPHA_LEVEL1_BLOCK - 1) / ALPHA_LEVEL1_BLOCK;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static)
+#endif
+	for (ALPHA_INT b = 0; b < block_num; ++b)
+	{
+		const ALPHA_INT bs = b * ALPHA_LEVEL1_BLOCK;
+		const ALPHA_INT bnz = alpha_min(ALPHA_LEVEL1_BLOCK, nz - bs);
+		if (contiguous)
+		{
+			ALPHA_Number *yb = y + indx[0] + bs;
+			const ALPHA_Number *xb = x + bs;
+			for (ALPHA_INT i = 0; i < bnz; ++i)
+			{
+				alpha_madde(yb[i], a, xb[i]);
+			}
+		}
+		else
+			axpy_block(bnz, a, x + bs, indx + bs, y);
 	}
 	return ALPHA_SPARSE_STATUS_SUCCESS;
 }
@@ -1,5 +1,51 @@
 #include "alphasparse/kernel.h"
 #include "alphasparse/util.h"
+#include "alphasparse/util/vec_index.h"
+
+// sum of conj(x[i]) * y[indx[i]] with four independent accumulators, y is indexed directly when indx is NULL
+static ALPHA_Complex dotci_block(const ALPHA_INT nz, const ALPHA_Complex *x, const ALPHA_INT *indx, const ALPHA_Complex *y)
+{
+	ALPHA_Complex r[4], t;
+	for (ALPHA_INT k = 0; k < 4; k++)
+		cmp_setzero(r[k]);
+	ALPHA_INT i = 0;
+	if (indx == NULL)
+	{
+		for (; i + 4 <= nz; i += 4)
+		{
+			for (ALPHA_INT k = 0; k < 4; k++)
+			{
+				cmp_conj(t, x[i + k]);
+				cmp_madde(r[k], t, y[i + k]);
+			}
+		}
+		for (; i < nz; i++)
+		{
+			cmp_conj(t, x[i]);
+			cmp_madde(r[0], t, y[i]);
+		}
+	}
+	else
+	{
+		for (; i + 4 <= nz; i += 4)
+		{
+			for (ALPHA_INT k = 0; k < 4; k++)
+			{
+				cmp_conj(t, x[i + k]);
+				cmp_madde(r[k], t, y[indx[i + k]]);
+			}
+		}
+		for (; i < nz; i++)
+		{
+			cmp_conj(t, x[i]);
+			cmp_madde(r[0], t, y[indx[i]]);
+		}
+	}
+	cmp_adde(r[0], r[1]);
+	cmp_adde(r[2], r[3]);
+	cmp_adde(r[0], r[2]);
+	return r[0];
+}
 
 void ONAME(const ALPHA_INT nz,
 		   const ALPHA_Complex *x,
@@ -14,12 +60,24 @@ void ONAME(const ALPHA_INT nz,
 		fprintf(stderr, "Invalid Values : nz <= 0 !\n");
 		return;
 	}
-	for (ALPHA_INT i = 0; i < nz; i++)
+	const bool contiguous = alpha_index_contiguous(nz, indx);
+	const ALPHA_INT thread_num = alpha_level1_thread_num(nz);
+	const ALPHA_INT block_num = (nz + ALPHA_LEVEL1_BLOCK - 1) / ALPHA_LEVEL1_BLOCK;
+	ALPHA_Float real = res.real, imag = res.imag;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static) reduction(+ : real, imag)
+#endif
+	for (ALPHA_INT b = 0; b < block_num; ++b)
 	{
-		ALPHA_Complex t;
-		cmp_conj(t, x[i]);
-		cmp_madde(res, t, y[indx[i]]);
+		const ALPHA_INT bs = b * ALPHA_LEVEL1_BLOCK;
+		const ALPHA_INT bnz = alpha_min(ALPHA_LEVEL1_BLOCK, nz - bs);
+		const ALPHA_Complex part = contiguous ? dotci_block(bnz, x + bs, NULL, y + indx[0] + bs)
+											  : dotci_block(bnz, x + bs, indx + bs, y);
+		real += part.real;
+		imag += part.imag;
 	}
+	res.real = real;
+	res.imag = imag;
 	*dotci = res;
 	return;
 }
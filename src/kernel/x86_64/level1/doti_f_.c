@@ -1,6 +1,81 @@
 #include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/vec_index.h"
 #include <stdio.h>
 
+// sum of x[i] * y[indx[i]], gathered a vector at a time into independent accumulators
+static ALPHA_Float doti_block(const ALPHA_INT nz, const ALPHA_Float *x, const ALPHA_INT *indx, const ALPHA_Float *y)
+{
+	ALPHA_INT i = 0;
+	ALPHA_Float res = 0.f;
+#if defined(__AVX512F__)
+	if (sizeof(ALPHA_INT) == 4)
+	{
+#ifdef S
+		__m512 acc0 = _mm512_setzero_ps(), acc1 = _mm512_setzero_ps();
+		for (; i + 32 <= nz; i += 32)
+		{
+			const __m512 y0 = _mm512_i32gather_ps(_mm512_loadu_si512((const void *)(indx + i)), y, 4);
+			const __m512 y1 = _mm512_i32gather_ps(_mm512_loadu_si512((const void *)(indx + i + 16)), y, 4);
+			acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i), y0, acc0);
+			acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i + 16), y1, acc1);
+		}
+		res = _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+#else
+		__m512d acc0 = _mm512_setzero_pd(), acc1 = _mm512_setzero_pd();
+		for (; i + 16 <= nz; i += 16)
+		{
+			const __m512d y0 = _mm512_i32gather_pd(_mm256_loadu_si256((const __m256i *)(indx + i)), y, 8);
+			const __m512d y1 = _mm512_i32gather_pd(_mm256_loadu_si256((const __m256i *)(indx + i + 8)), y, 8);
+			acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), y0, acc0);
+			acc1 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i + 8), y1, acc1);
+		}
+		res = _mm512_reduce_add_pd(_mm512_add_pd(acc0, acc1));
+#endif
+	}
+#elif defined(__AVX2__)
+	if (sizeof(ALPHA_INT) == 4)
+	{
+#ifdef S
+		__m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+		for (; i + 16 <= nz; i += 16)
+		{
+			const __m256 y0 = _mm256_i32gather_ps(y, _mm256_loadu_si256((const __m256i *)(indx + i)), 4);
+			const __m256 y1 = _mm256_i32gather_ps(y, _mm256_loadu_si256((const __m256i *)(indx + i + 8)), 4);
+			acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i), y0, acc0);
+			acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i + 8), y1, acc1);
+		}
+		float lanes[8];
+		_mm256_storeu_ps(lanes, _mm256_add_ps(acc0, acc1));
+#else
+		__m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+		for (; i + 8 <= nz; i += 8)
+		{
+			const __m256d y0 = _mm256_i32gather_pd(y, _mm_loadu_si128((const __m128i *)(indx + i)), 8);
+			const __m256d y1 = _mm256_i32gather_pd(y, _mm_loadu_si128((const __m128i *)(indx + i + 4)), 8);
+			acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), y0, acc0);
+			acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 4), y1, acc1);
+		}
+		double lanes[4];
+		_mm256_storeu_pd(lanes, _mm256_add_pd(acc0, acc1));
+#endif
+		for (ALPHA_INT l = 0; l < (ALPHA_INT)(sizeof(lanes) / sizeof(lanes[0])); l++)
+			res += lanes[l];
+	}
+#endif
+	ALPHA_Float r0 = 0.f, r1 = 0.f, r2 = 0.f, r3 = 0.f;
+	for (; i + 4 <= nz; i += 4)
+	{
+		r0 += x[i] * y[indx[i]];
+		r1 += x[i + 1] * y[indx[i + 1]];
+		r2 += x[i + 2] * y[indx[i + 2]];
+		r3 += x[i + 3] * y[indx[i + 3]];
+	}
+	for (; i < nz; i++)
+		r0 += x[i] * y[indx[i]];
+	return res + (r0 + r1) + (r2 + r3);
+}
+
 ALPHA_Float ONAME(const ALPHA_INT nz,
 				const ALPHA_Float *x,
 				const ALPHA_INT *indx,
@@ -12,8 +87,25 @@ ALPHA_Float ONAME(const ALPHA_INT nz,
 		fprintf(stderr, "Invalid Values : nz <= 0 !\n");
 		return res;
 	}
-
-	for (ALPHA_INT i = 0; i < nz; i++)
-		res += x[i] * y[indx[i]];
+	const bool contiguous = alpha_index_contiguous(nz, indx);
+	const ALPHA_INT thread_num = alpha_level1_thread_num(nz);
+	const ALPHA_INT block_num = (nz + ALPHA_LEVEL1_BLOCK - 1) / ALPHA_LEVEL1_BLOCK;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static) reduction(+ : res)
+#endif
+	for (ALPHA_INT b = 0; b < block_num; ++b)
+	{
+		const ALPHA_INT bs = b * ALPHA_LEVEL1_BLOCK;
+		const ALPHA_INT bnz = alpha_min(ALPHA_LEVEL1_BLOCK, nz - bs);
+		if (contiguous)
+		{
+			const ALPHA_Float *xb = x + bs;
+			const ALPHA_Float *yb = y + indx[0] + bs;
+			for (ALPHA_INT i = 0; i < bnz; i++)
+				res += xb[i] * yb[i];
+		}
+		else
+			res += doti_block(bnz, x + bs, indx + bs, y);
+	}
 	return res;
 }
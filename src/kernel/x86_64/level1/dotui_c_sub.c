@@ -1,5 +1,45 @@
 #include "alphasparse/kernel.h"
 #include "alphasparse/util.h"
+#include "alphasparse/util/vec_index.h"
+
+// sum of x[i] * y[indx[i]] with four independent accumulators, y is indexed directly when indx is NULL
+static ALPHA_Complex dotui_block(const ALPHA_INT nz, const ALPHA_Complex *x, const ALPHA_INT *indx, const ALPHA_Complex *y)
+{
+	ALPHA_Complex r0, r1, r2, r3;
+	alpha_setzero(r0);
+	alpha_setzero(r1);
+	alpha_setzero(r2);
+	alpha_setzero(r3);
+	ALPHA_INT i = 0;
+	if (indx == NULL)
+	{
+		for (; i + 4 <= nz; i += 4)
+		{
+			cmp_madde(r0, x[i], y[i]);
+			cmp_madde(r1, x[i + 1], y[i + 1]);
+			cmp_madde(r2, x[i + 2], y[i + 2]);
+			cmp_madde(r3, x[i + 3], y[i + 3]);
+		}
+		for (; i < nz; i++)
+			cmp_madde(r0, x[i], y[i]);
+	}
+	else
+	{
+		for (; i + 4 <= nz; i += 4)
+		{
+			cmp_madde(r0, x[i], y[indx[i]]);
+			cmp_madde(r1, x[i + 1], y[indx[i + 1]]);
+			cmp_madde(r2, x[i + 2], y[indx[i + 2]]);
+			cmp_madde(r3, x[i + 3], y[indx[i + 3]]);
+		}
+		for (; i < nz; i++)
+			cmp_madde(r0, x[i], y[indx[i]]);
+	}
+	cmp_adde(r0, r1);
+	cmp_adde(r2, r3);
+	cmp_adde(r0, r2);
+	return r0;
+}
 
 void ONAME(const ALPHA_INT nz,
 		   const ALPHA_Complex *x,
@@ -14,9 +54,24 @@ void ONAME(const ALPHA_INT nz,
 		fprintf(stderr, "Invalid Values : nz <= 0 !\n");
 		return;
 	}
-	for (ALPHA_INT i = 0; i < nz; i++)
-		cmp_madde(res, x[i], y[indx[i]]);
-
+	const bool contiguous = alpha_index_contiguous(nz, indx);
+	const ALPHA_INT thread_num = alpha_level1_thread_num(nz);
+	const ALPHA_INT block_num = (nz + ALPHA_LEVEL1_BLOCK - 1) / ALPHA_LEVEL1_BLOCK;
+	ALPHA_Float real = res.real, imag = res.imag;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static) reduction(+ : real, imag)
+#endif
+	for (ALPHA_INT b = 0; b < block_num; ++b)
+	{
+		const ALPHA_INT bs = b * ALPHA_LEVEL1_BLOCK;
+		const ALPHA_INT bnz = alpha_min(ALPHA_LEVEL1_BLOCK, nz - bs);
+		const ALPHA_Complex part = contiguous ? dotui_block(bnz, x + bs, NULL, y + indx[0] + bs)
+											  : dotui_block(bnz, x + bs, indx + bs, y);
+		real += part.real;
+		imag += part.imag;
+	}
+	res.real = real;
+	res.imag = imag;
 	(*dotui) = res;
 	return;
 }
@@ -1,4 +1,22 @@
 #include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/vec_index.h"
+#include <string.h>
+
+static void gthr_block(const ALPHA_INT nz, const ALPHA_Number *y, ALPHA_Number *x, const ALPHA_INT *indx)
+{
+#if defined(S)
+	ALPHA_INT i = vec_gather_b32(nz, y, x, indx);
+#elif defined(D) || defined(C)
+	ALPHA_INT i = vec_gather_b64(nz, y, x, indx);
+#else
+	ALPHA_INT i = 0;
+#endif
+	for (; i < nz; ++i)
+	{
+		x[i] = y[indx[i]];
+	}
+}
 
 alphasparse_status_t
 ONAME(const ALPHA_INT nz,
@@ -6,9 +24,23 @@ ONAME(const ALPHA_INT nz,
 	  ALPHA_Number *x,
 	  const ALPHA_INT *indx)
 {
-	for (ALPHA_INT i = 0; i < nz; ++i)
+	if (nz <= 0)
+		return ALPHA_SPARSE_STATUS_SUCCESS;
+	// a contiguous run of y is copied as is
+	const bool contiguous = alpha_index_contiguous(nz, indx);
+	const ALPHA_INT thread_num = alpha_level1_thread_num(nz);
+	const ALPHA_INT block_num = (nz + ALPHA_LEVEL1_BLOCK - 1) / ALPHA_LEVEL1_BLOCK;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static)
+#endif
+	for (ALPHA_INT b = 0; b < block_num; ++b)
 	{
-		x[i] = y[indx[i]];
+		const ALPHA_INT bs = b * ALPHA_LEVEL1_BLOCK;
+		const ALPHA_INT bnz = alpha_min(ALPHA_LEVEL1_BLOCK, nz - bs);
+		if (contiguous)
+			memcpy(x + bs, y + indx[0] + bs, sizeof(ALPHA_Number) * bnz);
+		else
+			gthr_block(bnz, y, x + bs, indx + bs);
 	}
 	return ALPHA_SPARSE_STATUS_SUCCESS;
 }
@@ -1,4 +1,26 @@
 #include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/vec_index.h"
+#include <string.h>
+
+static void gthrz_block(const ALPHA_INT nz, ALPHA_Number *y, ALPHA_Number *x, const ALPHA_INT *indx)
+{
+#if defined(S)
+	ALPHA_INT i = vec_gather_b32(nz, y, x, indx);
+#elif defined(D) || defined(C)
+	ALPHA_INT i = vec_gather_b64(nz, y, x, indx);
+#else
+	ALPHA_INT i = 0;
+#endif
+	for (; i < nz; ++i)
+	{
+		x[i] = y[indx[i]];
+	}
+	for (i = 0; i < nz; ++i)
+	{
+		alpha_setzero(y[indx[i]]);
+	}
+}
 
 alphasparse_status_t
 ONAME(const ALPHA_INT nz,
@@ -6,10 +28,37 @@ ONAME(const ALPHA_INT nz,
 	  ALPHA_Number *x,
 	  const ALPHA_INT *indx)
 {
-	for (ALPHA_INT i = 0; i < nz; ++i)
+	if (nz <= 0)
+		return ALPHA_SPARSE_STATUS_SUCCESS;
+	const ALPHA_INT thread_num = alpha_level1_thread_num(nz);
+	const bool contiguous = alpha_index_contiguous(nz, indx);
+	// blocks may only run side by side when no index repeats, which a strictly increasing indx
+	// proves, the scan proving it is skipped when a single thread would run them anyway
+	if (!contiguous && (thread_num == 1 || alpha_index_order(nz, indx) != ALPHA_INDEX_SORTED))
 	{
-		x[i] = y[indx[i]];
-		alpha_setzero(y[indx[i]]);
+		// a repeated index must gather the zero stored by its first occurrence
+		for (ALPHA_INT i = 0; i < nz; ++i)
+		{
+			x[i] = y[indx[i]];
+			alpha_setzero(y[indx[i]]);
+		}
+		return ALPHA_SPARSE_STATUS_SUCCESS;
+	}
+	const ALPHA_INT block_num = (nz + ALPHA_LEVEL1_BLOCK - 1) / ALPHA_LEVEL1_BLOCK;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static)
+#endif
+	for (ALPHA_INT b = 0; b < block_num; ++b)
+	{
+		const ALPHA_INT bs = b * ALPHA_LEVEL1_BLOCK;
+		const ALPHA_INT bnz = alpha_min(ALPHA_LEVEL1_BLOCK, nz - bs);
+		if (contiguous)
+		{
+			memcpy(x + bs, y + indx[0] + bs, sizeof(ALPHA_Number) * bnz);
+			memset(y + indx[0] + bs, 0, sizeof(ALPHA_Number) * bnz);
+		}
+		else
+			gthrz_block(bnz, y, x + bs, indx + bs);
 	}
 	return ALPHA_SPARSE_STATUS_SUCCESS;
 }
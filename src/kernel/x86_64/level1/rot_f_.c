@@ -1,4 +1,44 @@
 #include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/vec_index.h"
+
+// rotate the pairs (x[i], y[indx[i]]) for distinct indices, whole vectors at a time
+static void rot_block(const ALPHA_INT nz, ALPHA_Float *x, const ALPHA_INT *indx, ALPHA_Float *y, const ALPHA_Float c, const ALPHA_Float s)
+{
+	ALPHA_INT i = 0;
+#if defined(__AVX512F__)
+	if (sizeof(ALPHA_INT) == 4)
+	{
+#ifdef S
+		const __m512 vc = _mm512_set1_ps(c), vs = _mm512_set1_ps(s);
+		for (; i + 16 <= nz; i += 16)
+		{
+			const __m512i vi = _mm512_loadu_si512((const void *)(indx + i));
+			const __m512 vx = _mm512_loadu_ps(x + i);
+			const __m512 vy = _mm512_i32gather_ps(vi, y, 4);
+			_mm512_storeu_ps(x + i, _mm512_fmadd_ps(vc, vx, _mm512_mul_ps(vs, vy)));
+			_mm512_i32scatter_ps(y, vi, _mm512_fmsub_ps(vc, vy, _mm512_mul_ps(vs, vx)), 4);
+		}
+#else
+		const __m512d vc = _mm512_set1_pd(c), vs = _mm512_set1_pd(s);
+		for (; i + 8 <= nz; i += 8)
+		{
+			const __m256i vi = _mm256_loadu_si256((const __m256i *)(indx + i));
+			const __m512d vx = _mm512_loadu_pd(x + i);
+			const __m512d vy = _mm512_i32gather_pd(vi, y, 8);
+			_mm512_storeu_pd(x + i, _mm512_fmadd_pd(vc, vx, _mm512_mul_pd(vs, vy)));
+			_mm512_i32scatter_pd(y, vi, _mm512_fmsub_pd(vc, vy, _mm512_mul_pd(vs, vx)), 8);
+		}
+#endif
+	}
+#endif
+	for (; i < nz; ++i)
+	{
+		ALPHA_Float t = x[i];
+		x[i] = c * x[i] + s * y[indx[i]];
+		y[indx[i]] = c * y[indx[i]] - s * t;
+	}
+}
 
 alphasparse_status_t
 ONAME(const ALPHA_INT nz,
@@ -8,11 +48,44 @@ ONAME(const ALPHA_INT nz,
 	  const ALPHA_Float c,
 	  const ALPHA_Float s)
 {
-	for (ALPHA_INT i = 0; i < nz; ++i)
+	if (nz <= 0)
+		return ALPHA_SPARSE_STATUS_SUCCESS;
+	const ALPHA_INT thread_num = alpha_level1_thread_num(nz);
+	const bool contiguous = alpha_index_contiguous(nz, indx);
+	// blocks may only run side by side when no index repeats, which a strictly increasing indx
+	// proves, the scan proving it is skipped when a single thread would run them anyway
+	if (!contiguous && (thread_num == 1 || alpha_index_order(nz, indx) != ALPHA_INDEX_SORTED))
 	{
-		ALPHA_Float t = x[i];
-		x[i] = c * x[i] + s * y[indx[i]];
-		y[indx[i]] = c * y[indx[i]] - s * t;
+		// a repeated index must see the value rotated by its earlier occurrence
+		for (ALPHA_INT i = 0; i < nz; ++i)
+		{
+			ALPHA_Float t = x[i];
+			x[i] = c * x[i] + s * y[indx[i]];
+			y[indx[i]] = c * y[indx[i]] - s * t;
+		}
+		return ALPHA_SPARSE_STATUS_SUCCESS;
+	}
+	const ALPHA_INT block_num = (nz + ALPHA_LEVEL1_BLOCK - 1) / ALPHA_LEVEL1_BLOCK;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static)
+#endif
+	for (ALPHA_INT b = 0; b < block_num; ++b)
+	{
+		const ALPHA_INT bs = b * ALPHA_LEVEL1_BLOCK;
+		const ALPHA_INT bnz = alpha_min(ALPHA_LEVEL1_BLOCK, nz - bs);
+		if (contiguous)
+		{
+			ALPHA_Float *xb = x + bs;
+			ALPHA_Float *yb = y + indx[0] + bs;
+			for (ALPHA_INT i = 0; i < bnz; ++i)
+			{
+				ALPHA_Float t = xb[i];
+				xb[i] = c * xb[i] + s * yb[i];
+				yb[i] = c * yb[i] - s * t;
+			}
+		}
+		else
+			rot_block(bnz, x + bs, indx + bs, y, c, s);
 	}
 	return ALPHA_SPARSE_STATUS_SUCCESS;
 }
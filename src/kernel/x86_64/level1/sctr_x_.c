@@ -1,4 +1,23 @@
 #include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/vec_index.h"
+#include <string.h>
+
+// stores in index order, so a repeated index keeps its last value
+static void sctr_block(const ALPHA_INT nz, const ALPHA_Number *x, const ALPHA_INT *indx, ALPHA_Number *y)
+{
+#if defined(S)
+	ALPHA_INT i = vec_scatter_b32(nz, x, indx, y);
+#elif defined(D) || defined(C)
+	ALPHA_INT i = vec_scatter_b64(nz, x, indx, y);
+#else
+	ALPHA_INT i = 0;
+#endif
+	for (; i < nz; ++i)
+	{
+		y[indx[i]] = x[i];
+	}
+}
 
 alphasparse_status_t
 ONAME(const ALPHA_INT nz,
@@ -6,9 +25,30 @@ ONAME(const ALPHA_INT nz,
 	  const ALPHA_INT *indx,
 	  ALPHA_Number *y)
 {
-	for (ALPHA_INT i = 0; i < nz; ++i)
+	if (nz <= 0)
+		return ALPHA_SPARSE_STATUS_SUCCESS;
+	const ALPHA_INT thread_num = alpha_level1_thread_num(nz);
+	const bool contiguous = alpha_index_contiguous(nz, indx);
+	// blocks may only run side by side when no index repeats, which a strictly increasing indx
+	// proves, the scan proving it is skipped when a single thread would run them anyway
+	if (!contiguous && (thread_num == 1 || alpha_index_order(nz, indx) != ALPHA_INDEX_SORTED))
 	{
-		y[indx[i]] = x[i];
+		// vector scatters keep lane order, so a single pass stays in index order
+		sctr_block(nz, x, indx, y);
+		return ALPHA_SPARSE_STATUS_SUCCESS;
+	}
+	const ALPHA_INT block_num = (nz + ALPHA_LEVEL1_BLOCK - 1) / ALPHA_LEVEL1_BLOCK;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static)
+#endif
+	for (ALPHA_INT b = 0; b < block_num; ++b)
+	{
+		const ALPHA_INT bs = b * ALPHA_LEVEL1_BLOCK;
+		const ALPHA_INT bnz = alpha_min(ALPHA_LEVEL1_BLOCK, nz - bs);
+		if (contiguous)
+			memcpy(y + indx[0] + bs, x + bs, sizeof(ALPHA_Number) * bnz);
+		else
+			sctr_block(bnz, x + bs, indx + bs, y);
 	}
 	return ALPHA_SPARSE_STATUS_SUCCESS;
 }
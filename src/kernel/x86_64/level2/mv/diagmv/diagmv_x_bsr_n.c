@@ -24,7 +24,7 @@ ONAME(const ALPHA_Number alpha,
 		ALPHA_INT diag_block = 0;
 		 ALPHA_Number temp;
 		alpha_setzero(temp);
-			for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i];ai++){
+			for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i];ai++){
 				// the block is the diag one
 				if(A->col_indx[ai] == i){
 					diag_block = 1;
@@ -49,7 +49,7 @@ ONAME(const ALPHA_Number alpha,
 		ALPHA_INT diag_block = 0;
 		 ALPHA_Number temp;
 		alpha_setzero(temp);
-			for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i];ai++){
+			for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i];ai++){
 				// the block is the diag one
 				if(A->col_indx[ai] == i){
 					diag_block = 1;
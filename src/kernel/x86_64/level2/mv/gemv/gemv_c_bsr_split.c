@@ -0,0 +1,106 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/opt.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <string.h>
+
+/*
+* y := alpha * A * x + beta * y with the parts of the blocks in re and im.
+* The block of x a block multiplies is split once, after that a block is
+* plain real arithmetic on four part arrays, which vectorizes over the
+* inner columns (row major blocks) or the inner rows (column major blocks).
+*/
+static alphasparse_status_t
+gemv_bsr_split_for_each_thread(const ALPHA_Complex alpha,
+                               const ALPHA_SPMAT_BSR *A,
+                               const ALPHA_Float *re,
+                               const ALPHA_Float *im,
+                               const ALPHA_Complex *x,
+                               const ALPHA_Complex beta,
+                               ALPHA_Complex *y,
+                               ALPHA_INT lrs,
+                               ALPHA_INT lre)
+{
+    const ALPHA_INT bs = A->block_size;
+    const size_t bs2 = (size_t)bs * bs;
+    const bool row_major = A->block_layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR;
+    // parts of the current block of x, then of the sums of the current block row
+    ALPHA_Float *part = malloc(sizeof(ALPHA_Float) * 4 * bs);
+    check_null_return(part, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+    ALPHA_Float *xr = part, *xi = part + bs, *tr = part + 2 * bs, *ti = part + 3 * bs;
+    for (ALPHA_INT i = lrs; i < lre; i++)
+    {
+        memset(tr, 0, sizeof(ALPHA_Float) * 2 * bs);
+        for (ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ai++)
+        {
+            const ALPHA_Complex *X = x + (size_t)bs * A->col_indx[ai];
+            for (ALPHA_INT c = 0; c < bs; c++)
+            {
+                xr[c] = X[c].real;
+                xi[c] = X[c].imag;
+            }
+            const ALPHA_Float *br = re + ai * bs2, *bi = im + ai * bs2;
+            if (row_major)
+            {
+                for (ALPHA_INT r = 0; r < bs; r++)
+                {
+                    ALPHA_Float sr = 0, si = 0;
+                    for (ALPHA_INT c = 0; c < bs; c++)
+                    {
+                        sr += br[r * bs + c] * xr[c] - bi[r * bs + c] * xi[c];
+                        si += br[r * bs + c] * xi[c] + bi[r * bs + c] * xr[c];
+                    }
+                    tr[r] += sr;
+                    ti[r] += si;
+                }
+            }
+            else
+            {
+                for (ALPHA_INT c = 0; c < bs; c++)
+                    for (ALPHA_INT r = 0; r < bs; r++)
+                    {
+                        tr[r] += br[c * bs + r] * xr[c] - bi[c * bs + r] * xi[c];
+                        ti[r] += br[c * bs + r] * xi[c] + bi[c * bs + r] * xr[c];
+                    }
+            }
+        }
+        for (ALPHA_INT r = 0; r < bs; r++)
+        {
+            ALPHA_Complex *Y = y + (size_t)i * bs + r;
+            const ALPHA_Complex t = {tr[r], ti[r]};
+            alpha_mule(*Y, beta);
+            alpha_madde(*Y, alpha, t);
+        }
+    }
+    free(part);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t
+ONAME(const ALPHA_Complex alpha,
+      const ALPHA_SPMAT_BSR *A,
+      const ALPHA_Float *re,
+      const ALPHA_Float *im,
+      const ALPHA_Complex *x,
+      const ALPHA_Complex beta,
+      ALPHA_Complex *y)
+{
+    check_return(A->block_layout != ALPHA_SPARSE_LAYOUT_ROW_MAJOR && A->block_layout != ALPHA_SPARSE_LAYOUT_COLUMN_MAJOR,
+                 ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    ALPHA_INT thread_num = alpha_get_thread_num();
+    ALPHA_INT partition[thread_num + 1];
+    balanced_partition_row_by_offset(A->rows_end, A->rows, thread_num, partition);
+    alphasparse_status_t status = ALPHA_SPARSE_STATUS_SUCCESS;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num)
+#endif
+    {
+        ALPHA_INT tid = alpha_get_thread_id();
+        alphasparse_status_t local = gemv_bsr_split_for_each_thread(alpha, A, re, im, x, beta, y, partition[tid], partition[tid + 1]);
+        if (local != ALPHA_SPARSE_STATUS_SUCCESS)
+            status = local;
+    }
+    return status;
+}
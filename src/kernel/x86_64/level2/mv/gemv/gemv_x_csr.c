@@ -1,6 +1,7 @@
 #include "alphasparse/kernel.h"
 #include "alphasparse/util.h"
 #include "alphasparse/opt.h"
+#include "alphasparse/trace.h"
 #ifdef S
 #include <immintrin.h>
 #endif
@@ -163,8 +164,8 @@ gemv_csr_unroll4(const ALPHA_Number alpha,
 {
     for (ALPHA_INT i = lrs; i < lre; i++)
     {
-        ALPHA_INT pks = A->rows_start[i];
-        ALPHA_INT pke = A->rows_end[i];
+        ALPHA_OFFSET pks = A->rows_start[i];
+        ALPHA_OFFSET pke = A->rows_end[i];
         ALPHA_INT pkl = pke - pks;
 
 #if defined (__AVX512__) && defined(S)
@@ -192,17 +193,20 @@ gemv_csr_omp(const ALPHA_Number alpha,
 
     ALPHA_INT num_threads = alpha_get_thread_num();
     ALPHA_INT partition[num_threads + 1];
-    balanced_partition_row_by_nnz(A->rows_end, m, num_threads, partition);
+    balanced_partition_row_by_offset(A->rows_end, m, num_threads, partition);
 
+    alpha_trace_threads();
 #ifdef _OPENMP
 #pragma omp parallel num_threads(num_threads)
 #endif
     {
         ALPHA_INT tid = alpha_get_thread_id();
+        alpha_trace_thread_begin();
 
         ALPHA_INT local_m_s = partition[tid];
         ALPHA_INT local_m_e = partition[tid + 1];
         gemv_csr_unroll4(alpha, A, x, beta, y, local_m_s, local_m_e);
+        alpha_trace_thread_end(tid);
     }
     return ALPHA_SPARSE_STATUS_SUCCESS;
 }
@@ -0,0 +1,90 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/opt.h"
+#include "alphasparse/trace.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static ALPHA_Number gemv_kernel_doti_unroll4(const ALPHA_INT ns, const ALPHA_Number *x, const ALPHA_INT *indx, const ALPHA_Number *y)
+{
+    ALPHA_INT ns4 = ((ns >> 2) << 2);
+    ALPHA_INT i;
+    ALPHA_Number tmp0, tmp1, tmp2, tmp3;
+    alpha_setzero(tmp0);
+    alpha_setzero(tmp1);
+    alpha_setzero(tmp2);
+    alpha_setzero(tmp3);
+    for (i = 0; i < ns4; i += 4)
+    {
+        alpha_madde(tmp0, x[i], y[indx[i]]);
+        alpha_madde(tmp1, x[i + 1], y[indx[i + 1]]);
+        alpha_madde(tmp2, x[i + 2], y[indx[i + 2]]);
+        alpha_madde(tmp3, x[i + 3], y[indx[i + 3]]);
+    }
+    for (; i < ns; ++i)
+    {
+        alpha_madde(tmp0, x[i], y[indx[i]]);
+    }
+    alpha_adde(tmp0, tmp1);
+    alpha_adde(tmp2, tmp3);
+    alpha_adde(tmp0, tmp2);
+    return tmp0;
+}
+
+/*
+* Every thread takes whole row blocks, scales their rows by beta and then adds the
+* segments of the block, which come panel by panel, so x is read one panel at a time
+* while the rows of the block stay in cache.
+*/
+alphasparse_status_t
+ONAME(const ALPHA_Number alpha,
+      const ALPHA_SPMAT_CSR *A,
+      const alpha_csr_tiles_t *tiles,
+      const ALPHA_Number *x,
+      const ALPHA_Number beta,
+      ALPHA_Number *y)
+{
+    const ALPHA_INT m = A->rows;
+    const ALPHA_INT row_blocks = tiles->row_blocks;
+    const ALPHA_INT block_rows = tiles->block_rows;
+    const ALPHA_Number *values = tiles->values;
+
+    ALPHA_INT num_threads = alpha_get_thread_num();
+    ALPHA_INT partition[num_threads + 1];
+    balanced_partition_row_by_offset(tiles->block_ptr + 1, row_blocks, num_threads, partition);
+
+    alpha_trace_threads();
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+        ALPHA_INT tid = alpha_get_thread_id();
+        alpha_trace_thread_begin();
+
+        for (ALPHA_INT rb = partition[tid]; rb < partition[tid + 1]; rb++)
+        {
+            const ALPHA_INT rs = rb * block_rows, re = alpha_min(rs + block_rows, m);
+            for (ALPHA_INT i = rs; i < re; i++)
+                alpha_mule(y[i], beta);
+            for (ALPHA_OFFSET k = tiles->block_seg[rb]; k < tiles->block_seg[rb + 1]; k++)
+            {
+                const ALPHA_OFFSET pks = tiles->seg_ptr[k];
+                const ALPHA_INT pkl = tiles->seg_ptr[k + 1] - pks;
+                ALPHA_Number tmp;
+                // most segments of a sparse panel hold a single entry
+                if (pkl == 1)
+                {
+                    alpha_mul(tmp, values[pks], x[tiles->col_indx[pks]]);
+                }
+                else
+                {
+                    tmp = gemv_kernel_doti_unroll4(pkl, &values[pks], &tiles->col_indx[pks], x);
+                }
+                alpha_madde(y[tiles->seg_row[k]], alpha, tmp);
+            }
+        }
+        alpha_trace_thread_end(tid);
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
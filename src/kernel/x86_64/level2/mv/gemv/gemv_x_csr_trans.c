@@ -15,7 +15,7 @@ gemv_csr_trans_serial(const ALPHA_Number alpha,
     const ALPHA_INT m = A->rows;
     for (ALPHA_INT i = 0; i < m; ++i)
     {
-        for (ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ai++)
+        for (ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ai++)
         {
             ALPHA_Number val;
             alpha_mul(val, alpha, A->values[ai]);
@@ -25,6 +25,39 @@ gemv_csr_trans_serial(const ALPHA_Number alpha,
     return ALPHA_SPARSE_STATUS_SUCCESS;
 }
 
+typedef struct
+{
+    const ALPHA_SPMAT_CSR *A;
+    const ALPHA_Number *x;
+    ALPHA_Number *tmp;
+} gemv_trans_rows_t;
+
+// scatter rows [begin, end) into the partial y of the executing thread
+static void gemv_trans_rows(void *arg, const ALPHA_INT tid, const ALPHA_INT begin, const ALPHA_INT end)
+{
+    const gemv_trans_rows_t *rows = arg;
+    const ALPHA_SPMAT_CSR *A = rows->A;
+    const ALPHA_Number *x = rows->x;
+    ALPHA_Number *local_y = rows->tmp + (size_t)tid * A->cols;
+    for (ALPHA_INT i = begin; i < end; ++i)
+    {
+        const ALPHA_Number x_r = x[i];
+        ALPHA_OFFSET pkl = A->rows_start[i];
+        ALPHA_OFFSET pke = A->rows_end[i];
+        for (; pkl < pke - 3; pkl += 4)
+        {
+            alpha_madde(local_y[A->col_indx[pkl]], A->values[pkl], x_r);
+            alpha_madde(local_y[A->col_indx[pkl + 1]], A->values[pkl + 1], x_r);
+            alpha_madde(local_y[A->col_indx[pkl + 2]], A->values[pkl + 2], x_r);
+            alpha_madde(local_y[A->col_indx[pkl + 3]], A->values[pkl + 3], x_r);
+        }
+        for (; pkl < pke; ++pkl)
+        {
+            alpha_madde(local_y[A->col_indx[pkl]], A->values[pkl], x_r);
+        }
+    }
+}
+
 static alphasparse_status_t
 gemv_csr_trans_omp(const ALPHA_Number alpha,
                      const ALPHA_SPMAT_CSR *A,
@@ -35,35 +68,20 @@ gemv_csr_trans_omp(const ALPHA_Number alpha,
     const ALPHA_INT m = A->rows;
     const ALPHA_INT n = A->cols;
     const ALPHA_INT thread_num = alpha_get_thread_num();
-    ALPHA_INT partition[thread_num + 1];
-    balanced_partition_row_by_nnz(A->rows_end, m, thread_num, partition);
-    ALPHA_Number **tmp = (ALPHA_Number **)malloc(sizeof(ALPHA_Number *) * thread_num);
+    // one partial y per thread, taken from the workspace of the execution context when there is one
+    const size_t tmp_size = sizeof(ALPHA_Number) * (size_t)n * thread_num;
+    ALPHA_Number *tmp = (ALPHA_Number *)alpha_exec_workspace(tmp_size);
+    const bool tmp_owned = tmp == NULL;
+    if (tmp_owned)
+        tmp = (ALPHA_Number *)malloc(tmp_size);
+    check_null_return(tmp, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
 #ifdef _OPENMP
-#pragma omp parallel num_threads(thread_num)
+#pragma omp parallel for num_threads(thread_num)
 #endif
-    {
-        const ALPHA_INT tid = alpha_get_thread_id();
-        const ALPHA_INT local_m_s = partition[tid];
-        const ALPHA_INT local_m_e = partition[tid + 1];
-        tmp[tid] = (ALPHA_Number *)malloc(sizeof(ALPHA_Number) * n);
-        for (ALPHA_INT i = local_m_s; i < local_m_e; ++i)
-        {
-            const ALPHA_Number x_r = x[i];
-            int pkl = A->rows_start[i];
-            int pke = A->rows_end[i];
-            for (; pkl < pke - 3; pkl += 4)
-            {
-                alpha_madde(tmp[tid][A->col_indx[pkl]], A->values[pkl], x_r);
-                alpha_madde(tmp[tid][A->col_indx[pkl + 1]], A->values[pkl + 1], x_r);
-                alpha_madde(tmp[tid][A->col_indx[pkl + 2]], A->values[pkl + 2], x_r);
-                alpha_madde(tmp[tid][A->col_indx[pkl + 3]], A->values[pkl + 3], x_r);
-            }
-            for (; pkl < pke; ++pkl)
-            {
-                alpha_madde(tmp[tid][A->col_indx[pkl]], A->values[pkl], x_r);
-            }
-        }
-    }
+    for (size_t i = 0; i < (size_t)n * thread_num; ++i)
+        alpha_setzero(tmp[i]);
+    gemv_trans_rows_t rows = {A, x, tmp};
+    alpha_steal_for_offset(thread_num, m, A->rows_start, A->rows_end, gemv_trans_rows, &rows);
 #ifdef _OPENMP
 #pragma omp parallel for num_threads(thread_num)
 #endif
@@ -73,19 +91,13 @@ gemv_csr_trans_omp(const ALPHA_Number alpha,
         alpha_setzero(tmp_y);
         for (ALPHA_INT j = 0; j < thread_num; ++j)
         {
-            alpha_adde(tmp_y, tmp[j][i]);
+            alpha_adde(tmp_y, tmp[(size_t)j * n + i]);
         }
         alpha_mule(y[i],beta);
         alpha_madde(y[i],alpha,tmp_y);
     }
-#ifdef _OPENMP
-#pragma omp parallel for num_threads(thread_num)
-#endif
-    for (ALPHA_INT i = 0; i < thread_num; ++i)
-    {
-        alpha_free(tmp[i]);
-    }
-    alpha_free(tmp);
+    if (tmp_owned)
+        free(tmp);
     return ALPHA_SPARSE_STATUS_SUCCESS;
 }
 
@@ -0,0 +1,31 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/opt.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/dia_csr.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+alphasparse_status_t ONAME(const ALPHA_Number alpha,
+                           const ALPHA_SPMAT_DIA_CSR *A,
+                           const ALPHA_Number *x,
+                           const ALPHA_Number beta,
+                           ALPHA_Number *y)
+{
+    const ALPHA_INT m = A->rows;
+    const ALPHA_INT tiles = (m + DIA_CSR_TILE - 1) / DIA_CSR_TILE;
+    const ALPHA_INT num_threads = alpha_min(alpha_get_thread_num(), alpha_max(tiles, 1));
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+#endif
+    for (ALPHA_INT t = 0; t < tiles; t++)
+    {
+        ALPHA_Number acc[DIA_CSR_TILE];
+        const ALPHA_INT r0 = t * DIA_CSR_TILE;
+        const ALPHA_INT r1 = alpha_min(m, r0 + DIA_CSR_TILE);
+        dia_csr_rows(A, r0, r1, x, acc);
+        dia_csr_store(alpha, acc, r1 - r0, beta, &y[r0]);
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -25,7 +25,7 @@ ONAME(const ALPHA_Complex alpha,
 
 	for(ALPHA_INT i = 0; i < m; ++i)
 	{
-		for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
+		for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
 		{
 			ALPHA_Complex tmp;
 			tmp.real = 0.0;
@@ -23,7 +23,7 @@ ONAME(const ALPHA_Complex alpha,
         alpha_mul(tmp1, alpha, x[i]); 
         alpha_mul(tmp2, beta, y[i]); 
         alpha_add(y[i], tmp1, tmp2);
-        for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
+        for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
         {
             const ALPHA_INT col = A->col_indx[ai];
             if(col < i)
@@ -19,7 +19,7 @@ trmv_bsr_n_lo_conj_omp(const ALPHA_Number alpha,
 
     const ALPHA_INT thread_num = alpha_get_thread_num();
     ALPHA_INT partition[thread_num + 1];
-    balanced_partition_row_by_nnz(A->rows_end, m_inner, thread_num, partition);
+    balanced_partition_row_by_offset(A->rows_end, m_inner, thread_num, partition);
 
     ALPHA_Number** tmp = (ALPHA_Number**)malloc(sizeof(ALPHA_Number*) * thread_num);
 #ifdef _OPENMP
@@ -35,7 +35,7 @@ trmv_bsr_n_lo_conj_omp(const ALPHA_Number alpha,
 	{
 		for (ALPHA_INT i = local_m_s; i < local_m_e; i++){
 			ALPHA_INT col = i*bs;
-			for (ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ai++){	
+			for (ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ai++){	
 				ALPHA_INT row = A->col_indx[ai];
 				ALPHA_INT m_s = row*bs;
 				if (row > i){
@@ -62,7 +62,7 @@ trmv_bsr_n_lo_conj_omp(const ALPHA_Number alpha,
 	}else if (A->block_layout == ALPHA_SPARSE_LAYOUT_COLUMN_MAJOR){
 		for (ALPHA_INT i = local_m_s; i < local_m_e; i++){
 			ALPHA_INT col = i*bs;
-			for (ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ai++){	
+			for (ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ai++){	
 				ALPHA_INT row = A->col_indx[ai];
 				ALPHA_INT m_s = row*bs;
 				if (row > i ){
@@ -30,7 +30,7 @@ ONAME(const ALPHA_Number alpha,
 		alpha_mul(y[j], y[j], beta);
 	}
 	ALPHA_INT partition[thread_num + 1];
-	balanced_partition_row_by_nnz(A->rows_end, b_rows, thread_num, partition);
+	balanced_partition_row_by_offset(A->rows_end, b_rows, thread_num, partition);
 
 	if (A->block_layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR)
 	{
@@ -42,7 +42,7 @@ ONAME(const ALPHA_Number alpha,
 			for (ALPHA_INT br = partition[tid]; br < partition[tid + 1]; br++)
 			{
 				ALPHA_INT row = br * bs;
-				ALPHA_INT block_start = A->rows_start[br], block_end = A->rows_end[br];
+				ALPHA_OFFSET block_start = A->rows_start[br], block_end = A->rows_end[br];
 				ALPHA_INT lower_end = alpha_upper_bound(&A->col_indx[block_start], &A->col_indx[block_end], br) - A->col_indx;
 				for (ALPHA_INT ai = block_start; ai < lower_end; ai++)
 				{
@@ -89,7 +89,7 @@ ONAME(const ALPHA_Number alpha,
 			for (ALPHA_INT br = partition[tid]; br < partition[tid + 1]; br++)
 			{
 				ALPHA_INT row = br * bs;
-				ALPHA_INT block_start = A->rows_start[br], block_end = A->rows_end[br];
+				ALPHA_OFFSET block_start = A->rows_start[br], block_end = A->rows_end[br];
 				ALPHA_INT lower_end = alpha_upper_bound(&A->col_indx[block_start], &A->col_indx[block_end], br) - A->col_indx;
 
 				for (ALPHA_INT ai = block_start; ai < lower_end; ++ai)
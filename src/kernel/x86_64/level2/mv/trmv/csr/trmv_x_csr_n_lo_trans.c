@@ -14,7 +14,7 @@ trmv_x_csr_n_lo_trans_serial(const ALPHA_Number alpha,
     for(ALPHA_INT i = 0; i < m; ++i)
     {
         alpha_mule(y[i], beta);
-        for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
+        for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
         {
             const ALPHA_INT col = A->col_indx[ai];
             if(col <= i)
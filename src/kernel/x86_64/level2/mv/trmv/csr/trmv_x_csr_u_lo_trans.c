@@ -15,7 +15,7 @@ trmv_x_csr_u_lo_trans_serial(const ALPHA_Number alpha,
     {
         alpha_mule(y[i], beta);
 		alpha_madde(y[i], alpha, x[i]);
-        for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
+        for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
         {
             const ALPHA_INT col = A->col_indx[ai];                                            
             if(col < i)
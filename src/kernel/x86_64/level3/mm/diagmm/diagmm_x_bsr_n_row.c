@@ -22,7 +22,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
 #endif 
     for (ALPHA_INT ar = 0; ar < block_rowA; ++ar)
     {
-        for (ALPHA_INT ai = mat->rows_start[ar]; ai < mat->rows_end[ar]; ++ai)
+        for (ALPHA_OFFSET ai = mat->rows_start[ar]; ai < mat->rows_end[ar]; ++ai)
         {
             if (mat->col_indx[ai] == ar) 
             {
@@ -0,0 +1,25 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/split_complex.h"
+
+// every entry of y is a gathered dot product of a row of A with a column of x
+alphasparse_status_t ONAME(const ALPHA_Complex alpha, const ALPHA_SPMAT_CSR *mat, const ALPHA_Float *re, const ALPHA_Float *im, const ALPHA_Complex *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex beta, ALPHA_Complex *y, const ALPHA_INT ldy)
+{
+    const ALPHA_INT n = mat->cols;
+    ALPHA_INT num_threads = alpha_get_thread_num();
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads)
+#endif
+    for (ALPHA_INT cr = 0; cr < mat->rows; ++cr)
+    {
+        const ALPHA_OFFSET rs = mat->rows_start[cr];
+        const ALPHA_OFFSET nz = mat->rows_end[cr] - rs;
+        for (ALPHA_INT cc = 0; cc < columns; ++cc)
+        {
+            const ALPHA_Complex ctmp = split_dot_range(nz, re + rs, im + rs, mat->col_indx + rs, &x[index2(cc, 0, ldx)], 0, n, false);
+            alpha_mule(y[index2(cc, cr, ldy)], beta);
+            alpha_madde(y[index2(cc, cr, ldy)], alpha, ctmp);
+        }
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -0,0 +1,36 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/trace.h"
+#include "alphasparse/util/split_complex.h"
+
+// row r of y gains alpha * a * (row c of x) for every entry a of row r of A, one complex FMA per register of x
+alphasparse_status_t ONAME(const ALPHA_Complex alpha, const ALPHA_SPMAT_CSR *mat, const ALPHA_Float *re, const ALPHA_Float *im, const ALPHA_Complex *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Complex beta, ALPHA_Complex *y, const ALPHA_INT ldy)
+{
+    ALPHA_INT m = mat->rows;
+    ALPHA_INT n = columns;
+    ALPHA_INT num_threads = alpha_get_thread_num();
+    alpha_trace_threads();
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+        alpha_trace_thread_begin();
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (ALPHA_INT r = 0; r < m; ++r)
+        {
+            ALPHA_Complex *Y = &y[index2(r, 0, ldy)];
+            for (ALPHA_INT c = 0; c < n; c++)
+                alpha_mule(Y[c], beta);
+            for (ALPHA_OFFSET ai = mat->rows_start[r]; ai < mat->rows_end[r]; ai++)
+            {
+                const ALPHA_Float sr = alpha.real * re[ai] - alpha.imag * im[ai];
+                const ALPHA_Float si = alpha.real * im[ai] + alpha.imag * re[ai];
+                split_caxpy_dense(n, sr, si, &x[index2(mat->col_indx[ai], 0, ldx)], Y);
+            }
+        }
+        alpha_trace_thread_end(alpha_get_thread_id());
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -3,7 +3,8 @@
 
 alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat, const ALPHA_Number *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Number beta, ALPHA_Number *y, const ALPHA_INT ldy)
 {
-    ALPHA_INT m = mat->rows;
+    // rows counts block rows
+    ALPHA_INT m = mat->rows * mat->block_size;
     ALPHA_INT n = columns;
     ALPHA_INT ll = mat->block_size;
 
@@ -17,7 +18,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
                 for (ALPHA_INT c = 0; c < n; c++)
                     alpha_mul(y[index2(r + lr, c, ldy)], beta, y[index2(r + lr, c, ldy)]);
 
-            for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
+            for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
             {
                 ALPHA_INT lr, lc;
                 ALPHA_INT ac = mat->col_indx[ai] * ll;
@@ -46,7 +47,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
                 for (ALPHA_INT c = 0; c < n; c++)
                     alpha_mul(y[index2(r + lr, c, ldy)], beta, y[index2(r + lr, c, ldy)]);
 
-            for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
+            for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
             {
                 ALPHA_INT lr, lc;
                 ALPHA_INT ac = mat->col_indx[ai] * ll;
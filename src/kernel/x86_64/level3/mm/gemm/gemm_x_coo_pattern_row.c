@@ -0,0 +1,44 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/opt.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static alphasparse_status_t
+mm_coo_pattern_omp(const ALPHA_Number alpha, const ALPHA_SPMAT_COO *mat, const ALPHA_Number *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Number beta, ALPHA_Number *y, const ALPHA_INT ldy)
+{
+    ALPHA_INT num_threads = alpha_get_thread_num();
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads)
+#endif
+    for (ALPHA_INT i = 0; i < mat->rows; i++)
+        for (ALPHA_INT j = 0; j < columns; j++)
+            alpha_mule(y[index2(i, j, ldy)], beta);
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+        ALPHA_INT tid = alpha_get_thread_id();
+        for (ALPHA_INT nn = 0; nn < mat->nnz; ++nn)
+        {
+            ALPHA_INT cr = mat->row_indx[nn];
+            if (cr % num_threads != tid)
+                continue;
+
+            ALPHA_Number *Y = &y[index2(cr, 0, ldy)];
+            const ALPHA_Number *X = &x[index2(mat->col_indx[nn], 0, ldx)];
+            for (ALPHA_INT c = 0; c < columns; c++)
+                alpha_madde(Y[c], alpha, X[c]);
+        }
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t
+ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_COO *mat, const ALPHA_Number *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Number beta, ALPHA_Number *y, const ALPHA_INT ldy)
+{
+    return mm_coo_pattern_omp(alpha, mat, x, columns, ldx, beta, y, ldy);
+}
@@ -0,0 +1,28 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+
+alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSC *mat, const ALPHA_Number *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Number beta, ALPHA_Number *y, const ALPHA_INT ldy)
+{
+    ALPHA_INT num_threads = alpha_get_thread_num();
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads)
+#endif
+    for (ALPHA_INT cc = 0; cc < columns; ++cc)
+    {
+        const ALPHA_Number *X = &x[index2(cc, 0, ldx)];
+        ALPHA_Number *Y = &y[index2(cc, 0, ldy)];
+        for (ALPHA_INT r = 0; r < mat->rows; r++)
+            alpha_mule(Y[r], beta);
+
+        for (ALPHA_INT br = 0; br < mat->cols; ++br)
+        {
+            ALPHA_Number xval;
+            alpha_mul(xval, alpha, X[br]);
+            for (ALPHA_INT ai = mat->cols_start[br]; ai < mat->cols_end[br]; ++ai)
+            {
+                alpha_adde(Y[mat->row_indx[ai]], xval);
+            }
+        }
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
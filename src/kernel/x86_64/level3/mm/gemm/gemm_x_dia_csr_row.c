@@ -0,0 +1,48 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/opt.h"
+#include "alphasparse/util.h"
+#include "alphasparse/util/dia_csr.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_DIA_CSR *mat, const ALPHA_Number *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Number beta, ALPHA_Number *y, const ALPHA_INT ldy)
+{
+    const ALPHA_SPMAT_DIA *dia = mat->dia;
+    const ALPHA_SPMAT_CSR *csr = mat->csr;
+    const ALPHA_INT m = mat->rows;
+    const ALPHA_INT tiles = (m + DIA_CSR_MM_ROWS - 1) / DIA_CSR_MM_ROWS;
+    const ALPHA_INT num_threads = alpha_min(alpha_get_thread_num(), alpha_max(tiles, 1));
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+#endif
+    for (ALPHA_INT t = 0; t < tiles; t++)
+    {
+        ALPHA_Number acc[DIA_CSR_MM_ROWS][DIA_CSR_MM_TILE];
+        const ALPHA_INT r0 = t * DIA_CSR_MM_ROWS;
+        const ALPHA_INT r1 = alpha_min(m, r0 + DIA_CSR_MM_ROWS);
+        for (ALPHA_INT c0 = 0; c0 < columns; c0 += DIA_CSR_MM_TILE)
+        {
+            const ALPHA_INT w = alpha_min(DIA_CSR_MM_TILE, columns - c0);
+            for (ALPHA_INT i = 0; i < r1 - r0; i++)
+                for (ALPHA_INT c = 0; c < w; c++)
+                    alpha_setzero(acc[i][c]);
+            for (ALPHA_INT d = 0; d < dia->ndiag; d++)
+            {
+                const ALPHA_INT dis = dia->distance[d];
+                const ALPHA_INT lo = alpha_max(r0, -dis);
+                const ALPHA_INT hi = alpha_min(r1, mat->cols - dis);
+                const ALPHA_Number *v = &dia->values[(size_t)d * dia->lval];
+                for (ALPHA_INT i = lo; i < hi; i++)
+                    dia_csr_axpy(w, v[i], &x[index2(i + dis, c0, ldx)], acc[i - r0]);
+            }
+            for (ALPHA_INT r = r0; r < r1; r++)
+                for (ALPHA_OFFSET e = csr->rows_start[r]; e < csr->rows_end[r]; e++)
+                    dia_csr_axpy(w, csr->values[e], &x[index2(csr->col_indx[e], c0, ldx)], acc[r - r0]);
+            for (ALPHA_INT r = r0; r < r1; r++)
+                dia_csr_store(alpha, acc[r - r0], w, beta, &y[index2(r, c0, ldy)]);
+        }
+    }
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -1,32 +1,9 @@
 #include "alphasparse/kernel.h"
 #include "alphasparse/util.h"
+#include "alphasparse/util/symmetric_mm.h"
 
 alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSR *mat, const ALPHA_Number *x, const ALPHA_INT columns, const ALPHA_INT ldx, const ALPHA_Number beta, ALPHA_Number *y, const ALPHA_INT ldy)
 {
-    for (ALPHA_INT cc = 0; cc < columns; ++cc)
-    {
-        for (ALPHA_INT r = 0; r < mat->rows; r++)
-            alpha_mule(y[index2(cc, r, ldy)], beta);
-        for (ALPHA_INT ar = 0; ar < mat->rows; ++ar)
-        {
-            for (ALPHA_INT ai = mat->rows_start[ar]; ai < mat->rows_end[ar]; ++ai)
-            {
-                ALPHA_INT ac = mat->col_indx[ai];
-                if (ac < ar)
-                {
-                    ALPHA_Number val;
-                    alpha_mul(val, alpha, mat->values[ai]);
-                    alpha_madde(y[index2(cc, ar, ldy)], val, x[index2(cc, ac, ldx)]);
-                    alpha_madde(y[index2(cc, ac, ldy)], val, x[index2(cc, ar, ldx)]);
-                }
-                else if (ac == ar)
-                {
-                    ALPHA_Number val;
-                    alpha_mul(val, alpha, mat->values[ai]);
-                    alpha_madde(y[index2(cc, ar, ldy)], val, x[index2(cc, ac, ldx)]);
-                }
-            }
-        }
-    }
-    return ALPHA_SPARSE_STATUS_SUCCESS;
+    return symm_mm_compressed(alpha, mat->rows, (symm_mm_rows_t){mat->rows_start, mat->rows_end, NULL, NULL, mat->col_indx, mat->values},
+                              x, columns, ldx, beta, y, ldy, true, false, false, false, false, false);
 }
@@ -18,7 +18,7 @@ ONAME(ALPHA_SPMAT_CSR *A,
 #ifdef _OPENMP
 #pragma omp parallel for num_threads(num_thread) reduction(+:find)
 #endif
-	for(ALPHA_INT ai = A->rows_start[row]; ai < A->rows_end[row]; ++ai)
+	for(ALPHA_OFFSET ai = A->rows_start[row]; ai < A->rows_end[row]; ++ai)
 	{
 		const ALPHA_INT ac = A->col_indx[ai];
 		if(ac == col)
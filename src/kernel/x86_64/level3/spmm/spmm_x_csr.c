@@ -7,37 +7,29 @@
 #include <omp.h>
 #endif
 
-alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_SPMAT_CSR *B, ALPHA_SPMAT_CSR **matC)
+typedef struct
 {
-    check_return(B->cols != A->rows, ALPHA_SPARSE_STATUS_INVALID_VALUE);
-
-    ALPHA_SPMAT_CSR *mat = alpha_malloc(sizeof(ALPHA_SPMAT_CSR));
-    *matC = mat;
-    mat->rows = A->rows;
-    mat->cols = B->cols;
-
-    ALPHA_INT m = A->rows;
-    ALPHA_INT n = B->cols;
-    ALPHA_INT64 flop[m];
-    memset(flop,'\0',m*sizeof(ALPHA_INT64));
-    ALPHA_INT *row_offset = alpha_memalign(sizeof(ALPHA_INT) * (m + 1), DEFAULT_ALIGNMENT);
-    mat->rows_start = row_offset;
-    mat->rows_end = row_offset + 1;
-    memset(row_offset,'\0',sizeof(ALPHA_INT)*(m+1));
+    const ALPHA_SPMAT_CSR *A;
+    const ALPHA_SPMAT_CSR *B;
+    ALPHA_SPMAT_CSR *C;
+} spmm_rows_t;
 
-    ALPHA_INT num_thread = alpha_get_thread_num();
-#ifdef _OPENMP
-#pragma omp parallel for num_threads(num_thread)
-#endif
-    for (ALPHA_INT ar = 0; ar < m; ar++)
+// number of distinct columns of each C row
+static void spmm_rows_count(void *arg, const ALPHA_INT tid, const ALPHA_INT begin, const ALPHA_INT end)
+{
+    const spmm_rows_t *p = arg;
+    const ALPHA_SPMAT_CSR *A = p->A;
+    const ALPHA_SPMAT_CSR *B = p->B;
+    ALPHA_SPMAT_CSR *mat = p->C;
+    const ALPHA_INT n = B->cols;
+    for (ALPHA_INT ar = begin; ar < end; ar++)
     {
         bool flag[n];
         memset(flag, '\0', sizeof(bool) * n);
-        for (ALPHA_INT ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
+        for (ALPHA_OFFSET ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
         {
             ALPHA_INT br = A->col_indx[ai];
-            flop[ar] += B->rows_end[br] - B->rows_start[br];
-            for (ALPHA_INT bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
+            for (ALPHA_OFFSET bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
             {
                 if (!flag[B->col_indx[bi]])
                 {
@@ -47,32 +39,27 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_SPMAT_CSR *B, A
             }
         }
     }
-    
-    for(ALPHA_INT i = 1;i < m;++i)
-    {
-        flop[i] += flop[i - 1];
-        mat->rows_end[i] += mat->rows_end[i-1];
-    }
-    ALPHA_INT nnz = mat->rows_end[m-1];
-
-    mat->col_indx = alpha_memalign(nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
-    mat->values = alpha_memalign(nnz * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
+}
 
-#ifdef _OPENMP
-#pragma omp parallel for num_threads(num_thread)
-#endif
-    for (ALPHA_INT ar = 0; ar < m; ar++)
+static void spmm_rows_compute(void *arg, const ALPHA_INT tid, const ALPHA_INT begin, const ALPHA_INT end)
+{
+    const spmm_rows_t *p = arg;
+    const ALPHA_SPMAT_CSR *A = p->A;
+    const ALPHA_SPMAT_CSR *B = p->B;
+    ALPHA_SPMAT_CSR *mat = p->C;
+    const ALPHA_INT n = B->cols;
+    for (ALPHA_INT ar = begin; ar < end; ar++)
     {
         ALPHA_Number values[n];
         memset(values, '\0', sizeof(ALPHA_Number) * n);
         bool write_back[n];
         memset(write_back, '\0', sizeof(bool) * n);
-        for (ALPHA_INT ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
+        for (ALPHA_OFFSET ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
         {
             ALPHA_INT br = A->col_indx[ai];
             ALPHA_Number av = A->values[ai];
-            ALPHA_INT bis = B->rows_start[br];
-            ALPHA_INT bie = B->rows_end[br];
+            ALPHA_OFFSET bis = B->rows_start[br];
+            ALPHA_OFFSET bie = B->rows_end[br];
             ALPHA_INT bil = bie-bis;
             const ALPHA_INT* B_col = &B->col_indx[bis];
             const ALPHA_Number* B_val = &B->values[bis];
@@ -105,7 +92,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_SPMAT_CSR *B, A
             }
         }
         
-        ALPHA_INT index = mat->rows_start[ar];
+        ALPHA_OFFSET index = mat->rows_start[ar];
         for (ALPHA_INT c = 0; c < n; c++)
         {
             if (write_back[c])
@@ -116,6 +103,58 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_SPMAT_CSR *B, A
             }
         }
     }
+}
+
+alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_SPMAT_CSR *B, ALPHA_SPMAT_CSR **matC)
+{
+    check_return(B->cols != A->rows, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    ALPHA_SPMAT_CSR *mat = alpha_malloc(sizeof(ALPHA_SPMAT_CSR));
+    *matC = mat;
+    mat->rows = A->rows;
+    mat->cols = B->cols;
+
+    ALPHA_INT m = A->rows;
+    ALPHA_INT n = B->cols;
+    ALPHA_OFFSET *row_offset = alpha_memalign(sizeof(ALPHA_OFFSET) * (m + 1), DEFAULT_ALIGNMENT);
+    mat->rows_start = row_offset;
+    mat->rows_end = row_offset + 1;
+    memset(row_offset,'\0',sizeof(ALPHA_OFFSET)*(m+1));
+
+    ALPHA_INT num_thread = alpha_get_thread_num();
+    // both passes cost a dense row of n plus the products of the row, rows with heavy B rows are stolen
+    ALPHA_INT64 *flop = malloc(sizeof(ALPHA_INT64) * (m > 0 ? m : 1));
+    check_null_return(flop, ALPHA_SPARSE_STATUS_ALLOC_FAILED);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_thread)
+#endif
+    for (ALPHA_INT ar = 0; ar < m; ar++)
+    {
+        ALPHA_INT64 row_flop = n;
+        for (ALPHA_OFFSET ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
+        {
+            ALPHA_INT br = A->col_indx[ai];
+            row_flop += B->rows_end[br] - B->rows_start[br];
+        }
+        flop[ar] = row_flop;
+    }
+    for (ALPHA_INT i = 1; i < m; ++i)
+        flop[i] += flop[i - 1];
+
+    spmm_rows_t rows = {A, B, mat};
+    alpha_steal_for(num_thread, m, flop, spmm_rows_count, &rows);
+    
+    for(ALPHA_INT i = 1;i < m;++i)
+    {
+        mat->rows_end[i] += mat->rows_end[i-1];
+    }
+    ALPHA_OFFSET nnz = m > 0 ? mat->rows_end[m-1] : 0;
+
+    mat->col_indx = alpha_memalign(nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    mat->values = alpha_memalign(nnz * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
+
+    alpha_steal_for(num_thread, m, flop, spmm_rows_compute, &rows);
+    free(flop);
 
     return ALPHA_SPARSE_STATUS_SUCCESS;
 }
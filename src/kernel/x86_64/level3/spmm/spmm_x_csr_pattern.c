@@ -0,0 +1,121 @@
+#include "alphasparse/kernel.h"
+#include "alphasparse/util.h"
+#include "alphasparse/opt.h"
+#include <memory.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_SPMAT_CSR *B, ALPHA_SPMAT_CSR **matC)
+{
+    check_return(A->cols != B->rows, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+
+    ALPHA_SPMAT_CSR *mat = alpha_malloc(sizeof(ALPHA_SPMAT_CSR));
+    *matC = mat;
+    mat->rows = A->rows;
+    mat->cols = B->cols;
+
+    ALPHA_INT m = A->rows;
+    ALPHA_INT n = B->cols;
+    ALPHA_OFFSET *row_offset = alpha_memalign(sizeof(ALPHA_OFFSET) * (m + 1), DEFAULT_ALIGNMENT);
+    mat->rows_start = row_offset;
+    mat->rows_end = row_offset + 1;
+    memset(row_offset,'\0',sizeof(ALPHA_OFFSET)*(m+1));
+
+    ALPHA_INT num_thread = alpha_get_thread_num();
+    // the dense row scratch of a thread is n wide, too big for the stack of a wide matrix
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_thread)
+#endif
+    {
+        bool *flag = alpha_memalign(sizeof(bool) * n, DEFAULT_ALIGNMENT);
+#ifdef _OPENMP
+#pragma omp for
+#endif
+        for (ALPHA_INT ar = 0; ar < m; ar++)
+        {
+            memset(flag, '\0', sizeof(bool) * n);
+            for (ALPHA_OFFSET ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
+            {
+                ALPHA_INT br = A->col_indx[ai];
+                for (ALPHA_OFFSET bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
+                {
+                    if (!flag[B->col_indx[bi]])
+                    {
+                        mat->rows_end[ar] += 1;
+                        flag[B->col_indx[bi]] = true;
+                    }
+                }
+            }
+        }
+        alpha_release(flag);
+    }
+    
+    for(ALPHA_INT i = 1;i < m;++i)
+    {
+        mat->rows_end[i] += mat->rows_end[i-1];
+    }
+    ALPHA_OFFSET nnz = mat->rows_end[m-1];
+
+    mat->col_indx = alpha_memalign(nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    mat->values = alpha_memalign(nnz * sizeof(ALPHA_Number), DEFAULT_ALIGNMENT);
+
+    // a missing values array stands for all ones
+    ALPHA_Number one;
+    alpha_setone(one);
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_thread)
+#endif
+    {
+        ALPHA_Number *values = alpha_memalign(sizeof(ALPHA_Number) * n, DEFAULT_ALIGNMENT);
+        bool *write_back = alpha_memalign(sizeof(bool) * n, DEFAULT_ALIGNMENT);
+#ifdef _OPENMP
+#pragma omp for
+#endif
+        for (ALPHA_INT ar = 0; ar < m; ar++)
+        {
+            memset(values, '\0', sizeof(ALPHA_Number) * n);
+            memset(write_back, '\0', sizeof(bool) * n);
+            for (ALPHA_OFFSET ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
+            {
+                ALPHA_INT br = A->col_indx[ai];
+                ALPHA_Number av = A->values == NULL ? one : A->values[ai];
+                if (B->values == NULL)
+                {
+                    for (ALPHA_OFFSET bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
+                    {
+                        ALPHA_INT bc = B->col_indx[bi];
+                        alpha_adde(values[bc], av);
+                        write_back[bc] = true;
+                    }
+                }
+                else
+                {
+                    for (ALPHA_OFFSET bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
+                    {
+                        ALPHA_INT bc = B->col_indx[bi];
+                        alpha_madde(values[bc], av, B->values[bi]);
+                        write_back[bc] = true;
+                    }
+                }
+            }
+
+            ALPHA_OFFSET index = mat->rows_start[ar];
+            for (ALPHA_INT c = 0; c < n; c++)
+            {
+                if (write_back[c])
+                {
+                    mat->col_indx[index] = c;
+                    mat->values[index] = values[c];
+                    index += 1;
+                }
+            }
+        }
+        alpha_release(values);
+        alpha_release(write_back);
+    }
+
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -6,6 +6,40 @@
 #endif
 #include <memory.h>
 
+typedef struct
+{
+    const ALPHA_SPMAT_CSR *A;
+    const ALPHA_SPMAT_CSR *B;
+    ALPHA_Number *C;
+    ALPHA_INT ldc;
+} spmmd_rows_t;
+
+static void spmmd_rows(void *arg, const ALPHA_INT tid, const ALPHA_INT begin, const ALPHA_INT end)
+{
+    const spmmd_rows_t *p = arg;
+    const ALPHA_SPMAT_CSR *matA = p->A;
+    const ALPHA_SPMAT_CSR *matB = p->B;
+    ALPHA_Number *matC = p->C;
+    const ALPHA_INT ldc = p->ldc;
+    for (ALPHA_INT ar = begin; ar < end; ar++)
+    {
+        // rows of C are cleared by the thread computing them
+        for (ALPHA_INT j = 0; j < matB->cols; j++)
+            alpha_setzero(matC[index2(ar, j, ldc)]);
+        for (ALPHA_OFFSET ai = matA->rows_start[ar]; ai < matA->rows_end[ar]; ai++)
+        {
+            ALPHA_INT br = matA->col_indx[ai];
+            ALPHA_Number av = matA->values[ai];
+            for (ALPHA_OFFSET bi = matB->rows_start[br]; bi < matB->rows_end[br]; bi++)
+            {
+                ALPHA_INT bc = matB->col_indx[bi];
+                ALPHA_Number bv = matB->values[bi];
+                alpha_madde(matC[index2(ar, bc, ldc)], av, bv);
+            }
+        }
+    }
+}
+
 alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *matA, const ALPHA_SPMAT_CSR *matB, ALPHA_Number *matC, const ALPHA_INT ldc)
 {
     if (matA->cols != matB->rows || ldc < matB->cols)
@@ -13,12 +47,6 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *matA, const ALPHA_SPMAT_CSR *m
 
     ALPHA_INT m = matA->rows;
 
-    for(ALPHA_INT i = 0; i < matA->rows; i++)
-        for(ALPHA_INT j = 0; j < matB->cols; j++)
-        {
-            alpha_setzero(matC[index2(i, j, ldc)]);
-        }
-        
     ALPHA_INT num_thread = alpha_get_thread_num();
 
     ALPHA_INT64 flop[m];
@@ -29,7 +57,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *matA, const ALPHA_SPMAT_CSR *m
 #endif
     for (ALPHA_INT ar = 0; ar < m; ar++)
     {
-        for (ALPHA_INT ai = matA->rows_start[ar]; ai < matA->rows_end[ar]; ai++)
+        for (ALPHA_OFFSET ai = matA->rows_start[ar]; ai < matA->rows_end[ar]; ai++)
         {
             ALPHA_INT br = matA->col_indx[ai];
             flop[ar] += matB->rows_end[br] - matB->rows_start[br];
@@ -40,30 +68,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *matA, const ALPHA_SPMAT_CSR *m
         flop[i] += flop[i - 1];
     }
 
-    ALPHA_INT partition[num_thread + 1];
-    balanced_partition_row_by_flop(flop, m, num_thread, partition);
-
-#ifdef _OPENMP
-#pragma omp parallel num_threads(num_thread)
-#endif
-    {
-        ALPHA_INT tid = alpha_get_thread_id();
-        ALPHA_INT local_m_s = partition[tid];
-        ALPHA_INT local_m_e = partition[tid + 1];
-        for (ALPHA_INT ar = local_m_s; ar < local_m_e; ar++)
-        {
-            for (ALPHA_INT ai = matA->rows_start[ar]; ai < matA->rows_end[ar]; ai++)
-            {
-                ALPHA_INT br = matA->col_indx[ai];
-                ALPHA_Number av = matA->values[ai];
-                for (ALPHA_INT bi = matB->rows_start[br]; bi < matB->rows_end[br]; bi++)
-                {
-                    ALPHA_INT bc = matB->col_indx[bi];
-                    ALPHA_Number bv = matB->values[bi];
-                    alpha_madde(matC[index2(ar, bc, ldc)], av, bv);
-                }
-            }
-        }
-    }
+    spmmd_rows_t rows = {matA, matB, matC, ldc};
+    alpha_steal_for(num_thread, m, flop, spmmd_rows, &rows);
     return ALPHA_SPARSE_STATUS_SUCCESS;
 }
@@ -25,7 +25,7 @@ ONAME(const ALPHA_Number alpha,
 	// For matC, block_layout is defaulted as row_major
 	if (A->block_layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR){
 		for(ALPHA_INT i = 0; i < m_inner; i++){
-			for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i];ai++){
+			for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i];ai++){
 				// block[ai]: [A->col_indx[ai]][i]
 				for(ALPHA_INT col_inner = 0; col_inner < bs; col_inner++){
 					for(ALPHA_INT row_inner = 0; row_inner < bs; row_inner++){
@@ -44,7 +44,7 @@ ONAME(const ALPHA_Number alpha,
 	// For Fortran, block_layout is defaulted as col_major
 	else if (A->block_layout == ALPHA_SPARSE_LAYOUT_COLUMN_MAJOR){
 		for(ALPHA_INT i = 0; i < m_inner; i++){
-			for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i];ai++){
+			for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i];ai++){
 				// block[ai]: [A->col_indx[ai]][i]
 				for(ALPHA_INT row_inner = 0; row_inner < bs; row_inner++){
 					for(ALPHA_INT col_inner = 0; col_inner < bs; col_inner++){
@@ -14,7 +14,7 @@ ONAME(const ALPHA_Number alpha,
         alpha_mule(y[r], beta);
         ALPHA_Number tmp;
         alpha_setzero(tmp);
-        for (ALPHA_INT ai = A->rows_start[r]; ai < A->rows_end[r]; ai++)
+        for (ALPHA_OFFSET ai = A->rows_start[r]; ai < A->rows_end[r]; ai++)
         {
             alpha_madde(tmp, A->values[ai], x[A->col_indx[ai]]);
         }
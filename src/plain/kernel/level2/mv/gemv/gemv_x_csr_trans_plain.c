@@ -16,7 +16,7 @@ ONAME(const ALPHA_Number alpha,
     }
     for (ALPHA_INT i = 0; i < m; i++)
     {
-        for (ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ai++)
+        for (ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ai++)
         {
             ALPHA_Number val;
             alpha_mul(val, alpha, A->values[ai]);
@@ -46,7 +46,7 @@ ONAME(const ALPHA_Complex alpha,
 		for(ALPHA_INT br = 0 ; br < b_rows; br++){
 			row = br * bs;
 			
-			for(ALPHA_INT ai = A->rows_start[br]; ai < A->rows_end[br]; ++ai){
+			for(ALPHA_OFFSET ai = A->rows_start[br]; ai < A->rows_end[br]; ++ai){
 	            ALPHA_INT bc = A->col_indx[ai];
 				col = bc * bs;
 				//block (br,bc)
@@ -99,7 +99,7 @@ ONAME(const ALPHA_Complex alpha,
     	for(ALPHA_INT br = 0 ; br < b_rows; br++){
 			row = br * bs;
 			
-			for(ALPHA_INT ai = A->rows_start[br]; ai < A->rows_end[br]; ++ai){
+			for(ALPHA_OFFSET ai = A->rows_start[br]; ai < A->rows_end[br]; ++ai){
 	            ALPHA_INT bc = A->col_indx[ai];
 				col = bc * bs;
 				//block (br,bc)
@@ -22,7 +22,7 @@ ONAME(const ALPHA_Complex alpha,
     {
         // y[i] *= beta;
         alpha_mul(y[i], y[i], beta); 
-        for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
+        for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
         {
             const ALPHA_INT col = A->col_indx[ai];
             ALPHA_Complex tmp;
@@ -26,7 +26,7 @@ ONAME(const ALPHA_Number alpha,
     	for(ALPHA_INT i = 0; i < m_inner; ++i)
     	{
 			ALPHA_INT m_s = i*bs;
-    	    for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
+    	    for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
     	    {
     	        const ALPHA_INT col = A->col_indx[ai];
     	        if(col < i)
@@ -78,7 +78,7 @@ ONAME(const ALPHA_Number alpha,
 		for(ALPHA_INT i = 0; i < m_inner; ++i)
     	{
 			ALPHA_INT m_s = i*bs;
-    	    for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
+    	    for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
     	    {
     	        const ALPHA_INT col = A->col_indx[ai];
     	        if(col < i)
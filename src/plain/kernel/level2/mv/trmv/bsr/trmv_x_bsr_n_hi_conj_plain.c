@@ -24,7 +24,7 @@ ONAME(const ALPHA_Number alpha,
 	if (A->block_layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR){
 		for (ALPHA_INT i = 0; i < m_inner; i++){
 			ALPHA_INT col = i*bs;
-			for (ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ai++){	
+			for (ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ai++){	
 				ALPHA_INT row = A->col_indx[ai];
 				ALPHA_INT m_s = row*bs;
 				if (row < i){
@@ -57,7 +57,7 @@ ONAME(const ALPHA_Number alpha,
 	}else if (A->block_layout == ALPHA_SPARSE_LAYOUT_COLUMN_MAJOR){
 		for (ALPHA_INT i = 0; i < m_inner; i++){
 			ALPHA_INT col = i*bs;
-			for (ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ai++){
+			for (ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ai++){
 				ALPHA_INT row = A->col_indx[ai];
 				ALPHA_INT m_s = row*bs;
 				if (row < i){
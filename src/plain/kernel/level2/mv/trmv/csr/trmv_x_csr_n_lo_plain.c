@@ -14,7 +14,7 @@ ONAME(const ALPHA_Number alpha,
     {
         ALPHA_Number tmp;
 		alpha_setzero(tmp);
-        for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
+        for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
         {
             const ALPHA_INT col = A->col_indx[ai];
             if(col <= i)
@@ -13,7 +13,7 @@ ONAME(const ALPHA_Number alpha,
     for(ALPHA_INT i = 0;i < m; ++i)
     {
         ALPHA_Number tmp = x[i];
-        for(ALPHA_INT ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
+        for(ALPHA_OFFSET ai = A->rows_start[i]; ai < A->rows_end[i]; ++ai)
         {
             const ALPHA_INT col = A->col_indx[ai];
             if(col < i)
@@ -12,7 +12,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *A, c
     memset(temp, '\0', sizeof(ALPHA_Number)*rowA);
     for (ALPHA_INT r = block_rowA-1; r >=0 ; r--)
     {
-        for (ALPHA_INT ai = A->rows_end[r]-1; ai >= A->rows_start[r]; ai--)
+        for (ALPHA_OFFSET ai = A->rows_end[r]-1; ai >= A->rows_start[r]; ai--)
         {
             ALPHA_INT ac = A->col_indx[ai];
             if(ac == r) //对角块
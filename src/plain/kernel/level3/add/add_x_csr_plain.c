@@ -13,7 +13,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_Number alpha, c
     check_return(rowA != rowB, ALPHA_SPARSE_STATUS_INVALID_VALUE);
     check_return(colA != colA, ALPHA_SPARSE_STATUS_INVALID_VALUE);
 
-    ALPHA_INT *rows_offset = alpha_memalign((rowA + 1) * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
+    ALPHA_OFFSET *rows_offset = alpha_memalign((rowA + 1) * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
     mat->rows = rowA;
     mat->cols = colB;
     mat->rows_start = rows_offset;
@@ -23,10 +23,10 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_Number alpha, c
     size_t count = 0;
     for (ALPHA_INT r = 0; r < rowA; ++r)
     {
-        ALPHA_INT ai = A->rows_start[r];
-        ALPHA_INT rea = A->rows_end[r];
-        ALPHA_INT bi = B->rows_start[r];
-        ALPHA_INT reb = B->rows_end[r];
+        ALPHA_OFFSET ai = A->rows_start[r];
+        ALPHA_OFFSET rea = A->rows_end[r];
+        ALPHA_OFFSET bi = B->rows_start[r];
+        ALPHA_OFFSET reb = B->rows_end[r];
         while (ai < rea && bi < reb)
         {
             ALPHA_INT ca = A->col_indx[ai];
@@ -63,10 +63,10 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_Number alpha, c
     mat->rows_start[0] = 0;
     for (ALPHA_INT r = 0; r < rowA; ++r)
     {
-        ALPHA_INT ai = A->rows_start[r];
-        ALPHA_INT rea = A->rows_end[r];
-        ALPHA_INT bi = B->rows_start[r];
-        ALPHA_INT reb = B->rows_end[r];
+        ALPHA_OFFSET ai = A->rows_start[r];
+        ALPHA_OFFSET rea = A->rows_end[r];
+        ALPHA_OFFSET bi = B->rows_start[r];
+        ALPHA_OFFSET reb = B->rows_end[r];
         while (ai < rea && bi < reb)
         {
             ALPHA_INT ca = A->col_indx[ai];
@@ -22,7 +22,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
             for (ALPHA_INT r = 0; r < m; r += ll)
             { // choose a block of row
                 ALPHA_INT br = r / ll;
-                for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
+                for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
                 { // choose a block
                     ALPHA_Number *blk = &mat->values[ai * ll * ll];
                     for (ALPHA_INT cc = 0; cc < ll; ++cc)
@@ -52,7 +52,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
             for (ALPHA_INT r = 0; r < m; r += ll)
             { // choose a block of row
                 ALPHA_INT br = r / ll;
-                for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
+                for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
                 { // choose a block
                     for (ALPHA_INT cc = 0; cc < ll; ++cc)
                     for (ALPHA_INT lr = 0; lr < ll; ++lr)
@@ -18,7 +18,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
                     // y[index2(r + lr, c, ldy)] *= beta;
                     alpha_mul(y[index2(r + lr, c, ldy)], beta, y[index2(r + lr, c, ldy)]);
 
-            for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
+            for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
             {
                 ALPHA_INT lr, lc;
                 ALPHA_INT ac = mat->col_indx[ai] * ll;
@@ -49,7 +49,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
                     // y[index2(r + lr, c, ldy)] *= beta;
                     alpha_mul(y[index2(r + lr, c, ldy)], beta, y[index2(r + lr, c, ldy)]);
 
-            for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
+            for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
             {
                 ALPHA_INT lr, lc;
                 ALPHA_INT ac = mat->col_indx[ai] * ll;
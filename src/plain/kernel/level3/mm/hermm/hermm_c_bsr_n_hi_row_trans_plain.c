@@ -33,7 +33,7 @@ alphasparse_status_t ONAME(const ALPHA_Complex alpha, const ALPHA_SPMAT_BSR *mat
 //        printf("ALPHA_SPARSE_LAYOUT_ROW_MAJOR \n");
         for(ALPHA_INT row = 0 ; row < m ; row += bs){
             ALPHA_INT br = row / bs;
-            for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai){
+            for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai){
                 const ALPHA_INT bc = mat->col_indx[ai];
                 const ALPHA_INT col = bc * bs;
                 if(bc < br ){
@@ -90,7 +90,7 @@ alphasparse_status_t ONAME(const ALPHA_Complex alpha, const ALPHA_SPMAT_BSR *mat
         for(ALPHA_INT row = 0 ; row < m ; row += bs){
             ALPHA_INT br = row / bs;
             
-            for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai){
+            for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai){
                 const ALPHA_INT bc = mat->col_indx[ai];
                 const ALPHA_INT col = bc * bs;
                 if(bc < br ){
@@ -12,7 +12,7 @@ alphasparse_status_t ONAME(const ALPHA_Complex alpha, const ALPHA_SPMAT_CSR *mat
     {
         for (ALPHA_INT cr = 0; cr < mat->rows; ++cr)
         {
-            for (ALPHA_INT ai = mat->rows_start[cr]; ai < mat->rows_end[cr]; ++ai)
+            for (ALPHA_OFFSET ai = mat->rows_start[cr]; ai < mat->rows_end[cr]; ++ai)
             {
                 ALPHA_INT ac = mat->col_indx[ai];
                 if (ac > cr)
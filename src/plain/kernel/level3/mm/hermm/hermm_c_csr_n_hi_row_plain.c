@@ -11,7 +11,7 @@ alphasparse_status_t ONAME(const ALPHA_Complex alpha, const ALPHA_SPMAT_CSR *mat
             
     for (ALPHA_INT r = 0; r < m; ++r)
     {
-        for (ALPHA_INT ai = mat->rows_start[r]; ai < mat->rows_end[r]; ai++)
+        for (ALPHA_OFFSET ai = mat->rows_start[r]; ai < mat->rows_end[r]; ai++)
         {
             ALPHA_INT ac = mat->col_indx[ai];
             if (ac > r)
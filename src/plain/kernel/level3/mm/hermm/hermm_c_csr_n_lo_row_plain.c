@@ -10,7 +10,7 @@ alphasparse_status_t ONAME(const ALPHA_Complex alpha, const ALPHA_SPMAT_CSR *mat
         for (ALPHA_INT c = 0; c < n; c++)
             // y[index2(r, c, ldy)] *= beta;
             alpha_mul(y[index2(r, c, ldy)], y[index2(r, c, ldy)], beta);
-        for (ALPHA_INT ai = mat->rows_start[r]; ai < mat->rows_end[r]; ai++)
+        for (ALPHA_OFFSET ai = mat->rows_start[r]; ai < mat->rows_end[r]; ai++)
         {
             ALPHA_INT ac = mat->col_indx[ai];
             if (ac < r)
@@ -6,7 +6,7 @@ alphasparse_status_t ONAME(const ALPHA_Complex alpha, const ALPHA_SPMAT_CSR *mat
     ALPHA_SPMAT_CSR *transposed_mat;
     transpose_csr(mat, &transposed_mat);
     for (ALPHA_INT r = 0; r < transposed_mat->rows; ++r){
-        for (ALPHA_INT i = transposed_mat->rows_start[r]; i < transposed_mat->rows_end[r]; ++i){
+        for (ALPHA_OFFSET i = transposed_mat->rows_start[r]; i < transposed_mat->rows_end[r]; ++i){
             ALPHA_INT c = transposed_mat->col_indx[i];
             if(r == c)
                 transposed_mat->values[i].imag = 0.0 - transposed_mat->values[i].imag;
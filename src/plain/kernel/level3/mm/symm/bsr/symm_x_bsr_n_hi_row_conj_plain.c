@@ -19,7 +19,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
         for (ALPHA_INT r = 0; r < m; r += ll)
         {
             ALPHA_INT br = r / ll;
-            for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
+            for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
             {
                 ALPHA_INT lr, lc;
                 ALPHA_INT ac = mat->col_indx[ai] * ll;
@@ -81,7 +81,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
         for (ALPHA_INT r = 0; r < m; r += ll)
         {
             ALPHA_INT br = r / ll;
-            for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
+            for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
             {
                 ALPHA_INT lr, lc;
                 ALPHA_INT ac = mat->col_indx[ai] * ll;
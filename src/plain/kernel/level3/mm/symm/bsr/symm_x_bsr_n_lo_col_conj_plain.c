@@ -21,7 +21,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
         {
             ALPHA_INT br = R / ll;
             
-            for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
+            for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
             {
                 ALPHA_INT ac = mat->col_indx[ai] * ll;
                 ALPHA_Number *blk = &mat->values[ai*ll*ll];
@@ -83,7 +83,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
         {
             ALPHA_INT br = R / ll;
             
-            for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
+            for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
             {
                 ALPHA_INT ac = mat->col_indx[ai] * ll;
                 ALPHA_Number *blk = &mat->values[ai*ll*ll];
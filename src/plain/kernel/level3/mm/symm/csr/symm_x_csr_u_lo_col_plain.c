@@ -15,7 +15,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSR *mat,
     {
         for (ALPHA_INT ar = 0; ar < mat->rows; ++ar)
         {
-            for (ALPHA_INT ai = mat->rows_start[ar]; ai < mat->rows_end[ar]; ++ai)
+            for (ALPHA_OFFSET ai = mat->rows_start[ar]; ai < mat->rows_end[ar]; ++ai)
             {
                 ALPHA_INT ac = mat->col_indx[ai];
                 if (ac < ar)
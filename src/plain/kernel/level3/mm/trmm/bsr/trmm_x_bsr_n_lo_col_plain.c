@@ -20,7 +20,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
                 { // choose a inner row
                     ALPHA_Number extra;
                     alpha_setzero(extra); 
-                    for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
+                    for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
                     { // choose a block
                         ALPHA_INT ac = mat->col_indx[ai] * ll;
                         ALPHA_Number *blk = &mat->values[ai * ll * ll];
@@ -61,7 +61,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *mat,
                 { // choose a inner row
                     ALPHA_Number extra;
                     alpha_setzero(extra); 
-                    for (ALPHA_INT ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
+                    for (ALPHA_OFFSET ai = mat->rows_start[br]; ai < mat->rows_end[br]; ++ai)
                     { // choose a block
                         ALPHA_INT ac = mat->col_indx[ai] * ll;
                         ALPHA_Number *blk = &mat->values[ai * ll * ll];
@@ -11,7 +11,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_CSR *mat,
         ALPHA_Number *Y = &y[index2(r, 0, ldy)];
         for (ALPHA_INT c = 0; c < columns; c++)
             alpha_mule(Y[c], beta);
-        for (ALPHA_INT ai = mat->rows_start[r]; ai < mat->rows_end[r]; ai++)
+        for (ALPHA_OFFSET ai = mat->rows_start[r]; ai < mat->rows_end[r]; ai++)
         {
             ALPHA_INT ac = mat->col_indx[ai];
             if (ac >= r)
@@ -7,7 +7,7 @@ ONAME(ALPHA_SPMAT_CSR *A,
 	  const ALPHA_Number value)
 {
 	bool find = false;
-	for(ALPHA_INT ai = A->rows_start[row]; ai < A->rows_end[row]; ++ai)
+	for(ALPHA_OFFSET ai = A->rows_start[row]; ai < A->rows_end[row]; ++ai)
 	{
 		const ALPHA_INT ac = A->col_indx[ai];
 		if(ac == col)
@@ -26,10 +26,10 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_BSR *A, const ALPHA_SPMAT_BSR *B, A
     for (ALPHA_INT ar = 0; ar < m; ar++)
     {
         memset(flag, '\0', sizeof(bool) * n); //flag一次标记mat的一行
-        for (ALPHA_INT ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
+        for (ALPHA_OFFSET ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
         {
             ALPHA_INT br = A->col_indx[ai];
-            for (ALPHA_INT bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
+            for (ALPHA_OFFSET bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
             {
                 if (!flag[B->col_indx[bi]])
                 {
@@ -71,7 +71,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_BSR *A, const ALPHA_SPMAT_BSR *B, A
     alpha_free(flag);
     //printf("nnz:%d\n", (int)nnz);
 
-    ALPHA_INT *row_offset = alpha_memalign(sizeof(ALPHA_INT) * (m + 1), DEFAULT_ALIGNMENT);
+    ALPHA_OFFSET *row_offset = alpha_memalign(sizeof(ALPHA_OFFSET) * (m + 1), DEFAULT_ALIGNMENT);
     mat->rows_start = row_offset;
     mat->rows_end = row_offset + 1;
     mat->col_indx = alpha_memalign(nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
@@ -87,11 +87,11 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_BSR *A, const ALPHA_SPMAT_BSR *B, A
         bool *flaggg = alpha_memalign(sizeof(bool) * n, DEFAULT_ALIGNMENT); //凑mkl结果
 	    memset(flaggg, '\0', sizeof(bool) * n);
 	    memset(values, '\0', sizeof(ALPHA_Number) * n * bs * bs);
-        for (ALPHA_INT ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++) //对A的第ar行做矩阵乘法
+        for (ALPHA_OFFSET ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++) //对A的第ar行做矩阵乘法
         {
             ALPHA_INT br = A->col_indx[ai];
             //ALPHA_Number av = A->values[ai];
-            for (ALPHA_INT bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
+            for (ALPHA_OFFSET bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
             {
 		        ALPHA_INT bc = B->col_indx[bi];
                 //values[bc] += av * B->values[bi];
@@ -21,10 +21,10 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_SPMAT_CSR *B, A
     for (ALPHA_INT ar = 0; ar < m; ar++)
     {
         memset(flag, '\0', sizeof(bool) * n);
-        for (ALPHA_INT ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
+        for (ALPHA_OFFSET ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
         {
             ALPHA_INT br = A->col_indx[ai];
-            for (ALPHA_INT bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
+            for (ALPHA_OFFSET bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
             {
                 if (!flag[B->col_indx[bi]])
                 {
@@ -36,7 +36,7 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_SPMAT_CSR *B, A
     }
     alpha_free(flag);
 
-    ALPHA_INT *row_offset = alpha_memalign(sizeof(ALPHA_INT) * (m + 1), DEFAULT_ALIGNMENT);
+    ALPHA_OFFSET *row_offset = alpha_memalign(sizeof(ALPHA_OFFSET) * (m + 1), DEFAULT_ALIGNMENT);
     mat->rows_start = row_offset;
     mat->rows_end = row_offset + 1;
     mat->col_indx = alpha_memalign(nnz * sizeof(ALPHA_INT), DEFAULT_ALIGNMENT);
@@ -52,11 +52,11 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_CSR *A, const ALPHA_SPMAT_CSR *B, A
     {
         memset(values, '\0', sizeof(ALPHA_Number) * n);
         memset(write_back, '\0', sizeof(bool) * n);
-        for (ALPHA_INT ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
+        for (ALPHA_OFFSET ai = A->rows_start[ar]; ai < A->rows_end[ar]; ai++)
         {
             ALPHA_INT br = A->col_indx[ai];
             ALPHA_Number av = A->values[ai];
-            for (ALPHA_INT bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
+            for (ALPHA_OFFSET bi = B->rows_start[br]; bi < B->rows_end[br]; bi++)
             {
                 ALPHA_INT bc = B->col_indx[bi];
                 write_back[bc] = true;
@@ -31,11 +31,11 @@ alphasparse_status_t ONAME(const ALPHA_SPMAT_BSR *matA, const ALPHA_SPMAT_BSR *m
     // 计算
     for (ALPHA_INT ar = 0; ar < A_block_rows; ar++)
     {
-        for (ALPHA_INT ai = matA->rows_start[ar]; ai < matA->rows_end[ar]; ai++)
+        for (ALPHA_OFFSET ai = matA->rows_start[ar]; ai < matA->rows_end[ar]; ai++)
         {
             ALPHA_INT br = matA->col_indx[ai];
             //ALPHA_Number av = matA->values[ai];// av：matA->values[block_size*block_size*ai, block_size*block_size*ai+block_size*block_size]
-            for (ALPHA_INT bi = matB->rows_start[br]; bi < matB->rows_end[br]; bi++)
+            for (ALPHA_OFFSET bi = matB->rows_start[br]; bi < matB->rows_end[br]; bi++)
             {
                 ALPHA_INT bc = matB->col_indx[bi];
                 //ALPHA_Number bv = matB->values[bi]; //bv：matB->values[block_size*block_size*bi: block_size*block_size*bi+block_size*block_size]
@@ -30,7 +30,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *A, c
         exit(-1);
     }
     for(ALPHA_INT br = 0 ; br < b_rows; br++){
-        for(ALPHA_INT ai = A->rows_start[br]; ai < A->rows_end[br]; ai++){
+        for(ALPHA_OFFSET ai = A->rows_start[br]; ai < A->rows_end[br]; ai++){
 
             ALPHA_INT bc = A->col_indx[ai];
             if(bc == br){
@@ -53,7 +53,7 @@ alphasparse_status_t ONAME(const ALPHA_Number alpha, const ALPHA_SPMAT_BSR *A, c
             }
             ALPHA_INT diagBlock = -1;
             // memset(temp,'\0', bs * sizeof(ALPHA_Number));
-            for (ALPHA_INT ai = A->rows_start[br]; ai < A->rows_end[br]; ai++)
+            for (ALPHA_OFFSET ai = A->rows_start[br]; ai < A->rows_end[br]; ai++)
             {
                 ALPHA_INT bc = A->col_indx[ai];
                 if(bc > br)
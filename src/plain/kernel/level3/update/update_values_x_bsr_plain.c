@@ -17,7 +17,7 @@ ONAME(ALPHA_SPMAT_BSR *A,
 		ALPHA_INT block_col = col / bs;
 		ALPHA_INT block_row_inside = row % bs;
 		ALPHA_INT block_col_inside = col % bs;
-		for(ALPHA_INT ai = A->rows_start[block_row]; ai < A->rows_end[block_row]; ai++)
+		for(ALPHA_OFFSET ai = A->rows_start[block_row]; ai < A->rows_end[block_row]; ai++)
 		{
 			const ALPHA_INT ac = A->col_indx[ai];
 			if(ac == block_col)
@@ -36,6 +36,7 @@ alphasparse_status_t ONAME(const alphasparse_operation_t operation,
 
     alphasparse_matrix *AA = alpha_malloc(sizeof(alphasparse_matrix));
     *matC = AA;
+    AA->inspector = NULL;
     ALPHA_SPMAT_CSR *mat = alpha_malloc(sizeof(ALPHA_SPMAT_CSR));
     AA->format = A->format;
     AA->datatype = A->datatype;
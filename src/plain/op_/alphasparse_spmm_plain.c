@@ -133,6 +133,7 @@ alphasparse_status_t alphasparse_spmm_plain(const alphasparse_operation_t operat
 
     alphasparse_matrix *CC = alpha_malloc(sizeof(alphasparse_matrix));
     *C = CC;
+    CC->inspector = NULL;
 
     CC->datatype = A->datatype;
     CC->format = A->format;
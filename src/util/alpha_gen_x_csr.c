@@ -0,0 +1,38 @@
+/**
+ * @brief implement for the typed synthetic CSR generators
+ */
+
+#include "alphasparse/util/generate.h"
+#include "alphasparse/util/malloc.h"
+#include "alphasparse/util/thread.h"
+#include "alphasparse/util/check.h"
+
+alphasparse_status_t ONAME(const alpha_gen_t *gen, ALPHA_INT *rows, ALPHA_INT *cols, ALPHA_OFFSET **rows_offset, ALPHA_INT **col_index, ALPHA_Number **values_p)
+{
+    check_error_return(alpha_gen_pattern(gen, rows, cols, rows_offset, col_index));
+    const ALPHA_INT m = *rows;
+    const ALPHA_OFFSET *offset = *rows_offset;
+    const ALPHA_INT *col = *col_index;
+    ALPHA_Number *values = alpha_memalign(sizeof(ALPHA_Number) * (offset[m] > 0 ? offset[m] : 1), DEFAULT_ALIGNMENT);
+    const int thread_num = alpha_get_thread_num();
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(dynamic, 256)
+#endif
+    for (ALPHA_INT r = 0; r < m; r++)
+    {
+        const ALPHA_OFFSET row_nnz = offset[r + 1] - offset[r];
+        for (ALPHA_OFFSET ai = offset[r]; ai < offset[r + 1]; ai++)
+        {
+            double re, im;
+            alpha_gen_value(gen, r, col[ai], row_nnz, &re, &im);
+#ifdef COMPLEX
+            values[ai].real = re;
+            values[ai].imag = im;
+#else
+            values[ai] = re;
+#endif
+        }
+    }
+    *values_p = values;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
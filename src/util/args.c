@@ -39,6 +39,17 @@ struct option long_options[] =
         {"formatB", optional_argument, NULL, 21},
 
         {"data-type", optional_argument, NULL, 22},
+
+        {"op", optional_argument, NULL, 23},
+        {"warmup", optional_argument, NULL, 24},
+        {"output", optional_argument, NULL, 25},
+        {"output-file", optional_argument, NULL, 26},
+        {"stream-bw", optional_argument, NULL, 27},
+        {"block-size", optional_argument, NULL, 28},
+        {"gen", optional_argument, NULL, 29},
+        {"seed", optional_argument, NULL, 30},
+        {"perf", no_argument, NULL, 31},
+        {0, 0, 0, 0},
 };
 
 void print_help()
@@ -60,6 +71,17 @@ void print_help()
     printf("--typeB=<G|S|H|T|D|BT|BD>\n\tmatrix A type,default:G\n\n");
     printf("--fillB=<L|U>\n\tmatrix A fill mode,default:L\n\n");
     printf("--diagB=<N|U>\n\tmatrix A diag type,default:N\n\n");
+    printf("--formatA=<COO|CSR|CSC|BSR|SKY|DIA>\n\tmatrix A format,default:CSR\n\n");
+    printf("--data-type=<s|d|c|z>\n\tprecision,default:d\n\n");
+    printf("--block-size=<int>\n\tBSR block size,default:%d\n\n", DEFAULT_BLOCK_SIZE);
+    printf("--op=<mv|mm|trsv>\n\toperation to benchmark,default:%s\n\n", DEFAULT_OP);
+    printf("--warmup=<int>\n\tuntimed calls before the timed ones,default:%d\n\n", DEFAULT_WARMUP);
+    printf("--output=<text|csv|json>\n\tresult format,default:%s\n\n", DEFAULT_OUTPUT);
+    printf("--output-file=<file>\n\tappend results to file instead of stdout\n\n");
+    printf("--stream-bw=<GB/s>\n\tmemory bandwidth reference,default:measured with a STREAM triad\n\n");
+    printf("--gen=<spec>\n\tsynthetic matrix instead of --data-file, e.g. stencil27:64,64,64 banded:N,BW blockdiag:N,BS fem:NX,NY,BS er:N,DEGREE rmat:SCALE,DEGREE[,A,B,C]\n\n");
+    printf("--seed=<int>\n\tseed of the synthetic matrix,default:%d\n\n", DEFAULT_SEED);
+    printf("--perf\n\tcount hardware events of the timed calls with perf_event_open,default:off\n\n");
     exit(-1);
 }
 
@@ -176,6 +198,127 @@ const char *args_get_data_fileB(const int argc, const char *argv[])
     return ret_data_file;
 }
 
+alphasparse_format_t alpha_args_get_formatA(const int argc, const char *argv[])
+{
+    optind = 0;
+    int opt;
+    int option_index;
+    while ((opt = getopt_long_only(argc, (char *const *)argv, stort_options, long_options, &option_index)) != -1)
+        if (opt == 20)
+            return alphasparse_format_parse(optarg);
+    return DEFAULT_FORMAT;
+}
+
+alphasparse_datatype_t alpha_args_get_data_type(const int argc, const char *argv[])
+{
+    optind = 0;
+    int opt;
+    int option_index;
+    while ((opt = getopt_long_only(argc, (char *const *)argv, stort_options, long_options, &option_index)) != -1)
+        if (opt == 22)
+            return alphasparse_datatype_parse(optarg);
+    return DEFAULT_DATA_TYPE;
+}
+
+const char *args_get_op(const int argc, const char *argv[])
+{
+    optind = 0;
+    int opt;
+    int option_index;
+    while ((opt = getopt_long_only(argc, (char *const *)argv, stort_options, long_options, &option_index)) != -1)
+        if (opt == 23)
+            return optarg;
+    return DEFAULT_OP;
+}
+
+int args_get_warmup(const int argc, const char *argv[])
+{
+    optind = 0;
+    int opt;
+    int option_index;
+    while ((opt = getopt_long_only(argc, (char *const *)argv, stort_options, long_options, &option_index)) != -1)
+        if (opt == 24)
+            return atoi(optarg);
+    return DEFAULT_WARMUP;
+}
+
+const char *args_get_output(const int argc, const char *argv[])
+{
+    optind = 0;
+    int opt;
+    int option_index;
+    while ((opt = getopt_long_only(argc, (char *const *)argv, stort_options, long_options, &option_index)) != -1)
+        if (opt == 25)
+            return optarg;
+    return DEFAULT_OUTPUT;
+}
+
+const char *args_get_output_file(const int argc, const char *argv[])
+{
+    optind = 0;
+    int opt;
+    int option_index;
+    while ((opt = getopt_long_only(argc, (char *const *)argv, stort_options, long_options, &option_index)) != -1)
+        if (opt == 26)
+            return optarg;
+    return NULL;
+}
+
+double args_get_stream_bw(const int argc, const char *argv[])
+{
+    optind = 0;
+    int opt;
+    int option_index;
+    while ((opt = getopt_long_only(argc, (char *const *)argv, stort_options, long_options, &option_index)) != -1)
+        if (opt == 27)
+            return atof(optarg);
+    return 0;
+}
+
+int args_get_block_size(const int argc, const char *argv[])
+{
+    optind = 0;
+    int opt;
+    int option_index;
+    while ((opt = getopt_long_only(argc, (char *const *)argv, stort_options, long_options, &option_index)) != -1)
+        if (opt == 28)
+            return atoi(optarg);
+    return DEFAULT_BLOCK_SIZE;
+}
+
+const char *args_get_gen(const int argc, const char *argv[])
+{
+    optind = 0;
+    int opt;
+    int option_index;
+    while ((opt = getopt_long_only(argc, (char *const *)argv, stort_options, long_options, &option_index)) != -1)
+        if (opt == 29)
+            return optarg;
+    return NULL;
+}
+
+unsigned long long args_get_seed(const int argc, const char *argv[])
+{
+    optind = 0;
+    int opt;
+    int option_index;
+    while ((opt = getopt_long_only(argc, (char *const *)argv, stort_options, long_options, &option_index)) != -1)
+        if (opt == 30)
+            return strtoull(optarg, NULL, 10);
+    return DEFAULT_SEED;
+}
+
+bool args_get_perf(const int argc, const char *argv[])
+{
+    optind = 0;
+    int opt;
+    int option_index;
+    while ((opt = getopt_long_only(argc, (char *const *)argv, stort_options, long_options, &option_index)) != -1)
+        if (opt == 31)
+            return true;
+    return false;
+}
+
 alphasparse_layout_t alpha_args_get_layout(const int argc, const char *argv[])
 {
     return alpha_args_get_layout_helper(argc, argv, 15);
@@ -293,6 +436,38 @@ alphasparse_matrix_type_t alphasparse_matrix_type_parse(const char *arg)
     exit(-1);
 }
 
+alphasparse_format_t alphasparse_format_parse(const char *arg)
+{
+    if (strcmp("COO", arg) == 0)
+        return ALPHA_SPARSE_FORMAT_COO;
+    if (strcmp("CSR", arg) == 0)
+        return ALPHA_SPARSE_FORMAT_CSR;
+    if (strcmp("CSC", arg) == 0)
+        return ALPHA_SPARSE_FORMAT_CSC;
+    if (strcmp("BSR", arg) == 0)
+        return ALPHA_SPARSE_FORMAT_BSR;
+    if (strcmp("SKY", arg) == 0)
+        return ALPHA_SPARSE_FORMAT_SKY;
+    if (strcmp("DIA", arg) == 0)
+        return ALPHA_SPARSE_FORMAT_DIA;
+    printf("invalid format value!!! %s\n", arg);
+    exit(-1);
+}
+
+alphasparse_datatype_t alphasparse_datatype_parse(const char *arg)
+{
+    if (strcmp("s", arg) == 0 || strcmp("FLOAT", arg) == 0)
+        return ALPHA_SPARSE_DATATYPE_FLOAT;
+    if (strcmp("d", arg) == 0 || strcmp("DOUBLE", arg) == 0)
+        return ALPHA_SPARSE_DATATYPE_DOUBLE;
+    if (strcmp("c", arg) == 0 || strcmp("FLOAT_COMPLEX", arg) == 0)
+        return ALPHA_SPARSE_DATATYPE_FLOAT_COMPLEX;
+    if (strcmp("z", arg) == 0 || strcmp("DOUBLE_COMPLEX", arg) == 0)
+        return ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX;
+    printf("invalid data type value!!! %s\n", arg);
+    exit(-1);
+}
+
 alphasparse_fill_mode_t alphasparse_fill_mode_parse(const char *arg)
 {
     if (strcmp("L", arg) == 0 || strcmp("LOWER", arg) == 0)
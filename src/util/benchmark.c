@@ -0,0 +1,97 @@
+/**
+ * @brief implement for benchmark statistics and the STREAM triad reference
+ */
+
+#include "alphasparse/util/bench.h"
+#include "alphasparse/util/timing.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define STREAM_TRIAD_RUNS 5
+
+static int double_cmp(const void *a, const void *b)
+{
+    const double x = *(const double *)a;
+    const double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// nearest-rank percentile of a sorted array
+static double percentile(const double *sorted, const int count, const double p)
+{
+    int rank = (int)(p * count + 0.999999);
+    if (rank < 1)
+        rank = 1;
+    if (rank > count)
+        rank = count;
+    return sorted[rank - 1];
+}
+
+void alpha_bench_stats(double *times, const int count, alpha_bench_stats_t *stats)
+{
+    stats->count = count;
+    stats->min = stats->median = stats->p95 = stats->mean = 0;
+    if (count <= 0)
+        return;
+    qsort(times, count, sizeof(double), double_cmp);
+    double sum = 0;
+    for (int i = 0; i < count; i++)
+        sum += times[i];
+    stats->min = times[0];
+    stats->median = count % 2 ? times[count / 2] : (times[count / 2 - 1] + times[count / 2]) / 2;
+    stats->p95 = percentile(times, count, 0.95);
+    stats->mean = sum / count;
+}
+
+double alpha_bench_stream_triad(const size_t elements, const int thread_num)
+{
+    // plain malloc/free, the arrays are large and must go back to the system before the benchmark
+    double *a = malloc(elements * sizeof(double));
+    double *b = malloc(elements * sizeof(double));
+    double *c = malloc(elements * sizeof(double));
+    if (a == NULL || b == NULL || c == NULL)
+    {
+        printf("no enough memory space for the stream triad!!!\n");
+        free(a);
+        free(b);
+        free(c);
+        return 0;
+    }
+    const double scalar = 3.0;
+    const long n = (long)elements;
+
+    // first touch on the same threads and static schedule the triad uses
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static)
+#endif
+    for (long i = 0; i < n; i++)
+    {
+        a[i] = 1.0;
+        b[i] = 2.0;
+        c[i] = 0.5;
+    }
+
+    double best = 0;
+    for (int run = 0; run < STREAM_TRIAD_RUNS; run++)
+    {
+        double start = alpha_timing_wtime();
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static)
+#endif
+        for (long i = 0; i < n; i++)
+            a[i] = b[i] + scalar * c[i];
+        double time = alpha_timing_wtime() - start;
+        if (run > 0 || STREAM_TRIAD_RUNS == 1)
+        {
+            // read b and c, write a
+            double bw = 3.0 * sizeof(double) * elements / time * 1e-9;
+            if (bw > best)
+                best = bw;
+        }
+    }
+
+    free(a);
+    free(b);
+    free(c);
+    return best;
+}
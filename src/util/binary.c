@@ -0,0 +1,29 @@
+/**
+ * @brief implement for the native binary matrix layout helpers
+ */
+
+#include "alphasparse/binary.h"
+#include <string.h>
+
+alphasparse_status_t alpha_binary_write_section(FILE *fp, alpha_binary_header_t *header, const alpha_binary_section_t section, const void *data, const size_t bytes)
+{
+    static const char zeros[ALPHA_BINARY_ALIGNMENT] = {0};
+    long pos = ftell(fp);
+    if (pos < 0)
+        return ALPHA_SPARSE_STATUS_EXECUTION_FAILED;
+    size_t pad = (ALPHA_BINARY_ALIGNMENT - pos % ALPHA_BINARY_ALIGNMENT) % ALPHA_BINARY_ALIGNMENT;
+    if (pad != 0 && fwrite(zeros, 1, pad, fp) != pad)
+        return ALPHA_SPARSE_STATUS_EXECUTION_FAILED;
+    header->section[section] = (uint64_t)pos + pad;
+    if (bytes != 0 && fwrite(data, 1, bytes, fp) != bytes)
+        return ALPHA_SPARSE_STATUS_EXECUTION_FAILED;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+void *alpha_binary_section(const alpha_binary_header_t *header, const alpha_binary_section_t section, const size_t bytes)
+{
+    uint64_t offset = header->section[section];
+    if (offset == 0 || offset % ALPHA_BINARY_ALIGNMENT != 0 || offset > header->file_size || bytes > header->file_size - offset)
+        return NULL;
+    return (char *)header + offset;
+}
@@ -0,0 +1,191 @@
+#include "alphasparse/util.h"
+#include "alphasparse/util/csr_tiles.h"
+#include "alphasparse/util/thread.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// smallest panel and row block worth a segment list
+#define TILES_MIN_PANEL 1024
+#define TILES_MIN_BLOCK 256
+
+void alpha_csr_tiles_size(const ALPHA_INT rows, const size_t value_size, const ALPHA_INT num_threads, ALPHA_INT *panel_cols, ALPHA_INT *block_rows)
+{
+    const ALPHA_INT threads = alpha_max(num_threads, 1);
+    const size_t panel = alpha_cache_size(3) / (2 * value_size * threads);
+    const size_t block = alpha_cache_size(2) / (2 * value_size);
+    // at least four blocks a thread, so uneven blocks still balance
+    const size_t spread = ((size_t)rows + 4 * threads - 1) / (4 * threads);
+    *panel_cols = (ALPHA_INT)alpha_min(alpha_max(panel, TILES_MIN_PANEL), (size_t)1 << 30);
+    *block_rows = (ALPHA_INT)alpha_min(alpha_max(alpha_min(block, spread), TILES_MIN_BLOCK), (size_t)1 << 30);
+}
+
+void alpha_csr_tiles_destroy(alpha_csr_tiles_t *tiles)
+{
+    if (tiles == NULL)
+        return;
+    alpha_release(tiles->block_ptr);
+    alpha_release(tiles->block_seg);
+    alpha_release(tiles->seg_row);
+    alpha_release(tiles->seg_ptr);
+    alpha_release(tiles->col_indx);
+    alpha_release(tiles->values);
+    alpha_release(tiles->value_pos);
+    alpha_release(tiles);
+}
+
+void alpha_csr_tiles_refresh(alpha_csr_tiles_t *tiles, const void *values)
+{
+    const ALPHA_OFFSET nnz = tiles->block_ptr[tiles->row_blocks];
+    const size_t value_size = tiles->value_size;
+    const ALPHA_INT num_threads = alpha_get_thread_num();
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads)
+#endif
+    for (ALPHA_OFFSET i = 0; i < nnz; i++)
+        memcpy((char *)tiles->values + i * value_size, (const char *)values + tiles->value_pos[i] * value_size, value_size);
+}
+
+alphasparse_status_t alpha_csr_tiles_build(const ALPHA_INT rows,
+                                           const ALPHA_INT cols,
+                                           const ALPHA_OFFSET *rows_start,
+                                           const ALPHA_OFFSET *rows_end,
+                                           const ALPHA_INT *col_indx,
+                                           const void *values,
+                                           const size_t value_size,
+                                           const ALPHA_INT panel_cols,
+                                           const ALPHA_INT block_rows,
+                                           alpha_csr_tiles_t **tiles_p)
+{
+    *tiles_p = NULL;
+    check_return(panel_cols <= 0 || block_rows <= 0, ALPHA_SPARSE_STATUS_INVALID_VALUE);
+    const ALPHA_INT panels = alpha_max((cols + panel_cols - 1) / panel_cols, 1);
+    const ALPHA_INT row_blocks = (rows + block_rows - 1) / block_rows;
+    // every array comes from the allocators of the library, which do not return on failure
+    alpha_csr_tiles_t *tiles = alpha_malloc(sizeof(alpha_csr_tiles_t));
+    tiles->panel_cols = panel_cols;
+    tiles->block_rows = block_rows;
+    tiles->row_blocks = row_blocks;
+    tiles->block_ptr = alpha_malloc(sizeof(ALPHA_OFFSET) * (row_blocks + 1));
+    tiles->block_seg = alpha_malloc(sizeof(ALPHA_OFFSET) * (row_blocks + 1));
+    const ALPHA_INT num_threads = alpha_get_thread_num();
+
+    // entries and segments of every row block, a segment starts where a row enters a panel again
+    tiles->block_ptr[0] = 0;
+    tiles->block_seg[0] = 0;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+        ALPHA_INT *last = alpha_malloc(sizeof(ALPHA_INT) * panels);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (ALPHA_INT rb = 0; rb < row_blocks; rb++)
+        {
+            const ALPHA_INT rs = rb * block_rows, re = alpha_min(rs + block_rows, rows);
+            for (ALPHA_INT b = 0; b < panels; b++)
+                last[b] = -1;
+            ALPHA_OFFSET nnz = 0, segs = 0;
+            for (ALPHA_INT r = rs; r < re; r++)
+            {
+                nnz += rows_end[r] - rows_start[r];
+                for (ALPHA_OFFSET ai = rows_start[r]; ai < rows_end[r]; ai++)
+                {
+                    const ALPHA_INT b = col_indx[ai] / panel_cols;
+                    if (last[b] != r)
+                    {
+                        last[b] = r;
+                        segs++;
+                    }
+                }
+            }
+            tiles->block_ptr[rb + 1] = nnz;
+            tiles->block_seg[rb + 1] = segs;
+        }
+        alpha_release(last);
+    }
+    for (ALPHA_INT rb = 0; rb < row_blocks; rb++)
+    {
+        tiles->block_ptr[rb + 1] += tiles->block_ptr[rb];
+        tiles->block_seg[rb + 1] += tiles->block_seg[rb];
+    }
+    const ALPHA_OFFSET nnz = tiles->block_ptr[row_blocks];
+    const ALPHA_OFFSET segs = tiles->block_seg[row_blocks];
+    tiles->seg_row = alpha_malloc(sizeof(ALPHA_INT) * alpha_max(segs, 1));
+    tiles->seg_ptr = alpha_malloc(sizeof(ALPHA_OFFSET) * (segs + 1));
+    tiles->col_indx = alpha_memalign(sizeof(ALPHA_INT) * alpha_max(nnz, 1), DEFAULT_ALIGNMENT);
+    tiles->values = alpha_memalign(value_size * alpha_max(nnz, 1), DEFAULT_ALIGNMENT);
+    tiles->value_pos = alpha_memalign(sizeof(ALPHA_OFFSET) * alpha_max(nnz, 1), DEFAULT_ALIGNMENT);
+    tiles->value_size = value_size;
+    tiles->seg_ptr[segs] = nnz;
+
+    // counting sort of every block by panel, stable in the rows
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+        ALPHA_INT *last = alpha_malloc(sizeof(ALPHA_INT) * panels);
+        ALPHA_OFFSET *fill = alpha_malloc(sizeof(ALPHA_OFFSET) * panels);
+        ALPHA_OFFSET *seg_fill = alpha_malloc(sizeof(ALPHA_OFFSET) * panels);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (ALPHA_INT rb = 0; rb < row_blocks; rb++)
+        {
+            const ALPHA_INT rs = rb * block_rows, re = alpha_min(rs + block_rows, rows);
+            for (ALPHA_INT b = 0; b < panels; b++)
+            {
+                last[b] = -1;
+                fill[b] = 0;
+                seg_fill[b] = 0;
+            }
+            for (ALPHA_INT r = rs; r < re; r++)
+                for (ALPHA_OFFSET ai = rows_start[r]; ai < rows_end[r]; ai++)
+                {
+                    const ALPHA_INT b = col_indx[ai] / panel_cols;
+                    fill[b] += 1;
+                    if (last[b] != r)
+                    {
+                        last[b] = r;
+                        seg_fill[b] += 1;
+                    }
+                }
+            ALPHA_OFFSET pos = tiles->block_ptr[rb], seg = tiles->block_seg[rb];
+            for (ALPHA_INT b = 0; b < panels; b++)
+            {
+                const ALPHA_OFFSET count = fill[b], seg_count = seg_fill[b];
+                fill[b] = pos;
+                seg_fill[b] = seg;
+                pos += count;
+                seg += seg_count;
+                last[b] = -1;
+            }
+            for (ALPHA_INT r = rs; r < re; r++)
+                for (ALPHA_OFFSET ai = rows_start[r]; ai < rows_end[r]; ai++)
+                {
+                    const ALPHA_INT c = col_indx[ai];
+                    const ALPHA_INT b = c / panel_cols;
+                    if (last[b] != r)
+                    {
+                        last[b] = r;
+                        tiles->seg_row[seg_fill[b]] = r;
+                        tiles->seg_ptr[seg_fill[b]] = fill[b];
+                        seg_fill[b] += 1;
+                    }
+                    const ALPHA_OFFSET to = fill[b]++;
+                    tiles->col_indx[to] = c;
+                    tiles->value_pos[to] = ai;
+                    memcpy((char *)tiles->values + to * value_size, (const char *)values + ai * value_size, value_size);
+                }
+        }
+        alpha_release(last);
+        alpha_release(fill);
+        alpha_release(seg_fill);
+    }
+    *tiles_p = tiles;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
@@ -0,0 +1,365 @@
+/**
+ * @brief implement for the synthetic matrix generators
+ *
+ * Row generators (stencils, banded, block-diagonal, FEM, Erdos-Renyi) run
+ * twice over the rows: the first pass counts each row, the second writes it
+ * at its offset. R-MAT draws edges instead, which are bucketed by row, sorted
+ * and merged.
+ */
+
+#include "alphasparse/util/generate.h"
+#include "alphasparse/util/malloc.h"
+#include "alphasparse/util/random.h"
+#include "alphasparse/util/thread.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RMAT_DEFAULT_A 0.57
+#define RMAT_DEFAULT_B 0.19
+#define RMAT_DEFAULT_C 0.19
+
+// keeps value streams apart from structure streams of the same seed
+#define GEN_VALUE_STREAM 0x76616c7565ull
+
+// largest row count an ALPHA_INT holds
+#define GEN_INT_MAX ((long long)(((uint64_t)1 << (sizeof(ALPHA_INT) * 8 - 1)) - 1))
+
+// a * b for a, b >= 0, false when the product does not fit in an ALPHA_INT
+static bool gen_mul(const long long a, const long long b, long long *product)
+{
+    if (a > GEN_INT_MAX || b > GEN_INT_MAX || (b != 0 && a > GEN_INT_MAX / b))
+        return false;
+    *product = a * b;
+    return true;
+}
+
+alphasparse_status_t alpha_gen_parse(const char *spec, const uint64_t seed, alpha_gen_t *gen)
+{
+    memset(gen, 0, sizeof(alpha_gen_t));
+    gen->seed = seed;
+    long long p0 = 0, p1 = 0, p2 = 0;
+    double d = 0;
+    int got;
+    if ((got = sscanf(spec, "stencil5:%lld,%lld", &p0, &p1)) == 2)
+        gen->kind = ALPHA_GEN_STENCIL_5PT, gen->nx = p0, gen->ny = p1, gen->nz = 1;
+    else if ((got = sscanf(spec, "stencil7:%lld,%lld,%lld", &p0, &p1, &p2)) == 3)
+        gen->kind = ALPHA_GEN_STENCIL_7PT, gen->nx = p0, gen->ny = p1, gen->nz = p2;
+    else if ((got = sscanf(spec, "stencil27:%lld,%lld,%lld", &p0, &p1, &p2)) == 3)
+        gen->kind = ALPHA_GEN_STENCIL_27PT, gen->nx = p0, gen->ny = p1, gen->nz = p2;
+    else if ((got = sscanf(spec, "banded:%lld,%lld", &p0, &p1)) == 2)
+        gen->kind = ALPHA_GEN_BANDED, gen->n = p0, gen->bandwidth = p1;
+    else if ((got = sscanf(spec, "blockdiag:%lld,%lld", &p0, &p1)) == 2)
+        gen->kind = ALPHA_GEN_BLOCK_DIAG, gen->n = p0, gen->block_size = p1;
+    else if ((got = sscanf(spec, "fem:%lld,%lld,%lld", &p0, &p1, &p2)) == 3)
+        gen->kind = ALPHA_GEN_FEM, gen->nx = p0, gen->ny = p1, gen->block_size = p2;
+    else if ((got = sscanf(spec, "er:%lld,%lf", &p0, &d)) == 2)
+        gen->kind = ALPHA_GEN_ER, gen->n = p0, gen->degree = d;
+    else if ((got = sscanf(spec, "rmat:%lld,%lf,%lf,%lf,%lf", &p0, &d, &gen->a, &gen->b, &gen->c)) >= 2)
+    {
+        gen->kind = ALPHA_GEN_RMAT, gen->scale = p0, gen->degree = d;
+        // the probabilities come all three or not at all
+        if (got != 2 && got != 5)
+            return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+        if (got == 2)
+            gen->a = RMAT_DEFAULT_A, gen->b = RMAT_DEFAULT_B, gen->c = RMAT_DEFAULT_C;
+        if (gen->a < 0 || gen->b < 0 || gen->c < 0 || gen->a + gen->b + gen->c > 1 || gen->scale < 0 || gen->scale > 30)
+            return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+    else
+    {
+        printf("invalid generator spec!!! %s\n", spec);
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+    if (p0 < 0 || p1 < 0 || p2 < 0 || d < 0)
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    // the row count of grids and meshes is a product, it has to fit in an ALPHA_INT
+    long long rows = p0;
+    if (gen->kind == ALPHA_GEN_STENCIL_5PT || gen->kind == ALPHA_GEN_STENCIL_7PT || gen->kind == ALPHA_GEN_STENCIL_27PT || gen->kind == ALPHA_GEN_FEM)
+    {
+        if (!gen_mul(p0, p1, &rows) || (gen->kind != ALPHA_GEN_STENCIL_5PT && !gen_mul(rows, p2, &rows)))
+            return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+    if (rows > GEN_INT_MAX || p1 > GEN_INT_MAX)
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    if ((gen->kind == ALPHA_GEN_BLOCK_DIAG || gen->kind == ALPHA_GEN_FEM) && gen->block_size <= 0)
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+static void gen_shape(const alpha_gen_t *gen, ALPHA_INT *rows, ALPHA_INT *cols)
+{
+    ALPHA_INT n;
+    if (gen->kind <= ALPHA_GEN_STENCIL_27PT)
+        n = gen->nx * gen->ny * (gen->kind == ALPHA_GEN_STENCIL_5PT ? 1 : gen->nz);
+    else if (gen->kind == ALPHA_GEN_FEM)
+        n = gen->nx * gen->ny * gen->block_size;
+    else if (gen->kind == ALPHA_GEN_RMAT)
+        n = (ALPHA_INT)1 << gen->scale;
+    else
+        n = gen->n;
+    *rows = n;
+    *cols = n;
+}
+
+// columns of row r in ascending order, only counted when out is NULL
+static ALPHA_INT gen_row(const alpha_gen_t *gen, const ALPHA_INT r, ALPHA_INT *out)
+{
+    ALPHA_INT len = 0;
+    switch (gen->kind)
+    {
+    case ALPHA_GEN_STENCIL_5PT:
+    case ALPHA_GEN_STENCIL_7PT:
+    case ALPHA_GEN_STENCIL_27PT:
+    {
+        const ALPHA_INT nx = gen->nx, ny = gen->ny;
+        const ALPHA_INT nz = gen->kind == ALPHA_GEN_STENCIL_5PT ? 1 : gen->nz;
+        const ALPHA_INT x = r % nx, y = (r / nx) % ny, z = r / (nx * ny);
+        // lexicographic (dz, dy, dx) keeps the columns sorted
+        for (int dz = -1; dz <= 1; dz++)
+            for (int dy = -1; dy <= 1; dy++)
+                for (int dx = -1; dx <= 1; dx++)
+                {
+                    const int dist = abs(dx) + abs(dy) + abs(dz);
+                    if (gen->kind != ALPHA_GEN_STENCIL_27PT && dist > 1)
+                        continue;
+                    if (x + dx < 0 || x + dx >= nx || y + dy < 0 || y + dy >= ny || z + dz < 0 || z + dz >= nz)
+                        continue;
+                    if (out != NULL)
+                        out[len] = r + (dz * ny + dy) * nx + dx;
+                    len++;
+                }
+        break;
+    }
+    case ALPHA_GEN_BANDED:
+    {
+        const ALPHA_INT begin = r - gen->bandwidth < 0 ? 0 : r - gen->bandwidth;
+        const ALPHA_INT end = r + gen->bandwidth >= gen->n ? gen->n - 1 : r + gen->bandwidth;
+        for (ALPHA_INT c = begin; c <= end; c++)
+            if (out != NULL)
+                out[len++] = c;
+            else
+                len++;
+        break;
+    }
+    case ALPHA_GEN_BLOCK_DIAG:
+    {
+        const ALPHA_INT begin = r / gen->block_size * gen->block_size;
+        const ALPHA_INT end = begin + gen->block_size > gen->n ? gen->n : begin + gen->block_size;
+        for (ALPHA_INT c = begin; c < end; c++)
+            if (out != NULL)
+                out[len++] = c;
+            else
+                len++;
+        break;
+    }
+    case ALPHA_GEN_FEM:
+    {
+        const ALPHA_INT bs = gen->block_size, nx = gen->nx, ny = gen->ny;
+        const ALPHA_INT node = r / bs, x = node % nx, y = node / nx;
+        // nodes sharing a quad element with this one, each a dense bs x bs block
+        for (int dy = -1; dy <= 1; dy++)
+            for (int dx = -1; dx <= 1; dx++)
+            {
+                if (x + dx < 0 || x + dx >= nx || y + dy < 0 || y + dy >= ny)
+                    continue;
+                const ALPHA_INT first = (node + dy * nx + dx) * bs;
+                for (ALPHA_INT k = 0; k < bs; k++)
+                    if (out != NULL)
+                        out[len++] = first + k;
+                    else
+                        len++;
+            }
+        break;
+    }
+    case ALPHA_GEN_ER:
+    {
+        const ALPHA_INT n = gen->n;
+        const double p = n > 0 ? gen->degree / n : 0;
+        if (p <= 0)
+            break;
+        uint64_t state = alpha_random_stream(gen->seed, r);
+        // geometric skips between present entries, the columns come out sorted
+        const double log_q = p < 1 ? log1p(-p) : 0;
+        for (int64_t c = -1;;)
+        {
+            int64_t skip = 0;
+            if (p < 1)
+            {
+                double s = floor(log(1.0 - alpha_random_uniform(&state)) / log_q);
+                skip = s > n ? n : (int64_t)s;
+            }
+            c += 1 + skip;
+            if (c >= n)
+                break;
+            if (out != NULL)
+                out[len] = (ALPHA_INT)c;
+            len++;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return len;
+}
+
+static int int_cmp(const void *a, const void *b)
+{
+    const ALPHA_INT x = *(const ALPHA_INT *)a;
+    const ALPHA_INT y = *(const ALPHA_INT *)b;
+    return (x > y) - (x < y);
+}
+
+static alphasparse_status_t gen_rmat(const alpha_gen_t *gen, const ALPHA_INT n, ALPHA_OFFSET **rows_offset_p, ALPHA_INT **col_index_p)
+{
+    const int thread_num = alpha_get_thread_num();
+    const int64_t edges = (int64_t)(gen->degree * n);
+    const int scale = gen->scale;
+    const double ab = gen->a + gen->b, abc = gen->a + gen->b + gen->c;
+    ALPHA_INT *src = malloc(sizeof(ALPHA_INT) * (edges > 0 ? edges : 1));
+    ALPHA_INT *dst = malloc(sizeof(ALPHA_INT) * (edges > 0 ? edges : 1));
+    ALPHA_OFFSET *cursor = malloc(sizeof(ALPHA_OFFSET) * (n + 1));
+    if (src == NULL || dst == NULL || cursor == NULL)
+    {
+        free(src);
+        free(dst);
+        free(cursor);
+        return ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    }
+    memset(cursor, 0, sizeof(ALPHA_OFFSET) * (n + 1));
+
+    // every edge descends scale levels of the quadrant recursion
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+    for (int64_t e = 0; e < edges; e++)
+    {
+        uint64_t state = alpha_random_stream(gen->seed, e);
+        ALPHA_INT r = 0, c = 0;
+        for (int level = scale - 1; level >= 0; level--)
+        {
+            const double u = alpha_random_uniform(&state);
+            if (u >= abc)
+                r |= (ALPHA_INT)1 << level, c |= (ALPHA_INT)1 << level;
+            else if (u >= ab)
+                r |= (ALPHA_INT)1 << level;
+            else if (u >= gen->a)
+                c |= (ALPHA_INT)1 << level;
+        }
+        src[e] = r;
+        dst[e] = c;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        cursor[r + 1]++;
+    }
+    for (ALPHA_INT r = 0; r < n; r++)
+        cursor[r + 1] += cursor[r];
+
+    ALPHA_INT *bucket = malloc(sizeof(ALPHA_INT) * (edges > 0 ? edges : 1));
+    ALPHA_OFFSET *fill = malloc(sizeof(ALPHA_OFFSET) * (n + 1));
+    if (bucket == NULL || fill == NULL)
+    {
+        free(src);
+        free(dst);
+        free(cursor);
+        free(bucket);
+        free(fill);
+        return ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    }
+    memcpy(fill, cursor, sizeof(ALPHA_OFFSET) * (n + 1));
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num)
+#endif
+    for (int64_t e = 0; e < edges; e++)
+    {
+        ALPHA_OFFSET at;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+        at = fill[src[e]]++;
+        bucket[at] = dst[e];
+    }
+    free(src);
+    free(dst);
+    free(fill);
+
+    // bucket order depends on the schedule, sorting and merging duplicates does not
+    ALPHA_OFFSET *rows_offset = alpha_memalign(sizeof(ALPHA_OFFSET) * (n + 1), DEFAULT_ALIGNMENT);
+    rows_offset[0] = 0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(dynamic, 256)
+#endif
+    for (ALPHA_INT r = 0; r < n; r++)
+    {
+        ALPHA_INT *row = bucket + cursor[r];
+        const ALPHA_OFFSET len = cursor[r + 1] - cursor[r];
+        qsort(row, len, sizeof(ALPHA_INT), int_cmp);
+        ALPHA_OFFSET unique = 0;
+        for (ALPHA_OFFSET i = 0; i < len; i++)
+            if (unique == 0 || row[i] != row[unique - 1])
+                row[unique++] = row[i];
+        rows_offset[r + 1] = unique;
+    }
+    for (ALPHA_INT r = 0; r < n; r++)
+        rows_offset[r + 1] += rows_offset[r];
+
+    ALPHA_INT *col_index = alpha_memalign(sizeof(ALPHA_INT) * (rows_offset[n] > 0 ? rows_offset[n] : 1), DEFAULT_ALIGNMENT);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(dynamic, 256)
+#endif
+    for (ALPHA_INT r = 0; r < n; r++)
+        memcpy(col_index + rows_offset[r], bucket + cursor[r], sizeof(ALPHA_INT) * (rows_offset[r + 1] - rows_offset[r]));
+    free(bucket);
+    free(cursor);
+    *rows_offset_p = rows_offset;
+    *col_index_p = col_index;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alpha_gen_pattern(const alpha_gen_t *gen, ALPHA_INT *rows, ALPHA_INT *cols, ALPHA_OFFSET **rows_offset_p, ALPHA_INT **col_index_p)
+{
+    ALPHA_INT m, n;
+    gen_shape(gen, &m, &n);
+    *rows = m;
+    *cols = n;
+    if (gen->kind == ALPHA_GEN_RMAT)
+        return gen_rmat(gen, m, rows_offset_p, col_index_p);
+
+    const int thread_num = alpha_get_thread_num();
+    ALPHA_OFFSET *rows_offset = alpha_memalign(sizeof(ALPHA_OFFSET) * (m + 1), DEFAULT_ALIGNMENT);
+    rows_offset[0] = 0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static)
+#endif
+    for (ALPHA_INT r = 0; r < m; r++)
+        rows_offset[r + 1] = gen_row(gen, r, NULL);
+    for (ALPHA_INT r = 0; r < m; r++)
+        rows_offset[r + 1] += rows_offset[r];
+
+    ALPHA_INT *col_index = alpha_memalign(sizeof(ALPHA_INT) * (rows_offset[m] > 0 ? rows_offset[m] : 1), DEFAULT_ALIGNMENT);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(static)
+#endif
+    for (ALPHA_INT r = 0; r < m; r++)
+        gen_row(gen, r, col_index + rows_offset[r]);
+    *rows_offset_p = rows_offset;
+    *col_index_p = col_index;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+void alpha_gen_value(const alpha_gen_t *gen, const ALPHA_INT row, const ALPHA_INT col, const ALPHA_OFFSET row_nnz, double *re, double *im)
+{
+    if (row == col)
+    {
+        *re = (double)row_nnz;
+        *im = 0;
+        return;
+    }
+    uint64_t state = alpha_random_stream(gen->seed ^ GEN_VALUE_STREAM, ((uint64_t)row << 32) ^ (uint64_t)col);
+    *re = -alpha_random_uniform(&state);
+    *im = -alpha_random_uniform(&state);
+}
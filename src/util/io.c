@@ -346,6 +346,97 @@ void alpha_read_coo_z(const char *file, ALPHA_INT *m_p, ALPHA_INT *n_p, ALPHA_IN
     alpha_close(fp);
 }
 
+int alpha_read_coo_is_pattern(const char *file)
+{
+    FILE *fp = alpha_open(file, "r");
+    char buffer[BUFFER_SIZE];
+    char *token;
+    const char PAT[] = "pattern";
+    int ispattern = 0;
+    // only the %%MatrixMarket banner carries the field type
+    if (fgets(buffer, BUFFER_SIZE, fp) && buffer[0] == '%')
+    {
+        token = strtok(buffer, " \n");
+        while (token != NULL)
+        {
+            if (strcmp(token, PAT) == 0)
+            {
+                ispattern = 1;
+                break;
+            }
+            token = strtok(NULL, " \n");
+        }
+    }
+    alpha_close(fp);
+    return ispattern;
+}
+
+void alpha_read_coo_pattern(const char *file, ALPHA_INT *m_p, ALPHA_INT *n_p, ALPHA_INT *nnz_p, ALPHA_INT **row_index, ALPHA_INT **col_index)
+{
+    FILE *fp = alpha_open(file, "r");
+    char buffer[BUFFER_SIZE];
+    char *token;
+    const char SYM[] = "symmetric";
+    int issym = 0;
+    int firstLine = 1;
+    while (fgets(buffer, BUFFER_SIZE, fp))
+    {
+        if (firstLine)
+        {
+            if (buffer[0] == '%')
+            {
+                token = strtok(buffer, " \n");
+                while (token != NULL)
+                {
+                    if (strcmp(token, SYM) == 0)
+                    {
+                        issym = 1;
+                        break;
+                    }
+                    token = strtok(NULL, " \n");
+                }
+            }
+            firstLine = 0;
+        }
+        if (buffer[0] != '%')
+            break;
+    }
+    ALPHA_INT64 m, n, nnz, real_nnz, double_nnz;
+    sscanf(buffer, "%ld %ld %ld\n", &m, &n, &nnz);
+    real_nnz = 0;
+    double_nnz = nnz << 1;
+    *m_p = (ALPHA_INT)m;
+    *n_p = (ALPHA_INT)n;
+    ALPHA_INT *fake_row_index = alpha_malloc(double_nnz * sizeof(ALPHA_INT));
+    ALPHA_INT *fake_col_index = alpha_malloc(double_nnz * sizeof(ALPHA_INT));
+    for (ALPHA_INT64 i = 0; i < nnz; i++, real_nnz++)
+    {
+        ALPHA_INT64 row, col;
+        fgets(buffer, BUFFER_SIZE, fp);
+        token = strtok(buffer, " ");
+        row = atol(token);
+        token = strtok(NULL, " ");
+        col = atol(token);
+        // a value column, if any, is ignored
+        fake_row_index[real_nnz] = (ALPHA_INT)row - 1;
+        fake_col_index[real_nnz] = (ALPHA_INT)col - 1;
+        if (row != col && issym)
+        {
+            real_nnz++;
+            fake_row_index[real_nnz] = (ALPHA_INT)col - 1;
+            fake_col_index[real_nnz] = (ALPHA_INT)row - 1;
+        }
+    }
+    *row_index = alpha_malloc(real_nnz * sizeof(ALPHA_INT));
+    *col_index = alpha_malloc(real_nnz * sizeof(ALPHA_INT));
+    *nnz_p = real_nnz;
+    memcpy(*row_index, fake_row_index, sizeof(ALPHA_INT) * real_nnz);
+    memcpy(*col_index, fake_col_index, sizeof(ALPHA_INT) * real_nnz);
+    alpha_free(fake_row_index);
+    alpha_free(fake_col_index);
+    alpha_close(fp);
+}
+
 #ifdef __MKL__
 
 void mkl_read_coo(const char *file, MKL_INT *m_p, MKL_INT *n_p, MKL_INT *nnz_p, MKL_INT **row_index, MKL_INT **col_index, float **values)
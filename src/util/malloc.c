@@ -7,6 +7,7 @@
 
 #include <malloc.h>
 #include <stdio.h>
+#include <string.h>
 #include <time.h>
 
 #include "alphasparse/util/random.h"
@@ -16,9 +17,21 @@
 #include <numa.h>
 #endif
 
+#ifdef NUMA
+// numa_free needs the size, keep it in front of the block, padded to keep the alignment
+#define NUMA_HEADER 64
+
+static void *numa_alloc_sized(size_t bytes) {
+  char *base = numa_alloc_onnode(bytes + NUMA_HEADER, 0);
+  if (base == NULL) return NULL;
+  *(size_t *)base = bytes + NUMA_HEADER;
+  return base + NUMA_HEADER;
+}
+#endif
+
 void *alpha_malloc(size_t bytes) {
 #ifdef NUMA
-  void *ret = numa_alloc_onnode(bytes, 0);
+  void *ret = numa_alloc_sized(bytes);
 #else
   void *ret = malloc(bytes);
 #endif
@@ -31,7 +44,7 @@ void *alpha_malloc(size_t bytes) {
 
 void *alpha_memalign(size_t bytes, size_t alignment) {
 #ifdef NUMA
-  void *ret = numa_alloc_onnode(bytes, 0);
+  void *ret = numa_alloc_sized(bytes);
 #else
   void *ret = memalign(alignment, bytes);
 #endif
@@ -47,6 +60,60 @@ void alpha_free(void *point) {
     free(point); 
 }
 
+void alpha_release(void *point) {
+  if (point == NULL) return;
+#ifdef NUMA
+  char *base = (char *)point - NUMA_HEADER;
+  numa_free(base, *(size_t *)base);
+#else
+  free(point);
+#endif
+}
+
+static size_t cache_size_sysfs(const int level) {
+  char path[96];
+  for (int index = 0; index < 16; index++) {
+    int found_level = 0;
+    char type[32] = "", size[32] = "";
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/level", index);
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) break;
+    if (fscanf(fp, "%d", &found_level) != 1) found_level = 0;
+    fclose(fp);
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/type", index);
+    fp = fopen(path, "r");
+    if (fp == NULL) continue;
+    if (fscanf(fp, "%31s", type) != 1) type[0] = '\0';
+    fclose(fp);
+    if (found_level != level || strcmp(type, "Instruction") == 0) continue;
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/size", index);
+    fp = fopen(path, "r");
+    if (fp == NULL) continue;
+    unsigned long value = 0;
+    char unit = '\0';
+    const int read = fscanf(fp, "%lu%c", &value, &unit);
+    fclose(fp);
+    if (read < 1 || value == 0) continue;
+    if (unit == 'K') value <<= 10;
+    else if (unit == 'M') value <<= 20;
+    else if (unit == 'G') value <<= 30;
+    return value;
+  }
+  return 0;
+}
+
+size_t alpha_cache_size(const int level) {
+  static size_t sizes[3];
+  if (level < 1 || level > 3) return 0;
+  if (sizes[level - 1] == 0) {
+    const size_t defaults[3] = {L1_CACHE_SIZE, L2_CACHE_SIZE, L3_CACHE_SIZE};
+    const size_t size = cache_size_sysfs(level);
+    // a racing first call stores the same value
+    sizes[level - 1] = size != 0 ? size : defaults[level - 1];
+  }
+  return sizes[level - 1];
+}
+
 void alpha_clear_cache() {
   ALPHA_INT thread_num = alpha_get_thread_num();
   const size_t L3_used = (thread_num + 23) / 24;
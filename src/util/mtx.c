@@ -0,0 +1,645 @@
+/**
+ * @brief parallel MatrixMarket reader over a mapped file
+ *
+ * The file is mapped once and the entry section is split into newline
+ * aligned chunks, one per thread. Numbers are parsed in place without
+ * strtok/atof and written straight into the caller's arrays, so a read
+ * allocates nothing beyond a few per-thread counters on the stack.
+ */
+
+// mmap and posix_madvise under -std=c11
+#define _POSIX_C_SOURCE 200809L
+
+#include "alphasparse/util/io.h"
+#include "alphasparse/util/thread.h"
+#include "alphasparse/util/timing.h"
+#include <ctype.h>
+#include <fcntl.h>
+#include <float.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+typedef enum
+{
+    MTX_OUT_S = 0,
+    MTX_OUT_D = 1,
+    MTX_OUT_C = 2,
+    MTX_OUT_Z = 3,
+} mtx_out_t;
+
+static const size_t mtx_out_size[] = {sizeof(float), sizeof(double), sizeof(ALPHA_Complex8), sizeof(ALPHA_Complex16)};
+
+// exact powers of ten, products with a mantissa below 2^53 round correctly
+static const double pow10_table[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                     1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+#if LDBL_MANT_DIG == 64
+// x87 extended precision holds any 19 digit mantissa and 10^27 exactly
+static const long double pow10_table_l[] = {1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L,
+                                            1e10L, 1e11L, 1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L,
+                                            1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L};
+#endif
+
+static inline const char *skip_blank(const char *p, const char *end)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+        p++;
+    return p;
+}
+
+static inline const char *next_line(const char *p, const char *end)
+{
+    const char *q = memchr(p, '\n', end - p);
+    return q == NULL ? end : q + 1;
+}
+
+// lines holding nothing or a comment are not entries
+static inline int is_entry_line(const char *p, const char *end)
+{
+    p = skip_blank(p, end);
+    return p < end && *p != '\n' && *p != '%';
+}
+
+static inline const char *parse_index(const char *p, const char *end, ALPHA_INT64 *v)
+{
+    p = skip_blank(p, end);
+    ALPHA_INT64 r = 0;
+    const char *s = p;
+    while (p < end && (unsigned)(*p - '0') < 10)
+        r = r * 10 + (*p++ - '0');
+    *v = p == s ? -1 : r;
+    return p;
+}
+
+static const char *parse_real_slow(const char *p, const char *end, double *v)
+{
+    char buffer[64];
+    size_t len = 0;
+    while (p + len < end && len < sizeof(buffer) - 1 && !isspace((unsigned char)p[len]))
+    {
+        // Fortran style exponents
+        buffer[len] = (p[len] == 'd' || p[len] == 'D') ? 'e' : p[len];
+        len++;
+    }
+    buffer[len] = '\0';
+    char *stop;
+    *v = strtod(buffer, &stop);
+    return p + len;
+}
+
+static inline const char *parse_real(const char *p, const char *end, double *v)
+{
+    p = skip_blank(p, end);
+    const char *s = p;
+    int neg = 0;
+    if (p < end && (*p == '-' || *p == '+'))
+        neg = *p++ == '-';
+    uint64_t mant = 0;
+    int digits = 0, exp10 = 0, any = 0;
+    while (p < end && (unsigned)(*p - '0') < 10)
+    {
+        if (digits < 19)
+            mant = mant * 10 + (*p - '0'), digits += mant != 0;
+        else
+            exp10++;
+        p++, any = 1;
+    }
+    if (p < end && *p == '.')
+    {
+        p++;
+        while (p < end && (unsigned)(*p - '0') < 10)
+        {
+            if (digits < 19)
+                mant = mant * 10 + (*p - '0'), digits += mant != 0, exp10--;
+            p++, any = 1;
+        }
+    }
+    if (!any)
+        return parse_real_slow(s, end, v);
+    if (p < end && (*p == 'e' || *p == 'E' || *p == 'd' || *p == 'D'))
+    {
+        p++;
+        int eneg = 0, e = 0;
+        if (p < end && (*p == '-' || *p == '+'))
+            eneg = *p++ == '-';
+        while (p < end && (unsigned)(*p - '0') < 10)
+        {
+            if (e < 100000)
+                e = e * 10 + (*p - '0');
+            p++;
+        }
+        exp10 += eneg ? -e : e;
+    }
+    double r;
+    if (!(mant >> 53) && exp10 >= -22 && exp10 <= 22)
+    {
+        r = (double)mant;
+        r = exp10 < 0 ? r / pow10_table[-exp10] : r * pow10_table[exp10];
+    }
+#if LDBL_MANT_DIG == 64
+    else if (exp10 >= -27 && exp10 <= 27)
+    {
+        // one rounding to 64 bits, the second one to 53 bits is only wrong
+        // when the first result sits exactly on a 53 bit midpoint
+        volatile long double x = (long double)mant;
+        x = exp10 < 0 ? x / pow10_table_l[-exp10] : x * pow10_table_l[exp10];
+        uint64_t bits;
+        memcpy(&bits, (const void *)&x, sizeof(bits));
+        if ((bits & 0x7ff) == 0x400)
+            return parse_real_slow(s, end, v);
+        r = (double)x;
+    }
+#endif
+    else
+        return parse_real_slow(s, end, v);
+    *v = neg ? -r : r;
+    return p;
+}
+
+static inline void store_value(void *values, mtx_out_t out, ALPHA_INT64 i, double re, double im)
+{
+    if (out == MTX_OUT_S)
+        ((float *)values)[i] = (float)re;
+    else if (out == MTX_OUT_D)
+        ((double *)values)[i] = re;
+    else if (out == MTX_OUT_C)
+    {
+        ((ALPHA_Complex8 *)values)[i].real = (float)re;
+        ((ALPHA_Complex8 *)values)[i].imag = (float)im;
+    }
+    else
+    {
+        ((ALPHA_Complex16 *)values)[i].real = re;
+        ((ALPHA_Complex16 *)values)[i].imag = im;
+    }
+}
+
+// value of the mirrored entry (col, row) of a stored (row, col)
+static inline void mirror_value(alpha_mtx_symmetry_t symmetry, double *re, double *im)
+{
+    if (symmetry == ALPHA_MTX_SKEW_SYMMETRIC)
+        *re = -*re, *im = -*im;
+    else if (symmetry == ALPHA_MTX_HERMITIAN)
+        *im = -*im;
+}
+
+// symmetric and hermitian files read as stored, skew-symmetric has no matching descriptor and is always expanded
+static inline int is_half(const alpha_mtx_t *mtx)
+{
+    return mtx->half && (mtx->symmetry == ALPHA_MTX_SYMMETRIC || mtx->symmetry == ALPHA_MTX_HERMITIAN);
+}
+
+// parse one entry line, returns 0 for an out of range or malformed index
+static inline int parse_entry(const alpha_mtx_t *mtx, const char **pp, const char *end, ALPHA_INT64 *row, ALPHA_INT64 *col, double *re, double *im, int want_value)
+{
+    const char *p = *pp;
+    p = parse_index(p, end, row);
+    p = parse_index(p, end, col);
+    *re = 1.0;
+    *im = 0.0;
+    if (want_value && mtx->field != ALPHA_MTX_FIELD_PATTERN)
+    {
+        p = parse_real(p, end, re);
+        if (mtx->field == ALPHA_MTX_FIELD_COMPLEX)
+            p = parse_real(p, end, im);
+    }
+    *pp = next_line(p, end);
+    // upper entries of a half-stored file move to the lower triangle
+    if (is_half(mtx) && *row < *col)
+    {
+        ALPHA_INT64 t = *row;
+        *row = *col;
+        *col = t;
+        mirror_value(mtx->symmetry, re, im);
+    }
+    return *row >= 1 && *row <= mtx->rows && *col >= 1 && *col <= mtx->cols;
+}
+
+static inline int is_mirrored(const alpha_mtx_t *mtx, ALPHA_INT64 row, ALPHA_INT64 col)
+{
+    return mtx->symmetry != ALPHA_MTX_GENERAL && !is_half(mtx) && row != col;
+}
+
+// post increment of a row cursor, atomic only when other threads share it
+static inline ALPHA_OFFSET cursor_inc(ALPHA_OFFSET *cursor, const int shared)
+{
+    ALPHA_OFFSET v;
+    if (!shared)
+        return (*cursor)++;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+    v = (*cursor)++;
+    return v;
+}
+
+// split the entry section into thread_num newline aligned chunks
+static void mtx_chunks(const alpha_mtx_t *mtx, const int thread_num, size_t *chunk)
+{
+    const char *end = mtx->data + mtx->size;
+    const size_t len = mtx->size - mtx->body;
+    chunk[0] = mtx->body;
+    for (int t = 1; t < thread_num; t++)
+    {
+        size_t raw = mtx->body + len / thread_num * t;
+        if (raw < chunk[t - 1])
+            raw = chunk[t - 1];
+        chunk[t] = raw == mtx->body ? raw : (size_t)(next_line(mtx->data + raw - 1, end) - mtx->data);
+    }
+    chunk[thread_num] = mtx->size;
+}
+
+static int mtx_token_is(const char *token, const char *word)
+{
+    return strcasecmp(token, word) == 0;
+}
+
+alphasparse_status_t alpha_mtx_open(const char *file, alpha_mtx_t *mtx)
+{
+    memset(mtx, 0, sizeof(alpha_mtx_t));
+    int fd = open(file, O_RDONLY);
+    if (fd < 0)
+    {
+        printf("file is not exist!!!\n");
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        close(fd);
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    posix_madvise(data, st.st_size, POSIX_MADV_WILLNEED);
+    mtx->data = data;
+    mtx->size = st.st_size;
+
+    const char *p = mtx->data;
+    const char *end = p + mtx->size;
+    const char *line_end = next_line(p, end);
+    if (line_end - p < 14 || strncmp(p, "%%MatrixMarket", 14) != 0)
+    {
+        alpha_mtx_close(mtx);
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+    // banner: %%MatrixMarket matrix coordinate <field> <symmetry>
+    char banner[BUFFER_SIZE];
+    size_t banner_len = line_end - p < BUFFER_SIZE ? line_end - p : BUFFER_SIZE - 1;
+    memcpy(banner, p, banner_len);
+    banner[banner_len] = '\0';
+    int coordinate = 0;
+    mtx->field = ALPHA_MTX_FIELD_REAL;
+    mtx->symmetry = ALPHA_MTX_GENERAL;
+    for (char *token = strtok(banner, " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n"))
+    {
+        if (mtx_token_is(token, "coordinate"))
+            coordinate = 1;
+        else if (mtx_token_is(token, "integer") || mtx_token_is(token, "real"))
+            mtx->field = ALPHA_MTX_FIELD_REAL;
+        else if (mtx_token_is(token, "complex"))
+            mtx->field = ALPHA_MTX_FIELD_COMPLEX;
+        else if (mtx_token_is(token, "pattern"))
+            mtx->field = ALPHA_MTX_FIELD_PATTERN;
+        else if (mtx_token_is(token, "symmetric"))
+            mtx->symmetry = ALPHA_MTX_SYMMETRIC;
+        else if (mtx_token_is(token, "skew-symmetric"))
+            mtx->symmetry = ALPHA_MTX_SKEW_SYMMETRIC;
+        else if (mtx_token_is(token, "hermitian"))
+            mtx->symmetry = ALPHA_MTX_HERMITIAN;
+    }
+    if (!coordinate)
+    {
+        alpha_mtx_close(mtx);
+        return ALPHA_SPARSE_STATUS_NOT_SUPPORTED;
+    }
+    p = line_end;
+    while (p < end && !is_entry_line(p, end))
+        p = next_line(p, end);
+    ALPHA_INT64 rows, cols, entries;
+    p = parse_index(p, end, &rows);
+    p = parse_index(p, end, &cols);
+    p = parse_index(p, end, &entries);
+    if (rows < 0 || cols < 0 || entries < 0)
+    {
+        alpha_mtx_close(mtx);
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    }
+    mtx->rows = (ALPHA_INT)rows;
+    mtx->cols = (ALPHA_INT)cols;
+    mtx->entries = entries;
+    mtx->body = next_line(p, end) - mtx->data;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+void alpha_mtx_close(alpha_mtx_t *mtx)
+{
+    if (mtx->data != NULL)
+        munmap((void *)mtx->data, mtx->size);
+    mtx->data = NULL;
+    mtx->size = 0;
+}
+
+ALPHA_INT64 alpha_mtx_nnz_max(const alpha_mtx_t *mtx)
+{
+    return mtx->symmetry == ALPHA_MTX_GENERAL || is_half(mtx) ? mtx->entries : mtx->entries * 2;
+}
+
+struct alpha_matrix_descr alpha_mtx_descr(const alpha_mtx_t *mtx)
+{
+    struct alpha_matrix_descr descr = {.type = ALPHA_SPARSE_MATRIX_TYPE_GENERAL};
+    if (is_half(mtx))
+    {
+        descr.type = mtx->symmetry == ALPHA_MTX_HERMITIAN ? ALPHA_SPARSE_MATRIX_TYPE_HERMITIAN : ALPHA_SPARSE_MATRIX_TYPE_SYMMETRIC;
+        descr.mode = ALPHA_SPARSE_FILL_MODE_LOWER;
+        descr.diag = ALPHA_SPARSE_DIAG_NON_UNIT;
+    }
+    return descr;
+}
+
+static alphasparse_status_t mtx_read_coo(alpha_mtx_t *mtx, ALPHA_INT *row_index, ALPHA_INT *col_index, void *values, mtx_out_t out, ALPHA_INT *nnz)
+{
+    alpha_timer_t timer;
+    alpha_timing_start(&timer);
+    const int thread_num = alpha_get_thread_num();
+    const char *end = mtx->data + mtx->size;
+    size_t chunk[thread_num + 1];
+    ALPHA_INT64 base[thread_num + 1];
+    ALPHA_INT64 mirror[thread_num + 1];
+    int bad = 0;
+    mtx_chunks(mtx, thread_num, chunk);
+
+    // pass 1: entry lines per chunk give every thread its output slice
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num)
+#endif
+    {
+        const int tid = alpha_get_thread_id();
+        ALPHA_INT64 count = 0;
+        for (const char *p = mtx->data + chunk[tid]; p < mtx->data + chunk[tid + 1]; p = next_line(p, end))
+            count += is_entry_line(p, end);
+        base[tid + 1] = count;
+    }
+    base[0] = 0;
+    for (int t = 0; t < thread_num; t++)
+        base[t + 1] += base[t];
+    if (base[thread_num] != mtx->entries)
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+
+    // pass 2: parse into the slice, count entries to mirror
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num) reduction(+ : bad)
+#endif
+    {
+        const int tid = alpha_get_thread_id();
+        ALPHA_INT64 i = base[tid];
+        ALPHA_INT64 count = 0;
+        const char *p = mtx->data + chunk[tid];
+        const char *chunk_end = mtx->data + chunk[tid + 1];
+        while (p < chunk_end)
+        {
+            if (!is_entry_line(p, end))
+            {
+                p = next_line(p, end);
+                continue;
+            }
+            ALPHA_INT64 row, col;
+            double re, im;
+            bad += !parse_entry(mtx, &p, end, &row, &col, &re, &im, values != NULL);
+            row_index[i] = (ALPHA_INT)(row - 1);
+            col_index[i] = (ALPHA_INT)(col - 1);
+            if (values != NULL)
+                store_value(values, out, i, re, im);
+            count += is_mirrored(mtx, row, col);
+            i++;
+        }
+        mirror[tid + 1] = count;
+    }
+    if (bad)
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    mirror[0] = mtx->entries;
+    for (int t = 0; t < thread_num; t++)
+        mirror[t + 1] += mirror[t];
+
+    // pass 3: mirrored entries go behind the stored ones
+    if (mtx->symmetry != ALPHA_MTX_GENERAL && !is_half(mtx))
+    {
+        const size_t vsize = mtx_out_size[out];
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num)
+#endif
+        {
+            const int tid = alpha_get_thread_id();
+            ALPHA_INT64 j = mirror[tid];
+            for (ALPHA_INT64 i = base[tid]; i < base[tid + 1]; i++)
+            {
+                if (row_index[i] == col_index[i])
+                    continue;
+                row_index[j] = col_index[i];
+                col_index[j] = row_index[i];
+                if (values != NULL)
+                {
+                    memcpy((char *)values + j * vsize, (char *)values + i * vsize, vsize);
+                    if (mtx->symmetry == ALPHA_MTX_SKEW_SYMMETRIC || mtx->symmetry == ALPHA_MTX_HERMITIAN)
+                    {
+                        double re, im;
+                        if (out == MTX_OUT_S)
+                            re = ((float *)values)[j], im = 0;
+                        else if (out == MTX_OUT_D)
+                            re = ((double *)values)[j], im = 0;
+                        else if (out == MTX_OUT_C)
+                            re = ((ALPHA_Complex8 *)values)[j].real, im = ((ALPHA_Complex8 *)values)[j].imag;
+                        else
+                            re = ((ALPHA_Complex16 *)values)[j].real, im = ((ALPHA_Complex16 *)values)[j].imag;
+                        mirror_value(mtx->symmetry, &re, &im);
+                        store_value(values, out, j, re, im);
+                    }
+                }
+                j++;
+            }
+        }
+    }
+    *nnz = (ALPHA_INT)mirror[thread_num];
+    alpha_timing_end(&timer);
+    mtx->parse_time = alpha_timing_elapsed_time(&timer);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+// in place sort of one row by column, values move along
+static void mtx_sort_row(ALPHA_INT *col, char *values, const size_t vsize, const ALPHA_INT64 len)
+{
+    char v[sizeof(ALPHA_Complex16)];
+    // shell sort, rows come out of the parallel fill almost sorted
+    static const ALPHA_INT64 gaps[] = {701, 301, 132, 57, 23, 10, 4, 1};
+    for (int g = 0; g < (int)(sizeof(gaps) / sizeof(gaps[0])); g++)
+    {
+        const ALPHA_INT64 gap = gaps[g];
+        for (ALPHA_INT64 i = gap; i < len; i++)
+        {
+            ALPHA_INT c = col[i];
+            if (values != NULL)
+                memcpy(v, values + i * vsize, vsize);
+            ALPHA_INT64 j = i;
+            for (; j >= gap && col[j - gap] > c; j -= gap)
+            {
+                col[j] = col[j - gap];
+                if (values != NULL)
+                    memcpy(values + j * vsize, values + (j - gap) * vsize, vsize);
+            }
+            col[j] = c;
+            if (values != NULL)
+                memcpy(values + j * vsize, v, vsize);
+        }
+    }
+}
+
+static alphasparse_status_t mtx_read_csr(alpha_mtx_t *mtx, ALPHA_OFFSET *rows_offset, ALPHA_INT *col_index, void *values, mtx_out_t out)
+{
+    alpha_timer_t timer;
+    alpha_timing_start(&timer);
+    const int thread_num = alpha_get_thread_num();
+    const char *end = mtx->data + mtx->size;
+    const ALPHA_INT m = mtx->rows;
+    const size_t vsize = mtx_out_size[out];
+    size_t chunk[thread_num + 1];
+    int bad = 0;
+    mtx_chunks(mtx, thread_num, chunk);
+    memset(rows_offset, 0, sizeof(ALPHA_OFFSET) * (m + 1));
+
+    // pass 1: row lengths from the indices only
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num) reduction(+ : bad)
+#endif
+    {
+        const int tid = alpha_get_thread_id();
+        const char *p = mtx->data + chunk[tid];
+        const char *chunk_end = mtx->data + chunk[tid + 1];
+        while (p < chunk_end)
+        {
+            if (!is_entry_line(p, end))
+            {
+                p = next_line(p, end);
+                continue;
+            }
+            ALPHA_INT64 row, col;
+            double re, im;
+            if (!parse_entry(mtx, &p, end, &row, &col, &re, &im, 0))
+            {
+                bad++;
+                continue;
+            }
+            cursor_inc(&rows_offset[row], thread_num > 1);
+            if (is_mirrored(mtx, row, col))
+                cursor_inc(&rows_offset[col], thread_num > 1);
+        }
+    }
+    if (bad)
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+    for (ALPHA_INT r = 0; r < m; r++)
+        rows_offset[r + 1] += rows_offset[r];
+    if (rows_offset[m] > alpha_mtx_nnz_max(mtx))
+        return ALPHA_SPARSE_STATUS_INVALID_VALUE;
+
+    // pass 2: rows_offset[r] is the fill cursor of row r and ends as the start of row r + 1
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num)
+#endif
+    {
+        const int tid = alpha_get_thread_id();
+        const char *p = mtx->data + chunk[tid];
+        const char *chunk_end = mtx->data + chunk[tid + 1];
+        while (p < chunk_end)
+        {
+            if (!is_entry_line(p, end))
+            {
+                p = next_line(p, end);
+                continue;
+            }
+            ALPHA_INT64 row, col;
+            double re, im;
+            parse_entry(mtx, &p, end, &row, &col, &re, &im, values != NULL);
+            ALPHA_OFFSET ai = cursor_inc(&rows_offset[row - 1], thread_num > 1);
+            col_index[ai] = (ALPHA_INT)(col - 1);
+            if (values != NULL)
+                store_value(values, out, ai, re, im);
+            if (is_mirrored(mtx, row, col))
+            {
+                ai = cursor_inc(&rows_offset[col - 1], thread_num > 1);
+                col_index[ai] = (ALPHA_INT)(row - 1);
+                if (values != NULL)
+                {
+                    mirror_value(mtx->symmetry, &re, &im);
+                    store_value(values, out, ai, re, im);
+                }
+            }
+        }
+    }
+    for (ALPHA_INT r = m; r > 0; r--)
+        rows_offset[r] = rows_offset[r - 1];
+    rows_offset[0] = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(dynamic, 256)
+#endif
+    for (ALPHA_INT r = 0; r < m; r++)
+        mtx_sort_row(col_index + rows_offset[r], values == NULL ? NULL : (char *)values + rows_offset[r] * vsize, vsize, rows_offset[r + 1] - rows_offset[r]);
+
+    alpha_timing_end(&timer);
+    mtx->parse_time = alpha_timing_elapsed_time(&timer);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alpha_mtx_read_coo_s(alpha_mtx_t *mtx, ALPHA_INT *row_index, ALPHA_INT *col_index, float *values, ALPHA_INT *nnz)
+{
+    return mtx_read_coo(mtx, row_index, col_index, values, MTX_OUT_S, nnz);
+}
+
+alphasparse_status_t alpha_mtx_read_coo_d(alpha_mtx_t *mtx, ALPHA_INT *row_index, ALPHA_INT *col_index, double *values, ALPHA_INT *nnz)
+{
+    return mtx_read_coo(mtx, row_index, col_index, values, MTX_OUT_D, nnz);
+}
+
+alphasparse_status_t alpha_mtx_read_coo_c(alpha_mtx_t *mtx, ALPHA_INT *row_index, ALPHA_INT *col_index, ALPHA_Complex8 *values, ALPHA_INT *nnz)
+{
+    return mtx_read_coo(mtx, row_index, col_index, values, MTX_OUT_C, nnz);
+}
+
+alphasparse_status_t alpha_mtx_read_coo_z(alpha_mtx_t *mtx, ALPHA_INT *row_index, ALPHA_INT *col_index, ALPHA_Complex16 *values, ALPHA_INT *nnz)
+{
+    return mtx_read_coo(mtx, row_index, col_index, values, MTX_OUT_Z, nnz);
+}
+
+alphasparse_status_t alpha_mtx_read_csr_s(alpha_mtx_t *mtx, ALPHA_OFFSET *rows_offset, ALPHA_INT *col_index, float *values)
+{
+    return mtx_read_csr(mtx, rows_offset, col_index, values, MTX_OUT_S);
+}
+
+alphasparse_status_t alpha_mtx_read_csr_d(alpha_mtx_t *mtx, ALPHA_OFFSET *rows_offset, ALPHA_INT *col_index, double *values)
+{
+    return mtx_read_csr(mtx, rows_offset, col_index, values, MTX_OUT_D);
+}
+
+alphasparse_status_t alpha_mtx_read_csr_c(alpha_mtx_t *mtx, ALPHA_OFFSET *rows_offset, ALPHA_INT *col_index, ALPHA_Complex8 *values)
+{
+    return mtx_read_csr(mtx, rows_offset, col_index, values, MTX_OUT_C);
+}
+
+alphasparse_status_t alpha_mtx_read_csr_z(alpha_mtx_t *mtx, ALPHA_OFFSET *rows_offset, ALPHA_INT *col_index, ALPHA_Complex16 *values)
+{
+    return mtx_read_csr(mtx, rows_offset, col_index, values, MTX_OUT_Z);
+}
+
+void alpha_mtx_stat_print(const alpha_mtx_t *mtx, const char *name)
+{
+    double mbytes = (double)(mtx->size - mtx->body) / 1e6;
+    printf("%s: %lld entries, %.1f MB in %.3f s, %.1f MB/s, %.1f M entries/s\n", name, (long long)mtx->entries, mbytes, mtx->parse_time,
+           mtx->parse_time > 0 ? mbytes / mtx->parse_time : 0.0, mtx->parse_time > 0 ? mtx->entries / mtx->parse_time / 1e6 : 0.0);
+}
@@ -90,6 +90,31 @@ void balanced_partition_row_by_nnz(const ALPHA_INT *acc_sum_arr, ALPHA_INT rows,
     }
     partition[num_threads] = rows;
 }
+// same as balanced_partition_row_by_nnz for the row offsets of CSR/BSR, which may be wider than ALPHA_INT
+void balanced_partition_row_by_offset(const ALPHA_OFFSET *acc_sum_arr, ALPHA_INT rows, ALPHA_INT num_threads, ALPHA_INT *partition)
+{
+    ALPHA_OFFSET nnz = acc_sum_arr[rows - 1];
+    ALPHA_OFFSET ave = nnz / num_threads;
+    partition[0] = 0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads)
+#endif
+    for (ALPHA_INT i = 1; i < num_threads; i++)
+    {
+        ALPHA_OFFSET value = ave * i;
+        ALPHA_INT l = 0, r = rows - 1;
+        while (r > l)
+        {
+            ALPHA_INT m = l + (r - l) / 2;
+            if (acc_sum_arr[m] < value)
+                l = m + 1;
+            else
+                r = m;
+        }
+        partition[i] = l;
+    }
+    partition[num_threads] = rows;
+}
 void partition_and_locate_uppernnz(const ALPHA_INT *acc_sum_arr,const ALPHA_INT *index, ALPHA_INT rows, ALPHA_INT num_threads, ALPHA_INT *partition, ALPHA_INT *row_start){
     ALPHA_INT * nnz_nums = (ALPHA_INT*) alpha_malloc(sizeof(ALPHA_INT) * (rows));
 #ifdef _OPENMP
@@ -188,6 +213,32 @@ void block_partition(ALPHA_INT *pointerB, ALPHA_INT *pointerE, ALPHA_INT *block_
     *ldp_p = ldp;
 }
 
+// block_partition over the ALPHA_OFFSET row offsets of CSR/BSR, pos holds offsets as well
+void block_partition_offset(ALPHA_OFFSET *pointerB, ALPHA_OFFSET *pointerE, ALPHA_INT *block_indx, ALPHA_INT block_dim_len, ALPHA_INT another_dim_len, ALPHA_INT block_size, ALPHA_OFFSET **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
+{
+    ALPHA_INT block_num = (block_dim_len + block_size - 1) / block_size;
+    ALPHA_INT ldp = block_num + 1;
+    ALPHA_OFFSET *pos = alpha_memalign((size_t)another_dim_len * ldp * sizeof(ALPHA_OFFSET), DEFAULT_ALIGNMENT);
+    for (ALPHA_INT r = 0; r < another_dim_len; ++r)
+    {
+        ALPHA_OFFSET ai = pointerB[r];
+        ALPHA_OFFSET aie = pointerE[r];
+        pos[index2(r, 0, ldp)] = ai;
+        ALPHA_INT block_upper_bound = block_size;
+        for (ALPHA_INT bi = 1; bi <= block_num; ++bi, block_upper_bound += block_size)
+        {
+            while (ai < aie && block_indx[ai] < block_upper_bound)
+            {
+                ai += 1;
+            }
+            pos[index2(r, bi, ldp)] = ai;
+        }
+    }
+    *pos_p = pos;
+    *block_num_p = block_num;
+    *ldp_p = ldp;
+}
+
 ALPHA_INT alpha_range_search(ALPHA_INT a[],ALPHA_INT start, ALPHA_INT end, ALPHA_INT target)
 {
 	for(ALPHA_INT i = start; i < end; i++)
@@ -200,23 +251,23 @@ ALPHA_INT alpha_range_search(ALPHA_INT a[],ALPHA_INT start, ALPHA_INT end, ALPHA
 	return -1;
 }
 
-void csr_s_col_partition(const spmat_csr_s_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_INT **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
+void csr_s_col_partition(const spmat_csr_s_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_OFFSET **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
 {
-    block_partition(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
+    block_partition_offset(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
 }
 
-void csr_d_col_partition(const spmat_csr_d_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_INT **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
+void csr_d_col_partition(const spmat_csr_d_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_OFFSET **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
 {
-    block_partition(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
+    block_partition_offset(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
 }
 
-void csr_c_col_partition(const spmat_csr_c_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_INT **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
+void csr_c_col_partition(const spmat_csr_c_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_OFFSET **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
 {
-    block_partition(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
+    block_partition_offset(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
 }
-void csr_z_col_partition(const spmat_csr_z_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_INT **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
+void csr_z_col_partition(const spmat_csr_z_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_OFFSET **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
 {
-    block_partition(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
+    block_partition_offset(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
 }
 
 void csc_s_row_partition(const spmat_csc_s_t *mat, ALPHA_INT cs, ALPHA_INT ce, ALPHA_INT block_size, ALPHA_INT **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
@@ -237,21 +288,21 @@ void csc_z_row_partition(const spmat_csc_z_t *mat, ALPHA_INT cs, ALPHA_INT ce, A
     block_partition(&mat->cols_start[cs], &mat->cols_end[cs], mat->row_indx, mat->rows, ce - cs, block_size, pos_p, block_num_p, ldp_p);
 }
 
-void bsr_s_col_partition(const spmat_bsr_s_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_INT **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
+void bsr_s_col_partition(const spmat_bsr_s_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_OFFSET **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
 {
-    block_partition(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
+    block_partition_offset(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
 }
 
-void bsr_d_col_partition(const spmat_bsr_d_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_INT **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
+void bsr_d_col_partition(const spmat_bsr_d_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_OFFSET **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
 {
-    block_partition(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
+    block_partition_offset(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
 }
 
-void bsr_c_col_partition(const spmat_bsr_c_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_INT **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
+void bsr_c_col_partition(const spmat_bsr_c_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_OFFSET **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
 {
-    block_partition(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
+    block_partition_offset(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
 }
-void bsr_z_col_partition(const spmat_bsr_z_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_INT **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
+void bsr_z_col_partition(const spmat_bsr_z_t *mat, ALPHA_INT rs, ALPHA_INT re, ALPHA_INT block_size, ALPHA_OFFSET **pos_p, ALPHA_INT *block_num_p, ALPHA_INT *ldp_p)
 {
-    block_partition(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
+    block_partition_offset(&mat->rows_start[rs], &mat->rows_end[rs], mat->col_indx, mat->cols, re - rs, block_size, pos_p, block_num_p, ldp_p);
 }
@@ -0,0 +1,274 @@
+/**
+ * @brief implement for hardware performance counters around kernel calls
+ */
+
+#define _GNU_SOURCE
+#include "alphasparse/util/perf.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+const char *const alpha_perf_event_name[ALPHA_PERF_EVENT_NUM] = {
+    "cycles",
+    "instructions",
+    "cache_misses",
+    "llc_loads",
+    "llc_load_misses",
+    "stalled_frontend",
+    "stalled_backend",
+};
+
+static bool perf_on = false;
+// events the probe of alpha_perf_enable could open
+static bool perf_available[ALPHA_PERF_EVENT_NUM];
+
+void alpha_perf_clear(alpha_perf_counters_t *counters)
+{
+    for (int e = 0; e < ALPHA_PERF_EVENT_NUM; e++)
+        counters->value[e] = -1;
+}
+
+#ifdef __linux__
+
+#define PERF_FD_UNOPENED -2
+#define PERF_FD_FAILED -1
+
+/*
+* Counters of one thread, opened on first use. Every thread that opened some is
+* on the perf_threads list, alpha_perf_enable(false) closes the counters of all of
+* them and a thread closes its own when it exits, through the perf_key destructor.
+*/
+typedef struct perf_thread
+{
+    int fd[ALPHA_PERF_EVENT_NUM];
+    int64_t start[ALPHA_PERF_EVENT_NUM];
+    // measurement the start values belong to
+    unsigned generation;
+    struct perf_thread *prev;
+    struct perf_thread *next;
+} perf_thread_t;
+
+static _Thread_local perf_thread_t *perf_self = NULL;
+static perf_thread_t *perf_threads = NULL;
+static pthread_mutex_t perf_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t perf_key;
+static pthread_once_t perf_key_once = PTHREAD_ONCE_INIT;
+static atomic_uint perf_generation = 0;
+
+static void perf_thread_close(perf_thread_t *t)
+{
+    for (int e = 0; e < ALPHA_PERF_EVENT_NUM; e++)
+    {
+        if (t->fd[e] >= 0)
+            close(t->fd[e]);
+        t->fd[e] = PERF_FD_UNOPENED;
+    }
+}
+
+static void perf_thread_exit(void *arg)
+{
+    perf_thread_t *t = arg;
+    pthread_mutex_lock(&perf_lock);
+    if (t->prev != NULL)
+        t->prev->next = t->next;
+    else
+        perf_threads = t->next;
+    if (t->next != NULL)
+        t->next->prev = t->prev;
+    perf_thread_close(t);
+    pthread_mutex_unlock(&perf_lock);
+    free(t);
+}
+
+static void perf_key_create()
+{
+    pthread_key_create(&perf_key, perf_thread_exit);
+}
+
+static perf_thread_t *perf_thread_get()
+{
+    if (perf_self != NULL)
+        return perf_self;
+    pthread_once(&perf_key_once, perf_key_create);
+    perf_thread_t *t = malloc(sizeof(perf_thread_t));
+    if (t == NULL)
+        return NULL;
+    for (int e = 0; e < ALPHA_PERF_EVENT_NUM; e++)
+        t->fd[e] = PERF_FD_UNOPENED;
+    t->generation = 0;
+    t->prev = NULL;
+    pthread_mutex_lock(&perf_lock);
+    t->next = perf_threads;
+    if (perf_threads != NULL)
+        perf_threads->prev = t;
+    perf_threads = t;
+    pthread_mutex_unlock(&perf_lock);
+    pthread_setspecific(perf_key, t);
+    perf_self = t;
+    return t;
+}
+
+static int perf_open(const alpha_perf_event_t event)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    switch (event)
+    {
+    case ALPHA_PERF_CYCLES: attr.config = PERF_COUNT_HW_CPU_CYCLES; break;
+    case ALPHA_PERF_INSTRUCTIONS: attr.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+    case ALPHA_PERF_CACHE_MISSES: attr.config = PERF_COUNT_HW_CACHE_MISSES; break;
+    case ALPHA_PERF_LLC_LOADS:
+    case ALPHA_PERF_LLC_LOAD_MISSES:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      ((event == ALPHA_PERF_LLC_LOADS ? PERF_COUNT_HW_CACHE_RESULT_ACCESS : PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+        break;
+    case ALPHA_PERF_STALLED_FRONTEND: attr.config = PERF_COUNT_HW_STALLED_CYCLES_FRONTEND; break;
+    default: attr.config = PERF_COUNT_HW_STALLED_CYCLES_BACKEND; break;
+    }
+    const long fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    return fd < 0 ? PERF_FD_FAILED : (int)fd;
+}
+
+// current count of an event of the calling thread, scaled up when the event was multiplexed
+static int64_t perf_read(const int fd)
+{
+    uint64_t buf[3];
+    if (read(fd, buf, sizeof(buf)) != (ssize_t)sizeof(buf) || buf[2] == 0)
+        return 0;
+    if (buf[2] == buf[1])
+        return (int64_t)buf[0];
+    return (int64_t)((double)buf[0] * buf[1] / buf[2]);
+}
+
+static void perf_thread_open(perf_thread_t *t)
+{
+    for (int e = 0; e < ALPHA_PERF_EVENT_NUM; e++)
+        if (t->fd[e] == PERF_FD_UNOPENED)
+            t->fd[e] = perf_available[e] ? perf_open(e) : PERF_FD_FAILED;
+}
+
+bool alpha_perf_enable(const bool enable)
+{
+    if (!enable)
+    {
+        perf_on = false;
+        pthread_mutex_lock(&perf_lock);
+        for (perf_thread_t *t = perf_threads; t != NULL; t = t->next)
+            perf_thread_close(t);
+        pthread_mutex_unlock(&perf_lock);
+        return true;
+    }
+    bool any = false;
+    for (int e = 0; e < ALPHA_PERF_EVENT_NUM; e++)
+    {
+        const int fd = perf_open(e);
+        perf_available[e] = fd >= 0;
+        any |= perf_available[e];
+        if (fd >= 0)
+            close(fd);
+    }
+    perf_on = any;
+    return any;
+}
+
+unsigned alpha_perf_begin(const int thread_num)
+{
+    if (!perf_on)
+        return 0;
+    // 0 is never handed out, it is the generation of threads that never started
+    unsigned generation = atomic_fetch_add(&perf_generation, 1) + 1;
+    if (generation == 0)
+        generation = atomic_fetch_add(&perf_generation, 1) + 1;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num)
+#endif
+    {
+        perf_thread_t *t = perf_thread_get();
+        if (t != NULL)
+        {
+            perf_thread_open(t);
+            for (int e = 0; e < ALPHA_PERF_EVENT_NUM; e++)
+                if (t->fd[e] >= 0)
+                    t->start[e] = perf_read(t->fd[e]);
+            t->generation = generation;
+        }
+    }
+    return generation;
+}
+
+void alpha_perf_end(const int thread_num, const unsigned generation, alpha_perf_counters_t *counters)
+{
+    alpha_perf_clear(counters);
+    if (!perf_on)
+        return;
+    int64_t sum[ALPHA_PERF_EVENT_NUM] = {0};
+    int threads[ALPHA_PERF_EVENT_NUM] = {0};
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num)
+#endif
+    {
+        // a thread that missed this alpha_perf_begin has no start value for the measurement
+        const perf_thread_t *t = perf_self;
+        const bool started = t != NULL && t->generation == generation;
+        for (int e = 0; e < ALPHA_PERF_EVENT_NUM; e++)
+            if (started && t->fd[e] >= 0)
+            {
+                const int64_t delta = perf_read(t->fd[e]) - t->start[e];
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                sum[e] += delta;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                threads[e]++;
+            }
+    }
+    for (int e = 0; e < ALPHA_PERF_EVENT_NUM; e++)
+        if (threads[e] > 0)
+            counters->value[e] = sum[e];
+}
+
+#else
+
+bool alpha_perf_enable(const bool enable)
+{
+    perf_on = false;
+    (void)perf_available;
+    return !enable;
+}
+
+unsigned alpha_perf_begin(const int thread_num)
+{
+    (void)thread_num;
+    return 0;
+}
+
+void alpha_perf_end(const int thread_num, const unsigned generation, alpha_perf_counters_t *counters)
+{
+    (void)thread_num;
+    (void)generation;
+    alpha_perf_clear(counters);
+}
+
+#endif
+
+bool alpha_perf_enabled()
+{
+    return perf_on;
+}
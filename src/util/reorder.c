@@ -0,0 +1,412 @@
+#include "alphasparse/util.h"
+#include "alphasparse/util/reorder.h"
+#include "alphasparse/opt.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// a vertex with more neighbours than max(GORDER_HUB_MIN, sqrt(n)) does not make its neighbours share one
+#define GORDER_HUB_MIN 32
+
+static int index_cmp(const void *a, const void *b)
+{
+    const ALPHA_INT x = *(const ALPHA_INT *)a, y = *(const ALPHA_INT *)b;
+    return (x > y) - (x < y);
+}
+
+alphasparse_status_t alpha_reorder_graph(const ALPHA_INT n,
+                                         const ALPHA_OFFSET *rows_start,
+                                         const ALPHA_OFFSET *rows_end,
+                                         const ALPHA_INT *col_indx,
+                                         ALPHA_OFFSET **ptr_p,
+                                         ALPHA_INT **idx_p)
+{
+    ALPHA_OFFSET *ptr = calloc(n + 1, sizeof(ALPHA_OFFSET));
+    ALPHA_OFFSET *fill = malloc(sizeof(ALPHA_OFFSET) * (n + 1));
+    if (ptr == NULL || fill == NULL)
+    {
+        free(ptr);
+        free(fill);
+        return ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    }
+    // every entry off the diagonal is an edge from both ends, repeats are dropped below
+    for (ALPHA_INT r = 0; r < n; r++)
+        for (ALPHA_OFFSET e = rows_start[r]; e < rows_end[r]; e++)
+            if (col_indx[e] != r)
+            {
+                ptr[r + 1] += 1;
+                ptr[col_indx[e] + 1] += 1;
+            }
+    for (ALPHA_INT v = 0; v < n; v++)
+        ptr[v + 1] += ptr[v];
+    ALPHA_INT *idx = malloc(sizeof(ALPHA_INT) * alpha_max(ptr[n], 1));
+    if (idx == NULL)
+    {
+        free(ptr);
+        free(fill);
+        return ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    }
+    memcpy(fill, ptr, sizeof(ALPHA_OFFSET) * n);
+    for (ALPHA_INT r = 0; r < n; r++)
+        for (ALPHA_OFFSET e = rows_start[r]; e < rows_end[r]; e++)
+        {
+            const ALPHA_INT c = col_indx[e];
+            if (c != r)
+            {
+                idx[fill[r]++] = c;
+                idx[fill[c]++] = r;
+            }
+        }
+
+    // sorted neighbours without repeats, fill[v] becomes their count
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(alpha_get_thread_num()) schedule(dynamic, 256)
+#endif
+    for (ALPHA_INT v = 0; v < n; v++)
+    {
+        ALPHA_INT *adj = &idx[ptr[v]];
+        const ALPHA_OFFSET len = ptr[v + 1] - ptr[v];
+        qsort(adj, len, sizeof(ALPHA_INT), index_cmp);
+        ALPHA_OFFSET kept = 0;
+        for (ALPHA_OFFSET k = 0; k < len; k++)
+            if (kept == 0 || adj[k] != adj[kept - 1])
+                adj[kept++] = adj[k];
+        fill[v] = kept;
+    }
+    // compact in place, a list only moves towards the front
+    ALPHA_OFFSET pos = 0;
+    for (ALPHA_INT v = 0; v < n; v++)
+    {
+        const ALPHA_OFFSET from = ptr[v];
+        ptr[v] = pos;
+        memmove(&idx[pos], &idx[from], sizeof(ALPHA_INT) * fill[v]);
+        pos += fill[v];
+    }
+    ptr[n] = pos;
+    free(fill);
+    *ptr_p = ptr;
+    *idx_p = idx;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+alphasparse_status_t alpha_reorder_degree(const ALPHA_INT n, const ALPHA_OFFSET *ptr_start, const ALPHA_OFFSET *ptr_end, ALPHA_INT *perm)
+{
+    ALPHA_INT max_degree = 0;
+    for (ALPHA_INT v = 0; v < n; v++)
+        max_degree = alpha_max(max_degree, (ALPHA_INT)(ptr_end[v] - ptr_start[v]));
+    // counting sort, first[d] is the first position of degree d counted from the largest degree down
+    ALPHA_INT *first = calloc(max_degree + 2, sizeof(ALPHA_INT));
+    if (first == NULL)
+        return ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    for (ALPHA_INT v = 0; v < n; v++)
+        first[max_degree - (ptr_end[v] - ptr_start[v]) + 1] += 1;
+    for (ALPHA_INT d = 0; d <= max_degree; d++)
+        first[d + 1] += first[d];
+    for (ALPHA_INT v = 0; v < n; v++)
+        perm[first[max_degree - (ptr_end[v] - ptr_start[v])]++] = v;
+    free(first);
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+typedef struct
+{
+    ALPHA_INT degree;
+    ALPHA_INT v;
+} rcm_vertex_t;
+
+static int rcm_vertex_cmp(const void *a, const void *b)
+{
+    const rcm_vertex_t *x = a, *y = b;
+    if (x->degree != y->degree)
+        return x->degree < y->degree ? -1 : 1;
+    return (x->v > y->v) - (x->v < y->v);
+}
+
+/*
+* breadth-first levels of the unplaced vertices reached from root, queue holds them level by
+* level, returns the number of levels with the last one starting at *last
+*/
+static ALPHA_INT rcm_levels(const ALPHA_OFFSET *ptr, const ALPHA_INT *idx, const ALPHA_INT root,
+                            const char *placed, ALPHA_INT *stamp, const ALPHA_INT mark,
+                            ALPHA_INT *queue, ALPHA_INT *last, ALPHA_INT *size)
+{
+    ALPHA_INT head = 0, tail = 0, levels = 0;
+    queue[tail++] = root;
+    stamp[root] = mark;
+    while (head < tail)
+    {
+        const ALPHA_INT level_end = tail;
+        *last = head;
+        levels += 1;
+        for (; head < level_end; head++)
+        {
+            const ALPHA_INT v = queue[head];
+            for (ALPHA_OFFSET e = ptr[v]; e < ptr[v + 1]; e++)
+            {
+                const ALPHA_INT u = idx[e];
+                if (!placed[u] && stamp[u] != mark)
+                {
+                    stamp[u] = mark;
+                    queue[tail++] = u;
+                }
+            }
+        }
+    }
+    *size = tail;
+    return levels;
+}
+
+alphasparse_status_t alpha_reorder_rcm(const ALPHA_INT n, const ALPHA_OFFSET *ptr, const ALPHA_INT *idx, ALPHA_INT *perm)
+{
+    ALPHA_INT max_degree = 0;
+    for (ALPHA_INT v = 0; v < n; v++)
+        max_degree = alpha_max(max_degree, (ALPHA_INT)(ptr[v + 1] - ptr[v]));
+    char *placed = calloc(n, 1);
+    ALPHA_INT *stamp = malloc(sizeof(ALPHA_INT) * n);
+    ALPHA_INT *queue = malloc(sizeof(ALPHA_INT) * n);
+    ALPHA_INT *ascending = malloc(sizeof(ALPHA_INT) * n);
+    rcm_vertex_t *children = malloc(sizeof(rcm_vertex_t) * (max_degree + 1));
+    alphasparse_status_t status = ALPHA_SPARSE_STATUS_SUCCESS;
+    if (placed == NULL || stamp == NULL || queue == NULL || ascending == NULL || children == NULL)
+    {
+        status = ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+        goto out;
+    }
+    for (ALPHA_INT v = 0; v < n; v++)
+        stamp[v] = -1;
+    // components start from their vertex of least degree, the reverse of decreasing degree
+    status = alpha_reorder_degree(n, ptr, ptr + 1, ascending);
+    if (status != ALPHA_SPARSE_STATUS_SUCCESS)
+        goto out;
+    for (ALPHA_INT i = 0; i < n / 2; i++)
+    {
+        const ALPHA_INT t = ascending[i];
+        ascending[i] = ascending[n - 1 - i];
+        ascending[n - 1 - i] = t;
+    }
+
+    ALPHA_INT count = 0, mark = 0;
+    for (ALPHA_INT s = 0; s < n; s++)
+    {
+        ALPHA_INT root = ascending[s];
+        if (placed[root])
+            continue;
+        // pseudo-peripheral root, move to the least connected vertex of the last level while the levels deepen
+        ALPHA_INT last, size;
+        ALPHA_INT height = rcm_levels(ptr, idx, root, placed, stamp, mark++, queue, &last, &size);
+        while (true)
+        {
+            ALPHA_INT next = queue[last];
+            for (ALPHA_INT k = last + 1; k < size; k++)
+                if (ptr[queue[k] + 1] - ptr[queue[k]] < ptr[next + 1] - ptr[next])
+                    next = queue[k];
+            if (next == root)
+                break;
+            const ALPHA_INT next_height = rcm_levels(ptr, idx, next, placed, stamp, mark++, queue, &last, &size);
+            if (next_height <= height)
+                break;
+            root = next;
+            height = next_height;
+        }
+
+        // Cuthill-McKee, the unplaced neighbours of a vertex follow it by increasing degree
+        ALPHA_INT head = count;
+        perm[count++] = root;
+        placed[root] = 1;
+        while (head < count)
+        {
+            const ALPHA_INT v = perm[head++];
+            ALPHA_INT k = 0;
+            for (ALPHA_OFFSET e = ptr[v]; e < ptr[v + 1]; e++)
+            {
+                const ALPHA_INT u = idx[e];
+                if (!placed[u])
+                {
+                    placed[u] = 1;
+                    children[k].degree = ptr[u + 1] - ptr[u];
+                    children[k].v = u;
+                    k++;
+                }
+            }
+            qsort(children, k, sizeof(rcm_vertex_t), rcm_vertex_cmp);
+            for (ALPHA_INT c = 0; c < k; c++)
+                perm[count++] = children[c].v;
+        }
+    }
+    for (ALPHA_INT i = 0; i < n / 2; i++)
+    {
+        const ALPHA_INT t = perm[i];
+        perm[i] = perm[n - 1 - i];
+        perm[n - 1 - i] = t;
+    }
+out:
+    free(placed);
+    free(stamp);
+    free(queue);
+    free(ascending);
+    free(children);
+    return status;
+}
+
+/*
+* unplaced vertices with a positive score in one list per score, so a score moves by one
+* in constant time and the best vertex is at the top list
+*/
+typedef struct
+{
+    ALPHA_INT *score;
+    ALPHA_INT *next;
+    ALPHA_INT *prev;
+    ALPHA_INT *head;
+    ALPHA_INT cap;
+    ALPHA_INT top;
+    const char *placed;
+} gorder_heap_t;
+
+static void gorder_unlink(gorder_heap_t *h, const ALPHA_INT v)
+{
+    if (h->prev[v] >= 0)
+        h->next[h->prev[v]] = h->next[v];
+    else
+        h->head[h->score[v]] = h->next[v];
+    if (h->next[v] >= 0)
+        h->prev[h->next[v]] = h->prev[v];
+}
+
+static void gorder_link(gorder_heap_t *h, const ALPHA_INT v)
+{
+    const ALPHA_INT s = h->score[v];
+    h->prev[v] = -1;
+    h->next[v] = h->head[s];
+    if (h->head[s] >= 0)
+        h->prev[h->head[s]] = v;
+    h->head[s] = v;
+    h->top = alpha_max(h->top, s);
+}
+
+static bool gorder_inc(gorder_heap_t *h, const ALPHA_INT v)
+{
+    if (h->placed[v])
+        return true;
+    if (h->score[v] + 1 >= h->cap)
+    {
+        ALPHA_INT *head = realloc(h->head, sizeof(ALPHA_INT) * h->cap * 2);
+        if (head == NULL)
+            return false;
+        for (ALPHA_INT s = h->cap; s < h->cap * 2; s++)
+            head[s] = -1;
+        h->head = head;
+        h->cap *= 2;
+    }
+    if (h->score[v] > 0)
+        gorder_unlink(h, v);
+    h->score[v] += 1;
+    gorder_link(h, v);
+    return true;
+}
+
+static void gorder_dec(gorder_heap_t *h, const ALPHA_INT v)
+{
+    if (h->placed[v])
+        return;
+    gorder_unlink(h, v);
+    h->score[v] -= 1;
+    if (h->score[v] > 0)
+        gorder_link(h, v);
+}
+
+static bool gorder_move(gorder_heap_t *h, const ALPHA_INT v, const bool enter)
+{
+    if (enter)
+        return gorder_inc(h, v);
+    gorder_dec(h, v);
+    return true;
+}
+
+// scores of the vertices u is a neighbour of or shares a neighbour with, up when u enters the window and down when it leaves
+static bool gorder_update(gorder_heap_t *h, const ALPHA_OFFSET *ptr, const ALPHA_INT *idx, const ALPHA_INT hub, const ALPHA_INT u, const bool enter)
+{
+    for (ALPHA_OFFSET e = ptr[u]; e < ptr[u + 1]; e++)
+    {
+        const ALPHA_INT w = idx[e];
+        if (!gorder_move(h, w, enter))
+            return false;
+        if (ptr[w + 1] - ptr[w] > hub)
+            continue;
+        for (ALPHA_OFFSET f = ptr[w]; f < ptr[w + 1]; f++)
+        {
+            const ALPHA_INT v = idx[f];
+            if (v == u)
+                continue;
+            if (!gorder_move(h, v, enter))
+                return false;
+        }
+    }
+    return true;
+}
+
+alphasparse_status_t alpha_reorder_gorder(const ALPHA_INT n, const ALPHA_OFFSET *ptr, const ALPHA_INT *idx, const ALPHA_INT window, ALPHA_INT *perm)
+{
+    gorder_heap_t h;
+    char *placed = calloc(n, 1);
+    ALPHA_INT *seeds = malloc(sizeof(ALPHA_INT) * n);
+    h.score = calloc(n, sizeof(ALPHA_INT));
+    h.next = malloc(sizeof(ALPHA_INT) * n);
+    h.prev = malloc(sizeof(ALPHA_INT) * n);
+    h.cap = 64;
+    h.head = malloc(sizeof(ALPHA_INT) * h.cap);
+    h.top = 0;
+    h.placed = placed;
+    alphasparse_status_t status = ALPHA_SPARSE_STATUS_SUCCESS;
+    if (placed == NULL || seeds == NULL || h.score == NULL || h.next == NULL || h.prev == NULL || h.head == NULL)
+    {
+        status = ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+        goto out;
+    }
+    for (ALPHA_INT s = 0; s < h.cap; s++)
+        h.head[s] = -1;
+    // vertices without a score in the window are taken by decreasing degree
+    status = alpha_reorder_degree(n, ptr, ptr + 1, seeds);
+    if (status != ALPHA_SPARSE_STATUS_SUCCESS)
+        goto out;
+    const ALPHA_INT hub = alpha_max(GORDER_HUB_MIN, (ALPHA_INT)sqrt((double)n));
+    ALPHA_INT seed = 0;
+    for (ALPHA_INT i = 0; i < n; i++)
+    {
+        while (h.top > 0 && h.head[h.top] < 0)
+            h.top -= 1;
+        ALPHA_INT v;
+        if (h.top > 0)
+        {
+            v = h.head[h.top];
+            gorder_unlink(&h, v);
+        }
+        else
+        {
+            while (placed[seeds[seed]])
+                seed += 1;
+            v = seeds[seed];
+        }
+        placed[v] = 1;
+        perm[i] = v;
+        if (i >= window)
+            gorder_update(&h, ptr, idx, hub, perm[i - window], false);
+        if (!gorder_update(&h, ptr, idx, hub, v, true))
+        {
+            status = ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+            goto out;
+        }
+    }
+out:
+    free(placed);
+    free(seeds);
+    free(h.score);
+    free(h.next);
+    free(h.prev);
+    free(h.head);
+    return status;
+}
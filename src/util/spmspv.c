@@ -0,0 +1,143 @@
+/**
+ * @brief implement for the structure shared by the spmspv traversals
+ */
+
+#include "alphasparse/util/spmspv.h"
+#include "alphasparse/util/partition.h"
+#include "alphasparse/util/thread.h"
+#include "alphasparse/util.h"
+#include <stdlib.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+alphasparse_status_t alpha_spmspv_push_plan(const ALPHA_OFFSET *ptr, const ALPHA_INT *idx, const ALPHA_INT *indx, const ALPHA_INT nz, const ALPHA_INT base,
+                                            const ALPHA_INT rows, const ALPHA_INT bucket_rows, const ALPHA_INT parts, alpha_spmspv_push_t *plan)
+{
+    const ALPHA_INT bucket_num = rows > 0 ? (rows + bucket_rows - 1) / bucket_rows : 0;
+    plan->parts = parts;
+    plan->bucket_rows = bucket_rows;
+    plan->bucket_num = bucket_num;
+    ALPHA_INT64 *work = malloc(sizeof(ALPHA_INT64) * (nz + 1));
+    plan->first = malloc(sizeof(ALPHA_INT) * (parts + 1));
+    // slot (b, t) holds the products part t deals into bucket b, laid out bucket major
+    plan->slot = calloc((size_t)bucket_num * parts + 1, sizeof(ALPHA_INT64));
+    plan->fill = malloc(sizeof(ALPHA_INT64) * ((size_t)bucket_num * parts + 1));
+    plan->bucket_out = malloc(sizeof(ALPHA_INT64) * (bucket_num + 1));
+    plan->mark = calloc((size_t)parts * bucket_rows, sizeof(char));
+    plan->touched = malloc(sizeof(ALPHA_INT) * (size_t)parts * bucket_rows);
+    if (work == NULL || plan->first == NULL || plan->slot == NULL || plan->fill == NULL || plan->bucket_out == NULL ||
+        plan->mark == NULL || plan->touched == NULL)
+    {
+        free(work);
+        alpha_spmspv_push_destroy(plan);
+        return ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    }
+    work[0] = 0;
+    for (ALPHA_INT k = 0; k < nz; k++)
+    {
+        const ALPHA_INT j = indx[k] - base;
+        work[k + 1] = work[k] + (ptr[j + 1] - ptr[j]);
+    }
+    const ALPHA_INT64 total = work[nz];
+    ALPHA_INT *first = plan->first;
+    first[0] = 0;
+    for (ALPHA_INT t = 1; t < parts; t++)
+    {
+        const ALPHA_INT64 target = total / parts * t + total % parts * t / parts;
+        ALPHA_INT lo = first[t - 1], hi = nz;
+        while (lo < hi)
+        {
+            const ALPHA_INT mid = lo + (hi - lo) / 2;
+            if (work[mid + 1] <= target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        first[t] = lo;
+    }
+    first[parts] = nz;
+    free(work);
+    plan->total = total;
+
+    ALPHA_INT64 *slot = plan->slot;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(parts)
+#endif
+    {
+        const ALPHA_INT tid = alpha_get_thread_id();
+#ifdef _OPENMP
+        const ALPHA_INT team = omp_get_num_threads();
+#else
+        const ALPHA_INT team = 1;
+#endif
+        for (ALPHA_INT t = tid; t < parts; t += team)
+            for (ALPHA_INT k = first[t]; k < first[t + 1]; k++)
+            {
+                const ALPHA_INT j = indx[k] - base;
+                for (ALPHA_OFFSET e = ptr[j]; e < ptr[j + 1]; e++)
+                    slot[(ALPHA_INT64)(idx[e] / bucket_rows) * parts + t + 1]++;
+            }
+    }
+    for (ALPHA_INT64 s = 0; s < (ALPHA_INT64)bucket_num * parts; s++)
+        slot[s + 1] += slot[s];
+    for (ALPHA_INT t = 0; t < parts; t++)
+        for (ALPHA_INT b = 0; b < bucket_num; b++)
+            plan->fill[(ALPHA_INT64)t * bucket_num + b] = slot[(ALPHA_INT64)b * parts + t];
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+ALPHA_INT64 alpha_spmspv_push_out(alpha_spmspv_push_t *plan)
+{
+    plan->bucket_out[0] = 0;
+    for (ALPHA_INT b = 0; b < plan->bucket_num; b++)
+        plan->bucket_out[b + 1] += plan->bucket_out[b];
+    return plan->bucket_out[plan->bucket_num];
+}
+
+void alpha_spmspv_push_destroy(alpha_spmspv_push_t *plan)
+{
+    free(plan->first);
+    free(plan->slot);
+    free(plan->fill);
+    free(plan->bucket_out);
+    free(plan->mark);
+    free(plan->touched);
+    plan->first = NULL;
+    plan->slot = plan->fill = plan->bucket_out = NULL;
+    plan->mark = NULL;
+    plan->touched = NULL;
+}
+
+alphasparse_status_t alpha_spmspv_pull_plan(const ALPHA_OFFSET *ptr, const ALPHA_INT rows, const ALPHA_INT parts, alpha_spmspv_pull_t *plan)
+{
+    plan->parts = parts;
+    plan->partition = malloc(sizeof(ALPHA_INT) * (parts + 1));
+    plan->found = malloc(sizeof(ALPHA_INT) * (parts + 1));
+    if (plan->partition == NULL || plan->found == NULL)
+    {
+        alpha_spmspv_pull_destroy(plan);
+        return ALPHA_SPARSE_STATUS_ALLOC_FAILED;
+    }
+    if (rows > 0)
+        balanced_partition_row_by_offset(ptr + 1, rows, parts, plan->partition);
+    else
+        for (ALPHA_INT t = 0; t <= parts; t++)
+            plan->partition[t] = 0;
+    return ALPHA_SPARSE_STATUS_SUCCESS;
+}
+
+ALPHA_INT alpha_spmspv_pull_found(alpha_spmspv_pull_t *plan)
+{
+    plan->found[0] = 0;
+    for (ALPHA_INT t = 0; t < plan->parts; t++)
+        plan->found[t + 1] += plan->found[t];
+    return plan->found[plan->parts];
+}
+
+void alpha_spmspv_pull_destroy(alpha_spmspv_pull_t *plan)
+{
+    free(plan->partition);
+    free(plan->found);
+    plan->partition = plan->found = NULL;
+}
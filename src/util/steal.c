@@ -0,0 +1,291 @@
+/**
+ * @brief implement for the work-stealing row scheduler
+ */
+
+#include "alphasparse/util/steal.h"
+#include "alphasparse/util/timing.h"
+#include "alphasparse/util/thread.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*
+* Chase-Lev deque over a fixed run of block numbers. All blocks are pushed
+* before the loop starts, so the buffer never grows and only pop and steal
+* remain. Deques sit on their own cache lines.
+*/
+typedef struct
+{
+    _Atomic ALPHA_INT64 top;
+    _Atomic ALPHA_INT64 bottom;
+    ALPHA_INT *blocks;
+    ALPHA_INT owner_first;
+    ALPHA_INT owner_last;
+    char pad[64 - 2 * sizeof(ALPHA_INT64) - sizeof(ALPHA_INT *) - 2 * sizeof(ALPHA_INT)];
+} __attribute__((aligned(64))) steal_deque_t;
+
+typedef struct
+{
+    ALPHA_INT64 blocks;
+    ALPHA_INT64 steals;
+    ALPHA_INT64 failed;
+    double busy;
+    char pad[64 - 3 * sizeof(ALPHA_INT64) - sizeof(double)];
+} __attribute__((aligned(64))) steal_thread_stats_t;
+
+static alphasparse_steal_stats_t steal_stats = {0};
+
+#define STEAL_EMPTY -1
+#define STEAL_ABORT -2
+
+static ALPHA_INT deque_pop(steal_deque_t *q)
+{
+    const ALPHA_INT64 b = atomic_load_explicit(&q->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&q->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    ALPHA_INT64 t = atomic_load_explicit(&q->top, memory_order_relaxed);
+    if (t > b)
+    {
+        atomic_store_explicit(&q->bottom, b + 1, memory_order_relaxed);
+        return STEAL_EMPTY;
+    }
+    ALPHA_INT block = q->blocks[b];
+    if (t == b)
+    {
+        // last block, race the thieves for it
+        if (!atomic_compare_exchange_strong_explicit(&q->top, &t, t + 1, memory_order_seq_cst, memory_order_relaxed))
+            block = STEAL_EMPTY;
+        atomic_store_explicit(&q->bottom, b + 1, memory_order_relaxed);
+    }
+    return block;
+}
+
+static ALPHA_INT deque_steal(steal_deque_t *q)
+{
+    ALPHA_INT64 t = atomic_load_explicit(&q->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    const ALPHA_INT64 b = atomic_load_explicit(&q->bottom, memory_order_acquire);
+    if (t >= b)
+        return STEAL_EMPTY;
+    const ALPHA_INT block = q->blocks[t];
+    if (!atomic_compare_exchange_strong_explicit(&q->top, &t, t + 1, memory_order_seq_cst, memory_order_relaxed))
+        return STEAL_ABORT;
+    return block;
+}
+
+static void run_block(const ALPHA_INT *bounds, const ALPHA_INT block, const ALPHA_INT tid, alpha_steal_fn_t fn, void *arg, steal_thread_stats_t *st)
+{
+    const double start = alpha_timing_wtime();
+    fn(arg, tid, bounds[block], bounds[block + 1]);
+    st->busy += alpha_timing_wtime() - start;
+    st->blocks++;
+}
+
+static void steal_stats_merge(const steal_thread_stats_t *st, const ALPHA_INT thread_num)
+{
+    ALPHA_INT64 blocks = 0, steals = 0, failed = 0;
+    double busy_max = 0, busy_sum = 0;
+    for (ALPHA_INT t = 0; t < thread_num; t++)
+    {
+        blocks += st[t].blocks;
+        steals += st[t].steals;
+        failed += st[t].failed;
+        busy_sum += st[t].busy;
+        if (st[t].busy > busy_max)
+            busy_max = st[t].busy;
+    }
+#ifdef _OPENMP
+#pragma omp critical(alpha_steal)
+#endif
+    {
+        steal_stats.loops++;
+        steal_stats.blocks += blocks;
+        steal_stats.steals += steals;
+        steal_stats.failed += failed;
+        steal_stats.thread_num = thread_num;
+        steal_stats.busy_max = busy_max;
+        steal_stats.busy_mean = busy_sum / thread_num;
+        steal_stats.imbalance = busy_sum > 0 ? busy_max * thread_num / busy_sum : 1.0;
+    }
+}
+
+// run blocks [bounds[b], bounds[b + 1]) for b < block_num, dealt to the threads in contiguous runs
+static void steal_run(const ALPHA_INT thread_num, const ALPHA_INT *bounds, const ALPHA_INT block_num, alpha_steal_fn_t fn, void *arg)
+{
+    steal_deque_t *deques = aligned_alloc(64, sizeof(steal_deque_t) * thread_num);
+    steal_thread_stats_t *st = aligned_alloc(64, sizeof(steal_thread_stats_t) * thread_num);
+    ALPHA_INT *blocks = malloc(sizeof(ALPHA_INT) * block_num);
+    if (deques == NULL || st == NULL || blocks == NULL)
+    {
+        // run serially rather than fail a kernel that cannot report it
+        for (ALPHA_INT b = 0; b < block_num; b++)
+            fn(arg, 0, bounds[b], bounds[b + 1]);
+        free(deques);
+        free(st);
+        free(blocks);
+        return;
+    }
+    for (ALPHA_INT t = 0; t < thread_num; t++)
+    {
+        steal_deque_t *q = &deques[t];
+        q->owner_first = (ALPHA_INT)((ALPHA_INT64)t * block_num / thread_num);
+        q->owner_last = (ALPHA_INT)((ALPHA_INT64)(t + 1) * block_num / thread_num);
+        q->blocks = blocks + q->owner_first;
+        // pushed last block first, so the owner pops its run in row order and thieves take its far end
+        const ALPHA_INT len = q->owner_last - q->owner_first;
+        for (ALPHA_INT i = 0; i < len; i++)
+            q->blocks[i] = q->owner_last - 1 - i;
+        atomic_init(&q->top, 0);
+        atomic_init(&q->bottom, len);
+        st[t].blocks = st[t].steals = st[t].failed = 0;
+        st[t].busy = 0;
+    }
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num)
+#endif
+    {
+        const ALPHA_INT tid = alpha_get_thread_id();
+#ifdef _OPENMP
+        const ALPHA_INT team = omp_get_num_threads();
+#else
+        const ALPHA_INT team = 1;
+#endif
+        steal_thread_stats_t *my = &st[tid];
+        // a smaller team than planned also drains the deques of the missing threads
+        for (ALPHA_INT t = tid; t < thread_num; t += team)
+        {
+            ALPHA_INT block;
+            while ((block = deque_pop(&deques[t])) != STEAL_EMPTY)
+            {
+                if (t != tid)
+                    my->steals++;
+                run_block(bounds, block, tid, fn, arg, my);
+            }
+        }
+        // no blocks are ever added, so a sweep finding every deque empty ends the loop
+        for (;;)
+        {
+            bool left = false;
+            for (ALPHA_INT k = 1; k < thread_num; k++)
+            {
+                const ALPHA_INT block = deque_steal(&deques[(tid + k) % thread_num]);
+                if (block == STEAL_EMPTY)
+                {
+                    my->failed++;
+                    continue;
+                }
+                left = true;
+                if (block == STEAL_ABORT)
+                {
+                    my->failed++;
+                    continue;
+                }
+                my->steals++;
+                run_block(bounds, block, tid, fn, arg, my);
+                break;
+            }
+            if (!left)
+                break;
+        }
+    }
+    steal_stats_merge(st, thread_num);
+    free(deques);
+    free(st);
+    free(blocks);
+}
+
+static ALPHA_INT block_count(const ALPHA_INT thread_num, const ALPHA_INT rows)
+{
+    const ALPHA_INT64 want = (ALPHA_INT64)thread_num * ALPHA_STEAL_BLOCKS_PER_THREAD;
+    return (ALPHA_INT)(want < rows ? want : rows);
+}
+
+void alpha_steal_for(const ALPHA_INT thread_num, const ALPHA_INT rows, const ALPHA_INT64 *cost, alpha_steal_fn_t fn, void *arg)
+{
+    if (rows <= 0)
+        return;
+    const ALPHA_INT block_num = block_count(thread_num, rows);
+    ALPHA_INT bounds[block_num + 1];
+    const ALPHA_INT64 total = cost[rows - 1];
+    bounds[0] = 0;
+    for (ALPHA_INT b = 1; b < block_num; b++)
+    {
+        if (total <= 0)
+        {
+            bounds[b] = (ALPHA_INT)((ALPHA_INT64)b * rows / block_num);
+            continue;
+        }
+        // first row whose prefix reaches the b-th share, rows stay in order
+        const ALPHA_INT64 target = total / block_num * b + total % block_num * b / block_num;
+        ALPHA_INT lo = bounds[b - 1], hi = rows;
+        while (lo < hi)
+        {
+            const ALPHA_INT mid = lo + (hi - lo) / 2;
+            if (cost[mid] < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        bounds[b] = lo;
+    }
+    bounds[block_num] = rows;
+    steal_run(thread_num, bounds, block_num, fn, arg);
+}
+
+void alpha_steal_for_offset(const ALPHA_INT thread_num, const ALPHA_INT rows, const ALPHA_OFFSET *rows_start, const ALPHA_OFFSET *rows_end, alpha_steal_fn_t fn, void *arg)
+{
+    if (rows <= 0)
+        return;
+    const ALPHA_INT block_num = block_count(thread_num, rows);
+    ALPHA_INT bounds[block_num + 1];
+    // row 0 starts the range, so its entries count like those of any other row
+    const ALPHA_INT64 first = rows_start[0];
+    const ALPHA_INT64 total = (ALPHA_INT64)rows_end[rows - 1] - first;
+    bounds[0] = 0;
+    for (ALPHA_INT b = 1; b < block_num; b++)
+    {
+        if (total <= 0)
+        {
+            bounds[b] = (ALPHA_INT)((ALPHA_INT64)b * rows / block_num);
+            continue;
+        }
+        // first row whose end reaches the b-th share
+        const ALPHA_INT64 target = first + total / block_num * b + total % block_num * b / block_num;
+        ALPHA_INT lo = bounds[b - 1], hi = rows;
+        while (lo < hi)
+        {
+            const ALPHA_INT mid = lo + (hi - lo) / 2;
+            if ((ALPHA_INT64)rows_end[mid] < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        // the block ends before or after that row, whichever is closer to the share
+        const ALPHA_INT64 before = lo > 0 ? (ALPHA_INT64)rows_end[lo - 1] : first;
+        bounds[b] = lo < rows && (ALPHA_INT64)rows_end[lo] - target <= target - before ? lo + 1 : lo;
+    }
+    bounds[block_num] = rows;
+    steal_run(thread_num, bounds, block_num, fn, arg);
+}
+
+void alpha_steal_stats(alphasparse_steal_stats_t *stats)
+{
+#ifdef _OPENMP
+#pragma omp critical(alpha_steal)
+#endif
+    *stats = steal_stats;
+}
+
+void alpha_steal_stats_reset()
+{
+#ifdef _OPENMP
+#pragma omp critical(alpha_steal)
+#endif
+    {
+        alphasparse_steal_stats_t zero = {0};
+        steal_stats = zero;
+    }
+}
@@ -3,13 +3,32 @@
  * @author Zhuoqiang Guo <gzq9425@qq.com>
  */
 
+#define _GNU_SOURCE
 #include "alphasparse/util/thread.h"
 #ifdef _OPENMP
 #include <omp.h>
 #endif
+#ifdef __linux__
+#include <sched.h>
+#endif
+#include <stdlib.h>
 
 int _thread_num;
 
+// thread count of the call in flight on this thread, 0 outside an execution context
+static _Thread_local int _call_thread_num = 0;
+static _Thread_local struct alpha_exec_context *_call_ctx = NULL;
+// context set with alphasparse_set_thread_exec_context
+static _Thread_local struct alpha_exec_context *_thread_ctx = NULL;
+// context and version the teams of this thread were last bound for
+static _Thread_local struct alpha_exec_context *_bound_ctx = NULL;
+static _Thread_local unsigned _bound_version = 0;
+#if defined(_OPENMP) && defined(__linux__)
+// affinity the workers of this thread's teams had before they were first bound, by team thread id
+static _Thread_local cpu_set_t *_worker_masks = NULL;
+static _Thread_local int _worker_mask_num = 0;
+#endif
+
 int alpha_get_core_num()
 {
 #ifdef _OPENMP
@@ -19,10 +38,31 @@ int alpha_get_core_num()
 #endif
 }
 
+int alpha_get_cores(int *cores, const int max)
+{
+    int count = 0;
+#ifdef __linux__
+    cpu_set_t set;
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+    {
+        for (int c = 0; c < CPU_SETSIZE && count < max; c++)
+            if (CPU_ISSET(c, &set))
+                cores[count++] = c;
+        return count;
+    }
+#endif
+    for (; count < alpha_get_core_num() && count < max; count++)
+        cores[count] = count;
+    return count;
+}
+
 void alpha_set_thread_num(const int thread_num)
 {
 #ifdef _OPENMP
-    _thread_num = thread_num;
+    if (_call_thread_num > 0)
+        _call_thread_num = thread_num > 0 ? thread_num : 1;
+    else
+        _thread_num = thread_num;
 #else
     _thread_num = 1;
 #endif
@@ -31,6 +71,10 @@ void alpha_set_thread_num(const int thread_num)
 int alpha_get_thread_num()
 {
 #ifdef _OPENMP
+    if (_call_thread_num > 0)
+        return _call_thread_num;
+    if (_thread_ctx != NULL)
+        return _thread_ctx->thread_num;
     return _thread_num == 0 ? alpha_get_core_num() : _thread_num;
 #else
     return 1;
@@ -44,4 +88,134 @@ int alpha_get_thread_id()
 #else
     return 0;
 #endif
-}
\ No newline at end of file
+}
+
+#if defined(_OPENMP) && defined(__linux__)
+_Static_assert(sizeof(((alpha_exec_scope_t *)0)->caller_mask) >= sizeof(cpu_set_t), "caller_mask holds a cpu_set_t");
+
+// the workers stay bound for later calls, the calling thread is bound per call by alpha_exec_enter,
+// false when a worker could not be bound. Workers not bound before keep their own mask in
+// _worker_masks for restore_team
+static bool bind_team(struct alpha_exec_context *ctx)
+{
+    const int saved = _worker_mask_num;
+    if (ctx->thread_num > saved)
+    {
+        cpu_set_t *masks = realloc(_worker_masks, sizeof(cpu_set_t) * ctx->thread_num);
+        if (masks == NULL)
+            return false;
+        _worker_masks = masks;
+    }
+    int failed = 0;
+#pragma omp parallel num_threads(ctx->thread_num) reduction(| : failed)
+    {
+        const int tid = omp_get_thread_num();
+        const int threads = omp_get_num_threads();
+        const int slot = ctx->policy == ALPHA_SPARSE_BIND_SPREAD ? (int)((long long)tid * ctx->core_num / threads) : tid % ctx->core_num;
+        if (tid != 0)
+        {
+            if (tid >= saved)
+                failed |= sched_getaffinity(0, sizeof(cpu_set_t), _worker_masks + tid) != 0;
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(ctx->cores[slot], &set);
+            failed |= sched_setaffinity(0, sizeof(set), &set) != 0;
+        }
+    }
+    if (ctx->thread_num > saved)
+        _worker_mask_num = ctx->thread_num;
+    return failed == 0;
+}
+
+// gives the workers of a bound team the affinity they had before, so calls without cores run unpinned
+static void restore_team()
+{
+    cpu_set_t *masks = _worker_masks;
+#pragma omp parallel num_threads(_worker_mask_num)
+    {
+        const int tid = omp_get_thread_num();
+        if (tid != 0)
+            sched_setaffinity(0, sizeof(cpu_set_t), masks + tid);
+    }
+    _worker_mask_num = 0;
+    _bound_ctx = NULL;
+}
+#endif
+
+void alpha_exec_enter(alpha_exec_scope_t *scope, struct alpha_exec_context *matrix_ctx)
+{
+    struct alpha_exec_context *ctx = _thread_ctx != NULL ? _thread_ctx : matrix_ctx;
+    scope->ctx = ctx;
+    scope->prev_ctx = _call_ctx;
+    scope->prev_thread_num = _call_thread_num;
+    scope->caller_bound = false;
+#if defined(_OPENMP) && defined(__linux__)
+    // an unbound outermost call after a bound one must not run on the pinned workers
+    if (_worker_mask_num > 0 && _call_ctx == NULL && (ctx == NULL || ctx->cores == NULL || ctx->policy == ALPHA_SPARSE_BIND_NONE))
+        restore_team();
+#endif
+    if (ctx == NULL)
+        return;
+    _call_ctx = ctx;
+    _call_thread_num = ctx->thread_num;
+#if defined(_OPENMP) && defined(__linux__)
+    // libgomp keeps the team of a thread for later regions of the same size, binding it once is enough,
+    // a team that could not be bound is tried again on the next call
+    if (ctx->cores != NULL && ctx->policy != ALPHA_SPARSE_BIND_NONE && (_bound_ctx != ctx || _bound_version != ctx->version) &&
+        bind_team(ctx))
+    {
+        _bound_ctx = ctx;
+        _bound_version = ctx->version;
+    }
+    // thread 0 of the team is the user's thread, it gets its own affinity back on leave
+    if (ctx->cores != NULL && ctx->policy != ALPHA_SPARSE_BIND_NONE &&
+        sched_getaffinity(0, sizeof(cpu_set_t), (cpu_set_t *)scope->caller_mask) == 0)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(ctx->cores[0], &set);
+        scope->caller_bound = sched_setaffinity(0, sizeof(set), &set) == 0;
+    }
+#endif
+}
+
+void alpha_exec_leave(const alpha_exec_scope_t *scope)
+{
+    if (scope->ctx == NULL)
+        return;
+    _call_ctx = scope->prev_ctx;
+    _call_thread_num = scope->prev_thread_num;
+#if defined(_OPENMP) && defined(__linux__)
+    if (scope->caller_bound)
+        sched_setaffinity(0, sizeof(cpu_set_t), (const cpu_set_t *)scope->caller_mask);
+#endif
+}
+
+struct alpha_exec_context *alpha_exec_thread_context()
+{
+    return _thread_ctx;
+}
+
+void alpha_exec_set_thread_context(struct alpha_exec_context *ctx)
+{
+    _thread_ctx = ctx;
+}
+
+void *alpha_exec_workspace(const size_t size)
+{
+    struct alpha_exec_context *ctx = _call_ctx;
+    if (ctx == NULL)
+        return NULL;
+    if (ctx->workspace_size >= size)
+        return ctx->workspace;
+    if (!ctx->workspace_owned && ctx->workspace != NULL)
+        return NULL;
+    void *workspace = NULL;
+    if (posix_memalign(&workspace, 64, size) != 0)
+        return NULL;
+    free(ctx->workspace);
+    ctx->workspace = workspace;
+    ctx->workspace_size = size;
+    ctx->workspace_owned = true;
+    return workspace;
+}
@@ -0,0 +1,69 @@
+/**
+ * @brief implement for the building blocks of the level-1 sparse vector kernels
+ */
+
+#include "alphasparse/util/vec_index.h"
+#include "alphasparse/util/thread.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// order of the pairs (indx[i - 1], indx[i]) for begin < i < end
+static int index_order_range(const ALPHA_INT *indx, const ALPHA_INT begin, const ALPHA_INT end)
+{
+    bool contiguous = true;
+    for (ALPHA_INT i = begin + 1; i < end; i++)
+    {
+        if (indx[i] <= indx[i - 1])
+            return ALPHA_INDEX_UNSORTED;
+        if (indx[i] != indx[i - 1] + 1)
+            contiguous = false;
+    }
+    return contiguous ? ALPHA_INDEX_CONTIGUOUS : ALPHA_INDEX_SORTED;
+}
+
+alpha_index_order_t alpha_index_order(const ALPHA_INT nz, const ALPHA_INT *indx)
+{
+    if (nz <= 1)
+        return ALPHA_INDEX_CONTIGUOUS;
+    if (indx[1] <= indx[0] || indx[nz - 1] <= indx[0])
+        return ALPHA_INDEX_UNSORTED;
+    const ALPHA_INT thread_num = alpha_level1_thread_num(nz);
+    if (thread_num == 1)
+        return index_order_range(indx, 0, nz);
+    int order = ALPHA_INDEX_CONTIGUOUS;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thread_num) reduction(max : order)
+#endif
+    {
+#ifdef _OPENMP
+        const ALPHA_INT team = omp_get_num_threads();
+#else
+        const ALPHA_INT team = 1;
+#endif
+        const ALPHA_INT tid = alpha_get_thread_id();
+        const ALPHA_INT begin = (ALPHA_INT)((ALPHA_INT64)tid * nz / team);
+        const ALPHA_INT end = (ALPHA_INT)((ALPHA_INT64)(tid + 1) * nz / team);
+        // each range also checks the pair it shares with the previous one
+        order = index_order_range(indx, begin > 0 ? begin - 1 : 0, end);
+    }
+    return (alpha_index_order_t)order;
+}
+
+bool alpha_index_contiguous(const ALPHA_INT nz, const ALPHA_INT *indx)
+{
+    if (nz <= 1)
+        return true;
+    if ((ALPHA_INT64)indx[nz - 1] - indx[0] != nz - 1)
+        return false;
+    return alpha_index_order(nz, indx) == ALPHA_INDEX_CONTIGUOUS;
+}
+
+ALPHA_INT alpha_level1_thread_num(const ALPHA_INT nz)
+{
+    const ALPHA_INT most = nz / ALPHA_LEVEL1_PARALLEL_NZ;
+    if (most <= 1)
+        return 1;
+    const ALPHA_INT thread_num = alpha_get_thread_num();
+    return thread_num < most ? thread_num : most;
+}
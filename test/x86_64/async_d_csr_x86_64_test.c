@@ -0,0 +1,191 @@
+/**
+ * @brief openspblas asynchronous routines test, wait and test, dependency chains and failed dependencies
+ */
+
+#include <alphasparse.h>
+#include <stdio.h>
+#include "alphasparse/util/random.h"
+
+#define CHAIN 6
+
+static struct alpha_matrix_descr general()
+{
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    return descr;
+}
+
+static int check_status(const alphasparse_status_t got, const alphasparse_status_t expect, const char *name)
+{
+    printf("%s : ", name);
+    if (got != expect)
+    {
+        printf("status %d instead of %d\n", got, expect);
+        return -1;
+    }
+    printf("correct\n");
+    return 0;
+}
+
+// y_i = A y_(i-1) as a chain of futures each depending on the one before, polled with future_test
+static int check_chain(alphasparse_matrix_t A, const ALPHA_INT n)
+{
+    double *ref = alpha_memalign(sizeof(double) * n * (CHAIN + 1), DEFAULT_ALIGNMENT);
+    double *y = alpha_memalign(sizeof(double) * n * (CHAIN + 1), DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(ref, 1, n);
+    alpha_fill_random_d(y, 1, n);
+    for (int i = 1; i <= CHAIN; i++)
+        alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, .5, A, general(), ref + (i - 1) * n, 0., ref + i * n), "alphasparse_d_mv");
+
+    alphasparse_future_t future[CHAIN + 1];
+    for (int i = 1; i <= CHAIN; i++)
+        alpha_call_exit(alphasparse_d_mv_async(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, .5, A, general(), y + (i - 1) * n, 0., y + i * n, i > 1 ? 1 : 0,
+                                               i > 1 ? &future[i - 1] : NULL, &future[i]),
+                        "alphasparse_d_mv_async");
+    // the user may drop a future another one depends on, the executor keeps it until the dependent ran
+    alphasparse_future_destroy(future[1]);
+    bool completed = false;
+    while (!completed)
+        alpha_call_exit(alphasparse_future_test(future[CHAIN], &completed), "alphasparse_future_test");
+    int status = check_status(alphasparse_future_wait(future[CHAIN]), ALPHA_SPARSE_STATUS_SUCCESS, "chain wait after test");
+    // the dependencies completed before the last one started
+    for (int i = 2; i < CHAIN; i++)
+    {
+        alpha_call_exit(alphasparse_future_test(future[i], &completed), "alphasparse_future_test");
+        status |= completed ? 0 : -1;
+    }
+    printf("chain dependencies completed : %s\n", status == 0 ? "correct" : "wrong");
+    printf("chain mv : ");
+    status |= check_d(ref, n * (CHAIN + 1), y, n * (CHAIN + 1));
+    for (int i = 2; i <= CHAIN; i++)
+        alphasparse_future_destroy(future[i]);
+    alpha_release(ref);
+    alpha_release(y);
+    return status;
+}
+
+// C = A A handed out before it exists and used by an mv waiting on the product
+static int check_produced(alphasparse_matrix_t A, const ALPHA_INT n)
+{
+    double *x = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    double *t = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    double *y0 = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    double *y1 = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(x, 2, n);
+    alpha_fill_random_d(y0, 3, n);
+    alpha_fill_random_d(y1, 3, n);
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 1., A, general(), x, 0., t), "alphasparse_d_mv");
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 2., A, general(), t, .5, y0), "alphasparse_d_mv");
+
+    alphasparse_matrix_t C;
+    alphasparse_future_t product, mv;
+    alpha_call_exit(alphasparse_spmm_async(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, A, A, &C, 0, NULL, &product), "alphasparse_spmm_async");
+    alpha_call_exit(alphasparse_d_mv_async(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 2., C, general(), x, .5, y1, 1, &product, &mv), "alphasparse_d_mv_async");
+    int status = check_status(alphasparse_future_wait(mv), ALPHA_SPARSE_STATUS_SUCCESS, "mv on the product wait");
+    status |= check_status(alphasparse_future_wait(product), ALPHA_SPARSE_STATUS_SUCCESS, "product wait");
+    printf("mv on the product : ");
+    status |= check_d(y0, n, y1, n);
+
+    alphasparse_future_destroy(product);
+    alphasparse_future_destroy(mv);
+    alphasparse_destroy(C);
+    alpha_release(x);
+    alpha_release(t);
+    alpha_release(y0);
+    alpha_release(y1);
+    return status;
+}
+
+// a failed product fails every operation behind it without running them, an independent one still runs
+static int check_failed(alphasparse_matrix_t A, alphasparse_matrix_t coo, const ALPHA_INT n)
+{
+    double *x = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    double *y = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    double *z = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    double *kept = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    double *w0 = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    double *w1 = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(x, 4, n);
+    alpha_fill_random_d(y, 5, n);
+    alpha_fill_random_d(kept, 5, n);
+    alpha_fill_random_d(z, 6, n);
+    alpha_fill_random_d(w0, 7, n);
+    alpha_fill_random_d(w1, 7, n);
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 1., A, general(), x, 1., w0), "alphasparse_d_mv");
+
+    // csr times coo is rejected when the product runs
+    alphasparse_matrix_t C;
+    alphasparse_future_t product, first, second, other;
+    alpha_call_exit(alphasparse_spmm_async(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, A, coo, &C, 0, NULL, &product), "alphasparse_spmm_async");
+    alpha_call_exit(alphasparse_d_mv_async(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 1., C, general(), x, 1., y, 1, &product, &first), "alphasparse_d_mv_async");
+    alpha_call_exit(alphasparse_d_mv_async(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 1., A, general(), y, 0., z, 1, &first, &second), "alphasparse_d_mv_async");
+    alpha_call_exit(alphasparse_d_mv_async(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 1., A, general(), x, 1., w1, 0, NULL, &other), "alphasparse_d_mv_async");
+
+    int status = check_status(alphasparse_future_wait(second), ALPHA_SPARSE_STATUS_EXECUTION_FAILED, "second behind the failure");
+    status |= check_status(alphasparse_future_wait(first), ALPHA_SPARSE_STATUS_EXECUTION_FAILED, "first behind the failure");
+    status |= check_status(alphasparse_future_wait(product), ALPHA_SPARSE_STATUS_INVALID_VALUE, "failed product");
+    status |= check_status(alphasparse_future_wait(other), ALPHA_SPARSE_STATUS_SUCCESS, "independent mv");
+    printf("output behind the failure untouched : ");
+    status |= check_d(kept, n, y, n);
+    printf("independent mv : ");
+    status |= check_d(w0, n, w1, n);
+
+    alphasparse_future_destroy(product);
+    alphasparse_future_destroy(first);
+    alphasparse_future_destroy(second);
+    alphasparse_future_destroy(other);
+    // the handle of a product that never ran is destroyed as usual
+    alphasparse_destroy(C);
+    alpha_release(x);
+    alpha_release(y);
+    alpha_release(z);
+    alpha_release(kept);
+    alpha_release(w0);
+    alpha_release(w1);
+    return status;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    alpha_gen_t gen;
+    ALPHA_INT n, cols;
+    ALPHA_OFFSET *rows_offset;
+    ALPHA_INT *col_index;
+    double *values;
+    alpha_call_exit(alpha_gen_parse("stencil5:40,50", 1, &gen), "alpha_gen_parse");
+    alpha_call_exit(alpha_gen_d_csr(&gen, &n, &cols, &rows_offset, &col_index, &values), "alpha_gen_d_csr");
+    const ALPHA_INT nnz = (ALPHA_INT)rows_offset[n];
+    ALPHA_INT *row_index = alpha_malloc(sizeof(ALPHA_INT) * nnz);
+    for (ALPHA_INT r = 0; r < n; r++)
+        for (ALPHA_OFFSET ai = rows_offset[r]; ai < rows_offset[r + 1]; ai++)
+            row_index[ai] = r;
+
+    alphasparse_matrix_t coo, csr;
+    alpha_call_exit(alphasparse_d_create_coo(&coo, ALPHA_SPARSE_INDEX_BASE_ZERO, n, cols, nnz, row_index, col_index, values), "alphasparse_d_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &csr), "alphasparse_convert_csr");
+
+    int status = 0;
+    // one team and the default, a restart of the executor in between
+    const ALPHA_INT teams[2] = {1, 0};
+    for (int t = 0; t < 2; t++)
+    {
+        alpha_call_exit(alphasparse_set_async_teams(teams[t]), "alphasparse_set_async_teams");
+        printf("teams %d\n", (int)teams[t]);
+        status |= check_chain(csr, n);
+        status |= check_produced(csr, n);
+        status |= check_failed(csr, coo, n);
+    }
+
+    alphasparse_destroy(coo);
+    alphasparse_destroy(csr);
+    alpha_release(rows_offset);
+    alpha_release(col_index);
+    alpha_release(values);
+    alpha_release(row_index);
+    return status;
+}
@@ -0,0 +1,216 @@
+/**
+ * @brief openspblas csr builder test, every way of filling a builder against alphasparse_d_create_csr
+ */
+
+#include <alphasparse.h>
+#include <alphasparse/spmat.h>
+#include <stdio.h>
+#include "alphasparse/util/random.h"
+
+#define M 5000
+#define K 3000
+// rows hold 0 to MAX_ROW - 1 entries, enough for the unhinted buffers to grow many times
+#define MAX_ROW 23
+#define RANGES 7
+
+typedef struct
+{
+    ALPHA_OFFSET *rows_offset;
+    ALPHA_INT *row_nnz;
+    ALPHA_INT *col_indx;
+    double *values;
+} rows_t;
+
+// every row has distinct sorted columns, some rows are empty
+static rows_t make_rows()
+{
+    rows_t rows;
+    rows.rows_offset = alpha_malloc(sizeof(ALPHA_OFFSET) * (M + 1));
+    rows.row_nnz = alpha_malloc(sizeof(ALPHA_INT) * M);
+    rows.rows_offset[0] = 0;
+    for (ALPHA_INT r = 0; r < M; r++)
+    {
+        rows.row_nnz[r] = (r * 7) % MAX_ROW;
+        rows.rows_offset[r + 1] = rows.rows_offset[r] + rows.row_nnz[r];
+    }
+    rows.col_indx = alpha_malloc(sizeof(ALPHA_INT) * rows.rows_offset[M]);
+    rows.values = alpha_memalign(sizeof(double) * rows.rows_offset[M], DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(rows.values, 3, rows.rows_offset[M]);
+    for (ALPHA_INT r = 0; r < M; r++)
+        for (ALPHA_INT j = 0; j < rows.row_nnz[r]; j++)
+            rows.col_indx[rows.rows_offset[r] + j] = (r % 50) + j * (K / MAX_ROW);
+    return rows;
+}
+
+static void append_rows(const rows_t *rows, alphasparse_csr_range_t range, const ALPHA_INT begin, const ALPHA_INT end)
+{
+    for (ALPHA_INT r = begin; r < end; r++)
+        alpha_call_exit(alphasparse_d_csr_builder_append_row(range, rows->row_nnz[r], rows->col_indx + rows->rows_offset[r], rows->values + rows->rows_offset[r]),
+                        "alphasparse_d_csr_builder_append_row");
+}
+
+// rows of range i, the ranges are uneven and the last one takes the rest
+static ALPHA_INT range_row(const ALPHA_INT i)
+{
+    return i == RANGES ? M : i * (M / RANGES) + (i % 2) * 37;
+}
+
+// the built arrays must match the source exactly and mv must agree with the handle create_csr makes
+static int check_built(alphasparse_matrix_t built, alphasparse_matrix_t ref, const rows_t *rows, const char *name)
+{
+    const spmat_csr_d_t *mat = built->mat;
+    int status = mat->rows == M && mat->cols == K ? 0 : -1;
+    for (ALPHA_INT r = 0; r < M && status == 0; r++)
+    {
+        if (mat->rows_end[r] - mat->rows_start[r] != rows->row_nnz[r])
+            status = -1;
+        for (ALPHA_INT j = 0; j < rows->row_nnz[r] && status == 0; j++)
+            if (mat->col_indx[mat->rows_start[r] + j] != rows->col_indx[rows->rows_offset[r] + j] ||
+                mat->values[mat->rows_start[r] + j] != rows->values[rows->rows_offset[r] + j])
+                status = -1;
+    }
+    printf("%s arrays : %s\n", name, status == 0 ? "correct" : "wrong");
+
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    double *x = alpha_memalign(sizeof(double) * K, DEFAULT_ALIGNMENT);
+    double *y0 = alpha_memalign(sizeof(double) * M, DEFAULT_ALIGNMENT);
+    double *y1 = alpha_memalign(sizeof(double) * M, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(x, 1, K);
+    alpha_fill_random_d(y0, 2, M);
+    alpha_fill_random_d(y1, 2, M);
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 2., ref, descr, x, .5, y0), "alphasparse_d_mv");
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 2., built, descr, x, .5, y1), "alphasparse_d_mv");
+    printf("%s mv : ", name);
+    status |= check_d(y0, M, y1, M);
+    alpha_release(x);
+    alpha_release(y0);
+    alpha_release(y1);
+    return status;
+}
+
+// several producers claim their ranges at once, in no particular order
+static alphasparse_matrix_t build_ranges(const rows_t *rows, const bool exact, const int thread_num)
+{
+    alphasparse_csr_builder_t builder;
+    alpha_call_exit(alphasparse_d_create_csr_builder(&builder, M, K, exact ? rows->row_nnz : NULL, 0), "alphasparse_d_create_csr_builder");
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(thread_num) schedule(dynamic, 1)
+#endif
+    for (ALPHA_INT i = RANGES - 1; i >= 0; i--)
+    {
+        alphasparse_csr_range_t range;
+        alpha_call_exit(alphasparse_csr_builder_begin_rows(builder, range_row(i), range_row(i + 1), 0, &range), "alphasparse_csr_builder_begin_rows");
+        append_rows(rows, range, range_row(i), range_row(i + 1));
+    }
+    alphasparse_matrix_t A;
+    alpha_call_exit(alphasparse_csr_builder_finalize(builder, &A), "alphasparse_csr_builder_finalize");
+    return A;
+}
+
+static int check_status(const alphasparse_status_t got, const alphasparse_status_t expect, const char *name)
+{
+    printf("%s : ", name);
+    if (got != expect)
+    {
+        printf("status %d instead of %d\n", got, expect);
+        return -1;
+    }
+    printf("correct\n");
+    return 0;
+}
+
+static int check_rejected(const rows_t *rows)
+{
+    alphasparse_csr_builder_t builder;
+    alphasparse_csr_range_t range, other;
+    alphasparse_matrix_t A;
+    int status = 0;
+
+    alpha_call_exit(alphasparse_d_create_csr_builder(&builder, M, K, NULL, 0), "alphasparse_d_create_csr_builder");
+    alpha_call_exit(alphasparse_csr_builder_begin_rows(builder, 100, 200, 0, &range), "alphasparse_csr_builder_begin_rows");
+    status |= check_status(alphasparse_csr_builder_begin_rows(builder, 150, 250, 0, &other), ALPHA_SPARSE_STATUS_INVALID_VALUE, "overlapping range");
+    status |= check_status(alphasparse_csr_builder_begin_rows(builder, 0, 101, 0, &other), ALPHA_SPARSE_STATUS_INVALID_VALUE, "range overlapping the start");
+    status |= check_status(alphasparse_csr_builder_begin_rows(builder, M - 10, M + 1, 0, &other), ALPHA_SPARSE_STATUS_INVALID_VALUE, "range past the rows");
+    const ALPHA_INT bad_col = K;
+    const double one = 1.;
+    status |= check_status(alphasparse_d_csr_builder_append_row(range, 1, &bad_col, &one), ALPHA_SPARSE_STATUS_INVALID_VALUE, "column out of range");
+    append_rows(rows, range, 100, 199);
+    // row 199 is missing, and rows outside [100, 200) were never claimed
+    status |= check_status(alphasparse_csr_builder_finalize(builder, &A), ALPHA_SPARSE_STATUS_INVALID_VALUE, "incomplete range");
+    append_rows(rows, range, 199, 200);
+    status |= check_status(alphasparse_d_csr_builder_append_row(range, 0, NULL, NULL), ALPHA_SPARSE_STATUS_INVALID_VALUE, "row past the range");
+    status |= check_status(alphasparse_csr_builder_finalize(builder, &A), ALPHA_SPARSE_STATUS_INVALID_VALUE, "rows not covered");
+    alpha_call_exit(alphasparse_csr_builder_destroy(builder), "alphasparse_csr_builder_destroy");
+
+    // exact mode holds every row to its announced length
+    alpha_call_exit(alphasparse_d_create_csr_builder(&builder, M, K, rows->row_nnz, 0), "alphasparse_d_create_csr_builder");
+    alpha_call_exit(alphasparse_csr_builder_begin_rows(builder, 0, M, 0, &range), "alphasparse_csr_builder_begin_rows");
+    append_rows(rows, range, 0, 1);
+    status |= check_status(alphasparse_d_csr_builder_append_row(range, rows->row_nnz[1] - 1, rows->col_indx + rows->rows_offset[1], rows->values + rows->rows_offset[1]),
+                           ALPHA_SPARSE_STATUS_INVALID_VALUE, "exact row of the wrong length");
+    alpha_call_exit(alphasparse_csr_builder_destroy(builder), "alphasparse_csr_builder_destroy");
+
+    ALPHA_INT negative[2] = {1, -1};
+    status |= check_status(alphasparse_d_create_csr_builder(&builder, 2, K, negative, 0), ALPHA_SPARSE_STATUS_INVALID_VALUE, "negative row length");
+    return status;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    rows_t rows = make_rows();
+    alphasparse_matrix_t ref, built;
+    alpha_call_exit(alphasparse_d_create_csr(&ref, ALPHA_SPARSE_INDEX_BASE_ZERO, M, K, rows.rows_offset, rows.rows_offset + 1, rows.col_indx, rows.values),
+                    "alphasparse_d_create_csr");
+    int status = 0;
+
+    // exact sizes, one producer
+    alphasparse_csr_builder_t builder;
+    alphasparse_csr_range_t range;
+    alpha_call_exit(alphasparse_d_create_csr_builder(&builder, M, K, rows.row_nnz, 0), "alphasparse_d_create_csr_builder");
+    alpha_call_exit(alphasparse_csr_builder_begin_rows(builder, 0, M, 0, &range), "alphasparse_csr_builder_begin_rows");
+    append_rows(&rows, range, 0, M);
+    alpha_call_exit(alphasparse_csr_builder_finalize(builder, &built), "alphasparse_csr_builder_finalize");
+    status |= check_built(built, ref, &rows, "exact");
+    alphasparse_destroy(built);
+
+    // exact sizes, several producers
+    built = build_ranges(&rows, true, thread_num);
+    status |= check_built(built, ref, &rows, "exact ranges");
+    alphasparse_destroy(built);
+
+    // no sizes and no hint, one range over every row grows from the smallest buffer and is adopted
+    alpha_call_exit(alphasparse_d_create_csr_builder(&builder, M, K, NULL, 0), "alphasparse_d_create_csr_builder");
+    alpha_call_exit(alphasparse_csr_builder_begin_rows(builder, 0, M, 0, &range), "alphasparse_csr_builder_begin_rows");
+    append_rows(&rows, range, 0, M);
+    alpha_call_exit(alphasparse_csr_builder_finalize(builder, &built), "alphasparse_csr_builder_finalize");
+    status |= check_built(built, ref, &rows, "growing");
+    alphasparse_destroy(built);
+
+    // a hint too small for the rows still grows
+    alpha_call_exit(alphasparse_d_create_csr_builder(&builder, M, K, NULL, M), "alphasparse_d_create_csr_builder");
+    alpha_call_exit(alphasparse_csr_builder_begin_rows(builder, 0, M, 0, &range), "alphasparse_csr_builder_begin_rows");
+    append_rows(&rows, range, 0, M);
+    alpha_call_exit(alphasparse_csr_builder_finalize(builder, &built), "alphasparse_csr_builder_finalize");
+    status |= check_built(built, ref, &rows, "growing from a hint");
+    alphasparse_destroy(built);
+
+    // no sizes, several producers, finalize copies the ranges in parallel
+    built = build_ranges(&rows, false, thread_num);
+    status |= check_built(built, ref, &rows, "growing ranges");
+    alphasparse_destroy(built);
+
+    status |= check_rejected(&rows);
+
+    alphasparse_destroy(ref);
+    alpha_release(rows.rows_offset);
+    alpha_release(rows.row_nnz);
+    alpha_release(rows.col_indx);
+    alpha_release(rows.values);
+    return status;
+}
@@ -0,0 +1,130 @@
+/**
+ * @brief openspblas csr tiles test, tiled mv against gemv_csr, also after the values change
+ */
+
+#include <alphasparse.h>
+#include <alphasparse/inspector.h>
+#include <alphasparse/spmat.h>
+#include <stdio.h>
+#include "alphasparse/util/random.h"
+
+#define M 3000
+#define K 5000
+#define PER_ROW 12
+// far below the cache sized panels, so the product walks many panels and row blocks
+#define PANEL_COLS 1024
+#define BLOCK_ROWS 256
+
+static int check_mv(alphasparse_matrix_t csr, alphasparse_matrix_t tiled, const char *name)
+{
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    double *x = alpha_memalign(sizeof(double) * K, DEFAULT_ALIGNMENT);
+    double *y0 = alpha_memalign(sizeof(double) * M, DEFAULT_ALIGNMENT);
+    double *y1 = alpha_memalign(sizeof(double) * M, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(x, 1, K);
+    alpha_fill_random_d(y0, 2, M);
+    alpha_fill_random_d(y1, 2, M);
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 2., csr, descr, x, .5, y0), "alphasparse_d_mv");
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 2., tiled, descr, x, .5, y1), "alphasparse_d_mv");
+    printf("%s : ", name);
+    int status = check_d(y0, M, y1, M);
+    alpha_free(x);
+    alpha_free(y0);
+    alpha_free(y1);
+    return status;
+}
+
+// the tiles alphasparse_optimize would build on a machine whose caches hold only PANEL_COLS entries of x
+static void build_tiles(alphasparse_matrix_t A)
+{
+    alpha_call_exit(alphasparse_optimize(A), "alphasparse_optimize");
+    const spmat_csr_d_t *mat = A->mat;
+    alphasparse_inspector_t inspector = alphasparse_inspector_get(A);
+    alpha_csr_tiles_destroy(inspector->csr_tiles);
+    alpha_call_exit(alpha_csr_tiles_build(mat->rows, mat->cols, mat->rows_start, mat->rows_end, mat->col_indx, mat->values, sizeof(double),
+                                          PANEL_COLS, BLOCK_ROWS, &inspector->csr_tiles),
+                    "alpha_csr_tiles_build");
+}
+
+static int check_tiles(alphasparse_matrix_t tiled, const bool expect, const char *name)
+{
+    const bool built = alpha_matrix_csr_tiles(tiled) != NULL;
+    printf("%s : %s\n", name, built ? "used" : "not used");
+    return built == expect ? 0 : -1;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    // PER_ROW columns spread over every panel, empty rows and a few rows crowding one panel
+    ALPHA_INT *row_index = alpha_malloc(sizeof(ALPHA_INT) * M * PER_ROW);
+    ALPHA_INT *col_index = alpha_malloc(sizeof(ALPHA_INT) * M * PER_ROW);
+    double *values = alpha_memalign(sizeof(double) * M * PER_ROW, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(values, 3, M * PER_ROW);
+    ALPHA_INT nnz = 0;
+    for (ALPHA_INT i = 0; i < M; i++)
+    {
+        if (i % 17 == 5)
+            continue;
+        const ALPHA_INT stride = i % 10 == 0 ? 7 : 419;
+        for (ALPHA_INT j = 0; j < PER_ROW; j++)
+        {
+            row_index[nnz] = i;
+            col_index[nnz++] = (i * 3 + j * stride) % K;
+        }
+    }
+
+    alphasparse_matrix_t coo, csr, tiled;
+    alpha_call_exit(alphasparse_d_create_coo(&coo, ALPHA_SPARSE_INDEX_BASE_ZERO, M, K, nnz, row_index, col_index, values), "alphasparse_d_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &csr), "alphasparse_convert_csr");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &tiled), "alphasparse_convert_csr");
+    alpha_call_exit(alphasparse_set_mv_tiling_hint(tiled, ALPHA_SPARSE_MV_TILING_2D), "alphasparse_set_mv_tiling_hint");
+    build_tiles(tiled);
+
+    int status = check_tiles(tiled, true, "tiles");
+    status |= check_mv(csr, tiled, "gemv tiled");
+
+    // changed values are written into the tiles, mv keeps using them
+    const ALPHA_INT nvalues = nnz / 5;
+    ALPHA_INT *indx = alpha_malloc(sizeof(ALPHA_INT) * nvalues);
+    ALPHA_INT *indy = alpha_malloc(sizeof(ALPHA_INT) * nvalues);
+    double *new_values = alpha_memalign(sizeof(double) * nnz, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(new_values, 4, nnz);
+    for (ALPHA_INT i = 0; i < nvalues; i++)
+    {
+        indx[i] = row_index[i * 5];
+        indy[i] = col_index[i * 5];
+    }
+    alpha_call_exit(alphasparse_d_update_values(csr, nvalues, indx, indy, new_values), "alphasparse_d_update_values");
+    alpha_call_exit(alphasparse_d_update_values(tiled, nvalues, indx, indy, new_values), "alphasparse_d_update_values");
+    status |= check_tiles(tiled, true, "tiles after update values");
+    status |= check_mv(csr, tiled, "gemv tiled after update values");
+
+    // the same for a full replace in storage order
+    alpha_call_exit(alphasparse_d_update_values(csr, nnz, NULL, NULL, new_values), "alphasparse_d_update_values");
+    alpha_call_exit(alphasparse_d_update_values(tiled, nnz, NULL, NULL, new_values), "alphasparse_d_update_values");
+    status |= check_tiles(tiled, true, "tiles after replace");
+    status |= check_mv(csr, tiled, "gemv tiled after replace");
+
+    // and a single value set on a row in a crowded panel
+    alpha_call_exit(alphasparse_d_set_value(csr, row_index[0], col_index[0], 3.), "alphasparse_d_set_value");
+    alpha_call_exit(alphasparse_d_set_value(tiled, row_index[0], col_index[0], 3.), "alphasparse_d_set_value");
+    status |= check_tiles(tiled, true, "tiles after set value");
+    status |= check_mv(csr, tiled, "gemv tiled after set value");
+
+    alpha_free(indx);
+    alpha_free(indy);
+    alpha_free(new_values);
+    alphasparse_destroy(coo);
+    alphasparse_destroy(csr);
+    alphasparse_destroy(tiled);
+    alpha_free(row_index);
+    alpha_free(col_index);
+    alpha_free(values);
+    return status;
+}
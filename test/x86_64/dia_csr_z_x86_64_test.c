@@ -0,0 +1,175 @@
+/**
+ * @brief openspblas dia+csr test, conversion thresholds and the fused kernels against csr
+ */
+
+#include <alphasparse.h>
+#include <alphasparse/spmat.h>
+#include <stdio.h>
+#include "alphasparse/util/random.h"
+
+#define M 1500
+#define K 1437
+// entries off the band, enough for a tail of several parts
+#define STRAY 3000
+
+static const char *op_name(const alphasparse_operation_t op)
+{
+    return op == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE ? "n" : op == ALPHA_SPARSE_OPERATION_TRANSPOSE ? "t" : "h";
+}
+
+static int check_mv(alphasparse_matrix_t csr, alphasparse_matrix_t hyb, const alphasparse_operation_t op, const char *name)
+{
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    const ALPHA_Complex16 alpha = {2., -1.}, beta = {.5, 1.};
+    const ALPHA_INT size_x = op == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE ? K : M;
+    const ALPHA_INT size_y = op == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE ? M : K;
+    ALPHA_Complex16 *x = alpha_memalign(sizeof(ALPHA_Complex16) * size_x, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y0 = alpha_memalign(sizeof(ALPHA_Complex16) * size_y, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y1 = alpha_memalign(sizeof(ALPHA_Complex16) * size_y, DEFAULT_ALIGNMENT);
+    alpha_fill_random_z(x, 1, size_x);
+    alpha_fill_random_z(y0, 2, size_y);
+    alpha_fill_random_z(y1, 2, size_y);
+    alpha_call_exit(alphasparse_z_mv(op, alpha, csr, descr, x, beta, y0), "alphasparse_z_mv");
+    alpha_call_exit(alphasparse_z_mv(op, alpha, hyb, descr, x, beta, y1), "alphasparse_z_mv");
+    printf("gemv %s %s : ", name, op_name(op));
+    int status = check_z(y0, size_y, y1, size_y);
+    alpha_free(x);
+    alpha_free(y0);
+    alpha_free(y1);
+    return status;
+}
+
+static int check_mm(alphasparse_matrix_t csr, alphasparse_matrix_t hyb, const alphasparse_layout_t layout, const char *name)
+{
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    const ALPHA_Complex16 alpha = {2., -1.}, beta = {.5, 1.};
+    const ALPHA_INT columns = 21;
+    const ALPHA_INT ldx = layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR ? columns : K;
+    const ALPHA_INT ldy = layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR ? columns : M;
+    const size_t size_x = (size_t)K * columns, size_y = (size_t)M * columns;
+    ALPHA_Complex16 *x = alpha_memalign(sizeof(ALPHA_Complex16) * size_x, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y0 = alpha_memalign(sizeof(ALPHA_Complex16) * size_y, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y1 = alpha_memalign(sizeof(ALPHA_Complex16) * size_y, DEFAULT_ALIGNMENT);
+    alpha_fill_random_z(x, 1, size_x);
+    alpha_fill_random_z(y0, 2, size_y);
+    alpha_fill_random_z(y1, 2, size_y);
+    alpha_call_exit(alphasparse_z_mm(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, alpha, csr, descr, layout, x, columns, ldx, beta, y0, ldy), "alphasparse_z_mm");
+    alpha_call_exit(alphasparse_z_mm(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, alpha, hyb, descr, layout, x, columns, ldx, beta, y1, ldy), "alphasparse_z_mm");
+    printf("gemm %s %s : ", name, layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR ? "row" : "col");
+    int status = check_z(y0, size_y, y1, size_y);
+    alpha_free(x);
+    alpha_free(y0);
+    alpha_free(y1);
+    return status;
+}
+
+// where the entries of a hybrid matrix ended up, every kept diagonal and the tail counted
+static int check_split(alphasparse_matrix_t hyb, const ALPHA_INT ndiag, const ALPHA_INT tail, const char *name)
+{
+    const spmat_dia_csr_z_t *mat = hyb->mat;
+    const ALPHA_INT got_tail = mat->csr->rows_end[M - 1] - mat->csr->rows_start[0];
+    printf("split %s : %d diagonals and %d tail entries, ", name, mat->dia->ndiag, got_tail);
+    if ((ndiag >= 0 && mat->dia->ndiag != ndiag) || (tail >= 0 && got_tail != tail))
+    {
+        printf("expected %d and %d\n", ndiag, tail);
+        return -1;
+    }
+    printf("correct\n");
+    return 0;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    // five full diagonals, stray entries off the band and a second copy of some entries of both
+    const ALPHA_INT dists[5] = {-3, -1, 0, 1, 40};
+    const ALPHA_INT cap = M * 5 + 2 * STRAY + M / 10;
+    ALPHA_INT *row_index = alpha_malloc(sizeof(ALPHA_INT) * cap);
+    ALPHA_INT *col_index = alpha_malloc(sizeof(ALPHA_INT) * cap);
+    ALPHA_Complex16 *values = alpha_memalign(sizeof(ALPHA_Complex16) * cap, DEFAULT_ALIGNMENT);
+    alpha_fill_random_z(values, 3, cap);
+    ALPHA_INT nnz = 0;
+    for (ALPHA_INT i = 0; i < M; i++)
+        for (int d = 0; d < 5; d++)
+            if (i + dists[d] >= 0 && i + dists[d] < K)
+            {
+                row_index[nnz] = i;
+                col_index[nnz++] = i + dists[d];
+            }
+    const ALPHA_INT band = nnz;
+    // strays keep 100 columns away from the band so no diagonal of them fills up
+    for (ALPHA_INT s = 0; s < STRAY; s++)
+    {
+        row_index[nnz] = (s * 37) % M;
+        col_index[nnz] = (row_index[nnz] + 100 + (s * 61) % (K - 200)) % K;
+        nnz++;
+    }
+    const ALPHA_INT stray = nnz - band;
+    for (ALPHA_INT i = 0; i < M / 10; i++)
+    {
+        row_index[nnz] = row_index[i * 7];
+        col_index[nnz++] = col_index[i * 7];
+    }
+    for (ALPHA_INT s = 0; s < STRAY; s += 3)
+    {
+        row_index[nnz] = row_index[band + s];
+        col_index[nnz++] = col_index[band + s];
+    }
+
+    alphasparse_matrix_t coo, csr, hyb;
+    alpha_call_exit(alphasparse_z_create_coo(&coo, ALPHA_SPARSE_INDEX_BASE_ZERO, M, K, nnz, row_index, col_index, values), "alphasparse_z_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &csr), "alphasparse_convert_csr");
+
+    const alphasparse_operation_t ops[3] = {ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, ALPHA_SPARSE_OPERATION_TRANSPOSE, ALPHA_SPARSE_OPERATION_CONJUGATE_TRANSPOSE};
+    const double thresholds[3] = {0., .5, 1.};
+    const char *names[3] = {"threshold 0", "threshold .5", "threshold 1"};
+    int status = 0;
+    for (int t = 0; t < 3; t++)
+    {
+        alpha_call_exit(alphasparse_convert_dia_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, thresholds[t], &hyb), "alphasparse_convert_dia_csr");
+        // 0 keeps every occupied diagonal, 1 no diagonal at all, in between only the band,
+        // the duplicates of the band are summed into it and those of the strays stay in the tail
+        if (t == 0)
+            status |= check_split(hyb, -1, 0, names[t]);
+        else if (t == 1)
+            status |= check_split(hyb, 5, stray + (STRAY + 2) / 3, names[t]);
+        else
+            status |= check_split(hyb, 0, nnz, names[t]);
+        for (int o = 0; o < 3; o++)
+            status |= check_mv(csr, hyb, ops[o], names[t]);
+        status |= check_mm(csr, hyb, ALPHA_SPARSE_LAYOUT_ROW_MAJOR, names[t]);
+        status |= check_mm(csr, hyb, ALPHA_SPARSE_LAYOUT_COLUMN_MAJOR, names[t]);
+        alphasparse_destroy(hyb);
+    }
+
+    // the transposed conversion against the transposed product
+    alpha_call_exit(alphasparse_convert_dia_csr(csr, ALPHA_SPARSE_OPERATION_TRANSPOSE, .5, &hyb), "alphasparse_convert_dia_csr");
+    {
+        struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+        const ALPHA_Complex16 one = {1., 0.}, zero = {0., 0.};
+        ALPHA_Complex16 *x = alpha_memalign(sizeof(ALPHA_Complex16) * M, DEFAULT_ALIGNMENT);
+        ALPHA_Complex16 *y0 = alpha_memalign(sizeof(ALPHA_Complex16) * K, DEFAULT_ALIGNMENT);
+        ALPHA_Complex16 *y1 = alpha_memalign(sizeof(ALPHA_Complex16) * K, DEFAULT_ALIGNMENT);
+        alpha_fill_random_z(x, 1, M);
+        alpha_call_exit(alphasparse_z_mv(ALPHA_SPARSE_OPERATION_TRANSPOSE, one, csr, descr, x, zero, y0), "alphasparse_z_mv");
+        alpha_call_exit(alphasparse_z_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, one, hyb, descr, x, zero, y1), "alphasparse_z_mv");
+        printf("convert transposed : ");
+        status |= check_z(y0, K, y1, K);
+        alpha_free(x);
+        alpha_free(y0);
+        alpha_free(y1);
+    }
+    alphasparse_destroy(hyb);
+
+    alphasparse_destroy(coo);
+    alphasparse_destroy(csr);
+    alpha_free(row_index);
+    alpha_free(col_index);
+    alpha_free(values);
+    return status;
+}
@@ -0,0 +1,109 @@
+/**
+ * @brief openspblas execution context test
+ */
+
+#define _GNU_SOURCE
+#include <alphasparse.h>
+#include <omp.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include "alphasparse/util/random.h"
+
+/*
+* a call under a context bound to cores gives the same result and leaves the affinity of the calling
+* thread alone, the next call without a context runs the workers on their own affinity again
+*/
+static int check_bound(alphasparse_matrix_t csr, const ALPHA_INT m, const ALPHA_INT k, const int thread_num)
+{
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    double *x = alpha_memalign(sizeof(double) * k, DEFAULT_ALIGNMENT);
+    double *y0 = alpha_memalign(sizeof(double) * m, DEFAULT_ALIGNMENT);
+    double *y1 = alpha_memalign(sizeof(double) * m, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(x, 1, k);
+    alpha_fill_random_d(y0, 2, m);
+    alpha_fill_random_d(y1, 2, m);
+
+    cpu_set_t before, after;
+    sched_getaffinity(0, sizeof(before), &before);
+    // the last core the process may use, so the user's thread is pinned somewhere it would not be on its own
+    ALPHA_INT core = 0;
+    for (int c = 0; c < CPU_SETSIZE; c++)
+        if (CPU_ISSET(c, &before))
+            core = c;
+
+    alphasparse_exec_context_t ctx;
+    alpha_call_exit(alphasparse_create_exec_context(&ctx, thread_num), "alphasparse_create_exec_context");
+    alpha_call_exit(alphasparse_exec_context_set_cores(ctx, 1, &core, ALPHA_SPARSE_BIND_CLOSE), "alphasparse_exec_context_set_cores");
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 2., csr, descr, x, 3., y0), "alphasparse_d_mv");
+    alpha_call_exit(alphasparse_set_exec_context(csr, ctx), "alphasparse_set_exec_context");
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 2., csr, descr, x, 3., y1), "alphasparse_d_mv");
+    sched_getaffinity(0, sizeof(after), &after);
+    alphasparse_set_exec_context(csr, NULL);
+    alphasparse_destroy_exec_context(ctx);
+
+    printf("bound mv : ");
+    int status = check_d(y0, m, y1, m);
+    const int kept = CPU_EQUAL(&before, &after);
+    // the same pool of workers serves the next call without a context and the region below
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 2., csr, descr, x, 3., y1), "alphasparse_d_mv");
+    int pinned = 0;
+#pragma omp parallel num_threads(thread_num) reduction(+ : pinned)
+    {
+        cpu_set_t worker;
+        sched_getaffinity(0, sizeof(worker), &worker);
+        pinned += !CPU_EQUAL(&before, &worker);
+    }
+    printf("caller affinity : %s\n", kept ? "kept" : "changed");
+    printf("worker affinity after the bound call : %s\n", pinned == 0 ? "restored" : "pinned");
+
+    alpha_free(x);
+    alpha_free(y0);
+    alpha_free(y1);
+    return status | (kept && pinned == 0 ? 0 : -1);
+}
+
+// cores outside the affinity mask of the process cannot be bound and are rejected up front
+static int check_foreign_core(void)
+{
+    cpu_set_t set;
+    sched_getaffinity(0, sizeof(set), &set);
+    ALPHA_INT core = 0;
+    while (core < CPU_SETSIZE - 1 && CPU_ISSET(core, &set))
+        core++;
+    alphasparse_exec_context_t ctx;
+    alpha_call_exit(alphasparse_create_exec_context(&ctx, 1), "alphasparse_create_exec_context");
+    const alphasparse_status_t status = alphasparse_exec_context_set_cores(ctx, 1, &core, ALPHA_SPARSE_BIND_CLOSE);
+    alphasparse_destroy_exec_context(ctx);
+    printf("core %d outside the mask : %s\n", (int)core, status == ALPHA_SPARSE_STATUS_INVALID_VALUE ? "rejected" : "accepted");
+    return status == ALPHA_SPARSE_STATUS_INVALID_VALUE ? 0 : -1;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    const char *file = args_get_data_file(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    ALPHA_INT m, k, nnz;
+    ALPHA_INT *row_index, *col_index;
+    double *values;
+    alpha_read_coo_d(file, &m, &k, &nnz, &row_index, &col_index, &values);
+
+    alphasparse_matrix_t coo, csr;
+    alpha_call_exit(alphasparse_d_create_coo(&coo, ALPHA_SPARSE_INDEX_BASE_ZERO, m, k, nnz, row_index, col_index, values), "alphasparse_d_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &csr), "alphasparse_convert_csr");
+
+    int status = check_bound(csr, m, k, thread_num);
+    status |= check_foreign_core();
+
+    alphasparse_destroy(coo);
+    alphasparse_destroy(csr);
+    alpha_free(row_index);
+    alpha_free(col_index);
+    alpha_free(values);
+    return status;
+}
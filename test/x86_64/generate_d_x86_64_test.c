@@ -0,0 +1,129 @@
+/**
+ * @brief openspblas matrix generator test, seeded output at different thread counts, row order and rejected specs
+ */
+
+#include <alphasparse.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef struct
+{
+    ALPHA_INT rows;
+    ALPHA_INT cols;
+    ALPHA_OFFSET *rows_offset;
+    ALPHA_INT *col_index;
+    double *values;
+} generated_t;
+
+static generated_t generate(const char *spec, const uint64_t seed, const int thread_num)
+{
+    generated_t g;
+    alpha_gen_t gen;
+    alpha_set_thread_num(thread_num);
+    alpha_call_exit(alpha_gen_parse(spec, seed, &gen), "alpha_gen_parse");
+    alpha_call_exit(alpha_gen_d_csr(&gen, &g.rows, &g.cols, &g.rows_offset, &g.col_index, &g.values), "alpha_gen_d_csr");
+    return g;
+}
+
+static void release(generated_t *g)
+{
+    alpha_release(g->rows_offset);
+    alpha_release(g->col_index);
+    alpha_release(g->values);
+}
+
+static bool same(const generated_t *a, const generated_t *b)
+{
+    if (a->rows != b->rows || a->cols != b->cols || a->rows_offset[a->rows] != b->rows_offset[b->rows])
+        return false;
+    const ALPHA_OFFSET nnz = a->rows_offset[a->rows];
+    return memcmp(a->rows_offset, b->rows_offset, sizeof(ALPHA_OFFSET) * (a->rows + 1)) == 0 &&
+           memcmp(a->col_index, b->col_index, sizeof(ALPHA_INT) * nnz) == 0 && memcmp(a->values, b->values, sizeof(double) * nnz) == 0;
+}
+
+// columns in range, strictly ascending in every row
+static bool sorted_unique(const generated_t *g)
+{
+    for (ALPHA_INT r = 0; r < g->rows; r++)
+        for (ALPHA_OFFSET ai = g->rows_offset[r]; ai < g->rows_offset[r + 1]; ai++)
+            if (g->col_index[ai] < 0 || g->col_index[ai] >= g->cols || (ai > g->rows_offset[r] && g->col_index[ai - 1] >= g->col_index[ai]))
+                return false;
+    return true;
+}
+
+static int check_kind(const char *spec, const bool random, const int thread_num)
+{
+    generated_t one = generate(spec, 7, 1);
+    generated_t many = generate(spec, 7, thread_num);
+    int status = 0;
+
+    printf("%s same at 1 and %d threads : %s\n", spec, thread_num, same(&one, &many) ? "correct" : "wrong");
+    status |= same(&one, &many) ? 0 : -1;
+    printf("%s sorted unique columns : %s\n", spec, sorted_unique(&many) ? "correct" : "wrong");
+    status |= sorted_unique(&many) ? 0 : -1;
+    printf("%s nnz : %s\n", spec, one.rows_offset[one.rows] > 0 ? "correct" : "empty");
+    status |= one.rows_offset[one.rows] > 0 ? 0 : -1;
+
+    // the random kinds draw their structure from the seed
+    if (random)
+    {
+        generated_t other = generate(spec, 8, thread_num);
+        printf("%s other seed differs : %s\n", spec, same(&one, &other) ? "wrong" : "correct");
+        status |= same(&one, &other) ? -1 : 0;
+        release(&other);
+    }
+    release(&one);
+    release(&many);
+    alpha_set_thread_num(thread_num);
+    return status;
+}
+
+static int check_rejected(const char *spec)
+{
+    alpha_gen_t gen;
+    const alphasparse_status_t got = alpha_gen_parse(spec, 1, &gen);
+    printf("rejected \"%s\" : ", spec);
+    if (got != ALPHA_SPARSE_STATUS_INVALID_VALUE)
+    {
+        printf("status %d\n", got);
+        return -1;
+    }
+    printf("correct\n");
+    return 0;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    int status = 0;
+    status |= check_kind("stencil5:60,70", false, thread_num);
+    status |= check_kind("stencil7:20,15,11", false, thread_num);
+    status |= check_kind("stencil27:17,13,9", false, thread_num);
+    status |= check_kind("banded:5000,7", false, thread_num);
+    status |= check_kind("blockdiag:4999,6", false, thread_num);
+    status |= check_kind("fem:21,19,3", false, thread_num);
+    status |= check_kind("er:6000,9.5", true, thread_num);
+    status |= check_kind("rmat:13,6", true, thread_num);
+    status |= check_kind("rmat:12,8,0.45,0.25,0.15", true, thread_num);
+
+    status |= check_rejected("");
+    status |= check_rejected("ring:100,4");
+    status |= check_rejected("stencil5:100");
+    status |= check_rejected("stencil27:10,10");
+    status |= check_rejected("banded:-5,2");
+    status |= check_rejected("banded:100,-1");
+    status |= check_rejected("blockdiag:100,0");
+    status |= check_rejected("fem:10,10,0");
+    status |= check_rejected("er:1000,-3");
+    status |= check_rejected("stencil27:100000,100000,100000");
+    status |= check_rejected("rmat:31,4");
+    status |= check_rejected("rmat:10,4,0.5,0.3");
+    status |= check_rejected("rmat:10,4,0.5,0.3,0.3");
+    status |= check_rejected("rmat:10,4,-0.1,0.3,0.3");
+    return status;
+}
@@ -0,0 +1,207 @@
+/**
+ * @brief openspblas operation graph test, replays of mv, axpby and dot against direct calls and the stages they fuse into
+ */
+
+#include <alphasparse.h>
+#include <stdio.h>
+#include "alphasparse/util/random.h"
+
+#define REPLAYS 3
+
+static struct alpha_matrix_descr general()
+{
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    return descr;
+}
+
+static void mv(alphasparse_matrix_t A, const double alpha, const double *x, const double beta, double *y)
+{
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, alpha, A, general(), x, beta, y), "alphasparse_d_mv");
+}
+
+static void axpby(const ALPHA_INT n, const double alpha, const double *x, const double beta, const double *y, double *w)
+{
+    for (ALPHA_INT i = 0; i < n; i++)
+        w[i] = alpha * x[i] + beta * y[i];
+}
+
+static double dot(const ALPHA_INT n, const double *x, const double *y)
+{
+    double sum = 0.;
+    for (ALPHA_INT i = 0; i < n; i++)
+        sum += x[i] * y[i];
+    return sum;
+}
+
+// the vectors a graph works on, the same layout for the replay and the direct calls
+typedef struct
+{
+    double *x;
+    double *y1;
+    double *y2;
+    double *w;
+    double result;
+} vectors_t;
+
+static vectors_t make_vectors(const ALPHA_INT n)
+{
+    vectors_t v;
+    v.x = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    v.y1 = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    v.y2 = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    v.w = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    v.result = 0.;
+    return v;
+}
+
+static void fill_vectors(vectors_t *v, const ALPHA_INT n, const unsigned seed)
+{
+    alpha_fill_random_d(v->x, seed, n);
+    alpha_fill_random_d(v->y1, seed + 1, n);
+    alpha_fill_random_d(v->y2, seed + 2, n);
+    alpha_fill_random_d(v->w, seed + 3, n);
+}
+
+static void release_vectors(vectors_t *v)
+{
+    alpha_release(v->x);
+    alpha_release(v->y1);
+    alpha_release(v->y2);
+    alpha_release(v->w);
+}
+
+// sequence of a graph, run directly when graph is NULL and recorded otherwise
+typedef void (*sequence_t)(alphasparse_graph_t graph, alphasparse_matrix_t A, const ALPHA_INT n, vectors_t *v);
+
+/*
+* y1 = A x, y2 = 2 A x + y2, w = y1 - 0.5 y2, result = w . y1
+* every node reads only what the others write on the same rows, one stage
+*/
+static void sequence_fused(alphasparse_graph_t graph, alphasparse_matrix_t A, const ALPHA_INT n, vectors_t *v)
+{
+    mv(A, 1., v->x, 0., v->y1);
+    mv(A, 2., v->x, 1., v->y2);
+    if (graph == NULL)
+    {
+        axpby(n, 1., v->y1, -.5, v->y2, v->w);
+        v->result = dot(n, v->w, v->y1);
+        return;
+    }
+    alpha_call_exit(alphasparse_d_graph_axpby(graph, n, 1., v->y1, -.5, v->y2, v->w), "alphasparse_d_graph_axpby");
+    alpha_call_exit(alphasparse_d_graph_dot(graph, n, v->w, v->y1, &v->result), "alphasparse_d_graph_dot");
+}
+
+/*
+* y1 = A x, y2 = A y1, y2 = 3 y1 + y2 in place, result = y2 . y2
+* the second mv reads all of y1 the first one writes, a second stage
+*/
+static void sequence_chained(alphasparse_graph_t graph, alphasparse_matrix_t A, const ALPHA_INT n, vectors_t *v)
+{
+    mv(A, 1., v->x, 0., v->y1);
+    mv(A, 1., v->y1, 0., v->y2);
+    if (graph == NULL)
+    {
+        axpby(n, 3., v->y1, 1., v->y2, v->y2);
+        v->result = dot(n, v->y2, v->y2);
+        return;
+    }
+    alpha_call_exit(alphasparse_d_graph_axpby(graph, n, 3., v->y1, 1., v->y2, v->y2), "alphasparse_d_graph_axpby");
+    alpha_call_exit(alphasparse_d_graph_dot(graph, n, v->y2, v->y2, &v->result), "alphasparse_d_graph_dot");
+}
+
+/*
+* y1 = A x, y2 = 2 A x + y2, x = x - y1 in place, result = x . y2
+* the axpby overwrites the x both mv read in full, so it may not join their stage
+*/
+static void sequence_aliased(alphasparse_graph_t graph, alphasparse_matrix_t A, const ALPHA_INT n, vectors_t *v)
+{
+    mv(A, 1., v->x, 0., v->y1);
+    mv(A, 2., v->x, 1., v->y2);
+    if (graph == NULL)
+    {
+        axpby(n, 1., v->x, -1., v->y1, v->x);
+        v->result = dot(n, v->x, v->y2);
+        return;
+    }
+    alpha_call_exit(alphasparse_d_graph_axpby(graph, n, 1., v->x, -1., v->y1, v->x), "alphasparse_d_graph_axpby");
+    alpha_call_exit(alphasparse_d_graph_dot(graph, n, v->x, v->y2, &v->result), "alphasparse_d_graph_dot");
+}
+
+static int check_vectors(const vectors_t *ref, const vectors_t *got, const ALPHA_INT n, const char *name, const int replay)
+{
+    int status = 0;
+    printf("%s replay %d x : ", name, replay);
+    status |= check_d(ref->x, n, got->x, n);
+    printf("%s replay %d y1 : ", name, replay);
+    status |= check_d(ref->y1, n, got->y1, n);
+    printf("%s replay %d y2 : ", name, replay);
+    status |= check_d(ref->y2, n, got->y2, n);
+    printf("%s replay %d w : ", name, replay);
+    status |= check_d(ref->w, n, got->w, n);
+    printf("%s replay %d dot : ", name, replay);
+    status |= check_d(&ref->result, 1, &got->result, 1);
+    return status;
+}
+
+// every replay starts from fresh inputs, the graph reads them by address
+static int check_sequence(alphasparse_matrix_t A, const ALPHA_INT n, sequence_t sequence, const ALPHA_INT expect_stages, const char *name)
+{
+    vectors_t ref = make_vectors(n), got = make_vectors(n);
+    alphasparse_graph_t graph;
+    alpha_call_exit(alphasparse_graph_create(&graph), "alphasparse_graph_create");
+    alpha_call_exit(alphasparse_graph_begin_capture(graph), "alphasparse_graph_begin_capture");
+    sequence(graph, A, n, &got);
+    alpha_call_exit(alphasparse_graph_end_capture(graph), "alphasparse_graph_end_capture");
+
+    ALPHA_INT node_num, stage_num, region_num;
+    alpha_call_exit(alphasparse_graph_info(graph, &node_num, &stage_num, &region_num), "alphasparse_graph_info");
+    const bool shape = node_num == 4 && stage_num == expect_stages && region_num == 1;
+    printf("%s : %d nodes, %d stages, %d regions : %s\n", name, (int)node_num, (int)stage_num, (int)region_num, shape ? "correct" : "wrong");
+    int status = shape ? 0 : -1;
+
+    for (int r = 0; r < REPLAYS; r++)
+    {
+        fill_vectors(&ref, n, 10 * r + 1);
+        fill_vectors(&got, n, 10 * r + 1);
+        sequence(NULL, A, n, &ref);
+        alpha_call_exit(alphasparse_graph_execute(graph), "alphasparse_graph_execute");
+        status |= check_vectors(&ref, &got, n, name, r);
+    }
+
+    alphasparse_graph_destroy(graph);
+    release_vectors(&ref);
+    release_vectors(&got);
+    return status;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    // several row blocks per thread, rows of uneven length at the borders
+    alpha_gen_t gen;
+    ALPHA_INT n, cols;
+    ALPHA_OFFSET *rows_offset;
+    ALPHA_INT *col_index;
+    double *values;
+    alpha_call_exit(alpha_gen_parse("stencil5:70,80", 1, &gen), "alpha_gen_parse");
+    alpha_call_exit(alpha_gen_d_csr(&gen, &n, &cols, &rows_offset, &col_index, &values), "alpha_gen_d_csr");
+    alphasparse_matrix_t csr;
+    alpha_call_exit(alphasparse_d_create_csr(&csr, ALPHA_SPARSE_INDEX_BASE_ZERO, n, cols, rows_offset, rows_offset + 1, col_index, values),
+                    "alphasparse_d_create_csr");
+
+    int status = 0;
+    status |= check_sequence(csr, n, sequence_fused, 1, "mv mv axpby dot");
+    status |= check_sequence(csr, n, sequence_chained, 2, "mv on mv output");
+    status |= check_sequence(csr, n, sequence_aliased, 2, "axpby over mv input");
+
+    alphasparse_destroy(csr);
+    alpha_release(rows_offset);
+    alpha_release(col_index);
+    alpha_release(values);
+    return status;
+}
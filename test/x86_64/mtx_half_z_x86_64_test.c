@@ -0,0 +1,212 @@
+/**
+ * @brief openspblas half-stored MatrixMarket read test, symmetric and hermitian files into symv, hemv, symm and hermm
+ */
+
+// mkstemp under -std=c11
+#define _POSIX_C_SOURCE 200809L
+
+#include <alphasparse.h>
+#include <stdio.h>
+#include <unistd.h>
+#include "alphasparse/util/random.h"
+
+#define N 1500
+#define PER_ROW 12
+
+static const char *op_name(const alphasparse_operation_t op)
+{
+    return op == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE ? "n" : op == ALPHA_SPARSE_OPERATION_TRANSPOSE ? "t" : "h";
+}
+
+static int check_mv(alphasparse_matrix_t full, alphasparse_matrix_t half, const struct alpha_matrix_descr descr, const alphasparse_operation_t op, const char *name)
+{
+    struct alpha_matrix_descr general = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    const ALPHA_Complex16 alpha = {2., -1.}, beta = {.5, 1.};
+    ALPHA_Complex16 *x = alpha_memalign(sizeof(ALPHA_Complex16) * N, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y0 = alpha_memalign(sizeof(ALPHA_Complex16) * N, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y1 = alpha_memalign(sizeof(ALPHA_Complex16) * N, DEFAULT_ALIGNMENT);
+    alpha_fill_random_z(x, 1, N);
+    alpha_fill_random_z(y0, 2, N);
+    alpha_fill_random_z(y1, 2, N);
+    alpha_call_exit(alphasparse_z_mv(op, alpha, full, general, x, beta, y0), "alphasparse_z_mv");
+    alpha_call_exit(alphasparse_z_mv(op, alpha, half, descr, x, beta, y1), "alphasparse_z_mv");
+    printf("%s %s : ", name, op_name(op));
+    int status = check_z(y0, N, y1, N);
+    alpha_release(x);
+    alpha_release(y0);
+    alpha_release(y1);
+    return status;
+}
+
+static int check_mm(alphasparse_matrix_t full, alphasparse_matrix_t half, const struct alpha_matrix_descr descr, const alphasparse_layout_t layout, const char *name)
+{
+    struct alpha_matrix_descr general = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    const ALPHA_Complex16 alpha = {2., -1.}, beta = {.5, 1.};
+    const ALPHA_INT columns = 11;
+    const ALPHA_INT ld = layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR ? columns : N;
+    const size_t size = (size_t)N * columns;
+    ALPHA_Complex16 *x = alpha_memalign(sizeof(ALPHA_Complex16) * size, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y0 = alpha_memalign(sizeof(ALPHA_Complex16) * size, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y1 = alpha_memalign(sizeof(ALPHA_Complex16) * size, DEFAULT_ALIGNMENT);
+    alpha_fill_random_z(x, 1, size);
+    alpha_fill_random_z(y0, 2, size);
+    alpha_fill_random_z(y1, 2, size);
+    alpha_call_exit(alphasparse_z_mm(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, alpha, full, general, layout, x, columns, ld, beta, y0, ld), "alphasparse_z_mm");
+    alpha_call_exit(alphasparse_z_mm(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, alpha, half, descr, layout, x, columns, ld, beta, y1, ld), "alphasparse_z_mm");
+    printf("%s %s : ", name, layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR ? "row" : "col");
+    int status = check_z(y0, size, y1, size);
+    alpha_release(x);
+    alpha_release(y0);
+    alpha_release(y1);
+    return status;
+}
+
+/*
+* a symmetric or hermitian file whose entries sit in both triangles, the reader has to move
+* the upper ones down, conjugated for hermitian files. The full matrix is the reference.
+*/
+static alphasparse_matrix_t write_file(const char *path, const bool herm)
+{
+    ALPHA_Complex16 *values = alpha_malloc(sizeof(ALPHA_Complex16) * N * PER_ROW);
+    alpha_fill_random_z(values, 5, N * PER_ROW);
+    ALPHA_INT *rows = alpha_malloc(sizeof(ALPHA_INT) * N * PER_ROW * 2);
+    ALPHA_INT *cols = alpha_malloc(sizeof(ALPHA_INT) * N * PER_ROW * 2);
+    ALPHA_Complex16 *vals = alpha_malloc(sizeof(ALPHA_Complex16) * N * PER_ROW * 2);
+    ALPHA_INT lines = 0;
+    for (ALPHA_INT i = 0; i < N; i++)
+        for (ALPHA_INT j = 0; j < PER_ROW; j++)
+        {
+            const ALPHA_INT c = j == 0 ? i : (i * 3 + j * 211) % N;
+            if (c > i || (j > 0 && c == i))
+                continue;
+            const bool upper = c != i && (i + j) % 3 == 0;
+            rows[lines] = upper ? c : i;
+            cols[lines] = upper ? i : c;
+            vals[lines] = values[i * PER_ROW + j];
+            if (herm && c == i)
+                vals[lines].imag = 0.;
+            lines++;
+        }
+    FILE *fp = fopen(path, "w");
+    fprintf(fp, "%%%%MatrixMarket matrix coordinate complex %s\n%d %d %d\n", herm ? "hermitian" : "symmetric", N, N, lines);
+    for (ALPHA_INT i = 0; i < lines; i++)
+        fprintf(fp, "%d %d %.17g %.17g\n", rows[i] + 1, cols[i] + 1, vals[i].real, vals[i].imag);
+    fclose(fp);
+
+    ALPHA_INT nnz = lines;
+    for (ALPHA_INT i = 0; i < lines; i++)
+        if (rows[i] != cols[i])
+        {
+            rows[nnz] = cols[i];
+            cols[nnz] = rows[i];
+            vals[nnz].real = vals[i].real;
+            vals[nnz].imag = herm ? -vals[i].imag : vals[i].imag;
+            nnz++;
+        }
+    alphasparse_matrix_t coo, full;
+    alpha_call_exit(alphasparse_z_create_coo(&coo, ALPHA_SPARSE_INDEX_BASE_ZERO, N, N, nnz, rows, cols, vals), "alphasparse_z_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &full), "alphasparse_convert_csr");
+    alphasparse_destroy(coo);
+    alpha_release(values);
+    alpha_release(rows);
+    alpha_release(cols);
+    alpha_release(vals);
+    return full;
+}
+
+static int check_lower(const ALPHA_INT nnz, const ALPHA_INT *row_index, const ALPHA_INT *col_index, const char *name)
+{
+    ALPHA_INT upper = 0;
+    for (ALPHA_INT i = 0; i < nnz; i++)
+        upper += col_index[i] > row_index[i];
+    printf("%s lower triangle : ", name);
+    if (upper != 0)
+    {
+        printf("%d entries above the diagonal\n", upper);
+        return -1;
+    }
+    printf("correct\n");
+    return 0;
+}
+
+static int check_kind(const char *path, const bool herm)
+{
+    const char *name = herm ? "hermitian" : "symmetric";
+    alphasparse_matrix_t full = write_file(path, herm);
+    alpha_mtx_t mtx;
+    alpha_call_exit(alpha_mtx_open(path, &mtx), "alpha_mtx_open");
+    mtx.half = true;
+    const struct alpha_matrix_descr descr = alpha_mtx_descr(&mtx);
+    const ALPHA_INT64 cap = alpha_mtx_nnz_max(&mtx);
+    int status = descr.type == (herm ? ALPHA_SPARSE_MATRIX_TYPE_HERMITIAN : ALPHA_SPARSE_MATRIX_TYPE_SYMMETRIC) && descr.mode == ALPHA_SPARSE_FILL_MODE_LOWER &&
+                         cap == mtx.entries
+                     ? 0
+                     : -1;
+    printf("%s descriptor : %s\n", name, status == 0 ? "correct" : "wrong");
+
+    // the COO read through a conversion and the CSR read straight into a handle
+    ALPHA_INT *row_index = alpha_malloc(sizeof(ALPHA_INT) * cap);
+    ALPHA_INT *col_index = alpha_malloc(sizeof(ALPHA_INT) * cap);
+    ALPHA_Complex16 *values = alpha_malloc(sizeof(ALPHA_Complex16) * cap);
+    ALPHA_OFFSET *rows_offset = alpha_malloc(sizeof(ALPHA_OFFSET) * (N + 1));
+    ALPHA_INT *csr_col = alpha_malloc(sizeof(ALPHA_INT) * cap);
+    ALPHA_Complex16 *csr_values = alpha_malloc(sizeof(ALPHA_Complex16) * cap);
+    ALPHA_INT nnz;
+    alpha_call_exit(alpha_mtx_read_coo_z(&mtx, row_index, col_index, values, &nnz), "alpha_mtx_read_coo_z");
+    alpha_call_exit(alpha_mtx_read_csr_z(&mtx, rows_offset, csr_col, csr_values), "alpha_mtx_read_csr_z");
+    alpha_mtx_close(&mtx);
+    status |= check_lower(nnz, row_index, col_index, name);
+
+    alphasparse_matrix_t coo, half[2];
+    alpha_call_exit(alphasparse_z_create_coo(&coo, ALPHA_SPARSE_INDEX_BASE_ZERO, N, N, nnz, row_index, col_index, values), "alphasparse_z_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &half[0]), "alphasparse_convert_csr");
+    alpha_call_exit(alphasparse_z_create_csr(&half[1], ALPHA_SPARSE_INDEX_BASE_ZERO, N, N, rows_offset, rows_offset + 1, csr_col, csr_values), "alphasparse_z_create_csr");
+    const char *names[2][2] = {{"symv coo read", "symm coo read"}, {"symv csr read", "symm csr read"}};
+    const char *herm_names[2][2] = {{"hemv coo read", "hermm coo read"}, {"hemv csr read", "hermm csr read"}};
+    for (int h = 0; h < 2; h++)
+    {
+        const char *mv_name = herm ? herm_names[h][0] : names[h][0];
+        const char *mm_name = herm ? herm_names[h][1] : names[h][1];
+        status |= check_mv(full, half[h], descr, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, mv_name);
+        // the kernel tables hold the transpose for hermitian and the conjugate transpose for symmetric
+        status |= check_mv(full, half[h], descr, herm ? ALPHA_SPARSE_OPERATION_TRANSPOSE : ALPHA_SPARSE_OPERATION_CONJUGATE_TRANSPOSE, mv_name);
+        status |= check_mm(full, half[h], descr, ALPHA_SPARSE_LAYOUT_ROW_MAJOR, mm_name);
+        status |= check_mm(full, half[h], descr, ALPHA_SPARSE_LAYOUT_COLUMN_MAJOR, mm_name);
+    }
+
+    alphasparse_destroy(coo);
+    alphasparse_destroy(half[0]);
+    alphasparse_destroy(half[1]);
+    alphasparse_destroy(full);
+    alpha_release(row_index);
+    alpha_release(col_index);
+    alpha_release(values);
+    alpha_release(rows_offset);
+    alpha_release(csr_col);
+    alpha_release(csr_values);
+    return status;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    char path[] = "/tmp/alpha_mtx_half_XXXXXX";
+    const int fd = mkstemp(path);
+    if (fd < 0)
+    {
+        printf("no temporary file\n");
+        return -1;
+    }
+    close(fd);
+
+    int status = check_kind(path, false);
+    status |= check_kind(path, true);
+
+    remove(path);
+    return status;
+}
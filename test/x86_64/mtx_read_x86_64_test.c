@@ -0,0 +1,260 @@
+/**
+ * @brief openspblas parallel MatrixMarket reader test, every header kind into COO and CSR against alpha_read_coo
+ */
+
+// mkstemp under -std=c11
+#define _POSIX_C_SOURCE 200809L
+
+#include <alphasparse.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "alphasparse/util/random.h"
+
+// enough entry lines for every thread to get a chunk of its own
+#define N 20000
+#define PER_ROW 9
+
+typedef struct
+{
+    ALPHA_INT row;
+    ALPHA_INT col;
+    ALPHA_Complex16 v;
+} entry_t;
+
+static int entry_cmp(const void *a, const void *b)
+{
+    const entry_t *x = a, *y = b;
+    if (x->row != y->row)
+        return x->row < y->row ? -1 : 1;
+    return x->col < y->col ? -1 : x->col > y->col;
+}
+
+// entries of a read in (row, col) order, values widened to complex, real_values or complex_values may be NULL
+static entry_t *gather(const ALPHA_INT nnz, const ALPHA_INT *row_index, const ALPHA_INT *col_index, const double *real_values,
+                       const ALPHA_Complex16 *complex_values)
+{
+    entry_t *e = alpha_malloc(sizeof(entry_t) * (nnz > 0 ? nnz : 1));
+    for (ALPHA_INT i = 0; i < nnz; i++)
+    {
+        e[i].row = row_index[i];
+        e[i].col = col_index[i];
+        e[i].v.real = complex_values != NULL ? complex_values[i].real : real_values != NULL ? real_values[i] : 1.;
+        e[i].v.imag = complex_values != NULL ? complex_values[i].imag : 0.;
+    }
+    qsort(e, nnz, sizeof(entry_t), entry_cmp);
+    return e;
+}
+
+static int check_entries(const entry_t *e0, const ALPHA_INT nnz0, const entry_t *e1, const ALPHA_INT nnz1, const char *name)
+{
+    printf("%s : ", name);
+    if (nnz0 != nnz1)
+    {
+        printf("%d entries instead of %d\n", nnz1, nnz0);
+        return -1;
+    }
+    ALPHA_Complex16 *v0 = alpha_malloc(sizeof(ALPHA_Complex16) * (nnz0 > 0 ? nnz0 : 1));
+    ALPHA_Complex16 *v1 = alpha_malloc(sizeof(ALPHA_Complex16) * (nnz0 > 0 ? nnz0 : 1));
+    int status = 0;
+    for (ALPHA_INT i = 0; i < nnz0; i++)
+    {
+        if (e0[i].row != e1[i].row || e0[i].col != e1[i].col)
+            status = -1;
+        v0[i] = e0[i].v;
+        v1[i] = e1[i].v;
+    }
+    if (status != 0)
+        printf("indices differ\n");
+    else
+        status = check_z(v0, nnz0, v1, nnz0);
+    alpha_release(v0);
+    alpha_release(v1);
+    return status;
+}
+
+/*
+* a file of one header kind. Symmetric kinds store the lower triangle, skew without the
+* diagonal, hermitian with a real one. The expanded matrix goes to the returned entries.
+*/
+static entry_t *write_file(const char *path, const char *field, const char *symmetry, ALPHA_INT *nnz_p)
+{
+    const bool general = symmetry[0] == 'g', skew = symmetry[0] == 's' && symmetry[1] == 'k', herm = symmetry[0] == 'h';
+    const bool complex = field[0] == 'c', pattern = field[0] == 'p';
+    ALPHA_Complex16 *values = alpha_malloc(sizeof(ALPHA_Complex16) * N * PER_ROW);
+    alpha_fill_random_z(values, 7, N * PER_ROW);
+    entry_t *e = alpha_malloc(sizeof(entry_t) * N * PER_ROW * 2);
+    ALPHA_INT lines = 0;
+    for (ALPHA_INT i = 0; i < N; i++)
+        for (ALPHA_INT j = 0; j < PER_ROW; j++)
+        {
+            const ALPHA_INT col = (i * 7 + j * 1931 + 3) % N;
+            if (!general && (col > i || (skew && col == i)))
+                continue;
+            e[lines].row = i;
+            e[lines].col = col;
+            e[lines].v.real = pattern ? 1. : values[i * PER_ROW + j].real;
+            e[lines].v.imag = complex && !(herm && col == i) ? values[i * PER_ROW + j].imag : 0.;
+            lines++;
+        }
+    FILE *fp = fopen(path, "w");
+    fprintf(fp, "%%%%MatrixMarket matrix coordinate %s %s\n%% written by the reader test\n%d %d %d\n", field, symmetry, N, N, lines);
+    for (ALPHA_INT i = 0; i < lines; i++)
+    {
+        if (pattern)
+            fprintf(fp, "%d %d\n", e[i].row + 1, e[i].col + 1);
+        else if (complex)
+            fprintf(fp, "%d %d %.17g %.17g\n", e[i].row + 1, e[i].col + 1, e[i].v.real, e[i].v.imag);
+        else
+            fprintf(fp, "%d %d %.17g\n", e[i].row + 1, e[i].col + 1, e[i].v.real);
+    }
+    fclose(fp);
+    ALPHA_INT nnz = lines;
+    for (ALPHA_INT i = 0; i < lines && !general; i++)
+    {
+        if (e[i].row == e[i].col)
+            continue;
+        e[nnz].row = e[i].col;
+        e[nnz].col = e[i].row;
+        e[nnz].v.real = skew ? -e[i].v.real : e[i].v.real;
+        e[nnz].v.imag = skew || herm ? -e[i].v.imag : e[i].v.imag;
+        nnz++;
+    }
+    qsort(e, nnz, sizeof(entry_t), entry_cmp);
+    alpha_release(values);
+    *nnz_p = nnz;
+    return e;
+}
+
+static int check_kind(const char *path, const char *field, const char *symmetry, const alpha_mtx_field_t want_field,
+                      const alpha_mtx_symmetry_t want_symmetry, const int thread_num)
+{
+    const bool complex = field[0] == 'c', pattern = field[0] == 'p';
+    ALPHA_INT nnz;
+    entry_t *expect = write_file(path, field, symmetry, &nnz);
+    char name[96];
+    int status = 0;
+
+    // the line based reader knows real and pattern files, general or symmetric, and fills both
+    // parts of complex values with the first number; the other kinds are checked against the
+    // expansion of what was written only
+    if (!complex && (symmetry[0] == 'g' || (symmetry[0] == 's' && symmetry[1] == 'y')))
+    {
+        ALPHA_INT m, k, ref_nnz, *row_index, *col_index;
+        double *dv = NULL;
+        if (pattern)
+            alpha_read_coo_pattern(path, &m, &k, &ref_nnz, &row_index, &col_index);
+        else
+            alpha_read_coo_d(path, &m, &k, &ref_nnz, &row_index, &col_index, &dv);
+        entry_t *ref = gather(ref_nnz, row_index, col_index, dv, NULL);
+        snprintf(name, sizeof(name), "%s %s alpha_read_coo", field, symmetry);
+        status |= check_entries(expect, nnz, ref, ref_nnz, name);
+        alpha_release(ref);
+        alpha_release(row_index);
+        alpha_release(col_index);
+        alpha_release(dv);
+    }
+
+    alpha_mtx_t mtx;
+    alpha_call_exit(alpha_mtx_open(path, &mtx), "alpha_mtx_open");
+    snprintf(name, sizeof(name), "%s %s header", field, symmetry);
+    printf("%s : ", name);
+    if (mtx.rows != N || mtx.cols != N || mtx.field != want_field || mtx.symmetry != want_symmetry || alpha_mtx_nnz_max(&mtx) < nnz)
+    {
+        printf("wrong\n");
+        status = -1;
+    }
+    else
+        printf("correct\n");
+
+    const ALPHA_INT64 cap = alpha_mtx_nnz_max(&mtx);
+    ALPHA_INT *row_index = alpha_malloc(sizeof(ALPHA_INT) * cap);
+    ALPHA_INT *col_index = alpha_malloc(sizeof(ALPHA_INT) * cap);
+    ALPHA_OFFSET *rows_offset = alpha_malloc(sizeof(ALPHA_OFFSET) * (N + 1));
+    double *dv = alpha_malloc(sizeof(double) * cap);
+    ALPHA_Complex16 *zv = alpha_malloc(sizeof(ALPHA_Complex16) * cap);
+    // one chunk and one per thread
+    const int threads[2] = {1, thread_num};
+    for (int t = 0; t < 2; t++)
+    {
+        alpha_set_thread_num(threads[t]);
+        ALPHA_INT got;
+        if (complex)
+        {
+            alpha_call_exit(alpha_mtx_read_coo_z(&mtx, row_index, col_index, zv, &got), "alpha_mtx_read_coo_z");
+        }
+        else
+        {
+            alpha_call_exit(alpha_mtx_read_coo_d(&mtx, row_index, col_index, dv, &got), "alpha_mtx_read_coo_d");
+        }
+        entry_t *e = gather(got, row_index, col_index, complex ? NULL : dv, complex ? zv : NULL);
+        snprintf(name, sizeof(name), "%s %s coo %d threads", field, symmetry, threads[t]);
+        status |= check_entries(expect, nnz, e, got, name);
+        alpha_release(e);
+
+        if (complex)
+        {
+            alpha_call_exit(alpha_mtx_read_csr_z(&mtx, rows_offset, col_index, zv), "alpha_mtx_read_csr_z");
+        }
+        else
+        {
+            alpha_call_exit(alpha_mtx_read_csr_d(&mtx, rows_offset, col_index, dv), "alpha_mtx_read_csr_d");
+        }
+        got = (ALPHA_INT)rows_offset[N];
+        bool sorted = true;
+        for (ALPHA_INT r = 0; r < N; r++)
+            for (ALPHA_OFFSET ai = rows_offset[r]; ai < rows_offset[r + 1]; ai++)
+            {
+                row_index[ai] = r;
+                sorted &= ai == rows_offset[r] || col_index[ai - 1] < col_index[ai];
+            }
+        // gather sorts, so the row order the CSR read promises is checked here
+        if (!sorted)
+            printf("%s %s csr %d threads : columns not sorted\n", field, symmetry, threads[t]);
+        status |= sorted ? 0 : -1;
+        e = gather(got, row_index, col_index, complex ? NULL : dv, complex ? zv : NULL);
+        snprintf(name, sizeof(name), "%s %s csr %d threads", field, symmetry, threads[t]);
+        status |= check_entries(expect, nnz, e, got, name);
+        alpha_release(e);
+    }
+    alpha_set_thread_num(thread_num);
+
+    alpha_mtx_close(&mtx);
+    alpha_release(row_index);
+    alpha_release(col_index);
+    alpha_release(rows_offset);
+    alpha_release(dv);
+    alpha_release(zv);
+    alpha_release(expect);
+    return status;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    char path[] = "/tmp/alpha_mtx_read_XXXXXX";
+    const int fd = mkstemp(path);
+    if (fd < 0)
+    {
+        printf("no temporary file\n");
+        return -1;
+    }
+    close(fd);
+
+    int status = 0;
+    status |= check_kind(path, "real", "general", ALPHA_MTX_FIELD_REAL, ALPHA_MTX_GENERAL, thread_num);
+    status |= check_kind(path, "real", "symmetric", ALPHA_MTX_FIELD_REAL, ALPHA_MTX_SYMMETRIC, thread_num);
+    status |= check_kind(path, "real", "skew-symmetric", ALPHA_MTX_FIELD_REAL, ALPHA_MTX_SKEW_SYMMETRIC, thread_num);
+    status |= check_kind(path, "complex", "general", ALPHA_MTX_FIELD_COMPLEX, ALPHA_MTX_GENERAL, thread_num);
+    status |= check_kind(path, "complex", "hermitian", ALPHA_MTX_FIELD_COMPLEX, ALPHA_MTX_HERMITIAN, thread_num);
+    status |= check_kind(path, "pattern", "general", ALPHA_MTX_FIELD_PATTERN, ALPHA_MTX_GENERAL, thread_num);
+    status |= check_kind(path, "pattern", "symmetric", ALPHA_MTX_FIELD_PATTERN, ALPHA_MTX_SYMMETRIC, thread_num);
+
+    remove(path);
+    return status;
+}
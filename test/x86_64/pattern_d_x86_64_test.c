@@ -0,0 +1,141 @@
+/**
+ * @brief openspblas pattern-only csr/csc/coo test
+ */
+
+#include <alphasparse.h>
+#include <stdio.h>
+#include "alphasparse/util/random.h"
+
+// the valued matrix with all ones is the reference for its pattern-only copy
+
+static int check_mv(alphasparse_matrix_t valued, alphasparse_matrix_t pattern, const alphasparse_operation_t op, const ALPHA_INT m, const ALPHA_INT k, const char *name)
+{
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    const ALPHA_INT size_x = op == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE ? k : m;
+    const ALPHA_INT size_y = op == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE ? m : k;
+    double *x = alpha_memalign(sizeof(double) * size_x, DEFAULT_ALIGNMENT);
+    double *y0 = alpha_memalign(sizeof(double) * size_y, DEFAULT_ALIGNMENT);
+    double *y1 = alpha_memalign(sizeof(double) * size_y, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(x, 1, size_x);
+    alpha_fill_random_d(y0, 2, size_y);
+    alpha_fill_random_d(y1, 2, size_y);
+
+    alpha_call_exit(alphasparse_d_mv(op, 2., valued, descr, x, 3., y0), "alphasparse_d_mv");
+    alpha_call_exit(alphasparse_d_mv(op, 2., pattern, descr, x, 3., y1), "alphasparse_d_mv");
+    printf("%s : ", name);
+    int status = check_d(y0, size_y, y1, size_y);
+
+    alpha_free(x);
+    alpha_free(y0);
+    alpha_free(y1);
+    return status;
+}
+
+static int check_mm(alphasparse_matrix_t valued, alphasparse_matrix_t pattern, const alphasparse_layout_t layout, const ALPHA_INT m, const ALPHA_INT k, const char *name)
+{
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    const ALPHA_INT columns = 7;
+    const ALPHA_INT ldx = layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR ? columns : k;
+    const ALPHA_INT ldy = layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR ? columns : m;
+    const size_t size_x = (size_t)k * columns, size_y = (size_t)m * columns;
+    double *x = alpha_memalign(sizeof(double) * size_x, DEFAULT_ALIGNMENT);
+    double *y0 = alpha_memalign(sizeof(double) * size_y, DEFAULT_ALIGNMENT);
+    double *y1 = alpha_memalign(sizeof(double) * size_y, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(x, 1, size_x);
+    alpha_fill_random_d(y0, 2, size_y);
+    alpha_fill_random_d(y1, 2, size_y);
+
+    alpha_call_exit(alphasparse_d_mm(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 2., valued, descr, layout, x, columns, ldx, 3., y0, ldy), "alphasparse_d_mm");
+    alpha_call_exit(alphasparse_d_mm(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 2., pattern, descr, layout, x, columns, ldx, 3., y1, ldy), "alphasparse_d_mm");
+    printf("%s : ", name);
+    int status = check_d(y0, size_y, y1, size_y);
+
+    alpha_free(x);
+    alpha_free(y0);
+    alpha_free(y1);
+    return status;
+}
+
+// A * A^T of the valued and of the pattern-only CSR, compared through their product with a vector
+static int check_spmm(alphasparse_matrix_t valued, alphasparse_matrix_t pattern, const ALPHA_INT m)
+{
+    alphasparse_matrix_t valued_t, pattern_t, valued_c, pattern_c;
+    alpha_call_exit(alphasparse_transpose(valued, &valued_t), "alphasparse_transpose");
+    alpha_call_exit(alphasparse_transpose(pattern, &pattern_t), "alphasparse_transpose");
+    alpha_call_exit(alphasparse_spmm(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, valued, valued_t, &valued_c), "alphasparse_spmm");
+    alpha_call_exit(alphasparse_spmm(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, pattern, pattern_t, &pattern_c), "alphasparse_spmm");
+    int status = check_mv(valued_c, pattern_c, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, m, m, "spmm csr");
+    alphasparse_destroy(valued_t);
+    alphasparse_destroy(pattern_t);
+    alphasparse_destroy(valued_c);
+    alphasparse_destroy(pattern_c);
+    return status;
+}
+
+// a matrix without rows has an empty pattern
+static int check_empty(void)
+{
+    ALPHA_INT row_index[1] = {0}, col_index[1] = {0};
+    double values[1] = {1};
+    alphasparse_matrix_t cooA, csrA, patternA;
+    alpha_call_exit(alphasparse_d_create_coo(&cooA, ALPHA_SPARSE_INDEX_BASE_ZERO, 0, 0, 0, row_index, col_index, values), "alphasparse_d_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(cooA, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &csrA), "alphasparse_convert_csr");
+    alphasparse_status_t status = alphasparse_convert_pattern(csrA, &patternA);
+    alphasparse_destroy(cooA);
+    alphasparse_destroy(csrA);
+    if (status != ALPHA_SPARSE_STATUS_SUCCESS)
+    {
+        printf("empty matrix pattern failed : %d\n", status);
+        return -1;
+    }
+    alphasparse_destroy(patternA);
+    return 0;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    const char *file = args_get_data_file(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    ALPHA_INT m, k, nnz;
+    ALPHA_INT *row_index, *col_index;
+    double *values;
+    alpha_read_coo_d(file, &m, &k, &nnz, &row_index, &col_index, &values);
+    alpha_fill_d(values, 1., nnz);
+
+    alphasparse_matrix_t coo, csr, csc, pattern_coo, pattern_csr, pattern_csc;
+    alpha_call_exit(alphasparse_d_create_coo(&coo, ALPHA_SPARSE_INDEX_BASE_ZERO, m, k, nnz, row_index, col_index, values), "alphasparse_d_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &csr), "alphasparse_convert_csr");
+    alpha_call_exit(alphasparse_convert_csc(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &csc), "alphasparse_convert_csc");
+    alpha_call_exit(alphasparse_convert_pattern(coo, &pattern_coo), "alphasparse_convert_pattern");
+    alpha_call_exit(alphasparse_convert_pattern(csr, &pattern_csr), "alphasparse_convert_pattern");
+    alpha_call_exit(alphasparse_convert_pattern(csc, &pattern_csc), "alphasparse_convert_pattern");
+
+    int status = check_empty();
+    status |= check_mv(coo, pattern_coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, m, k, "mv coo");
+    status |= check_mv(coo, pattern_coo, ALPHA_SPARSE_OPERATION_TRANSPOSE, m, k, "mv coo trans");
+    status |= check_mv(csr, pattern_csr, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, m, k, "mv csr");
+    status |= check_mv(csr, pattern_csr, ALPHA_SPARSE_OPERATION_TRANSPOSE, m, k, "mv csr trans");
+    status |= check_mv(csc, pattern_csc, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, m, k, "mv csc");
+    status |= check_mv(csc, pattern_csc, ALPHA_SPARSE_OPERATION_TRANSPOSE, m, k, "mv csc trans");
+    status |= check_mm(csr, pattern_csr, ALPHA_SPARSE_LAYOUT_ROW_MAJOR, m, k, "mm csr row");
+    status |= check_mm(csr, pattern_csr, ALPHA_SPARSE_LAYOUT_COLUMN_MAJOR, m, k, "mm csr col");
+    status |= check_mm(csc, pattern_csc, ALPHA_SPARSE_LAYOUT_ROW_MAJOR, m, k, "mm csc row");
+    status |= check_mm(csc, pattern_csc, ALPHA_SPARSE_LAYOUT_COLUMN_MAJOR, m, k, "mm csc col");
+    status |= check_spmm(csr, pattern_csr, m);
+
+    alphasparse_destroy(coo);
+    alphasparse_destroy(csr);
+    alphasparse_destroy(csc);
+    alphasparse_destroy(pattern_coo);
+    alphasparse_destroy(pattern_csr);
+    alphasparse_destroy(pattern_csc);
+    alpha_free(row_index);
+    alpha_free(col_index);
+    alpha_free(values);
+    return status;
+}
@@ -0,0 +1,191 @@
+/**
+ * @brief openspblas reordering test, valid permutations, mv on the reordered matrix and the band RCM recovers
+ */
+
+#include <alphasparse.h>
+#include <alphasparse/spmat.h>
+#include <stdio.h>
+#include <string.h>
+#include "alphasparse/util/random.h"
+
+static const char *ordering_name(const alphasparse_reorder_t ordering)
+{
+    return ordering == ALPHA_SPARSE_REORDER_RCM ? "rcm" : ordering == ALPHA_SPARSE_REORDER_DEGREE ? "degree" : "gorder";
+}
+
+static alphasparse_matrix_t generate(const char *spec, ALPHA_OFFSET **rows_offset, ALPHA_INT **col_index, double **values)
+{
+    alpha_gen_t gen;
+    ALPHA_INT rows, cols;
+    alpha_call_exit(alpha_gen_parse(spec, 5, &gen), "alpha_gen_parse");
+    alpha_call_exit(alpha_gen_d_csr(&gen, &rows, &cols, rows_offset, col_index, values), "alpha_gen_d_csr");
+    alphasparse_matrix_t A;
+    alpha_call_exit(alphasparse_d_create_csr(&A, ALPHA_SPARSE_INDEX_BASE_ZERO, rows, cols, *rows_offset, *rows_offset + 1, *col_index, *values),
+                    "alphasparse_d_create_csr");
+    return A;
+}
+
+// largest |row - col| over the entries
+static ALPHA_INT bandwidth(const alphasparse_matrix_t A)
+{
+    const spmat_csr_d_t *mat = A->mat;
+    ALPHA_INT band = 0;
+    for (ALPHA_INT r = 0; r < mat->rows; r++)
+        for (ALPHA_OFFSET ai = mat->rows_start[r]; ai < mat->rows_end[r]; ai++)
+        {
+            const ALPHA_INT d = r > mat->col_indx[ai] ? r - mat->col_indx[ai] : mat->col_indx[ai] - r;
+            if (d > band)
+                band = d;
+        }
+    return band;
+}
+
+// every index once, and iperm undoes perm
+static bool inverse_permutations(const ALPHA_INT n, const ALPHA_INT *perm, const ALPHA_INT *iperm)
+{
+    bool *seen = alpha_malloc(sizeof(bool) * n);
+    memset(seen, 0, sizeof(bool) * n);
+    bool valid = true;
+    for (ALPHA_INT i = 0; i < n && valid; i++)
+    {
+        valid = perm[i] >= 0 && perm[i] < n && !seen[perm[i]] && iperm[perm[i]] == i;
+        if (valid)
+            seen[perm[i]] = true;
+    }
+    alpha_release(seen);
+    return valid;
+}
+
+/*
+* B = P A P^T when symmetric, P A otherwise, so B (P x) = P (A x), or B x = P (A x),
+* and the inverse gather of B's result gives A x back
+*/
+static int check_ordering(alphasparse_matrix_t A, const alphasparse_reorder_t ordering, const bool symmetric, const char *spec)
+{
+    const spmat_csr_d_t *mat = A->mat;
+    const ALPHA_INT n = mat->rows;
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    ALPHA_INT *perm = alpha_malloc(sizeof(ALPHA_INT) * n);
+    ALPHA_INT *iperm = alpha_malloc(sizeof(ALPHA_INT) * n);
+    double *x = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    double *px = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    double *y = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    double *py = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    double *pz = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    double *z = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(x, 1, n);
+
+    alphasparse_matrix_t B;
+    alpha_call_exit(alphasparse_reorder(A, ordering, symmetric, perm, iperm, &B), "alphasparse_reorder");
+    const bool valid = inverse_permutations(n, perm, iperm);
+    printf("%s %s %s permutations : %s\n", spec, ordering_name(ordering), symmetric ? "symmetric" : "rows", valid ? "correct" : "wrong");
+    int status = valid ? 0 : -1;
+
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 1., A, descr, x, 0., y), "alphasparse_d_mv");
+    alpha_call_exit(alphasparse_d_gthr(n, y, py, perm), "alphasparse_d_gthr");
+    if (symmetric)
+    {
+        alpha_call_exit(alphasparse_d_gthr(n, x, px, perm), "alphasparse_d_gthr");
+    }
+    else
+        memcpy(px, x, sizeof(double) * n);
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 1., B, descr, px, 0., pz), "alphasparse_d_mv");
+    printf("%s %s %s reordered mv : ", spec, ordering_name(ordering), symmetric ? "symmetric" : "rows");
+    status |= check_d(py, n, pz, n);
+    alpha_call_exit(alphasparse_d_gthr(n, pz, z, iperm), "alphasparse_d_gthr");
+    printf("%s %s %s mv gathered back : ", spec, ordering_name(ordering), symmetric ? "symmetric" : "rows");
+    status |= check_d(y, n, z, n);
+
+    // the ordering alone is the same one
+    ALPHA_INT *again = alpha_malloc(sizeof(ALPHA_INT) * n);
+    alpha_call_exit(alphasparse_reorder(A, ordering, symmetric, again, NULL, NULL), "alphasparse_reorder");
+    const bool same = memcmp(perm, again, sizeof(ALPHA_INT) * n) == 0;
+    printf("%s %s %s ordering without B : %s\n", spec, ordering_name(ordering), symmetric ? "symmetric" : "rows", same ? "correct" : "wrong");
+    status |= same ? 0 : -1;
+
+    alphasparse_destroy(B);
+    alpha_release(again);
+    alpha_release(perm);
+    alpha_release(iperm);
+    alpha_release(x);
+    alpha_release(px);
+    alpha_release(y);
+    alpha_release(py);
+    alpha_release(pz);
+    alpha_release(z);
+    return status;
+}
+
+// a band matrix with its rows and columns shuffled, RCM narrows it back to about the band
+static int check_band(void)
+{
+    ALPHA_OFFSET *rows_offset;
+    ALPHA_INT *col_index;
+    double *values;
+    alphasparse_matrix_t band = generate("banded:4000,6", &rows_offset, &col_index, &values);
+    const ALPHA_INT n = ((spmat_csr_d_t *)band->mat)->rows;
+    ALPHA_INT *shuffle = alpha_malloc(sizeof(ALPHA_INT) * n);
+    ALPHA_INT *perm = alpha_malloc(sizeof(ALPHA_INT) * n);
+    for (ALPHA_INT i = 0; i < n; i++)
+        shuffle[i] = i;
+    uint64_t state = 12345;
+    for (ALPHA_INT i = n - 1; i > 0; i--)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        const ALPHA_INT j = (ALPHA_INT)((state >> 33) % (uint64_t)(i + 1));
+        const ALPHA_INT t = shuffle[i];
+        shuffle[i] = shuffle[j];
+        shuffle[j] = t;
+    }
+    alphasparse_matrix_t shuffled, B;
+    alpha_call_exit(alphasparse_permute(band, shuffle, shuffle, &shuffled), "alphasparse_permute");
+    alpha_call_exit(alphasparse_reorder(shuffled, ALPHA_SPARSE_REORDER_RCM, true, perm, NULL, &B), "alphasparse_reorder");
+
+    const ALPHA_INT original = bandwidth(band), scattered = bandwidth(shuffled), recovered = bandwidth(B);
+    const bool narrow = recovered <= 2 * original && recovered < scattered;
+    printf("rcm bandwidth %d shuffled to %d, reordered %d : %s\n", (int)original, (int)scattered, (int)recovered, narrow ? "correct" : "wrong");
+    int status = narrow ? 0 : -1;
+    status |= check_ordering(shuffled, ALPHA_SPARSE_REORDER_RCM, true, "shuffled band");
+
+    alphasparse_destroy(band);
+    alphasparse_destroy(shuffled);
+    alphasparse_destroy(B);
+    alpha_release(shuffle);
+    alpha_release(perm);
+    alpha_release(rows_offset);
+    alpha_release(col_index);
+    alpha_release(values);
+    return status;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    // a mesh and a power-law graph, neither pattern symmetric in its values
+    const char *specs[2] = {"fem:23,19,2", "rmat:11,6"};
+    const alphasparse_reorder_t orderings[3] = {ALPHA_SPARSE_REORDER_RCM, ALPHA_SPARSE_REORDER_DEGREE, ALPHA_SPARSE_REORDER_GORDER};
+    int status = 0;
+    for (int s = 0; s < 2; s++)
+    {
+        ALPHA_OFFSET *rows_offset;
+        ALPHA_INT *col_index;
+        double *values;
+        alphasparse_matrix_t A = generate(specs[s], &rows_offset, &col_index, &values);
+        for (int o = 0; o < 3; o++)
+        {
+            status |= check_ordering(A, orderings[o], true, specs[s]);
+            status |= check_ordering(A, orderings[o], false, specs[s]);
+        }
+        alphasparse_destroy(A);
+        alpha_release(rows_offset);
+        alpha_release(col_index);
+        alpha_release(values);
+    }
+    status |= check_band();
+    return status;
+}
@@ -0,0 +1,226 @@
+/**
+ * @brief openspblas save and load test, round trips of csr, pattern csr and bsr and rejected files
+ */
+
+// mkstemp under -std=c11
+#define _POSIX_C_SOURCE 200809L
+
+#include <alphasparse.h>
+#include <alphasparse/binary.h>
+#include <alphasparse/inspector.h>
+#include <alphasparse/spmat.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "alphasparse/util/random.h"
+
+#define N 1200
+#define PER_ROW 7
+
+static int check_mv(alphasparse_matrix_t A, alphasparse_matrix_t B, const ALPHA_INT m, const ALPHA_INT k, const char *name)
+{
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    double *x = alpha_memalign(sizeof(double) * k, DEFAULT_ALIGNMENT);
+    double *y0 = alpha_memalign(sizeof(double) * m, DEFAULT_ALIGNMENT);
+    double *y1 = alpha_memalign(sizeof(double) * m, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(x, 1, k);
+    alpha_fill_random_d(y0, 2, m);
+    alpha_fill_random_d(y1, 2, m);
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 2., A, descr, x, .5, y0), "alphasparse_d_mv");
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 2., B, descr, x, .5, y1), "alphasparse_d_mv");
+    printf("%s : ", name);
+    int status = check_d(y0, m, y1, m);
+    alpha_release(x);
+    alpha_release(y0);
+    alpha_release(y1);
+    return status;
+}
+
+static int check_status(const alphasparse_status_t got, const alphasparse_status_t expect, const char *name)
+{
+    printf("%s : ", name);
+    if (got != expect)
+    {
+        printf("status %d instead of %d\n", got, expect);
+        return -1;
+    }
+    printf("correct\n");
+    return 0;
+}
+
+static alphasparse_matrix_t round_trip(alphasparse_matrix_t A, const char *path)
+{
+    alphasparse_matrix_t B;
+    alpha_call_exit(alphasparse_save(A, path), "alphasparse_save");
+    alpha_call_exit(alphasparse_load(path, &B), "alphasparse_load");
+    return B;
+}
+
+static void write_bytes(const char *path, const char *bytes, const size_t size)
+{
+    FILE *fp = fopen(path, "wb");
+    fwrite(bytes, 1, size, fp);
+    fclose(fp);
+}
+
+// a saved file with one thing wrong at a time, load_check_header or the section checks turn each down
+static int check_rejected(const char *saved, const char *path)
+{
+    FILE *fp = fopen(saved, "rb");
+    fseek(fp, 0, SEEK_END);
+    const size_t size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *bytes = alpha_malloc(size + 1);
+    char *copy = alpha_malloc(size + 1);
+    size_t got = fread(bytes, 1, size, fp);
+    fclose(fp);
+    alpha_binary_header_t *header = (alpha_binary_header_t *)copy;
+    alphasparse_matrix_t A;
+    int status = got == size ? 0 : -1;
+
+    write_bytes(path, bytes, size / 2);
+    status |= check_status(alphasparse_load(path, &A), ALPHA_SPARSE_STATUS_INVALID_VALUE, "load truncated");
+    write_bytes(path, bytes, sizeof(alpha_binary_header_t) / 2);
+    status |= check_status(alphasparse_load(path, &A), ALPHA_SPARSE_STATUS_INVALID_VALUE, "load shorter than the header");
+    memcpy(copy, bytes, size);
+    copy[size] = 0;
+    write_bytes(path, copy, size + 1);
+    status |= check_status(alphasparse_load(path, &A), ALPHA_SPARSE_STATUS_INVALID_VALUE, "load with trailing bytes");
+
+    memcpy(copy, bytes, size);
+    header->magic[3] ^= 1;
+    write_bytes(path, copy, size);
+    status |= check_status(alphasparse_load(path, &A), ALPHA_SPARSE_STATUS_INVALID_VALUE, "load bad magic");
+    memcpy(copy, bytes, size);
+    header->version = ALPHA_BINARY_VERSION + 1;
+    write_bytes(path, copy, size);
+    status |= check_status(alphasparse_load(path, &A), ALPHA_SPARSE_STATUS_NOT_SUPPORTED, "load newer version");
+    memcpy(copy, bytes, size);
+    header->endian = 0x04030201u;
+    write_bytes(path, copy, size);
+    status |= check_status(alphasparse_load(path, &A), ALPHA_SPARSE_STATUS_NOT_SUPPORTED, "load other byte order");
+    memcpy(copy, bytes, size);
+    header->offset_size = sizeof(ALPHA_OFFSET) == 8 ? 4 : 8;
+    write_bytes(path, copy, size);
+    status |= check_status(alphasparse_load(path, &A), ALPHA_SPARSE_STATUS_NOT_SUPPORTED, "load other offset width");
+    memcpy(copy, bytes, size);
+    header->rows = -1;
+    write_bytes(path, copy, size);
+    status |= check_status(alphasparse_load(path, &A), ALPHA_SPARSE_STATUS_INVALID_VALUE, "load negative rows");
+    memcpy(copy, bytes, size);
+    header->section[ALPHA_BINARY_SECTION_COL_INDX] = size - ALPHA_BINARY_ALIGNMENT;
+    write_bytes(path, copy, size);
+    status |= check_status(alphasparse_load(path, &A), ALPHA_SPARSE_STATUS_INVALID_VALUE, "load section past the end");
+    memcpy(copy, bytes, size);
+    header->nnz += 1;
+    write_bytes(path, copy, size);
+    status |= check_status(alphasparse_load(path, &A), ALPHA_SPARSE_STATUS_INVALID_VALUE, "load wrong nnz");
+
+    alpha_release(bytes);
+    alpha_release(copy);
+    return status;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    char path[] = "/tmp/alpha_save_XXXXXX", bad[] = "/tmp/alpha_save_bad_XXXXXX";
+    int fd = mkstemp(path), fd_bad = mkstemp(bad);
+    if (fd < 0 || fd_bad < 0)
+    {
+        printf("no temporary file\n");
+        return -1;
+    }
+    close(fd);
+    close(fd_bad);
+
+    // PER_ROW distinct columns in every row, a few rows left empty
+    const ALPHA_INT cap = N * PER_ROW;
+    ALPHA_INT *row_index = alpha_malloc(sizeof(ALPHA_INT) * cap);
+    ALPHA_INT *col_index = alpha_malloc(sizeof(ALPHA_INT) * cap);
+    double *values = alpha_memalign(sizeof(double) * cap, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(values, 3, cap);
+    ALPHA_INT nnz = 0;
+    for (ALPHA_INT i = 0; i < N; i++)
+        for (ALPHA_INT j = 0; j < PER_ROW && i % 13 != 4; j++)
+        {
+            row_index[nnz] = i;
+            col_index[nnz++] = (i * 5 + j * 163) % N;
+        }
+
+    alphasparse_matrix_t coo, csr, pattern, bsr, loaded;
+    alpha_call_exit(alphasparse_d_create_coo(&coo, ALPHA_SPARSE_INDEX_BASE_ZERO, N, N, nnz, row_index, col_index, values), "alphasparse_d_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &csr), "alphasparse_convert_csr");
+    alpha_call_exit(alphasparse_convert_bsr(coo, 3, ALPHA_SPARSE_LAYOUT_ROW_MAJOR, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &bsr), "alphasparse_convert_bsr");
+    const spmat_csr_d_t *mat = csr->mat;
+    alpha_call_exit(alphasparse_d_create_csr_pattern(&pattern, ALPHA_SPARSE_INDEX_BASE_ZERO, N, N, mat->rows_start, mat->rows_end, mat->col_indx),
+                    "alphasparse_d_create_csr_pattern");
+
+    // an indexed update builds the value index, the save carries it along
+    const ALPHA_INT nvalues = nnz / 4;
+    ALPHA_INT *indx = alpha_malloc(sizeof(ALPHA_INT) * nvalues);
+    ALPHA_INT *indy = alpha_malloc(sizeof(ALPHA_INT) * nvalues);
+    double *new_values = alpha_memalign(sizeof(double) * nvalues, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(new_values, 4, nvalues);
+    for (ALPHA_INT i = 0; i < nvalues; i++)
+    {
+        indx[i] = row_index[i * 4];
+        indy[i] = col_index[i * 4];
+    }
+    alpha_call_exit(alphasparse_d_update_values(csr, nvalues, indx, indy, new_values), "alphasparse_d_update_values");
+
+    loaded = round_trip(csr, path);
+    int status = check_mv(csr, loaded, N, N, "csr round trip");
+    alphasparse_inspector_t inspector = loaded->inspector;
+    const alpha_value_index_t *index = inspector->value_index;
+    printf("csr value index : %s\n", index != NULL && inspector->value_index_mapped ? "mapped" : "missing");
+    status |= index != NULL && inspector->value_index_mapped ? 0 : -1;
+    double *saved = alpha_memalign(sizeof(double) * nnz, DEFAULT_ALIGNMENT);
+    memcpy(saved, mat->values, sizeof(double) * nnz);
+    // the next update goes through the mapped index instead of building one
+    alpha_fill_random_d(new_values, 5, nvalues);
+    alpha_call_exit(alphasparse_d_update_values(csr, nvalues, indx, indy, new_values), "alphasparse_d_update_values");
+    alpha_call_exit(alphasparse_d_update_values(loaded, nvalues, indx, indy, new_values), "alphasparse_d_update_values");
+    printf("csr value index reused : %s\n", inspector->value_index == index ? "yes" : "no");
+    status |= inspector->value_index == index ? 0 : -1;
+    status |= check_mv(csr, loaded, N, N, "csr update after load");
+    alphasparse_destroy(loaded);
+    // the mapping is private, the file still holds the values of the save
+    alpha_call_exit(alphasparse_load(path, &loaded), "alphasparse_load");
+    printf("csr file untouched : ");
+    status |= check_d(saved, nnz, ((spmat_csr_d_t *)loaded->mat)->values, nnz);
+    alphasparse_destroy(loaded);
+    alpha_release(saved);
+
+    loaded = round_trip(pattern, path);
+    printf("pattern format : %s\n", loaded->format == ALPHA_SPARSE_FORMAT_CSR_PATTERN ? "kept" : "lost");
+    status |= loaded->format == ALPHA_SPARSE_FORMAT_CSR_PATTERN ? 0 : -1;
+    status |= check_mv(pattern, loaded, N, N, "pattern csr round trip");
+    alphasparse_destroy(loaded);
+
+    loaded = round_trip(bsr, path);
+    status |= check_mv(bsr, loaded, (N + 2) / 3 * 3, (N + 2) / 3 * 3, "bsr round trip");
+    alphasparse_destroy(loaded);
+
+    alpha_call_exit(alphasparse_save(csr, path), "alphasparse_save");
+    status |= check_rejected(path, bad);
+
+    remove(path);
+    remove(bad);
+    alpha_release(indx);
+    alpha_release(indy);
+    alpha_release(new_values);
+    alphasparse_destroy(coo);
+    alphasparse_destroy(csr);
+    alphasparse_destroy(pattern);
+    alphasparse_destroy(bsr);
+    alpha_release(row_index);
+    alpha_release(col_index);
+    alpha_release(values);
+    return status;
+}
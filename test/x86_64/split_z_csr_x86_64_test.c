@@ -0,0 +1,175 @@
+/**
+ * @brief openspblas split complex values test, kernels on split values against the interleaved ones
+ */
+
+#include <alphasparse.h>
+#include <alphasparse/inspector.h>
+#include <stdio.h>
+#include "alphasparse/util/random.h"
+
+#define N 2000
+#define PER_ROW 8
+
+static const char *op_name(const alphasparse_operation_t op)
+{
+    return op == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE ? "n" : op == ALPHA_SPARSE_OPERATION_TRANSPOSE ? "t" : "h";
+}
+
+static int check_mv(alphasparse_matrix_t inter, alphasparse_matrix_t split, const alphasparse_operation_t op, const struct alpha_matrix_descr descr, const char *name)
+{
+    const ALPHA_Complex16 alpha = {2., -1.}, beta = {.5, 1.};
+    ALPHA_Complex16 *x = alpha_memalign(sizeof(ALPHA_Complex16) * N, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y0 = alpha_memalign(sizeof(ALPHA_Complex16) * N, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y1 = alpha_memalign(sizeof(ALPHA_Complex16) * N, DEFAULT_ALIGNMENT);
+    alpha_fill_random_z(x, 1, N);
+    alpha_fill_random_z(y0, 2, N);
+    alpha_fill_random_z(y1, 2, N);
+    alpha_call_exit(alphasparse_z_mv(op, alpha, inter, descr, x, beta, y0), "alphasparse_z_mv");
+    alpha_call_exit(alphasparse_z_mv(op, alpha, split, descr, x, beta, y1), "alphasparse_z_mv");
+    printf("%s %s : ", name, op_name(op));
+    int status = check_z(y0, N, y1, N);
+    alpha_free(x);
+    alpha_free(y0);
+    alpha_free(y1);
+    return status;
+}
+
+// y comes in as NaN, the split solve must not read entries it has not solved yet
+static int check_trsv(alphasparse_matrix_t inter, alphasparse_matrix_t split, const alphasparse_operation_t op, const struct alpha_matrix_descr descr, const char *name)
+{
+    const ALPHA_Complex16 alpha = {2., -1.}, nan = {0. / 0., 0. / 0.};
+    ALPHA_Complex16 *x = alpha_memalign(sizeof(ALPHA_Complex16) * N, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y0 = alpha_memalign(sizeof(ALPHA_Complex16) * N, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y1 = alpha_memalign(sizeof(ALPHA_Complex16) * N, DEFAULT_ALIGNMENT);
+    alpha_fill_random_z(x, 1, N);
+    alpha_fill_z(y0, nan, N);
+    alpha_fill_z(y1, nan, N);
+    alpha_call_exit(alphasparse_z_trsv(op, alpha, inter, descr, x, y0), "alphasparse_z_trsv");
+    alpha_call_exit(alphasparse_z_trsv(op, alpha, split, descr, x, y1), "alphasparse_z_trsv");
+    printf("%s %s : ", name, op_name(op));
+    int status = check_z(y0, N, y1, N);
+    alpha_free(x);
+    alpha_free(y0);
+    alpha_free(y1);
+    return status;
+}
+
+static int check_mm(alphasparse_matrix_t inter, alphasparse_matrix_t split, const alphasparse_operation_t op, const alphasparse_layout_t layout, const char *name)
+{
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    const ALPHA_Complex16 alpha = {2., -1.}, beta = {.5, 1.};
+    const ALPHA_INT columns = 13;
+    const ALPHA_INT ld = layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR ? columns : N;
+    const size_t size = (size_t)N * columns;
+    ALPHA_Complex16 *x = alpha_memalign(sizeof(ALPHA_Complex16) * size, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y0 = alpha_memalign(sizeof(ALPHA_Complex16) * size, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y1 = alpha_memalign(sizeof(ALPHA_Complex16) * size, DEFAULT_ALIGNMENT);
+    alpha_fill_random_z(x, 1, size);
+    alpha_fill_random_z(y0, 2, size);
+    alpha_fill_random_z(y1, 2, size);
+    alpha_call_exit(alphasparse_z_mm(op, alpha, inter, descr, layout, x, columns, ld, beta, y0, ld), "alphasparse_z_mm");
+    alpha_call_exit(alphasparse_z_mm(op, alpha, split, descr, layout, x, columns, ld, beta, y1, ld), "alphasparse_z_mm");
+    printf("%s %s : ", name, op_name(op));
+    int status = check_z(y0, size, y1, size);
+    alpha_free(x);
+    alpha_free(y0);
+    alpha_free(y1);
+    return status;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    // a strong diagonal and PER_ROW distinct columns on either side of it in every row
+    const ALPHA_INT nnz = N * (PER_ROW + 1);
+    ALPHA_INT *row_index = alpha_malloc(sizeof(ALPHA_INT) * nnz);
+    ALPHA_INT *col_index = alpha_malloc(sizeof(ALPHA_INT) * nnz);
+    ALPHA_Complex16 *values = alpha_memalign(sizeof(ALPHA_Complex16) * nnz, DEFAULT_ALIGNMENT);
+    alpha_fill_random_z(values, 3, nnz);
+    for (ALPHA_INT i = 0; i < N; i++)
+    {
+        ALPHA_INT *rows = row_index + (size_t)i * (PER_ROW + 1), *cols = col_index + (size_t)i * (PER_ROW + 1);
+        for (ALPHA_INT j = 0; j < PER_ROW; j++)
+        {
+            rows[j] = i;
+            cols[j] = (i + 1 + j * 251) % N;
+        }
+        rows[PER_ROW] = cols[PER_ROW] = i;
+        values[(size_t)i * (PER_ROW + 1) + PER_ROW].real += 10.;
+    }
+
+    alphasparse_matrix_t coo, inter, split;
+    alpha_call_exit(alphasparse_z_create_coo(&coo, ALPHA_SPARSE_INDEX_BASE_ZERO, N, N, nnz, row_index, col_index, values), "alphasparse_z_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &inter), "alphasparse_convert_csr");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &split), "alphasparse_convert_csr");
+    alpha_call_exit(alphasparse_set_complex_layout_hint(split, ALPHA_SPARSE_COMPLEX_SPLIT), "alphasparse_set_complex_layout_hint");
+    alpha_call_exit(alphasparse_optimize(split), "alphasparse_optimize");
+
+    const alphasparse_operation_t ops[3] = {ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, ALPHA_SPARSE_OPERATION_TRANSPOSE, ALPHA_SPARSE_OPERATION_CONJUGATE_TRANSPOSE};
+    const alphasparse_fill_mode_t fills[2] = {ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_FILL_MODE_UPPER};
+    const alphasparse_diag_type_t diags[2] = {ALPHA_SPARSE_DIAG_NON_UNIT, ALPHA_SPARSE_DIAG_UNIT};
+    const char *fill_diag[2][2] = {{"lo n", "lo u"}, {"hi n", "hi u"}};
+    char name[32];
+    int status = alpha_matrix_split_values(split) != NULL ? 0 : -1;
+    printf("split values : %s\n", status == 0 ? "built" : "missing");
+    for (int o = 0; o < 3; o++)
+    {
+        struct alpha_matrix_descr general = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+        status |= check_mv(inter, split, ops[o], general, "gemv split");
+        status |= check_mm(inter, split, ops[o], ALPHA_SPARSE_LAYOUT_ROW_MAJOR, "gemm split row");
+        status |= check_mm(inter, split, ops[o], ALPHA_SPARSE_LAYOUT_COLUMN_MAJOR, "gemm split col");
+        for (int f = 0; f < 2; f++)
+            for (int d = 0; d < 2; d++)
+            {
+                struct alpha_matrix_descr herm = {ALPHA_SPARSE_MATRIX_TYPE_HERMITIAN, fills[f], diags[d]};
+                struct alpha_matrix_descr tri = {ALPHA_SPARSE_MATRIX_TYPE_TRIANGULAR, fills[f], diags[d]};
+                if (o < 2)
+                {
+                    snprintf(name, sizeof(name), "hermv split %s", fill_diag[f][d]);
+                    status |= check_mv(inter, split, ops[o], herm, name);
+                }
+                snprintf(name, sizeof(name), "trsv split %s", fill_diag[f][d]);
+                status |= check_trsv(inter, split, ops[o], tri, name);
+            }
+    }
+
+
+    // changed values are copied into the split parts right away, the kernels keep using them
+    const ALPHA_INT nvalues = nnz / 3;
+    ALPHA_INT *indx = alpha_malloc(sizeof(ALPHA_INT) * nvalues);
+    ALPHA_INT *indy = alpha_malloc(sizeof(ALPHA_INT) * nvalues);
+    ALPHA_Complex16 *new_values = alpha_memalign(sizeof(ALPHA_Complex16) * nvalues, DEFAULT_ALIGNMENT);
+    alpha_fill_random_z(new_values, 4, nvalues);
+    for (ALPHA_INT i = 0; i < nvalues; i++)
+    {
+        indx[i] = row_index[i * 3];
+        indy[i] = col_index[i * 3];
+    }
+    alpha_call_exit(alphasparse_z_update_values(inter, nvalues, indx, indy, new_values), "alphasparse_z_update_values");
+    alpha_call_exit(alphasparse_z_update_values(split, nvalues, indx, indy, new_values), "alphasparse_z_update_values");
+    const ALPHA_Complex16 one = {1., 0.};
+    alpha_call_exit(alphasparse_z_set_value(inter, 0, 0, one), "alphasparse_z_set_value");
+    alpha_call_exit(alphasparse_z_set_value(split, 0, 0, one), "alphasparse_z_set_value");
+    const bool kept = alpha_matrix_split_values(split) != NULL;
+    printf("split values after update : %s\n", kept ? "kept" : "stale");
+    status |= kept ? 0 : -1;
+    struct alpha_matrix_descr general = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    status |= check_mv(inter, split, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, general, "gemv split after update");
+    status |= check_mm(inter, split, ALPHA_SPARSE_OPERATION_TRANSPOSE, ALPHA_SPARSE_LAYOUT_ROW_MAJOR, "gemm split row after update");
+    alpha_release(indx);
+    alpha_release(indy);
+    alpha_release(new_values);
+
+    alphasparse_destroy(coo);
+    alphasparse_destroy(inter);
+    alphasparse_destroy(split);
+    alpha_free(row_index);
+    alpha_free(col_index);
+    alpha_free(values);
+    return status;
+}
@@ -0,0 +1,111 @@
+/**
+ * @brief openspblas sparse matrix times sparse vector test, push and pull of spmspv and semiring spmspv against mv
+ */
+
+#include <alphasparse.h>
+#include <stdio.h>
+#include "alphasparse/util/random.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// y of a call scattered into zeros is the dense product, so is that of PLUS_TIMES without alpha
+static alphasparse_status_t call_spmspv(alphasparse_matrix_t A, const alphasparse_operation_t op, const alphasparse_spmspv_alg_t alg,
+                                        const int semiring, alphasparse_spvec_t x, alphasparse_spvec_t *y)
+{
+    if (semiring)
+        return alphasparse_d_semiring_spmspv(ALPHA_SPARSE_SEMIRING_PLUS_TIMES, op, A, x, alg, y);
+    return alphasparse_d_spmspv(op, 1., A, x, alg, y);
+}
+
+// every 7th entry of x is set
+static int check_spmspv(alphasparse_matrix_t A, const alphasparse_operation_t op, const alphasparse_spmspv_alg_t alg,
+                        const ALPHA_INT m, const ALPHA_INT k, const int semiring, const int nested, const char *name)
+{
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    const ALPHA_INT size_x = op == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE ? k : m;
+    const ALPHA_INT size_y = op == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE ? m : k;
+    const ALPHA_INT nz = (size_x + 6) / 7;
+    ALPHA_INT *indx = alpha_malloc(sizeof(ALPHA_INT) * nz);
+    double *values = alpha_memalign(sizeof(double) * nz, DEFAULT_ALIGNMENT);
+    double *x = alpha_memalign(sizeof(double) * size_x, DEFAULT_ALIGNMENT);
+    double *y0 = alpha_memalign(sizeof(double) * size_y, DEFAULT_ALIGNMENT);
+    double *y1 = alpha_memalign(sizeof(double) * size_y, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(values, 1, nz);
+    alpha_fill_d(x, 0., size_x);
+    alpha_fill_d(y1, 0., size_y);
+    for (ALPHA_INT i = 0; i < nz; i++)
+    {
+        indx[i] = i * 7;
+        x[indx[i]] = values[i];
+    }
+    alphasparse_spvec_t sx, sy = NULL;
+    alpha_call_exit(alphasparse_create_spvec(&sx, ALPHA_SPARSE_DATATYPE_DOUBLE, ALPHA_SPARSE_INDEX_BASE_ZERO, size_x, nz, indx, values), "alphasparse_create_spvec");
+    alpha_call_exit(alphasparse_d_mv(op, 1., A, descr, x, 0., y0), "alphasparse_d_mv");
+
+    alphasparse_status_t call = ALPHA_SPARSE_STATUS_SUCCESS;
+    if (nested)
+    {
+        // called from inside a parallel region every region of the call gets a team of one
+#ifdef _OPENMP
+#pragma omp parallel num_threads(2)
+#pragma omp single
+#endif
+        call = call_spmspv(A, op, alg, semiring, sx, &sy);
+    }
+    else
+        call = call_spmspv(A, op, alg, semiring, sx, &sy);
+    alpha_call_exit(call, "call_spmspv");
+    alpha_call_exit(alphasparse_scatter(sy, y1), "alphasparse_scatter");
+    printf("%s%s : ", semiring ? "semiring " : "", name);
+    int ret = check_d(y0, size_y, y1, size_y);
+
+    alphasparse_destroy_spvec(sx);
+    alphasparse_destroy_spvec(sy);
+    alpha_free(indx);
+    alpha_free(values);
+    alpha_free(x);
+    alpha_free(y0);
+    alpha_free(y1);
+    return ret;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    const char *file = args_get_data_file(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+#ifdef _OPENMP
+    omp_set_max_active_levels(1);
+#endif
+
+    ALPHA_INT m, k, nnz;
+    ALPHA_INT *row_index, *col_index;
+    double *values;
+    alpha_read_coo_d(file, &m, &k, &nnz, &row_index, &col_index, &values);
+
+    alphasparse_matrix_t coo, csr;
+    alpha_call_exit(alphasparse_d_create_coo(&coo, ALPHA_SPARSE_INDEX_BASE_ZERO, m, k, nnz, row_index, col_index, values), "alphasparse_d_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &csr), "alphasparse_convert_csr");
+
+    int status = 0;
+    for (int semiring = 0; semiring < 2; semiring++)
+    {
+        status |= check_spmspv(csr, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, ALPHA_SPARSE_SPMSPV_PUSH, m, k, semiring, 0, "spmspv push");
+        status |= check_spmspv(csr, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, ALPHA_SPARSE_SPMSPV_PULL, m, k, semiring, 0, "spmspv pull");
+        status |= check_spmspv(csr, ALPHA_SPARSE_OPERATION_TRANSPOSE, ALPHA_SPARSE_SPMSPV_PUSH, m, k, semiring, 0, "spmspv push trans");
+        status |= check_spmspv(csr, ALPHA_SPARSE_OPERATION_TRANSPOSE, ALPHA_SPARSE_SPMSPV_PULL, m, k, semiring, 0, "spmspv pull trans");
+        status |= check_spmspv(csr, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, ALPHA_SPARSE_SPMSPV_PUSH, m, k, semiring, 1, "spmspv push nested");
+        status |= check_spmspv(csr, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, ALPHA_SPARSE_SPMSPV_PULL, m, k, semiring, 1, "spmspv pull nested");
+    }
+
+    alphasparse_destroy(coo);
+    alphasparse_destroy(csr);
+    alpha_free(row_index);
+    alpha_free(col_index);
+    alpha_free(values);
+    return status;
+}
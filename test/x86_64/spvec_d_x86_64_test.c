@@ -0,0 +1,99 @@
+/**
+ * @brief openspblas generic sparse vector test, one-based against zero-based
+ */
+
+#include <alphasparse.h>
+#include <stdio.h>
+#include "alphasparse/util/random.h"
+
+// the same entries, as a zero-based and as a one-based vector
+static void make_pair(const ALPHA_INT size, const ALPHA_INT nnz, ALPHA_INT *indx0, ALPHA_INT *indx1, double *values0, double *values1,
+                      alphasparse_spvec_t *x0, alphasparse_spvec_t *x1)
+{
+    for (ALPHA_INT i = 0; i < nnz; i++)
+    {
+        indx0[i] = (ALPHA_INT)((int64_t)i * size / nnz);
+        indx1[i] = indx0[i] + 1;
+    }
+    alpha_fill_random_d(values0, 1, nnz);
+    alpha_fill_random_d(values1, 1, nnz);
+    alpha_call_exit(alphasparse_create_spvec(x0, ALPHA_SPARSE_DATATYPE_DOUBLE, ALPHA_SPARSE_INDEX_BASE_ZERO, size, nnz, indx0, values0), "alphasparse_create_spvec");
+    alpha_call_exit(alphasparse_create_spvec(x1, ALPHA_SPARSE_DATATYPE_DOUBLE, ALPHA_SPARSE_INDEX_BASE_ONE, size, nnz, indx1, values1), "alphasparse_create_spvec");
+}
+
+static int check_d_base(const ALPHA_INT size, const ALPHA_INT nnz)
+{
+    ALPHA_INT *indx0 = alpha_malloc(sizeof(ALPHA_INT) * nnz), *indx1 = alpha_malloc(sizeof(ALPHA_INT) * nnz);
+    double *values0 = alpha_memalign(sizeof(double) * nnz, DEFAULT_ALIGNMENT), *values1 = alpha_memalign(sizeof(double) * nnz, DEFAULT_ALIGNMENT);
+    double *y0 = alpha_memalign(sizeof(double) * size, DEFAULT_ALIGNMENT), *y1 = alpha_memalign(sizeof(double) * size, DEFAULT_ALIGNMENT);
+    alphasparse_spvec_t x0, x1;
+    make_pair(size, nnz, indx0, indx1, values0, values1, &x0, &x1);
+    alpha_fill_random_d(y0, 2, size);
+    alpha_fill_random_d(y1, 2, size);
+
+    double r0, r1;
+    alpha_call_exit(alphasparse_spvv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, x0, y0, &r0), "alphasparse_spvv");
+    alpha_call_exit(alphasparse_spvv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, x1, y1, &r1), "alphasparse_spvv");
+    printf("spvv one-based : ");
+    int status = check_d(&r0, 1, &r1, 1);
+
+    const double alpha = 2., beta = 0.5;
+    alpha_call_exit(alphasparse_axpby(&alpha, x0, &beta, y0), "alphasparse_axpby");
+    alpha_call_exit(alphasparse_axpby(&alpha, x1, &beta, y1), "alphasparse_axpby");
+    printf("axpby one-based : ");
+    status |= check_d(y0, size, y1, size);
+
+    alpha_call_exit(alphasparse_gather(y0, x0), "alphasparse_gather");
+    alpha_call_exit(alphasparse_gather(y1, x1), "alphasparse_gather");
+    printf("gather one-based : ");
+    status |= check_d(values0, nnz, values1, nnz);
+
+    alpha_fill_d(values0, -1., nnz);
+    alpha_fill_d(values1, -1., nnz);
+    alpha_call_exit(alphasparse_scatter(x0, y0), "alphasparse_scatter");
+    alpha_call_exit(alphasparse_scatter(x1, y1), "alphasparse_scatter");
+    printf("scatter one-based : ");
+    status |= check_d(y0, size, y1, size);
+
+    alphasparse_destroy_spvec(x0);
+    alphasparse_destroy_spvec(x1);
+    alpha_free(indx0);
+    alpha_free(indx1);
+    alpha_free(values0);
+    alpha_free(values1);
+    alpha_free(y0);
+    alpha_free(y1);
+    return status;
+}
+
+// conjugated complex dot of a one-based vector whose first entry is position 1
+static int check_z_conj(void)
+{
+    ALPHA_INT indx0[3] = {0, 2, 4}, indx1[3] = {1, 3, 5};
+    ALPHA_Complex16 values[3] = {{1., 2.}, {3., -1.}, {0., 1.}};
+    ALPHA_Complex16 y[5] = {{1., 1.}, {2., 0.}, {0., 3.}, {1., -1.}, {2., 2.}};
+    alphasparse_spvec_t x0, x1;
+    alpha_call_exit(alphasparse_create_spvec(&x0, ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX, ALPHA_SPARSE_INDEX_BASE_ZERO, 5, 3, indx0, values), "alphasparse_create_spvec");
+    alpha_call_exit(alphasparse_create_spvec(&x1, ALPHA_SPARSE_DATATYPE_DOUBLE_COMPLEX, ALPHA_SPARSE_INDEX_BASE_ONE, 5, 3, indx1, values), "alphasparse_create_spvec");
+    ALPHA_Complex16 r0, r1;
+    alpha_call_exit(alphasparse_spvv(ALPHA_SPARSE_OPERATION_CONJUGATE_TRANSPOSE, x0, y, &r0), "alphasparse_spvv");
+    alpha_call_exit(alphasparse_spvv(ALPHA_SPARSE_OPERATION_CONJUGATE_TRANSPOSE, x1, y, &r1), "alphasparse_spvv");
+    printf("spvv conj one-based : ");
+    int status = check_z(&r0, 1, &r1, 1);
+    alphasparse_destroy_spvec(x0);
+    alphasparse_destroy_spvec(x1);
+    return status;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    int status = check_d_base(100000, 30000);
+    status |= check_z_conj();
+    return status;
+}
@@ -0,0 +1,76 @@
+/**
+ * @brief openspblas work-stealing scheduler test
+ */
+
+#include <alphasparse.h>
+#include <alphasparse/util.h>
+#include <alphasparse/util/steal.h>
+#include <stdio.h>
+
+#define ROWS 13
+
+typedef struct
+{
+    const ALPHA_OFFSET *rows_start;
+    const ALPHA_OFFSET *rows_end;
+    ALPHA_INT64 block_max;
+    ALPHA_INT visits[ROWS];
+} steal_check_t;
+
+static void record_block(void *arg, const ALPHA_INT tid, const ALPHA_INT begin, const ALPHA_INT end)
+{
+    steal_check_t *check = arg;
+    ALPHA_INT64 cost = 0;
+    for (ALPHA_INT r = begin; r < end; r++)
+    {
+        cost += check->rows_end[r] - check->rows_start[r];
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        check->visits[r]++;
+    }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+    if (cost > check->block_max)
+        check->block_max = cost;
+}
+
+/*
+* Rows of a view start past offset 0, and the first row is the heaviest: its
+* entries have to count, no block may hold more than the larger of one share
+* and that row.
+*/
+static int check_offset(const int thread_num)
+{
+    const ALPHA_OFFSET base = 1000;
+    ALPHA_OFFSET offsets[ROWS + 1];
+    offsets[0] = base;
+    offsets[1] = base + 40;
+    for (ALPHA_INT r = 1; r < ROWS; r++)
+        offsets[r + 1] = offsets[r] + 10;
+    steal_check_t check = {offsets, offsets + 1, 0, {0}};
+    alpha_steal_for_offset(thread_num, ROWS, check.rows_start, check.rows_end, record_block, &check);
+
+    const ALPHA_INT64 total = offsets[ROWS] - base;
+    const ALPHA_INT64 blocks = alpha_min((ALPHA_INT64)thread_num * ALPHA_STEAL_BLOCKS_PER_THREAD, ROWS);
+    const ALPHA_INT64 bound = alpha_max((total + blocks - 1) / blocks, 40);
+    int once = 1;
+    for (ALPHA_INT r = 0; r < ROWS; r++)
+        once &= check.visits[r] == 1;
+    printf("steal offset : every row once %s, heaviest block %lld of at most %lld\n", once ? "yes" : "no", (long long)check.block_max, (long long)bound);
+    return once && check.block_max <= bound ? 0 : -1;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    int status = check_offset(1);
+    status |= check_offset(thread_num);
+    return status;
+}
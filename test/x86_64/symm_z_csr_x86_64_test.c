@@ -0,0 +1,150 @@
+/**
+ * @brief openspblas symm and hermm test on csr, csc and bsr, against gemm on the full matrix
+ */
+
+#include <alphasparse.h>
+#include <stdio.h>
+#include "alphasparse/util/random.h"
+
+#define N 600
+#define PER_ROW 6
+// divides N, the bsr matrices need whole block rows
+#define BLOCK 3
+
+static const char *op_name(const alphasparse_operation_t op)
+{
+    return op == ALPHA_SPARSE_OPERATION_NON_TRANSPOSE ? "n" : op == ALPHA_SPARSE_OPERATION_TRANSPOSE ? "t" : "h";
+}
+
+/*
+* the full matrix of the triangle of A on or below (lower) or above the diagonal, the other
+* triangle mirrored, conjugated when hermitian, and a diagonal of ones when unit
+*/
+static alphasparse_matrix_t make_full(const ALPHA_INT nnz, const ALPHA_INT *row_index, const ALPHA_INT *col_index, const ALPHA_Complex16 *values,
+                                      const bool lower, const bool unit, const bool herm)
+{
+    ALPHA_INT *rows = alpha_malloc(sizeof(ALPHA_INT) * (2 * nnz + N));
+    ALPHA_INT *cols = alpha_malloc(sizeof(ALPHA_INT) * (2 * nnz + N));
+    ALPHA_Complex16 *vals = alpha_malloc(sizeof(ALPHA_Complex16) * (2 * nnz + N));
+    ALPHA_INT cnt = 0;
+    for (ALPHA_INT i = 0; i < nnz; i++)
+    {
+        const ALPHA_INT r = row_index[i], c = col_index[i];
+        if (r == c)
+        {
+            if (unit)
+                continue;
+            rows[cnt] = r, cols[cnt] = c, vals[cnt++] = values[i];
+        }
+        else if (lower ? c < r : c > r)
+        {
+            rows[cnt] = r, cols[cnt] = c, vals[cnt++] = values[i];
+            rows[cnt] = c, cols[cnt] = r, vals[cnt] = values[i];
+            if (herm)
+                vals[cnt].imag = -vals[cnt].imag;
+            cnt++;
+        }
+    }
+    if (unit)
+        for (ALPHA_INT i = 0; i < N; i++)
+        {
+            rows[cnt] = cols[cnt] = i;
+            vals[cnt].real = 1., vals[cnt++].imag = 0.;
+        }
+    alphasparse_matrix_t coo, csr;
+    alpha_call_exit(alphasparse_z_create_coo(&coo, ALPHA_SPARSE_INDEX_BASE_ZERO, N, N, cnt, rows, cols, vals), "alphasparse_z_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &csr), "alphasparse_convert_csr");
+    alphasparse_destroy(coo);
+    return csr;
+}
+
+static int check_mm(alphasparse_matrix_t A, alphasparse_matrix_t full, const alphasparse_operation_t op, const struct alpha_matrix_descr descr,
+                    const alphasparse_layout_t layout, const char *name)
+{
+    struct alpha_matrix_descr general = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    const ALPHA_Complex16 alpha = {2., -1.}, beta = {.5, 1.};
+    const ALPHA_INT columns = 21;
+    const ALPHA_INT ld = layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR ? columns : N;
+    const size_t size = (size_t)N * columns;
+    ALPHA_Complex16 *x = alpha_memalign(sizeof(ALPHA_Complex16) * size, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y0 = alpha_memalign(sizeof(ALPHA_Complex16) * size, DEFAULT_ALIGNMENT);
+    ALPHA_Complex16 *y1 = alpha_memalign(sizeof(ALPHA_Complex16) * size, DEFAULT_ALIGNMENT);
+    alpha_fill_random_z(x, 1, size);
+    alpha_fill_random_z(y0, 2, size);
+    alpha_fill_random_z(y1, 2, size);
+    alpha_call_exit(alphasparse_z_mm(op, alpha, full, general, layout, x, columns, ld, beta, y0, ld), "alphasparse_z_mm");
+    alpha_call_exit(alphasparse_z_mm(op, alpha, A, descr, layout, x, columns, ld, beta, y1, ld), "alphasparse_z_mm");
+    printf("%s %s %s %s %s : ", name, descr.mode == ALPHA_SPARSE_FILL_MODE_LOWER ? "lo" : "hi", descr.diag == ALPHA_SPARSE_DIAG_UNIT ? "u" : "n",
+           layout == ALPHA_SPARSE_LAYOUT_ROW_MAJOR ? "row" : "col", op_name(op));
+    int status = check_z(y0, size, y1, size);
+    alpha_free(x);
+    alpha_free(y0);
+    alpha_free(y1);
+    return status;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    // PER_ROW distinct columns spread over both triangles and a real diagonal in every row
+    const ALPHA_INT nnz = N * (PER_ROW + 1);
+    ALPHA_INT *row_index = alpha_malloc(sizeof(ALPHA_INT) * nnz);
+    ALPHA_INT *col_index = alpha_malloc(sizeof(ALPHA_INT) * nnz);
+    ALPHA_Complex16 *values = alpha_memalign(sizeof(ALPHA_Complex16) * nnz, DEFAULT_ALIGNMENT);
+    alpha_fill_random_z(values, 3, nnz);
+    for (ALPHA_INT i = 0; i < N; i++)
+    {
+        for (ALPHA_INT j = 0; j < PER_ROW; j++)
+        {
+            row_index[i * (PER_ROW + 1) + j] = i;
+            col_index[i * (PER_ROW + 1) + j] = (i + 1 + j * 97) % N;
+        }
+        row_index[i * (PER_ROW + 1) + PER_ROW] = col_index[i * (PER_ROW + 1) + PER_ROW] = i;
+        values[i * (PER_ROW + 1) + PER_ROW].imag = 0.;
+    }
+    alphasparse_matrix_t coo, csr, csc, bsr_row, bsr_col;
+    alpha_call_exit(alphasparse_z_create_coo(&coo, ALPHA_SPARSE_INDEX_BASE_ZERO, N, N, nnz, row_index, col_index, values), "alphasparse_z_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &csr), "alphasparse_convert_csr");
+    alpha_call_exit(alphasparse_convert_csc(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &csc), "alphasparse_convert_csc");
+    alpha_call_exit(alphasparse_convert_bsr(coo, BLOCK, ALPHA_SPARSE_LAYOUT_ROW_MAJOR, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &bsr_row), "alphasparse_convert_bsr");
+    alpha_call_exit(alphasparse_convert_bsr(coo, BLOCK, ALPHA_SPARSE_LAYOUT_COLUMN_MAJOR, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &bsr_col), "alphasparse_convert_bsr");
+
+    // symm takes the plain and the conjugated matrix, hermm the plain and the transposed one
+    const alphasparse_operation_t ops[2][2] = {{ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, ALPHA_SPARSE_OPERATION_CONJUGATE_TRANSPOSE},
+                                               {ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, ALPHA_SPARSE_OPERATION_TRANSPOSE}};
+    const alphasparse_layout_t layouts[2] = {ALPHA_SPARSE_LAYOUT_ROW_MAJOR, ALPHA_SPARSE_LAYOUT_COLUMN_MAJOR};
+    int status = 0;
+    for (int herm = 0; herm < 2; herm++)
+        for (int lower = 0; lower < 2; lower++)
+            for (int unit = 0; unit < 2; unit++)
+            {
+                alphasparse_matrix_t full = make_full(nnz, row_index, col_index, values, lower, unit, herm);
+                struct alpha_matrix_descr descr = {herm ? ALPHA_SPARSE_MATRIX_TYPE_HERMITIAN : ALPHA_SPARSE_MATRIX_TYPE_SYMMETRIC,
+                                                   lower ? ALPHA_SPARSE_FILL_MODE_LOWER : ALPHA_SPARSE_FILL_MODE_UPPER,
+                                                   unit ? ALPHA_SPARSE_DIAG_UNIT : ALPHA_SPARSE_DIAG_NON_UNIT};
+                for (int l = 0; l < 2; l++)
+                    for (int o = 0; o < 2; o++)
+                    {
+                        status |= check_mm(csr, full, ops[herm][o], descr, layouts[l], herm ? "hermm csr" : "symm csr");
+                        status |= check_mm(csc, full, ops[herm][o], descr, layouts[l], herm ? "hermm csc" : "symm csc");
+                        status |= check_mm(bsr_row, full, ops[herm][o], descr, layouts[l], herm ? "hermm bsr row blocks" : "symm bsr row blocks");
+                        status |= check_mm(bsr_col, full, ops[herm][o], descr, layouts[l], herm ? "hermm bsr col blocks" : "symm bsr col blocks");
+                    }
+                alphasparse_destroy(full);
+            }
+
+    alphasparse_destroy(coo);
+    alphasparse_destroy(csr);
+    alphasparse_destroy(csc);
+    alphasparse_destroy(bsr_row);
+    alphasparse_destroy(bsr_col);
+    alpha_free(row_index);
+    alpha_free(col_index);
+    alpha_free(values);
+    return status;
+}
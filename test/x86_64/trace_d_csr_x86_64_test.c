@@ -0,0 +1,144 @@
+/**
+ * @brief openspblas extended trace test
+ */
+
+#include <alphasparse.h>
+#include <alphasparse/inspector.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include "alphasparse/util/random.h"
+
+#define CALLS 200
+
+typedef struct
+{
+    alphasparse_matrix_t A;
+    ALPHA_INT m, k;
+} trace_job_t;
+
+static void *traced_calls(void *arg)
+{
+    const trace_job_t *job = arg;
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    double *x = alpha_memalign(sizeof(double) * job->k, DEFAULT_ALIGNMENT);
+    double *y = alpha_memalign(sizeof(double) * job->m, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(x, 1, job->k);
+    alpha_fill_random_d(y, 2, job->m);
+    for (int i = 0; i < CALLS; i++)
+        alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 1., job->A, descr, x, 0., y);
+    alpha_free(x);
+    alpha_free(y);
+    return NULL;
+}
+
+// calls traced from two user threads at once each see the times of their own kernel threads only
+static int check_concurrent(alphasparse_matrix_t A, const ALPHA_INT m, const ALPHA_INT k)
+{
+    trace_job_t job = {A, m, k};
+    pthread_t threads[2];
+    alphasparse_trace_clear();
+    for (int t = 0; t < 2; t++)
+        pthread_create(&threads[t], NULL, traced_calls, &job);
+    for (int t = 0; t < 2; t++)
+        pthread_join(threads[t], NULL);
+
+    ALPHA_INT size;
+    alphasparse_trace_size(&size);
+    int bad = 0;
+    for (ALPHA_INT i = 0; i < size; i++)
+    {
+        alphasparse_trace_record_t record;
+        alphasparse_trace_get(i, &record);
+        if (record.thread_count != record.thread_num || record.thread_max > record.time || record.thread_min < 0.)
+            bad++;
+    }
+    printf("concurrent trace : %d records, %d with foreign thread times\n", size, bad);
+    return bad == 0 && size == 2 * CALLS ? 0 : -1;
+}
+
+// the last traced call ran the kernel named
+static int check_kernel(const char *expected)
+{
+    ALPHA_INT size;
+    alphasparse_trace_record_t record;
+    alphasparse_trace_size(&size);
+    alphasparse_trace_get(size - 1, &record);
+    printf("kernel %s : %s\n", record.kernel, strcmp(record.kernel, expected) == 0 ? "correct" : "error");
+    return strcmp(record.kernel, expected) == 0 ? 0 : -1;
+}
+
+// tiles are only built when one panel does not cover x, so the matrix is as wide as a large L3
+static int check_tiled(void)
+{
+    const ALPHA_INT m = 1024, n = 1 << 22, per_row = 8;
+    ALPHA_INT *rows_offset = alpha_malloc(sizeof(ALPHA_INT) * (m + 1));
+    ALPHA_INT *col_index = alpha_malloc(sizeof(ALPHA_INT) * m * per_row);
+    double *values = alpha_malloc(sizeof(double) * m * per_row);
+    for (ALPHA_INT r = 0; r <= m; r++)
+        rows_offset[r] = r * per_row;
+    for (ALPHA_INT i = 0; i < m * per_row; i++)
+        col_index[i] = (ALPHA_INT)(((int64_t)i * 2654435761u) % n);
+    alpha_fill_random_d(values, 3, m * per_row);
+    alphasparse_matrix_t A;
+    alpha_call_exit(alphasparse_d_create_csr(&A, ALPHA_SPARSE_INDEX_BASE_ZERO, m, n, rows_offset, rows_offset + 1, col_index, values), "alphasparse_d_create_csr");
+    alpha_call_exit(alphasparse_set_mv_tiling_hint(A, ALPHA_SPARSE_MV_TILING_2D), "alphasparse_set_mv_tiling_hint");
+    alpha_call_exit(alphasparse_optimize(A), "alphasparse_optimize");
+
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    double *x = alpha_memalign(sizeof(double) * n, DEFAULT_ALIGNMENT);
+    double *y = alpha_memalign(sizeof(double) * m, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(x, 1, n);
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 1., A, descr, x, 0., y), "alphasparse_d_mv");
+    int status = check_kernel(alpha_matrix_csr_tiles(A) != NULL ? "gemv_csr_tiled" : "gemv_csr");
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_TRANSPOSE, 1., A, descr, y, 0., x), "alphasparse_d_mv");
+    status |= check_kernel("gemv_csr_trans");
+
+    alphasparse_destroy(A);
+    alpha_free(x);
+    alpha_free(y);
+    alpha_free(rows_offset);
+    alpha_free(col_index);
+    alpha_free(values);
+    return status;
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    const char *file = args_get_data_file(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    ALPHA_INT m, k, nnz;
+    ALPHA_INT *row_index, *col_index;
+    double *values;
+    alpha_read_coo_d(file, &m, &k, &nnz, &row_index, &col_index, &values);
+
+    alphasparse_matrix_t coo, csr;
+    alpha_call_exit(alphasparse_d_create_coo(&coo, ALPHA_SPARSE_INDEX_BASE_ZERO, m, k, nnz, row_index, col_index, values), "alphasparse_d_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &csr), "alphasparse_convert_csr");
+    alpha_call_exit(alphasparse_set_verbose_mode(ALPHA_SPARSE_VERBOSE_EXTENDED), "alphasparse_set_verbose_mode");
+
+    int status = check_concurrent(csr, m, k);
+
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    double *x = alpha_memalign(sizeof(double) * k, DEFAULT_ALIGNMENT);
+    double *y = alpha_memalign(sizeof(double) * m, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(x, 1, k);
+    alpha_call_exit(alphasparse_d_mv(ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, 1., csr, descr, x, 0., y), "alphasparse_d_mv");
+    status |= check_kernel("gemv_csr");
+    status |= check_tiled();
+
+    alphasparse_set_verbose_mode(ALPHA_SPARSE_VERBOSE_OFF);
+    alphasparse_destroy(coo);
+    alphasparse_destroy(csr);
+    alpha_free(x);
+    alpha_free(y);
+    alpha_free(row_index);
+    alpha_free(col_index);
+    alpha_free(values);
+    return status;
+}
@@ -0,0 +1,137 @@
+/**
+ * @brief openspblas row view test, conversions, transposes and updates of a view from the middle of a matrix
+ */
+
+#include <alphasparse.h>
+#include <alphasparse/spmat.h>
+#include <stdio.h>
+#include "alphasparse/util/random.h"
+
+// y of op(A) x against y of op(B) x, B holds the same matrix as A in another form
+static int check_mv(alphasparse_matrix_t A, const alphasparse_operation_t op_A, alphasparse_matrix_t B, const alphasparse_operation_t op_B,
+                    const ALPHA_INT size_x, const ALPHA_INT size_y, const char *name)
+{
+    struct alpha_matrix_descr descr = {ALPHA_SPARSE_MATRIX_TYPE_GENERAL, ALPHA_SPARSE_FILL_MODE_LOWER, ALPHA_SPARSE_DIAG_NON_UNIT};
+    double *x = alpha_memalign(sizeof(double) * size_x, DEFAULT_ALIGNMENT);
+    double *y0 = alpha_memalign(sizeof(double) * size_y, DEFAULT_ALIGNMENT);
+    double *y1 = alpha_memalign(sizeof(double) * size_y, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(x, 1, size_x);
+    alpha_fill_random_d(y0, 2, size_y);
+    alpha_fill_random_d(y1, 2, size_y);
+    alpha_call_exit(alphasparse_d_mv(op_A, 2., A, descr, x, .5, y0), "alphasparse_d_mv");
+    alpha_call_exit(alphasparse_d_mv(op_B, 2., B, descr, x, .5, y1), "alphasparse_d_mv");
+    printf("%s : ", name);
+    int status = check_d(y0, size_y, y1, size_y);
+    alpha_free(x);
+    alpha_free(y0);
+    alpha_free(y1);
+    return status;
+}
+
+// the CSR5 arrays start at the first entry of the view and hold its entries
+static int check_csr5(alphasparse_matrix_t view, alphasparse_matrix_t csr5)
+{
+    const spmat_csr_d_t *A = view->mat;
+    const spmat_csr5_d_t *B = csr5->mat;
+    const ALPHA_OFFSET first = A->rows_start[0];
+    int status = B->nnz == A->rows_end[A->rows - 1] - first && B->row_ptr[A->rows] == B->nnz ? 0 : -1;
+    for (ALPHA_INT r = 0; r < A->rows; r++)
+        if (B->row_ptr[r] != A->rows_start[r] - first)
+            status = -1;
+    double sum0 = 0., sum1 = 0.;
+    for (ALPHA_OFFSET i = 0; i < B->nnz; i++)
+    {
+        sum0 += A->values[first + i];
+        sum1 += B->val[i];
+    }
+    printf("convert csr5 : ");
+    if (status != 0)
+    {
+        printf("row pointers or nnz wrong\n");
+        return status;
+    }
+    return check_d(&sum0, 1, &sum1, 1);
+}
+
+int main(int argc, const char *argv[])
+{
+    // args
+    args_help(argc, argv);
+    const char *file = args_get_data_file(argc, argv);
+    int thread_num = args_get_thread_num(argc, argv);
+    alpha_set_thread_num(thread_num);
+    printf("thread_num : %d\n", thread_num);
+
+    ALPHA_INT m, k, nnz;
+    ALPHA_INT *row_index, *col_index;
+    double *values;
+    alpha_read_coo_d(file, &m, &k, &nnz, &row_index, &col_index, &values);
+
+    alphasparse_matrix_t coo, csr, bsr, view, copy, bsr_view, bsr_copy, out;
+    alpha_call_exit(alphasparse_d_create_coo(&coo, ALPHA_SPARSE_INDEX_BASE_ZERO, m, k, nnz, row_index, col_index, values), "alphasparse_d_create_coo");
+    alpha_call_exit(alphasparse_convert_csr(coo, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &csr), "alphasparse_convert_csr");
+    alpha_call_exit(alphasparse_convert_bsr(coo, 2, ALPHA_SPARSE_LAYOUT_ROW_MAJOR, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &bsr), "alphasparse_convert_bsr");
+
+    // the middle third of the rows, the copy is the reference every form of the view is checked against
+    const ALPHA_INT first = m / 3 / 2 * 2, last = 2 * m / 3 / 2 * 2, rows = last - first;
+    ALPHA_INT *row_indx = alpha_malloc(sizeof(ALPHA_INT) * rows);
+    for (ALPHA_INT i = 0; i < rows; i++)
+        row_indx[i] = first + i;
+    alpha_call_exit(alphasparse_view_rows(csr, first, last, &view), "alphasparse_view_rows");
+    alpha_call_exit(alphasparse_extract_submatrix(csr, rows, row_indx, k, NULL, &copy), "alphasparse_extract_submatrix");
+    alpha_call_exit(alphasparse_view_rows(bsr, first, last, &bsr_view), "alphasparse_view_rows");
+    // BSR indices count blocks
+    for (ALPHA_INT i = 0; i < rows / 2; i++)
+        row_indx[i] = first / 2 + i;
+    alpha_call_exit(alphasparse_extract_submatrix(bsr, rows / 2, row_indx, (k + 1) / 2, NULL, &bsr_copy), "alphasparse_extract_submatrix");
+
+    int status = check_mv(copy, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, view, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, k, rows, "view");
+
+    alpha_call_exit(alphasparse_transpose(view, &out), "alphasparse_transpose");
+    status |= check_mv(copy, ALPHA_SPARSE_OPERATION_TRANSPOSE, out, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, rows, k, "transpose");
+    alphasparse_destroy(out);
+
+    alpha_call_exit(alphasparse_convert_coo(view, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &out), "alphasparse_convert_coo");
+    status |= check_mv(copy, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, out, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, k, rows, "convert coo");
+    alphasparse_destroy(out);
+
+    alpha_call_exit(alphasparse_convert_csr5(view, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, &out), "alphasparse_convert_csr5");
+    status |= check_csr5(view, out);
+    alphasparse_destroy(out);
+
+    alpha_call_exit(alphasparse_transpose(bsr_view, &out), "alphasparse_transpose");
+    status |= check_mv(bsr_copy, ALPHA_SPARSE_OPERATION_TRANSPOSE, out, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, rows, (k + 1) / 2 * 2, "transpose bsr");
+    alphasparse_destroy(out);
+
+    // replacing every value of the view writes its rows of csr and nothing else
+    const spmat_csr_d_t *mat = view->mat;
+    const spmat_csr_d_t *parent = csr->mat;
+    const ALPHA_OFFSET view_first = mat->rows_start[0];
+    const ALPHA_INT view_nnz = mat->rows_end[rows - 1] - view_first;
+    const ALPHA_INT parent_nnz = parent->rows_end[m - 1];
+    double *new_values = alpha_memalign(sizeof(double) * (view_nnz > 0 ? view_nnz : 1), DEFAULT_ALIGNMENT);
+    double *expect = alpha_memalign(sizeof(double) * parent_nnz, DEFAULT_ALIGNMENT);
+    alpha_fill_random_d(new_values, 4, view_nnz);
+    for (ALPHA_INT i = 0; i < parent_nnz; i++)
+        expect[i] = i >= view_first && i < view_first + view_nnz ? new_values[i - view_first] : parent->values[i];
+    alpha_call_exit(alphasparse_d_update_values(view, view_nnz, NULL, NULL, new_values), "alphasparse_d_update_values");
+    alpha_call_exit(alphasparse_d_update_values(copy, view_nnz, NULL, NULL, new_values), "alphasparse_d_update_values");
+    status |= check_mv(copy, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, view, ALPHA_SPARSE_OPERATION_NON_TRANSPOSE, k, rows, "update values");
+    printf("update values parent : ");
+    status |= check_d(expect, parent_nnz, parent->values, parent_nnz);
+
+    alpha_free(expect);
+    alpha_free(new_values);
+    alphasparse_destroy(view);
+    alphasparse_destroy(copy);
+    alphasparse_destroy(bsr_view);
+    alphasparse_destroy(bsr_copy);
+    alphasparse_destroy(coo);
+    alphasparse_destroy(csr);
+    alphasparse_destroy(bsr);
+    alpha_free(row_indx);
+    alpha_free(row_index);
+    alpha_free(col_index);
+    alpha_free(values);
+    return status;
+}